@@ -53,9 +53,10 @@ void EvbKeyConfig(void)
     /* 1 bits for pre-emption priority and 3 bits for subpriority */
     NVIC_PRIGroup_Enable(NVIC_PRIGROUP_1);
 
-    /* Enable and set EXTI4_15 Interrupt to the highest priority */
+    /* Enable EXTI4_15 Interrupt. Its ISR calls kernel APIs, so its priority must not be
+       above TCLC_CPU_KERNEL_IRQ_PRIO (preemption priority 1 is 0x80 with NVIC_PRIGROUP_1) */
     NVIC_InitStructure.NVIC_IRQ = EXTI4_15_IRQn;
-    NVIC_InitStructure.NVIC_IRQPreemptPriority = 0;
+    NVIC_InitStructure.NVIC_IRQPreemptPriority = 1;
     NVIC_InitStructure.NVIC_IRQSubPriority = 0;
     NVIC_InitStructure.NVIC_IRQEnable = ENABLE;
     NVIC_Init(&NVIC_InitStructure);
@@ -0,0 +1,110 @@
+/*************************************************************************************************
+ *                                     Trochili RTOS Kernel                                      *
+ *                                  Copyright(C) 2016 LIUXUMING                                  *
+ *                                       www.trochili.com                                        *
+ *************************************************************************************************/
+#include <stdio.h>
+#include "benchmark.h"
+
+#if (BENCH_TM_SELECTED)
+
+/* ͳ߳̽ṹջ */
+static TThread BenchReportThread;
+static TBase32 BenchReportStack[BENCH_THREAD_STACK_BYTES/4];
+
+/* ͳƵĲƺͼ */
+static const char*       BenchName;
+static volatile TBase32* BenchCounter;
+static TBase32           BenchCounterNum;
+
+
+/*************************************************************************************************
+ *  ܣͳ߳                                                                         *
+ *  (1) data ̲߳δʹ                                                              *
+ *  أ                                                                                     *
+ *  ˵ÿͳһУʽΪ TM,<>,<>,<ڲ>,<ÿ>    *
+ *        űֱӽͱȽ                                                             *
+ *************************************************************************************************/
+static void BenchReportEntry(TArgument data)
+{
+    TState  state;
+    TError  error;
+    TIndex  index;
+    TBase32 period = 0U;
+    TBase32 total;
+    TBase32 last = 0U;
+    TBase32 ops;
+    char    str[96];
+
+    while (eTrue)
+    {
+        state = TclDelayThread((TThread*)0, TCLM_SEC2TICKS(BENCH_PERIOD_SECONDS), &error);
+        TCLM_ASSERT((state == eSuccess), "");
+        TCLM_ASSERT((error == TCLE_THREAD_NONE), "");
+
+        /* ̵ܸ߳ļʱ޷żȻȷ */
+        total = 0U;
+        for (index = 0U; index < BenchCounterNum; index++)
+        {
+            total += BenchCounter[index];
+        }
+        ops  = total - last;
+        last = total;
+        period++;
+
+        sprintf(str, "TM,%s,%lu,%lu,%lu\r\n",
+                BenchName,
+                (unsigned long)period,
+                (unsigned long)ops,
+                (unsigned long)(ops / BENCH_PERIOD_SECONDS));
+        TclTrace(str);
+    }
+}
+
+
+/*************************************************************************************************
+ *  ܣͳ߳                                                                           *
+ *  (1) pName                                                                      *
+ *        (2) pCounter ̵߳ļ                                                      *
+ *        (3) number   Ŀ                                                                *
+ *  أ                                                                                     *
+ *  ˵ûӦںе                                                               *
+ *************************************************************************************************/
+void BenchStartReport(const char* pName, volatile TBase32* pCounter, TBase32 number)
+{
+    TState state;
+    TError error;
+
+    BenchName       = pName;
+    BenchCounter    = pCounter;
+    BenchCounterNum = number;
+
+    state = TclCreateThread(&BenchReportThread,
+                            &BenchReportEntry,
+                            (TArgument)0,
+                            BenchReportStack,
+                            BENCH_THREAD_STACK_BYTES,
+                            BENCH_REPORT_PRIORITY,
+                            BENCH_THREAD_SLICE,
+                            &error);
+    TCLM_ASSERT((state == eSuccess), "");
+    TCLM_ASSERT((error == TCLE_THREAD_NONE), "");
+
+    state = TclActivateThread(&BenchReportThread, &error);
+    TCLM_ASSERT((state == eSuccess), "");
+    TCLM_ASSERT((error == TCLE_THREAD_NONE), "");
+}
+
+
+/*************************************************************************************************
+ *  ܣʽж                                                                 *
+ *                                                                                       *
+ *  أ                                                                                     *
+ *  ˵ʽɴֲжϴxIrqEnterISRòԳעISR            *
+ *************************************************************************************************/
+void BenchRaiseIrq(void)
+{
+    CpuRaiseIrq(BENCH_IRQ_ID);
+}
+
+#endif
@@ -0,0 +1,38 @@
+/*************************************************************************************************
+ *                                     Trochili RTOS Kernel                                      *
+ *                                  Copyright(C) 2016 LIUXUMING                                  *
+ *                                       www.trochili.com                                        *
+ *************************************************************************************************/
+#ifndef _BENCHMARK_H
+#define _BENCHMARK_H
+
+#include "example.h"
+#include "trochili.h"
+
+/* ǰѡеǷThread-MetricԼ */
+#define BENCH_TM_SELECTED   ((EVB_EXAMPLE >= BENCH_TM_COOPERATIVE) && \
+                             (EVB_EXAMPLE <= BENCH_TM_MEMORY))
+
+#if (BENCH_TM_SELECTED)
+
+/* ÿͳڵThread-Metric׼һ */
+#define BENCH_PERIOD_SECONDS      (30U)
+
+/* ̹߳õĲ */
+#define BENCH_THREAD_STACK_BYTES  (512)
+#define BENCH_THREAD_SLICE        (10U)
+
+/* ͳ߳ȼߣ̵߳ȼΧBENCH_PRIORITY_HIGHBENCH_PRIORITY_LOW */
+#define BENCH_REPORT_PRIORITY     (TCLC_USER_PRIORITY_HIGH)
+#define BENCH_PRIORITY_HIGH       (TCLC_USER_PRIORITY_HIGH + 2U)
+#define BENCH_PRIORITY_LOW        (BENCH_PRIORITY_HIGH + 4U)
+
+/* õжϣ尴ж */
+#define BENCH_IRQ_ID              (KEY_IRQ_ID)
+
+extern void BenchStartReport(const char* pName, volatile TBase32* pCounter, TBase32 number);
+extern void BenchRaiseIrq(void);
+
+#endif
+
+#endif /* _BENCHMARK_H */
@@ -0,0 +1,68 @@
+#include "benchmark.h"
+
+#if (EVB_EXAMPLE == BENCH_TM_COOPERATIVE)
+
+/* Thread-Metric ЭʽȲԣ
+   5ͬȼ߳óͳÿɵ߳лĿ */
+#define BENCH_THREAD_NUM  (5U)
+
+/* ߳̽ṹջͼ */
+static TThread BenchThread[BENCH_THREAD_NUM];
+static TBase32 BenchThreadStack[BENCH_THREAD_NUM][BENCH_THREAD_STACK_BYTES/4];
+static volatile TBase32 BenchCounter[BENCH_THREAD_NUM];
+
+/* ߳ */
+static void BenchThreadEntry(TArgument data)
+{
+    TError error;
+
+    while (eTrue)
+    {
+        BenchCounter[data]++;
+        TclYieldThread(&error);
+    }
+}
+
+
+/* ûӦں */
+static void AppSetupEntry(void)
+{
+    TState state;
+    TError error;
+    TIndex index;
+
+    for (index = 0U; index < BENCH_THREAD_NUM; index++)
+    {
+        state = TclCreateThread(&BenchThread[index],
+                                &BenchThreadEntry,
+                                (TArgument)index,
+                                BenchThreadStack[index],
+                                BENCH_THREAD_STACK_BYTES,
+                                BENCH_PRIORITY_LOW,
+                                BENCH_THREAD_SLICE,
+                                &error);
+        TCLM_ASSERT((state == eSuccess), "");
+        TCLM_ASSERT((error == TCLE_THREAD_NONE), "");
+
+        state = TclActivateThread(&BenchThread[index], &error);
+        TCLM_ASSERT((state == eSuccess), "");
+        TCLM_ASSERT((error == TCLE_THREAD_NONE), "");
+    }
+
+    BenchStartReport("cooperative_scheduling", BenchCounter, BENCH_THREAD_NUM);
+}
+
+
+/* BOOT֮mainṩ */
+int main(void)
+{
+    /* עں˺,ں */
+    TclStartKernel(&AppSetupEntry,
+                   &CpuSetupEntry,
+                   &EvbSetupEntry,
+                   &EvbTraceEntry);
+
+    return 1;
+}
+
+#endif
@@ -0,0 +1,92 @@
+#include "benchmark.h"
+
+#if (EVB_EXAMPLE == BENCH_TM_INTERRUPT_PREEMPTION)
+
+/* Thread-Metric жռԣ
+   ȼ߳жϣISRں˻첽жϴ߳(ASR)
+   ASRȼߣжϷʱռ̣߳ںԶ */
+
+/* ̺߳ASR߳̽ṹջͼ0żڲ̣߳1żASR */
+static TThread BenchThread;
+static TThread BenchASR;
+static TBase32 BenchThreadStack[BENCH_THREAD_STACK_BYTES/4];
+static TBase32 BenchASRStack[BENCH_THREAD_STACK_BYTES/4];
+static volatile TBase32 BenchCounter[2];
+
+/* жϴֻASR */
+static TBitMask BenchISR(TArgument data)
+{
+    return TCLR_IRQ_ASR;
+}
+
+
+/* ASRִ߳ϺԶں˹Բѭ */
+static void BenchASREntry(TArgument data)
+{
+    BenchCounter[1]++;
+}
+
+
+/* ߳ */
+static void BenchThreadEntry(TArgument data)
+{
+    while (eTrue)
+    {
+        BenchRaiseIrq();
+        BenchCounter[0]++;
+    }
+}
+
+
+/* ûӦں */
+static void AppSetupEntry(void)
+{
+    TState state;
+    TError error;
+
+    state = TclSetIrqVector(BENCH_IRQ_ID, &BenchISR, &BenchASR, (TArgument)0, &error);
+    TCLM_ASSERT((state == eSuccess), "");
+    TCLM_ASSERT((error == TCLE_IRQ_NONE), "");
+
+    /* ʼASṚ߳߳Զڹ״̬,Ҫû */
+    state = TclCreateAsyISR(&BenchASR,
+                            &BenchASREntry,
+                            (TArgument)0,
+                            BenchASRStack,
+                            BENCH_THREAD_STACK_BYTES,
+                            &error);
+    TCLM_ASSERT((state == eSuccess), "");
+    TCLM_ASSERT((error == TCLE_THREAD_NONE), "");
+
+    state = TclCreateThread(&BenchThread,
+                            &BenchThreadEntry,
+                            (TArgument)0,
+                            BenchThreadStack,
+                            BENCH_THREAD_STACK_BYTES,
+                            BENCH_PRIORITY_LOW,
+                            BENCH_THREAD_SLICE,
+                            &error);
+    TCLM_ASSERT((state == eSuccess), "");
+    TCLM_ASSERT((error == TCLE_THREAD_NONE), "");
+
+    state = TclActivateThread(&BenchThread, &error);
+    TCLM_ASSERT((state == eSuccess), "");
+    TCLM_ASSERT((error == TCLE_THREAD_NONE), "");
+
+    BenchStartReport("interrupt_preemption", BenchCounter, 2U);
+}
+
+
+/* BOOT֮mainṩ */
+int main(void)
+{
+    /* עں˺,ں */
+    TclStartKernel(&AppSetupEntry,
+                   &CpuSetupEntry,
+                   &EvbSetupEntry,
+                   &EvbTraceEntry);
+
+    return 1;
+}
+
+#endif
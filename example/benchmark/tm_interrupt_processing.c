@@ -0,0 +1,91 @@
+#include "benchmark.h"
+
+#if (EVB_EXAMPLE == BENCH_TM_INTERRUPT)
+
+/* Thread-Metric жϴԣ
+   ߳жϣISRxIrqEnterISRòͷź
+   ߳źû߳л */
+
+/* ߳̽ṹջͼ0ẓ̇߳1żISR */
+static TThread BenchThread;
+static TBase32 BenchThreadStack[BENCH_THREAD_STACK_BYTES/4];
+static volatile TBase32 BenchCounter[2];
+
+/* ź */
+static TSemaphore BenchSemaphore;
+
+/* жϴ */
+static TBitMask BenchISR(TArgument data)
+{
+    BenchCounter[1]++;
+    TclIsrReleaseSemaphore(&BenchSemaphore);
+
+    return TCLR_IRQ_DONE;
+}
+
+
+/* ߳ */
+static void BenchThreadEntry(TArgument data)
+{
+    TState state;
+    TError error;
+
+    while (eTrue)
+    {
+        BenchRaiseIrq();
+
+        state = TclObtainSemaphore(&BenchSemaphore, TCLO_IPC_WAIT, 0, &error);
+        TCLM_ASSERT((state == eSuccess), "");
+        TCLM_ASSERT((error == TCLE_IPC_NONE), "");
+
+        BenchCounter[0]++;
+    }
+}
+
+
+/* ûӦں */
+static void AppSetupEntry(void)
+{
+    TState state;
+    TError error;
+
+    state = TclCreateSemaphore(&BenchSemaphore, 0U, 1U, TCLP_IPC_DUMMY, &error);
+    TCLM_ASSERT((state == eSuccess), "");
+    TCLM_ASSERT((error == TCLE_IPC_NONE), "");
+
+    state = TclSetIrqVector(BENCH_IRQ_ID, &BenchISR, (TThread*)0, (TArgument)0, &error);
+    TCLM_ASSERT((state == eSuccess), "");
+    TCLM_ASSERT((error == TCLE_IRQ_NONE), "");
+
+    state = TclCreateThread(&BenchThread,
+                            &BenchThreadEntry,
+                            (TArgument)0,
+                            BenchThreadStack,
+                            BENCH_THREAD_STACK_BYTES,
+                            BENCH_PRIORITY_LOW,
+                            BENCH_THREAD_SLICE,
+                            &error);
+    TCLM_ASSERT((state == eSuccess), "");
+    TCLM_ASSERT((error == TCLE_THREAD_NONE), "");
+
+    state = TclActivateThread(&BenchThread, &error);
+    TCLM_ASSERT((state == eSuccess), "");
+    TCLM_ASSERT((error == TCLE_THREAD_NONE), "");
+
+    BenchStartReport("interrupt_processing", BenchCounter, 2U);
+}
+
+
+/* BOOT֮mainṩ */
+int main(void)
+{
+    /* עں˺,ں */
+    TclStartKernel(&AppSetupEntry,
+                   &CpuSetupEntry,
+                   &EvbSetupEntry,
+                   &EvbTraceEntry);
+
+    return 1;
+}
+
+#endif
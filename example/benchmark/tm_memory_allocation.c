@@ -0,0 +1,83 @@
+#include "benchmark.h"
+
+#if (EVB_EXAMPLE == BENCH_TM_MEMORY)
+
+/* Thread-Metric ڴԣ
+   ̷߳ӹ̶ҳСڴͷһ128ֽڵڴ */
+#define BENCH_BLOCK_BYTES   (128U)
+#define BENCH_BLOCK_NUM     (16U)
+
+/* ߳̽ṹջͼ */
+static TThread BenchThread;
+static TBase32 BenchThreadStack[BENCH_THREAD_STACK_BYTES/4];
+static volatile TBase32 BenchCounter[1];
+
+/* ڴ */
+static TBase32  BenchMemory[BENCH_BLOCK_BYTES * BENCH_BLOCK_NUM / 4];
+static TMemPool BenchMemoryPool;
+
+/* ߳ */
+static void BenchThreadEntry(TArgument data)
+{
+    TState state;
+    TError error;
+    void*  pBlock;
+
+    while (eTrue)
+    {
+        state = TclMallocPoolMemory(&BenchMemoryPool, &pBlock, &error);
+        TCLM_ASSERT((state == eSuccess), "");
+        TCLM_ASSERT((error == TCLE_MEMORY_NONE), "");
+
+        state = TclFreePoolMemory(&BenchMemoryPool, pBlock, &error);
+        TCLM_ASSERT((state == eSuccess), "");
+        TCLM_ASSERT((error == TCLE_MEMORY_NONE), "");
+
+        BenchCounter[0]++;
+    }
+}
+
+
+/* ûӦں */
+static void AppSetupEntry(void)
+{
+    TState state;
+    TError error;
+
+    state = TclCreateMemoryPool(&BenchMemoryPool, (void*)BenchMemory,
+                                BENCH_BLOCK_NUM, BENCH_BLOCK_BYTES, TCLP_MEMORY_DUMMY, &error);
+    TCLM_ASSERT((state == eSuccess), "");
+    TCLM_ASSERT((error == TCLE_MEMORY_NONE), "");
+
+    state = TclCreateThread(&BenchThread,
+                            &BenchThreadEntry,
+                            (TArgument)0,
+                            BenchThreadStack,
+                            BENCH_THREAD_STACK_BYTES,
+                            BENCH_PRIORITY_LOW,
+                            BENCH_THREAD_SLICE,
+                            &error);
+    TCLM_ASSERT((state == eSuccess), "");
+    TCLM_ASSERT((error == TCLE_THREAD_NONE), "");
+
+    state = TclActivateThread(&BenchThread, &error);
+    TCLM_ASSERT((state == eSuccess), "");
+    TCLM_ASSERT((error == TCLE_THREAD_NONE), "");
+
+    BenchStartReport("memory_allocation", BenchCounter, 1U);
+}
+
+
+/* BOOT֮mainṩ */
+int main(void)
+{
+    /* עں˺,ں */
+    TclStartKernel(&AppSetupEntry,
+                   &CpuSetupEntry,
+                   &EvbSetupEntry,
+                   &EvbTraceEntry);
+
+    return 1;
+}
+
+#endif
@@ -0,0 +1,87 @@
+#include "benchmark.h"
+
+#if (EVB_EXAMPLE == BENCH_TM_MESSAGE)
+
+/* Thread-Metric Ϣԣ
+   ߳ϢзһϢȻٴӶȡϢ
+   TrochiliϢָ룬ﴫָ16ֽݿָ */
+#define BENCH_MQ_POOL_LEN  (8U)
+
+/* ߳̽ṹջͼ */
+static TThread BenchThread;
+static TBase32 BenchThreadStack[BENCH_THREAD_STACK_BYTES/4];
+static volatile TBase32 BenchCounter[1];
+
+/* ϢкϢ */
+static void*     BenchMsgPool[BENCH_MQ_POOL_LEN];
+static TMsgQueue BenchMQ;
+static TBase32   BenchMsgData[4];
+
+/* ߳ */
+static void BenchThreadEntry(TArgument data)
+{
+    TState state;
+    TError error;
+    TMessage msg;
+
+    while (eTrue)
+    {
+        msg = (TMessage)BenchMsgData;
+        state = TclSendMessage(&BenchMQ, &msg, TCLO_IPC_WAIT, 0, &error);
+        TCLM_ASSERT((state == eSuccess), "");
+        TCLM_ASSERT((error == TCLE_IPC_NONE), "");
+
+        msg = (TMessage)0;
+        state = TclReceiveMessage(&BenchMQ, &msg, TCLO_IPC_WAIT, 0, &error);
+        TCLM_ASSERT((state == eSuccess), "");
+        TCLM_ASSERT((error == TCLE_IPC_NONE), "");
+        TCLM_ASSERT((msg == (TMessage)BenchMsgData), "");
+
+        BenchCounter[0]++;
+    }
+}
+
+
+/* ûӦں */
+static void AppSetupEntry(void)
+{
+    TState state;
+    TError error;
+
+    state = TclCreateMsgQueue(&BenchMQ, (void**)(&BenchMsgPool),
+                              BENCH_MQ_POOL_LEN, TCLP_IPC_DUMMY, &error);
+    TCLM_ASSERT((state == eSuccess), "");
+    TCLM_ASSERT((error == TCLE_IPC_NONE), "");
+
+    state = TclCreateThread(&BenchThread,
+                            &BenchThreadEntry,
+                            (TArgument)0,
+                            BenchThreadStack,
+                            BENCH_THREAD_STACK_BYTES,
+                            BENCH_PRIORITY_LOW,
+                            BENCH_THREAD_SLICE,
+                            &error);
+    TCLM_ASSERT((state == eSuccess), "");
+    TCLM_ASSERT((error == TCLE_THREAD_NONE), "");
+
+    state = TclActivateThread(&BenchThread, &error);
+    TCLM_ASSERT((state == eSuccess), "");
+    TCLM_ASSERT((error == TCLE_THREAD_NONE), "");
+
+    BenchStartReport("message_processing", BenchCounter, 1U);
+}
+
+
+/* BOOT֮mainṩ */
+int main(void)
+{
+    /* עں˺,ں */
+    TclStartKernel(&AppSetupEntry,
+                   &CpuSetupEntry,
+                   &EvbSetupEntry,
+                   &EvbTraceEntry);
+
+    return 1;
+}
+
+#endif
@@ -0,0 +1,78 @@
+#include "benchmark.h"
+
+#if (EVB_EXAMPLE == BENCH_TM_SYNCHRONIZATION)
+
+/* Thread-Metric ͬԣ
+   ̷߳úͷͬһźû߳л */
+
+/* ߳̽ṹջͼ */
+static TThread BenchThread;
+static TBase32 BenchThreadStack[BENCH_THREAD_STACK_BYTES/4];
+static volatile TBase32 BenchCounter[1];
+
+/* ź */
+static TSemaphore BenchSemaphore;
+
+/* ߳ */
+static void BenchThreadEntry(TArgument data)
+{
+    TState state;
+    TError error;
+
+    while (eTrue)
+    {
+        state = TclObtainSemaphore(&BenchSemaphore, TCLO_IPC_DUMMY, 0, &error);
+        TCLM_ASSERT((state == eSuccess), "");
+        TCLM_ASSERT((error == TCLE_IPC_NONE), "");
+
+        state = TclReleaseSemaphore(&BenchSemaphore, TCLO_IPC_DUMMY, 0, &error);
+        TCLM_ASSERT((state == eSuccess), "");
+        TCLM_ASSERT((error == TCLE_IPC_NONE), "");
+
+        BenchCounter[0]++;
+    }
+}
+
+
+/* ûӦں */
+static void AppSetupEntry(void)
+{
+    TState state;
+    TError error;
+
+    state = TclCreateSemaphore(&BenchSemaphore, 1U, 1U, TCLP_IPC_DUMMY, &error);
+    TCLM_ASSERT((state == eSuccess), "");
+    TCLM_ASSERT((error == TCLE_IPC_NONE), "");
+
+    state = TclCreateThread(&BenchThread,
+                            &BenchThreadEntry,
+                            (TArgument)0,
+                            BenchThreadStack,
+                            BENCH_THREAD_STACK_BYTES,
+                            BENCH_PRIORITY_LOW,
+                            BENCH_THREAD_SLICE,
+                            &error);
+    TCLM_ASSERT((state == eSuccess), "");
+    TCLM_ASSERT((error == TCLE_THREAD_NONE), "");
+
+    state = TclActivateThread(&BenchThread, &error);
+    TCLM_ASSERT((state == eSuccess), "");
+    TCLM_ASSERT((error == TCLE_THREAD_NONE), "");
+
+    BenchStartReport("synchronization_processing", BenchCounter, 1U);
+}
+
+
+/* BOOT֮mainṩ */
+int main(void)
+{
+    /* עں˺,ں */
+    TclStartKernel(&AppSetupEntry,
+                   &CpuSetupEntry,
+                   &EvbSetupEntry,
+                   &EvbTraceEntry);
+
+    return 1;
+}
+
+#endif
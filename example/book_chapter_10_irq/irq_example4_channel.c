@@ -0,0 +1,132 @@
+#include "example.h"
+#include "trochili.h"
+
+#if (EVB_EXAMPLE == CH10_IRQ_CHANNEL_EXAMPLE)
+
+/* û̲߳ */
+#define THREAD_LED_STACK_BYTES  (512)
+#define THREAD_LED_PRIORITY     (5)
+#define THREAD_LED_SLICE        (20)
+
+/* û߳ջ */
+static TBase32 ThreadLedStack[THREAD_LED_STACK_BYTES/4];
+
+/* û̶߳ */
+static TThread ThreadLed;
+
+/* ͨԪͶ壬ԪذֵƽͨҪڴ */
+typedef struct
+{
+    TBase32 Sequence;
+    TTimeTick Jiffies;
+} TKeyEvent;
+
+/* ͨ壬2ݡֻаISRдֻͨLed̶߳ͨ
+   ISRдͨʱҪжϣҲ */
+#define CHANNEL_CAPACITY (16)
+static TChannel KeyChannel;
+static TKeyEvent KeyRing[CHANNEL_CAPACITY];
+
+/* ¼źͨʱ¼Ŀ */
+static TBase32 KeySequence;
+static TBase32 KeyDropped;
+
+/* Led̵߳ */
+static void ThreadLedEntry(TArgument data)
+{
+    TState state;
+    TError error;
+    TKeyEvent event;
+
+    while (eTrue)
+    {
+        /* ͨΪʱȴȴ1 */
+        state = TclReadChannel(&KeyChannel, (void*)(&event),
+                               TCLO_IPC_WAIT | TCLO_IPC_TIMED, TCLM_MLS2TICKS(1000), &error);
+        if (state == eSuccess)
+        {
+            EvbLedControl(LED1, (event.Sequence & 0x1U) ? LED_ON : LED_OFF);
+            EVB_PRINTF("key event %d at %d, dropped %d\r\n",
+                       event.Sequence, event.Jiffies, KeyDropped);
+        }
+        else
+        {
+            TCLM_ASSERT((error == TCLE_IPC_TIMEO), "");
+        }
+    }
+}
+
+
+/* 尴жϴ */
+static TBitMask EvbKeyISR(TArgument data)
+{
+    TState state;
+    TError error;
+    TKeyEvent event;
+
+    if (EvbKeyScan())
+    {
+        event.Sequence = KeySequence++;
+        TclGetTimeJiffies(&event.Jiffies);
+
+        /* ISRֻͨдֻLed߳ڵȴʱŽں˻
+           ͨʱдʧܣISRֻ¼Ŀ */
+        state = TclWriteChannel(&KeyChannel, (void*)(&event), &error);
+        if (state == eFailure)
+        {
+            KeyDropped++;
+        }
+    }
+    return TCLR_IRQ_DONE;
+}
+
+
+/* ûӦóں */
+static void AppSetupEntry(void)
+{
+    TState state;
+    TError error;
+
+    /* úKEYصⲿж */
+    state = TclSetIrqVector(KEY_IRQ_ID, &EvbKeyISR, (TThread*)0, (TArgument)0, &error);
+    TCLM_ASSERT((state == eSuccess), "");
+    TCLM_ASSERT((error == TCLE_IRQ_NONE), "");
+
+    /* ʼͨ */
+    state = TclCreateChannel(&KeyChannel, (void*)KeyRing, CHANNEL_CAPACITY,
+                             sizeof(TKeyEvent), &error);
+    TCLM_ASSERT((state == eSuccess), "");
+    TCLM_ASSERT((error == TCLE_IPC_NONE), "");
+
+    /* ʼLed߳ */
+    state = TclCreateThread(&ThreadLed,
+                          &ThreadLedEntry,
+                          (TArgument)0,
+                          ThreadLedStack,
+                          THREAD_LED_STACK_BYTES,
+                          THREAD_LED_PRIORITY,
+                          THREAD_LED_SLICE,
+                          &error);
+    TCLM_ASSERT((state == eSuccess), "");
+    TCLM_ASSERT((error == TCLE_THREAD_NONE), "");
+
+    /* Led߳ */
+    state = TclActivateThread(&ThreadLed, &error);
+    TCLM_ASSERT((state == eSuccess), "");
+    TCLM_ASSERT((error == TCLE_THREAD_NONE), "");
+}
+
+
+/* BOOT֮mainṩ */
+int main(void)
+{
+    /* עں˺,ں */
+    TclStartKernel(&AppSetupEntry,
+                   &CpuSetupEntry,
+                   &EvbSetupEntry,
+                   &EvbTraceEntry);
+    return 1;
+}
+
+
+#endif
@@ -11,10 +11,11 @@ static TThread ThreadMem;
 static TBase32 ThreadMemStack[THREAD_MEMORY_STACK_BYTES/4];
 
 #define MEMORY_PAGE_SIZE (32)
-#define MEMORY_PAGES    (TCLC_MEMORY_BUDDY_PAGES)
+#define MEMORY_PAGES    (64)
 
 static TMemBuddy mem;
-static char memPool[MEMORY_PAGES * MEMORY_PAGE_SIZE];
+static TBase32 memPool[MEMORY_PAGES * MEMORY_PAGE_SIZE / 4];
+static TByte memTags[MEMORY_PAGES];
 static void ThreadMemEntry(TArgument arg)
 {
     TState state;
@@ -25,7 +26,8 @@ static void ThreadMemEntry(TArgument arg)
     TError error;
 
 
-    state = TclCreateMemBuddy(&mem, memPool, MEMORY_PAGES, MEMORY_PAGE_SIZE, &error);
+    state = TclCreateMemBuddy(&mem, (TChar*)memPool, MEMORY_PAGES, MEMORY_PAGE_SIZE,
+                              memTags, &error);
 
     while (eTrue)
     {
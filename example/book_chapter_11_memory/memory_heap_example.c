@@ -0,0 +1,145 @@
+#include "example.h"
+#include "trochili.h"
+
+#if (EVB_EXAMPLE == CH11_MEMORY_HEAP_EXAMPLE)
+#define THREAD_MEMORY_STACK_BYTES  (512)
+#define THREAD_MEMORY_PRIORITY     (5)
+#define THREAD_MEMORY_SLICE        (20)
+
+/* MEM߳̽ṹջ */
+static TThread ThreadMem;
+static TBase32 ThreadMemStack[THREAD_MEMORY_STACK_BYTES/4];
+
+/* ּڴѣ4ڴҳСֱ163264128ֽڣҳʵʹ */
+#define MEMORY_CLASSES    (4)
+#define MEMORY_MIN_SIZE   (16)
+#define MEMORY_HEAP_BYTES (16 * 16 + 8 * 32 + 4 * 64 + 2 * 128)
+static TBase32 MemPages[MEMORY_CLASSES] = {16, 8, 4, 2};
+static TMemHeap MemHeap;
+static TBase32 MemData[MEMORY_HEAP_BYTES/4];
+
+/* 128ֽڵӻϵͳз */
+#define MEMORY_PAGE_SIZE (64)
+#define MEMORY_PAGES     (16)
+static TMemBuddy MemBuddy;
+static TBase32 MemBuddyData[MEMORY_PAGES * MEMORY_PAGE_SIZE / 4];
+static TByte MemBuddyTags[MEMORY_PAGES];
+
+/* ӡּڴѵʹ */
+static void DumpHeapInfo(void)
+{
+    THeapInfo info;
+    TError error;
+    TState state;
+    TIndex index;
+
+    state = TclGetHeapInfo(&MemHeap, &info, &error);
+    TCLM_ASSERT((state == eSuccess), "");
+    TCLM_ASSERT((error == TCLE_MEMORY_NONE), "");
+
+    for (index = 0; index < info.Classes; index++)
+    {
+        EVB_PRINTF("class %d: size %d, pages %d, inuse %d, peak %d, spills %d\r\n",
+                   index, info.PageSize[index], info.PageNbr[index],
+                   info.PageInuse[index], info.PagePeak[index], info.Spills[index]);
+    }
+    EVB_PRINTF("buddy: inuse %d, peak %d\r\n", info.BigInuse, info.BigPeak);
+}
+
+static void ThreadMemEntry(TArgument arg)
+{
+    TState state;
+    TError error;
+    void* addr0;
+    void* addr1;
+    void* addr2;
+    TBase32 len;
+
+    len = 13;
+    while (eTrue)
+    {
+        /* 鲻ͬȵڴڲͬļ */
+        state = TclMalloc(&MemHeap, len, &addr0, &error);
+        TCLM_ASSERT((state == eSuccess), "");
+        TCLM_ASSERT((error == TCLE_MEMORY_NONE), "");
+
+        state = TclMalloc(&MemHeap, len * 4, &addr1, &error);
+        TCLM_ASSERT((state == eSuccess), "");
+        TCLM_ASSERT((error == TCLE_MEMORY_NONE), "");
+
+        state = TclMalloc(&MemHeap, len * 16, &addr2, &error);
+        TCLM_ASSERT((state == eSuccess), "");
+        TCLM_ASSERT((error == TCLE_MEMORY_NONE), "");
+        DumpHeapInfo();
+
+        /* ͷʱֻҪڴַҪָȻ߼ */
+        state = TclFree(&MemHeap, addr0, &error);
+        TCLM_ASSERT((state == eSuccess), "");
+        TCLM_ASSERT((error == TCLE_MEMORY_NONE), "");
+
+        state = TclFree(&MemHeap, addr1, &error);
+        TCLM_ASSERT((state == eSuccess), "");
+        TCLM_ASSERT((error == TCLE_MEMORY_NONE), "");
+
+        state = TclFree(&MemHeap, addr2, &error);
+        TCLM_ASSERT((state == eSuccess), "");
+        TCLM_ASSERT((error == TCLE_MEMORY_NONE), "");
+
+        len = (len * 5) % 31 + 1;
+        state = TclDelayThread((TThread*)0, TCLM_MLS2TICKS(1000), &error);
+        TCLM_ASSERT((state == eSuccess), "");
+        TCLM_ASSERT((error == TCLE_THREAD_NONE), "");
+    }
+}
+
+
+/* ûӦں */
+static void AppSetupEntry(void)
+{
+    TState state;
+    TError error;
+
+    state = TclCreateMemHeap(&MemHeap, (void*)MemData, MEMORY_CLASSES, MEMORY_MIN_SIZE,
+                             MemPages, TCLP_MEMORY_DUMMY, &error);
+    TCLM_ASSERT((state == eSuccess), "");
+    TCLM_ASSERT((error == TCLE_MEMORY_NONE), "");
+
+    state = TclCreateMemBuddy(&MemBuddy, (TChar*)MemBuddyData, MEMORY_PAGES, MEMORY_PAGE_SIZE,
+                              MemBuddyTags, &error);
+    TCLM_ASSERT((state == eSuccess), "");
+    TCLM_ASSERT((error == TCLE_MEMORY_NONE), "");
+
+    state = TclSetHeapFallback(&MemHeap, &MemBuddy, &error);
+    TCLM_ASSERT((state == eSuccess), "");
+    TCLM_ASSERT((error == TCLE_MEMORY_NONE), "");
+
+    /* ʼMEM豸߳ */
+    state = TclCreateThread(&ThreadMem,
+                          &ThreadMemEntry, (TArgument)0,
+                          ThreadMemStack, THREAD_MEMORY_STACK_BYTES,
+                          THREAD_MEMORY_PRIORITY,
+                          THREAD_MEMORY_SLICE,
+                          &error);
+    TCLM_ASSERT((state == eSuccess), "");
+    TCLM_ASSERT((error == TCLE_THREAD_NONE), "");
+
+    /* MEM豸߳ */
+    state = TclActivateThread(&ThreadMem, &error);
+    TCLM_ASSERT((state == eSuccess), "");
+    TCLM_ASSERT((error == TCLE_THREAD_NONE), "");
+}
+
+
+/* BOOT֮mainṩ */
+int main(void)
+{
+    /* עں˺,ں */
+    TclStartKernel(&AppSetupEntry,
+                   &CpuSetupEntry,
+                   &EvbSetupEntry,
+                   &EvbTraceEntry);
+    return 1;
+}
+
+#endif
+
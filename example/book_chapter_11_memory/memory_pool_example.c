@@ -52,7 +52,8 @@ static void AppSetupEntry(void)
     TError error;
     TState state;
 
-    state = TclCreateMemoryPool(&DataMemoryPool, (void*)DataMemory, 6, DATA_BLOCK_BYTES, &error);
+    state = TclCreateMemoryPool(&DataMemoryPool, (void*)DataMemory, 6, DATA_BLOCK_BYTES,
+                                TCLP_MEMORY_ZERO_ALLOC | TCLP_MEMORY_ZERO_FREE, &error);
     TCLM_ASSERT((state == eSuccess), "");
     TCLM_ASSERT((error == TCLE_MEMORY_NONE), "");
 
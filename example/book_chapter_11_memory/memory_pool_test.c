@@ -62,7 +62,8 @@ static void AppSetupEntry(void)
     TState state;
     int i;
 	memset(&blkPool, 0U, sizeof(blkPool));
-    TclCreateMemoryPool(&blkPool, (void*)test_array, blk_num, sizeof(struct test_blck), &error);
+    TclCreateMemoryPool(&blkPool, (void*)test_array, blk_num, sizeof(struct test_blck),
+                        TCLP_MEMORY_ZERO_ALLOC | TCLP_MEMORY_ZERO_FREE, &error);
 
     TclMallocPoolMemory(&blkPool, (void**)(&p0), &error);
     for (i=0; i<(blk_num-2); i++)
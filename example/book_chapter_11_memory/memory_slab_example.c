@@ -0,0 +1,169 @@
+#include "example.h"
+#include "trochili.h"
+
+#if (EVB_EXAMPLE == CH11_MEMORY_SLAB_EXAMPLE)
+#define THREAD_MEMORY_STACK_BYTES  (512)
+#define THREAD_MEMORY_PRIORITY     (5)
+#define THREAD_MEMORY_SLICE        (20)
+
+/* ̰߳贴߳̽ṹջԶ󻺴 */
+#define THREAD_WORKER_STACK_BYTES  (256)
+#define THREAD_WORKER_PRIORITY     (4)
+#define THREAD_WORKER_SLICE        (20)
+#define WORKERS                    (2)
+
+/* ÿ߳һԼϢ */
+#define WORKER_QUEUE_CAPACITY      (4)
+
+/* MEM߳̽ṹջ */
+static TThread ThreadMem;
+static TBase32 ThreadMemStack[THREAD_MEMORY_STACK_BYTES/4];
+
+/* 󻺴slabӻϵͳ */
+#define MEMORY_PAGE_SIZE (64)
+#define MEMORY_PAGES     (48)
+static TMemBuddy MemBuddy;
+static TBase32 MemHeap[MEMORY_PAGES * MEMORY_PAGE_SIZE / 4];
+static TByte MemTags[MEMORY_PAGES];
+
+static TMemSlab ThreadCache;
+static TMemSlab QueueCache;
+
+static TThread*   WorkerThread[WORKERS];
+static TMsgQueue* WorkerQueue[WORKERS];
+
+static void ThreadWorkerEntry(TArgument arg)
+{
+    TState state;
+    TError error;
+    TMessage msg;
+
+    /* һϢ֮ߣȴMEM̻߳ */
+    state = TclReceiveMessage(WorkerQueue[arg], &msg, TCLO_IPC_WAIT, 0U, &error);
+    TCLM_ASSERT((state == eSuccess), "");
+    TCLM_ASSERT((error == TCLE_IPC_NONE), "");
+    EVB_PRINTF("worker %d got message %d\r\n", arg, (TBase32)msg);
+
+    state = TclDeactivateThread((TThread*)0, &error);
+    TCLM_ASSERT((state == eSuccess), "");
+    TCLM_ASSERT((error == TCLE_THREAD_NONE), "");
+}
+
+
+static void ThreadMemEntry(TArgument arg)
+{
+    TState state;
+    TError error;
+    TMessage msg;
+    TIndex index;
+    TBase32 count;
+
+    count = 0U;
+    while (eTrue)
+    {
+        /* 贴̺߳Ϣ */
+        for (index = 0U; index < WORKERS; index++)
+        {
+            state = TclCreateMsgQueueDynamic(&QueueCache, &WorkerQueue[index],
+                                             TCLP_IPC_DUMMY, &error);
+            TCLM_ASSERT((state == eSuccess), "");
+            TCLM_ASSERT((error == TCLE_IPC_NONE), "");
+
+            state = TclCreateThreadDynamic(&ThreadCache, &WorkerThread[index],
+                                           &ThreadWorkerEntry, (TArgument)index,
+                                           THREAD_WORKER_PRIORITY,
+                                           THREAD_WORKER_SLICE,
+                                           &error);
+            TCLM_ASSERT((state == eSuccess), "");
+            TCLM_ASSERT((error == TCLE_THREAD_NONE), "");
+
+            state = TclActivateThread(WorkerThread[index], &error);
+            TCLM_ASSERT((state == eSuccess), "");
+            TCLM_ASSERT((error == TCLE_THREAD_NONE), "");
+        }
+
+        for (index = 0U; index < WORKERS; index++)
+        {
+            msg = (TMessage)(count++);
+            state = TclSendMessage(WorkerQueue[index], &msg, TCLO_IPC_WAIT, 0U, &error);
+            TCLM_ASSERT((state == eSuccess), "");
+            TCLM_ASSERT((error == TCLE_IPC_NONE), "");
+        }
+
+        /* ߳ȼߣʱѾߣ̺߳Ϣ */
+        for (index = 0U; index < WORKERS; index++)
+        {
+            state = TclDeleteThreadDynamic(&ThreadCache, WorkerThread[index], &error);
+            TCLM_ASSERT((state == eSuccess), "");
+            TCLM_ASSERT((error == TCLE_THREAD_NONE), "");
+
+            state = TclDeleteMsgQueueDynamic(&QueueCache, WorkerQueue[index], &error);
+            TCLM_ASSERT((state == eSuccess), "");
+            TCLM_ASSERT((error == TCLE_IPC_NONE), "");
+        }
+
+        EVB_PRINTF("threads inuse %d peak %d, queues inuse %d peak %d\r\n",
+                   ThreadCache.ObjInuse, ThreadCache.ObjPeak,
+                   QueueCache.ObjInuse, QueueCache.ObjPeak);
+
+        state = TclDelayThread((TThread*)0, TCLM_MLS2TICKS(1000), &error);
+        TCLM_ASSERT((state == eSuccess), "");
+        TCLM_ASSERT((error == TCLE_THREAD_NONE), "");
+    }
+}
+
+
+/* ûӦں */
+static void AppSetupEntry(void)
+{
+    TState state;
+    TError error;
+
+    state = TclCreateMemBuddy(&MemBuddy, (TChar*)MemHeap, MEMORY_PAGES, MEMORY_PAGE_SIZE,
+                              MemTags, &error);
+    TCLM_ASSERT((state == eSuccess), "");
+    TCLM_ASSERT((error == TCLE_MEMORY_NONE), "");
+
+    /* ÿslabȫ߳ */
+    state = TclCreateSlabCache(&ThreadCache, TCLM_THREAD_OBJ_BYTES(THREAD_WORKER_STACK_BYTES),
+                               WORKERS, (TMemPool*)0, &MemBuddy,
+                               (TSlabCtor)0, (TSlabDtor)0, &error);
+    TCLM_ASSERT((state == eSuccess), "");
+    TCLM_ASSERT((error == TCLE_MEMORY_NONE), "");
+
+    state = TclCreateSlabCache(&QueueCache, TCLM_MQUE_OBJ_BYTES(WORKER_QUEUE_CAPACITY),
+                               WORKERS, (TMemPool*)0, &MemBuddy,
+                               (TSlabCtor)0, (TSlabDtor)0, &error);
+    TCLM_ASSERT((state == eSuccess), "");
+    TCLM_ASSERT((error == TCLE_MEMORY_NONE), "");
+
+    /* ʼMEM豸߳ */
+    state = TclCreateThread(&ThreadMem,
+                          &ThreadMemEntry, (TArgument)0,
+                          ThreadMemStack, THREAD_MEMORY_STACK_BYTES,
+                          THREAD_MEMORY_PRIORITY,
+                          THREAD_MEMORY_SLICE,
+                          &error);
+    TCLM_ASSERT((state == eSuccess), "");
+    TCLM_ASSERT((error == TCLE_THREAD_NONE), "");
+
+    /* MEM豸߳ */
+    state = TclActivateThread(&ThreadMem, &error);
+    TCLM_ASSERT((state == eSuccess), "");
+    TCLM_ASSERT((error == TCLE_THREAD_NONE), "");
+}
+
+
+/* BOOT֮mainṩ */
+int main(void)
+{
+    /* עں˺,ں */
+    TclStartKernel(&AppSetupEntry,
+                   &CpuSetupEntry,
+                   &EvbSetupEntry,
+                   &EvbTraceEntry);
+    return 1;
+}
+
+#endif
+
@@ -0,0 +1,133 @@
+#include "example.h"
+#include "trochili.h"
+
+#if (EVB_EXAMPLE == CH11_MEMORY_TLSF_EXAMPLE)
+#define THREAD_MEMORY_STACK_BYTES  (512)
+#define THREAD_MEMORY_PRIORITY     (5)
+#define THREAD_MEMORY_SLICE        (20)
+
+/* MEM߳̽ṹջ */
+static TThread ThreadMem;
+static TBase32 ThreadMemStack[THREAD_MEMORY_STACK_BYTES/4];
+
+/* TLSFѣֽھͷֽ(4ֽڶ)ٰ2ȡ */
+#define MEMORY_HEAP_BYTES (2048)
+static TMemTlsf MemTlsf;
+static TBase32 MemHeap[MEMORY_HEAP_BYTES/4];
+
+/* ӡTLSFѵʹ */
+static void DumpTlsfInfo(void)
+{
+    TTlsfInfo info;
+    TError error;
+    TState state;
+
+    state = TclGetTlsfInfo(&MemTlsf, &info, &error);
+    TCLM_ASSERT((state == eSuccess), "");
+    TCLM_ASSERT((error == TCLE_MEMORY_NONE), "");
+
+    EVB_PRINTF("free %d, used %d, peak %d, blocks %d, largest %d, fragment %d%%\r\n",
+               info.FreeBytes, info.UsedBytes, info.PeakBytes,
+               info.FreeBlocks, info.LargestFree, info.Fragment);
+}
+
+static void ThreadMemEntry(TArgument arg)
+{
+    TState state;
+    TError error;
+    void* addr0;
+    void* addr1;
+    void* addr2;
+    TBase32 len;
+
+    len = 13;
+    while (eTrue)
+    {
+        /* 鲻ͬȵڴ */
+        state = TclMallocTlsfMem(&MemTlsf, len, &addr0, &error);
+        TCLM_ASSERT((state == eSuccess), "");
+        TCLM_ASSERT((error == TCLE_MEMORY_NONE), "");
+
+        state = TclMallocTlsfMem(&MemTlsf, len * 3, &addr1, &error);
+        TCLM_ASSERT((state == eSuccess), "");
+        TCLM_ASSERT((error == TCLE_MEMORY_NONE), "");
+
+        state = TclMallocTlsfMem(&MemTlsf, len * 7, &addr2, &error);
+        TCLM_ASSERT((state == eSuccess), "");
+        TCLM_ASSERT((error == TCLE_MEMORY_NONE), "");
+        DumpTlsfInfo();
+
+        /* ͷмһ */
+        state = TclFreeTlsfMem(&MemTlsf, addr1, &error);
+        TCLM_ASSERT((state == eSuccess), "");
+        TCLM_ASSERT((error == TCLE_MEMORY_NONE), "");
+
+        /* ظͷŻᱻܾ */
+        state = TclFreeTlsfMem(&MemTlsf, addr1, &error);
+        TCLM_ASSERT((state == eFailure), "");
+        TCLM_ASSERT((error == TCLE_MEMORY_DBLFREE), "");
+
+        /* һ飬һʱԭ */
+        state = TclReallocTlsfMem(&MemTlsf, addr0, len * 2, &addr0, &error);
+        TCLM_ASSERT((state == eSuccess), "");
+        TCLM_ASSERT((error == TCLE_MEMORY_NONE), "");
+        DumpTlsfInfo();
+
+        /* ȫͷ֮ڿпϲֻʣһп */
+        state = TclFreeTlsfMem(&MemTlsf, addr0, &error);
+        TCLM_ASSERT((state == eSuccess), "");
+        TCLM_ASSERT((error == TCLE_MEMORY_NONE), "");
+
+        state = TclFreeTlsfMem(&MemTlsf, addr2, &error);
+        TCLM_ASSERT((state == eSuccess), "");
+        TCLM_ASSERT((error == TCLE_MEMORY_NONE), "");
+        DumpTlsfInfo();
+
+        len = (len * 5) % 61 + 1;
+        state = TclDelayThread((TThread*)0, TCLM_MLS2TICKS(1000), &error);
+        TCLM_ASSERT((state == eSuccess), "");
+        TCLM_ASSERT((error == TCLE_THREAD_NONE), "");
+    }
+}
+
+
+/* ûӦں */
+static void AppSetupEntry(void)
+{
+    TState state;
+    TError error;
+
+    state = TclCreateMemTlsf(&MemTlsf, (void*)MemHeap, MEMORY_HEAP_BYTES, &error);
+    TCLM_ASSERT((state == eSuccess), "");
+    TCLM_ASSERT((error == TCLE_MEMORY_NONE), "");
+
+    /* ʼMEM豸߳ */
+    state = TclCreateThread(&ThreadMem,
+                          &ThreadMemEntry, (TArgument)0,
+                          ThreadMemStack, THREAD_MEMORY_STACK_BYTES,
+                          THREAD_MEMORY_PRIORITY,
+                          THREAD_MEMORY_SLICE,
+                          &error);
+    TCLM_ASSERT((state == eSuccess), "");
+    TCLM_ASSERT((error == TCLE_THREAD_NONE), "");
+
+    /* MEM豸߳ */
+    state = TclActivateThread(&ThreadMem, &error);
+    TCLM_ASSERT((state == eSuccess), "");
+    TCLM_ASSERT((error == TCLE_THREAD_NONE), "");
+}
+
+
+/* BOOT֮mainṩ */
+int main(void)
+{
+    /* עں˺,ں */
+    TclStartKernel(&AppSetupEntry,
+                   &CpuSetupEntry,
+                   &EvbSetupEntry,
+                   &EvbTraceEntry);
+    return 1;
+}
+
+#endif
+
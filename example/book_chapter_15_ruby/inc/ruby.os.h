@@ -59,13 +59,14 @@
 
 
 #define MEMORY_PAGE_SIZE      (32)
-#define MEMORY_PAGES    (TCLC_MEMORY_BUDDY_PAGES)
+#define MEMORY_PAGES    (64)
 
 extern void OS_SetupMemory(void);
 extern void OS_SetupFlags(void);
 extern void OS_SetupQueues(void);
 extern void OS_SetupISR(void);
-extern void OS_SetupThreads(void);
+extern void OS_SetupThreads(void);
+
 	
 extern void* OS_MallocMemory(int len);
 extern void OS_FreeMemory(void* pMsg);
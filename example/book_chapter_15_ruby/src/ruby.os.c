@@ -7,7 +7,8 @@
 
 #if 0 //memory
 static TMemBuddy SysMemoryBuddy;
-static char SysMemoryPool[MEMORY_PAGE_SIZE* MEMORY_PAGES];
+static TBase32 SysMemoryPool[MEMORY_PAGE_SIZE * MEMORY_PAGES / 4];
+static TByte SysMemoryTags[MEMORY_PAGES];
 
 
 void OS_SetupMemory(void)
@@ -15,8 +16,8 @@ void OS_SetupMemory(void)
     TState state;
     TError error;
 
-    state = TclInitMemBuddy(&SysMemoryBuddy, SysMemoryPool, MEMORY_PAGES,
-                            MEMORY_PAGE_SIZE, &error);
+    state = TclCreateMemBuddy(&SysMemoryBuddy, (TChar*)SysMemoryPool, MEMORY_PAGES,
+                              MEMORY_PAGE_SIZE, SysMemoryTags, &error);
     TCLM_ASSERT((state == eSuccess), "");
     TCLM_ASSERT((error == TCLE_MEMORY_NONE), "");
 }
@@ -169,11 +170,15 @@ void OS_WaitEvent(UINT16 fid, UINT32* pattern)
     TError error;
     TFlags* flag;
     TOption option;
+    TFlagMask events;
 
     flag = &AllEventGroups[fid];
 
+    /* ں¼64λģͨTFlagMask͵ľֲת */
+    events = (TFlagMask)(*pattern);
     option = TCLO_IPC_WAIT | TCLO_IPC_OR | TCLO_IPC_CONSUME;
-    state = TclReceiveFlags(flag, pattern, option, 0, &error);
+    state = TclReceiveFlags(flag, &events, option, 0, &error);
+    *pattern = (UINT32)events;
     if (state != eSuccess)
     {
         OS_Error("err OS_WaitEvent\r\n");
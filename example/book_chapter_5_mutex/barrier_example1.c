@@ -0,0 +1,90 @@
+#include "example.h"
+#include "trochili.h"
+
+#if (EVB_EXAMPLE == CH5_BARRIER_EXAMPLE1)
+
+/* û̲߳ÿ߳̿һLed */
+#define THREAD_LED_STACK_BYTES  (512)
+#define THREAD_LED_PRIORITY     (5)
+#define THREAD_LED_SLICE        (20)
+#define LED_THREADS             (3)
+
+/* û̶߳ */
+static TThread ThreadLed[LED_THREADS];
+
+/* û߳ջ */
+static TBase32 ThreadLedStack[LED_THREADS][THREAD_LED_STACK_BYTES/4];
+
+/* ߳ϣÿȫLed̵֮߳һһ */
+static TBarrier LedBarrier;
+
+/* Led̵߳ */
+static void ThreadLedEntry(TArgument arg)
+{
+    TState state;
+    TError error;
+    TBase32 round = 0U;
+    TBase32 value = LED_ON;
+
+    while (eTrue)
+    {
+        /* ÿ̵߳Ĺʱ䲻ͬɵ߳ϵȴ */
+        state = TclDelayThread((TThread*)0, TCLM_MLS2TICKS(100 * (arg + 1U)), &error);
+        TCLM_ASSERT((state == eSuccess), "");
+        TCLM_ASSERT((error == TCLE_THREAD_NONE), "");
+
+        EVB_PRINTF("thread %d reached barrier in round %d\r\n", arg, round);
+        state = TclWaitBarrier(&LedBarrier, TCLO_IPC_WAIT, 0, &error);
+        TCLM_ASSERT((state == eSuccess), "");
+        TCLM_ASSERT((error == TCLE_IPC_NONE), "");
+
+        /* 󵽴̻߳ѱȫȴ̣߳Ledͬʱл״̬ */
+        EvbLedControl(LED1 + arg, value);
+        value = (value == LED_ON) ? LED_OFF : LED_ON;
+        round++;
+    }
+}
+
+
+/* ûӦóں */
+static void AppSetupEntry(void)
+{
+    TState state;
+    TError error;
+    TIndex i;
+
+    /* ʼ߳ */
+    state = TclCreateBarrier(&LedBarrier, LED_THREADS, TCLP_IPC_DUMMY, &error);
+    TCLM_ASSERT((state == eSuccess), "");
+    TCLM_ASSERT((error == TCLE_IPC_NONE), "");
+
+    /* ʼLed߳ */
+    for (i = 0U; i < LED_THREADS; i++)
+    {
+        state = TclCreateThread(&ThreadLed[i],
+                              &ThreadLedEntry, (TArgument)i,
+                              ThreadLedStack[i], THREAD_LED_STACK_BYTES,
+                              THREAD_LED_PRIORITY, THREAD_LED_SLICE,
+                              &error);
+        TCLM_ASSERT((state == eSuccess), "");
+        TCLM_ASSERT((error == TCLE_THREAD_NONE), "");
+
+        state = TclActivateThread(&ThreadLed[i], &error);
+        TCLM_ASSERT((state == eSuccess), "");
+        TCLM_ASSERT((error == TCLE_THREAD_NONE), "");
+    }
+}
+
+
+/* BOOT֮mainṩ */
+int main(void)
+{
+    /* עں˺,ں */
+    TclStartKernel(&AppSetupEntry,
+                   &CpuSetupEntry,
+                   &EvbSetupEntry,
+                   &EvbTraceEntry);
+    return 1;
+}
+
+#endif
@@ -0,0 +1,175 @@
+#include "example.h"
+#include "trochili.h"
+
+#if (EVB_EXAMPLE == CH5_CONDVAR_EXAMPLE1)
+
+/* û̲߳ */
+#define THREAD_LED_STACK_BYTES  (512)
+#define THREAD_LED_PRIORITY     (5)
+#define THREAD_LED_SLICE        (20)
+
+#define THREAD_CTRL_STACK_BYTES (512)
+#define THREAD_CTRL_PRIORITY    (6)
+#define THREAD_CTRL_SLICE       (20)
+
+/* û̶߳ */
+static TThread ThreadLed;
+static TThread ThreadCtrl;
+
+/* û߳ջ */
+static TBase32 ThreadLedStack[THREAD_LED_STACK_BYTES/4];
+static TBase32 ThreadCtrlStack[THREAD_CTRL_STACK_BYTES/4];
+
+/* ɻнУֱʾзǿպͶв */
+#define CMD_QUEUE_LEN (4)
+static TMutex   CmdMutex;
+static TCondVar CmdNotEmpty;
+static TCondVar CmdNotFull;
+static TBase32  CmdQueue[CMD_QUEUE_LEN];
+static TBase32  CmdHead;
+static TBase32  CmdCount;
+
+/* Led̵߳Ϊ */
+static void ThreadLedEntry(TArgument arg)
+{
+    TState state;
+    TError error;
+    TBase32 cmd;
+
+    while (eTrue)
+    {
+        state = TclLockMutex(&CmdMutex, TCLO_IPC_WAIT, 0, &error);
+        TCLM_ASSERT((state == eSuccess), "");
+        TCLM_ASSERT((error == TCLE_IPC_NONE), "");
+
+        /* ȴʱͷţʱռлҪѭ¼ */
+        while (CmdCount == 0U)
+        {
+            state = TclWaitCondVar(&CmdNotEmpty, &CmdMutex, TCLO_IPC_WAIT, 0, &error);
+            TCLM_ASSERT((state == eSuccess), "");
+            TCLM_ASSERT((error == TCLE_IPC_NONE), "");
+        }
+
+        cmd = CmdQueue[CmdHead];
+        CmdHead = (CmdHead + 1U) % CMD_QUEUE_LEN;
+        CmdCount--;
+
+        state = TclSignalCondVar(&CmdNotFull, &error);
+        TCLM_ASSERT((state == eSuccess), "");
+        TCLM_ASSERT((error == TCLE_IPC_NONE), "");
+
+        state = TclFreeMutex(&CmdMutex, &error);
+        TCLM_ASSERT((state == eSuccess), "");
+        TCLM_ASSERT((error == TCLE_IPC_NONE), "");
+
+        /* ģLedлᱻ߳ */
+        EvbLedControl(LED1 + (cmd % 3U), (cmd & 0x4U) ? LED_ON : LED_OFF);
+        EVB_PRINTF("led thread run command %d\r\n", cmd);
+        state = TclDelayThread((TThread*)0, TCLM_MLS2TICKS(200), &error);
+        TCLM_ASSERT((state == eSuccess), "");
+        TCLM_ASSERT((error == TCLE_THREAD_NONE), "");
+    }
+}
+
+
+/* CTRL̵߳Ϊ */
+static void ThreadCtrlEntry(TArgument arg)
+{
+    TState state;
+    TError error;
+    TBase32 cmd = 0U;
+
+    while (eTrue)
+    {
+        state = TclLockMutex(&CmdMutex, TCLO_IPC_WAIT, 0, &error);
+        TCLM_ASSERT((state == eSuccess), "");
+        TCLM_ASSERT((error == TCLE_IPC_NONE), "");
+
+        while (CmdCount == CMD_QUEUE_LEN)
+        {
+            EVB_PRINTF("ctrl thread waits, queue full\r\n");
+            state = TclWaitCondVar(&CmdNotFull, &CmdMutex, TCLO_IPC_WAIT, 0, &error);
+            TCLM_ASSERT((state == eSuccess), "");
+            TCLM_ASSERT((error == TCLE_IPC_NONE), "");
+        }
+
+        CmdQueue[(CmdHead + CmdCount) % CMD_QUEUE_LEN] = cmd;
+        CmdCount++;
+        cmd++;
+
+        state = TclSignalCondVar(&CmdNotEmpty, &error);
+        TCLM_ASSERT((state == eSuccess), "");
+        TCLM_ASSERT((error == TCLE_IPC_NONE), "");
+
+        state = TclFreeMutex(&CmdMutex, &error);
+        TCLM_ASSERT((state == eSuccess), "");
+        TCLM_ASSERT((error == TCLE_IPC_NONE), "");
+
+        state = TclDelayThread((TThread*)0, TCLM_MLS2TICKS(50), &error);
+        TCLM_ASSERT((state == eSuccess), "");
+        TCLM_ASSERT((error == TCLE_THREAD_NONE), "");
+    }
+}
+
+
+/* ûӦóں */
+static void AppSetupEntry(void)
+{
+    TState state;
+    TError error;
+
+    /* ʼ */
+    state = TclCreateMutex(&CmdMutex, THREAD_LED_PRIORITY, TCLP_IPC_DUMMY, &error);
+    TCLM_ASSERT((state == eSuccess), "");
+    TCLM_ASSERT((error == TCLE_IPC_NONE), "");
+
+    state = TclCreateCondVar(&CmdNotEmpty, TCLP_IPC_DUMMY, &error);
+    TCLM_ASSERT((state == eSuccess), "");
+    TCLM_ASSERT((error == TCLE_IPC_NONE), "");
+
+    state = TclCreateCondVar(&CmdNotFull, TCLP_IPC_DUMMY, &error);
+    TCLM_ASSERT((state == eSuccess), "");
+    TCLM_ASSERT((error == TCLE_IPC_NONE), "");
+
+    /* ʼLed豸߳ */
+    state = TclCreateThread(&ThreadLed,
+                          &ThreadLedEntry, (TArgument)0,
+                          ThreadLedStack, THREAD_LED_STACK_BYTES,
+                          THREAD_LED_PRIORITY, THREAD_LED_SLICE,
+                          &error);
+    TCLM_ASSERT((state == eSuccess), "");
+    TCLM_ASSERT((error == TCLE_THREAD_NONE), "");
+
+    /* ʼCTRL߳ */
+    state = TclCreateThread(&ThreadCtrl,
+                          &ThreadCtrlEntry, (TArgument)0,
+                          ThreadCtrlStack, THREAD_CTRL_STACK_BYTES,
+                          THREAD_CTRL_PRIORITY, THREAD_CTRL_SLICE,
+                          &error);
+    TCLM_ASSERT((state == eSuccess), "");
+    TCLM_ASSERT((error == TCLE_THREAD_NONE), "");
+
+    /* Led߳ */
+    state = TclActivateThread(&ThreadLed, &error);
+    TCLM_ASSERT((state == eSuccess), "");
+    TCLM_ASSERT((error == TCLE_THREAD_NONE), "");
+
+    /* CTRL߳ */
+    state = TclActivateThread(&ThreadCtrl, &error);
+    TCLM_ASSERT((state == eSuccess), "");
+    TCLM_ASSERT((error == TCLE_THREAD_NONE), "");
+}
+
+
+/* BOOT֮mainṩ */
+int main(void)
+{
+    /* עں˺,ں */
+    TclStartKernel(&AppSetupEntry,
+                   &CpuSetupEntry,
+                   &EvbSetupEntry,
+                   &EvbTraceEntry);
+    return 1;
+}
+
+#endif
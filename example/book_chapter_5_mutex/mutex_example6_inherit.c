@@ -0,0 +1,258 @@
+#include "example.h"
+#include "trochili.h"
+
+#if (EVB_EXAMPLE == CH5_MUTEX_INHERIT_EXAMPLE)
+
+/* û̲߳CTRL߳ȼߣ̵߳ļ˳ */
+#define THREAD_CTRL_STACK_BYTES (512)
+#define THREAD_CTRL_PRIORITY    (3)
+#define THREAD_CTRL_SLICE       (20)
+
+#define THREAD_HIGH_STACK_BYTES (512)
+#define THREAD_HIGH_PRIORITY    (5)
+#define THREAD_HIGH_SLICE       (20)
+
+#define THREAD_MID_STACK_BYTES  (512)
+#define THREAD_MID_PRIORITY     (6)
+#define THREAD_MID_SLICE        (20)
+
+#define THREAD_LOW_STACK_BYTES  (512)
+#define THREAD_LOW_PRIORITY     (7)
+#define THREAD_LOW_SLICE        (20)
+
+/* û̶߳ */
+static TThread ThreadCtrl;
+static TThread ThreadHigh;
+static TThread ThreadMid;
+static TThread ThreadLow;
+
+/* û߳ջ */
+static TBase32 ThreadCtrlStack[THREAD_CTRL_STACK_BYTES/4];
+static TBase32 ThreadHighStack[THREAD_HIGH_STACK_BYTES/4];
+static TBase32 ThreadMidStack[THREAD_MID_STACK_BYTES/4];
+static TBase32 ThreadLowStack[THREAD_LOW_STACK_BYTES/4];
+
+/* ȼ̳ЭĻLOW߳ռMutexAMID߳ռMutexBȴMutexA
+   HIGH̵߳ȴMutexBHIGH̵߳ȼMID̴߳ݸLOW߳ */
+static TMutex MutexA;
+static TMutex MutexB;
+
+static void PrintPriority(const char* pNote)
+{
+    EVB_PRINTF("%s: high %d, mid %d, low %d\r\n", pNote,
+               ThreadHigh.Priority, ThreadMid.Priority, ThreadLow.Priority);
+}
+
+
+/* HIGH̵߳ */
+static void ThreadHighEntry(TArgument arg)
+{
+    TState state;
+    TError error;
+
+    while (eTrue)
+    {
+        state = TclLockMutex(&MutexB, TCLO_IPC_WAIT, 0, &error);
+        TCLM_ASSERT((state == eSuccess), "");
+        TCLM_ASSERT((error == TCLE_IPC_NONE), "");
+
+        EvbLedControl(LED1, LED_ON);
+
+        state = TclFreeMutex(&MutexB, &error);
+        TCLM_ASSERT((state == eSuccess), "");
+        TCLM_ASSERT((error == TCLE_IPC_NONE), "");
+
+        state = TclDeactivateThread((TThread*)0, &error);
+        TCLM_ASSERT((state == eSuccess), "");
+        TCLM_ASSERT((error == TCLE_THREAD_NONE), "");
+    }
+}
+
+
+/* MID̵߳ */
+static void ThreadMidEntry(TArgument arg)
+{
+    TState state;
+    TError error;
+
+    while (eTrue)
+    {
+        state = TclLockMutex(&MutexB, TCLO_IPC_WAIT, 0, &error);
+        TCLM_ASSERT((state == eSuccess), "");
+        TCLM_ASSERT((error == TCLE_IPC_NONE), "");
+
+        state = TclLockMutex(&MutexA, TCLO_IPC_WAIT, 0, &error);
+        TCLM_ASSERT((state == eSuccess), "");
+        TCLM_ASSERT((error == TCLE_IPC_NONE), "");
+
+        EvbLedControl(LED2, LED_ON);
+
+        state = TclFreeMutex(&MutexA, &error);
+        TCLM_ASSERT((state == eSuccess), "");
+        TCLM_ASSERT((error == TCLE_IPC_NONE), "");
+
+        state = TclFreeMutex(&MutexB, &error);
+        TCLM_ASSERT((state == eSuccess), "");
+        TCLM_ASSERT((error == TCLE_IPC_NONE), "");
+
+        state = TclDeactivateThread((TThread*)0, &error);
+        TCLM_ASSERT((state == eSuccess), "");
+        TCLM_ASSERT((error == TCLE_THREAD_NONE), "");
+    }
+}
+
+
+/* LOW̵߳ */
+static void ThreadLowEntry(TArgument arg)
+{
+    TState state;
+    TError error;
+
+    while (eTrue)
+    {
+        state = TclLockMutex(&MutexA, TCLO_IPC_WAIT, 0, &error);
+        TCLM_ASSERT((state == eSuccess), "");
+        TCLM_ASSERT((error == TCLE_IPC_NONE), "");
+
+        /* ռMutexAһʱ䣬ڼ߳½ */
+        EvbLedControl(LED3, LED_ON);
+        state = TclDelayThread((TThread*)0, TCLM_MLS2TICKS(500), &error);
+        TCLM_ASSERT((state == eSuccess), "");
+        TCLM_ASSERT((error == TCLE_THREAD_NONE), "");
+        EvbLedControl(LED3, LED_OFF);
+
+        state = TclFreeMutex(&MutexA, &error);
+        TCLM_ASSERT((state == eSuccess), "");
+        TCLM_ASSERT((error == TCLE_IPC_NONE), "");
+
+        state = TclDeactivateThread((TThread*)0, &error);
+        TCLM_ASSERT((state == eSuccess), "");
+        TCLM_ASSERT((error == TCLE_THREAD_NONE), "");
+    }
+}
+
+
+/* CTRL̵߳ */
+static void ThreadCtrlEntry(TArgument arg)
+{
+    TState state;
+    TError error;
+    TThread* pThreads[3];
+    TIndex i;
+
+    pThreads[0] = &ThreadLow;
+    pThreads[1] = &ThreadMid;
+    pThreads[2] = &ThreadHigh;
+
+    while (eTrue)
+    {
+        /* μLOWMIDHIGḤ߳ÿ߳еռлߵȴΪֹ */
+        for (i = 0U; i < 3U; i++)
+        {
+            state = TclActivateThread(pThreads[i], &error);
+            TCLM_ASSERT((state == eSuccess), "");
+            TCLM_ASSERT((error == TCLE_THREAD_NONE), "");
+
+            state = TclDelayThread((TThread*)0, TCLM_MLS2TICKS(10), &error);
+            TCLM_ASSERT((state == eSuccess), "");
+            TCLM_ASSERT((error == TCLE_THREAD_NONE), "");
+        }
+        PrintPriority("chain blocked");
+
+        /* еHIGH̵߳ȼµȼػ */
+        state = TclSetThreadPriority(&ThreadHigh, THREAD_HIGH_PRIORITY - 1, &error);
+        TCLM_ASSERT((state == eSuccess), "");
+        TCLM_ASSERT((error == TCLE_THREAD_NONE), "");
+        PrintPriority("high raised");
+
+        /* HIGH߳̽ͣLOW߳Ȼ̳MID̵߳ȼ */
+        state = TclSetThreadPriority(&ThreadHigh, THREAD_LOW_PRIORITY + 1, &error);
+        TCLM_ASSERT((state == eSuccess), "");
+        TCLM_ASSERT((error == TCLE_THREAD_NONE), "");
+        PrintPriority("high lowered");
+
+        state = TclSetThreadPriority(&ThreadHigh, THREAD_HIGH_PRIORITY, &error);
+        TCLM_ASSERT((state == eSuccess), "");
+        TCLM_ASSERT((error == TCLE_THREAD_NONE), "");
+
+        /* LOW߳ͷMutexA֮󣬻νMIDHIGḤָ̻߳߳ȼ */
+        state = TclDelayThread((TThread*)0, TCLM_MLS2TICKS(1000), &error);
+        TCLM_ASSERT((state == eSuccess), "");
+        TCLM_ASSERT((error == TCLE_THREAD_NONE), "");
+        PrintPriority("chain released");
+
+        for (i = 0U; i < 3U; i++)
+        {
+            EvbLedControl(LED1 + i, LED_OFF);
+        }
+    }
+}
+
+
+/* ûӦóں */
+static void AppSetupEntry(void)
+{
+    TState state;
+    TError error;
+
+    /* ʼ̳Э컨ȼ */
+    state = TclCreateMutex(&MutexA, 0, TCLP_IPC_INHERIT | TCLP_IPC_PREEMP_PRIMIQ, &error);
+    TCLM_ASSERT((state == eSuccess), "");
+    TCLM_ASSERT((error == TCLE_IPC_NONE), "");
+
+    state = TclCreateMutex(&MutexB, 0, TCLP_IPC_INHERIT | TCLP_IPC_PREEMP_PRIMIQ, &error);
+    TCLM_ASSERT((state == eSuccess), "");
+    TCLM_ASSERT((error == TCLE_IPC_NONE), "");
+
+    /* ʼ߳ */
+    state = TclCreateThread(&ThreadCtrl,
+                          &ThreadCtrlEntry, (TArgument)0,
+                          ThreadCtrlStack, THREAD_CTRL_STACK_BYTES,
+                          THREAD_CTRL_PRIORITY, THREAD_CTRL_SLICE,
+                          &error);
+    TCLM_ASSERT((state == eSuccess), "");
+    TCLM_ASSERT((error == TCLE_THREAD_NONE), "");
+
+    state = TclCreateThread(&ThreadHigh,
+                          &ThreadHighEntry, (TArgument)0,
+                          ThreadHighStack, THREAD_HIGH_STACK_BYTES,
+                          THREAD_HIGH_PRIORITY, THREAD_HIGH_SLICE,
+                          &error);
+    TCLM_ASSERT((state == eSuccess), "");
+    TCLM_ASSERT((error == TCLE_THREAD_NONE), "");
+
+    state = TclCreateThread(&ThreadMid,
+                          &ThreadMidEntry, (TArgument)0,
+                          ThreadMidStack, THREAD_MID_STACK_BYTES,
+                          THREAD_MID_PRIORITY, THREAD_MID_SLICE,
+                          &error);
+    TCLM_ASSERT((state == eSuccess), "");
+    TCLM_ASSERT((error == TCLE_THREAD_NONE), "");
+
+    state = TclCreateThread(&ThreadLow,
+                          &ThreadLowEntry, (TArgument)0,
+                          ThreadLowStack, THREAD_LOW_STACK_BYTES,
+                          THREAD_LOW_PRIORITY, THREAD_LOW_SLICE,
+                          &error);
+    TCLM_ASSERT((state == eSuccess), "");
+    TCLM_ASSERT((error == TCLE_THREAD_NONE), "");
+
+    /* ֻCTRḶ߳߳CTRL̰߳˳򼤻 */
+    state = TclActivateThread(&ThreadCtrl, &error);
+    TCLM_ASSERT((state == eSuccess), "");
+    TCLM_ASSERT((error == TCLE_THREAD_NONE), "");
+}
+
+
+/* BOOT֮mainṩ */
+int main(void)
+{
+    /* עں˺,ں */
+    TclStartKernel(&AppSetupEntry,
+                   &CpuSetupEntry,
+                   &EvbSetupEntry,
+                   &EvbTraceEntry);
+    return 1;
+}
+
+#endif
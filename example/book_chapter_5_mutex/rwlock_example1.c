@@ -0,0 +1,162 @@
+#include "example.h"
+#include "trochili.h"
+
+#if (EVB_EXAMPLE == CH5_RWLOCK_EXAMPLE1)
+
+/* û̲߳ */
+#define THREAD_WRITER_STACK_BYTES (512)
+#define THREAD_WRITER_PRIORITY    (5)
+#define THREAD_WRITER_SLICE       (20)
+
+#define THREAD_READER_STACK_BYTES (512)
+#define THREAD_READER_PRIORITY    (6)
+#define THREAD_READER_SLICE       (20)
+#define READERS                   (2)
+
+/* û̶߳ */
+static TThread ThreadWriter;
+static TThread ThreadReader[READERS];
+
+/* û߳ջ */
+static TBase32 ThreadWriterStack[THREAD_WRITER_STACK_BYTES/4];
+static TBase32 ThreadReaderStack[READERS][THREAD_READER_STACK_BYTES/4];
+
+/* дLed״̬߳̿ͬʱȡд̶߳ռ޸ */
+static TRwLock LedRwLock;
+static TBase32 LedTable[READERS];
+static TBase32 LedVersion;
+
+/* ̵߳ */
+static void ThreadReaderEntry(TArgument arg)
+{
+    TState state;
+    TError error;
+    TBase32 value;
+    TBase32 version;
+
+    while (eTrue)
+    {
+        state = TclLockRwRead(&LedRwLock, TCLO_IPC_WAIT, 0, &error);
+        TCLM_ASSERT((state == eSuccess), "");
+        TCLM_ASSERT((error == TCLE_IPC_NONE), "");
+
+        /* жڼ״̬ᱻ޸ģ߳̿ͬʱж */
+        value = LedTable[arg];
+        version = LedVersion;
+        state = TclDelayThread((TThread*)0, TCLM_MLS2TICKS(100), &error);
+        TCLM_ASSERT((state == eSuccess), "");
+        TCLM_ASSERT((error == TCLE_THREAD_NONE), "");
+        TCLM_ASSERT((version == LedVersion), "");
+
+        state = TclFreeRwLock(&LedRwLock, &error);
+        TCLM_ASSERT((state == eSuccess), "");
+        TCLM_ASSERT((error == TCLE_IPC_NONE), "");
+
+        EvbLedControl(LED1 + arg, value);
+        EVB_PRINTF("reader %d saw version %d\r\n", arg, version);
+
+        state = TclDelayThread((TThread*)0, TCLM_MLS2TICKS(50), &error);
+        TCLM_ASSERT((state == eSuccess), "");
+        TCLM_ASSERT((error == TCLE_THREAD_NONE), "");
+    }
+}
+
+
+/* д̵߳ */
+static void ThreadWriterEntry(TArgument arg)
+{
+    TState state;
+    TError error;
+    TIndex i;
+
+    while (eTrue)
+    {
+        state = TclDelayThread((TThread*)0, TCLM_MLS2TICKS(700), &error);
+        TCLM_ASSERT((state == eSuccess), "");
+        TCLM_ASSERT((error == TCLE_THREAD_NONE), "");
+
+        /* Զ״̬Ҫ޸ʱٰѶΪд
+           ҪͷŶдȲµĶ߲ٲ */
+        state = TclLockRwRead(&LedRwLock, TCLO_IPC_WAIT, 0, &error);
+        TCLM_ASSERT((state == eSuccess), "");
+        TCLM_ASSERT((error == TCLE_IPC_NONE), "");
+
+        state = TclUpgradeRwLock(&LedRwLock, TCLO_IPC_WAIT, 0, &error);
+        TCLM_ASSERT((state == eSuccess), "");
+        TCLM_ASSERT((error == TCLE_IPC_NONE), "");
+
+        for (i = 0U; i < READERS; i++)
+        {
+            LedTable[i] = (LedTable[i] == LED_ON) ? LED_OFF : LED_ON;
+        }
+        LedVersion++;
+        EVB_PRINTF("writer updated version %d\r\n", LedVersion);
+
+        /* ޸ɺ󽵼ΪȴеĶ̶߳̿ȡµ״̬ */
+        state = TclDowngradeRwLock(&LedRwLock, &error);
+        TCLM_ASSERT((state == eSuccess), "");
+        TCLM_ASSERT((error == TCLE_IPC_NONE), "");
+
+        state = TclFreeRwLock(&LedRwLock, &error);
+        TCLM_ASSERT((state == eSuccess), "");
+        TCLM_ASSERT((error == TCLE_IPC_NONE), "");
+    }
+}
+
+
+/* ûӦóں */
+static void AppSetupEntry(void)
+{
+    TState state;
+    TError error;
+    TIndex i;
+
+    /* ʼддȲԣд컨ȼд̵߳ȼ */
+    state = TclCreateRwLock(&LedRwLock, THREAD_WRITER_PRIORITY, TCLP_IPC_WRITER_PREF, &error);
+    TCLM_ASSERT((state == eSuccess), "");
+    TCLM_ASSERT((error == TCLE_IPC_NONE), "");
+
+    /* ʼд߳ */
+    state = TclCreateThread(&ThreadWriter,
+                          &ThreadWriterEntry, (TArgument)0,
+                          ThreadWriterStack, THREAD_WRITER_STACK_BYTES,
+                          THREAD_WRITER_PRIORITY, THREAD_WRITER_SLICE,
+                          &error);
+    TCLM_ASSERT((state == eSuccess), "");
+    TCLM_ASSERT((error == TCLE_THREAD_NONE), "");
+
+    state = TclActivateThread(&ThreadWriter, &error);
+    TCLM_ASSERT((state == eSuccess), "");
+    TCLM_ASSERT((error == TCLE_THREAD_NONE), "");
+
+    /* ʼ߳ */
+    for (i = 0U; i < READERS; i++)
+    {
+        LedTable[i] = LED_OFF;
+        state = TclCreateThread(&ThreadReader[i],
+                              &ThreadReaderEntry, (TArgument)i,
+                              ThreadReaderStack[i], THREAD_READER_STACK_BYTES,
+                              THREAD_READER_PRIORITY, THREAD_READER_SLICE,
+                              &error);
+        TCLM_ASSERT((state == eSuccess), "");
+        TCLM_ASSERT((error == TCLE_THREAD_NONE), "");
+
+        state = TclActivateThread(&ThreadReader[i], &error);
+        TCLM_ASSERT((state == eSuccess), "");
+        TCLM_ASSERT((error == TCLE_THREAD_NONE), "");
+    }
+}
+
+
+/* BOOT֮mainṩ */
+int main(void)
+{
+    /* עں˺,ں */
+    TclStartKernel(&AppSetupEntry,
+                   &CpuSetupEntry,
+                   &EvbSetupEntry,
+                   &EvbTraceEntry);
+    return 1;
+}
+
+#endif
@@ -0,0 +1,164 @@
+#include "example.h"
+#include "trochili.h"
+
+
+#if (EVB_EXAMPLE == CH7_MSGBUF_EXAMPLE1)
+
+/* û̲߳ */
+#define THREAD_LED_STACK_BYTES  (512)
+#define THREAD_LED_PRIORITY     (5)
+#define THREAD_LED_SLICE        (20)
+
+#define THREAD_CTRL_STACK_BYTES (512)
+#define THREAD_CTRL_PRIORITY    (6)
+#define THREAD_CTRL_SLICE       (20)
+
+/* û̶߳ */
+static TThread ThreadLed;
+static TThread ThreadCtrl;
+
+/* û߳ջ */
+static TBase32 ThreadLedStack[THREAD_LED_STACK_BYTES/4];
+static TBase32 ThreadCtrlStack[THREAD_CTRL_STACK_BYTES/4];
+
+/* ûϢͶ壬Ϣȿɱ䣬CountʾЧLedĿ */
+typedef struct
+{
+    TBase32 Index;
+    TBase32 Value;
+} TLedCmd;
+
+typedef struct
+{
+    TBase32 Count;
+    TLedCmd Cmd[3];
+} TLedMsg;
+
+/* ûϢ壬ϢֱӴڻλҪΪÿϢڴ */
+#define MSGBUF_BYTES (128)
+static TMsgBuffer LedMsgBuf;
+static TBase32 LedMsgRing[MSGBUF_BYTES/4];
+
+/* Led̵߳ */
+static void ThreadLedEntry(TArgument data)
+{
+    TError error;
+    TState state;
+    TLedMsg* pMsg;
+    TBase32 length;
+    TBase32 i;
+
+    while (eTrue)
+    {
+        /* Led߳ʽȡϢֱڻдϢݣϺͷ */
+        state = TclPeekMsgBuffer(&LedMsgBuf, (void**)(&pMsg), &length,
+                                 TCLO_IPC_WAIT, 0, &error);
+        if (state == eSuccess)
+        {
+            for (i = 0; i < pMsg->Count; i++)
+            {
+                EvbLedControl(pMsg->Cmd[i].Index, pMsg->Cmd[i].Value);
+            }
+
+            state = TclReleaseMsgBuffer(&LedMsgBuf, &error);
+            TCLM_ASSERT((state == eSuccess), "");
+            TCLM_ASSERT((error == TCLE_IPC_NONE), "");
+        }
+    }
+}
+
+
+/* ̵߳ */
+static void ThreadCtrlEntry(TArgument data)
+{
+    TError error;
+    TState state;
+    TLedMsg* pMsg;
+    TBase32 count = 1U;
+    TBase32 value = LED_ON;
+    TBase32 i;
+
+    while (eTrue)
+    {
+        /* ̰߳ϢԤռ䣬ֱڻдϢȻʵʳύ */
+        state = TclReserveMsgBuffer(&LedMsgBuf, sizeof(TLedMsg), (void**)(&pMsg),
+                                    TCLO_IPC_WAIT, 0, &error);
+        TCLM_ASSERT((state == eSuccess), "");
+        TCLM_ASSERT((error == TCLE_IPC_NONE), "");
+
+        pMsg->Count = count;
+        for (i = 0; i < count; i++)
+        {
+            pMsg->Cmd[i].Index = LED1 + i;
+            pMsg->Cmd[i].Value = value;
+        }
+
+        state = TclCommitMsgBuffer(&LedMsgBuf, sizeof(TBase32) + count * sizeof(TLedCmd), &error);
+        TCLM_ASSERT((state == eSuccess), "");
+        TCLM_ASSERT((error == TCLE_IPC_NONE), "");
+
+        count = (count % 3U) + 1U;
+        value = (value == LED_ON) ? LED_OFF : LED_ON;
+
+        state = TclDelayThread((TThread*)0, TCLM_MLS2TICKS(500), &error);
+        TCLM_ASSERT((state == eSuccess), "");
+        TCLM_ASSERT((error == TCLE_THREAD_NONE), "");
+    }
+}
+
+
+/* ûӦóں */
+static void AppSetupEntry(void)
+{
+    TState state;
+    TError error;
+
+    /* ʼϢ */
+    state = TclCreateMsgBuffer(&LedMsgBuf, (void*)LedMsgRing, MSGBUF_BYTES,
+                               TCLP_IPC_DUMMY, &error);
+    TCLM_ASSERT((state == eSuccess), "");
+    TCLM_ASSERT((error == TCLE_IPC_NONE), "");
+
+    /* ʼLed豸߳ */
+    state = TclCreateThread(&ThreadLed,
+                          &ThreadLedEntry, (TArgument)0,
+                          ThreadLedStack, THREAD_LED_STACK_BYTES,
+                          THREAD_LED_PRIORITY, THREAD_LED_SLICE,
+                          &error);
+    TCLM_ASSERT((state == eSuccess), "");
+    TCLM_ASSERT((error == TCLE_THREAD_NONE), "");
+
+    /* ʼ߳ */
+    state = TclCreateThread(&ThreadCtrl,
+                          &ThreadCtrlEntry, (TArgument)0,
+                          ThreadCtrlStack, THREAD_CTRL_STACK_BYTES,
+                          THREAD_CTRL_PRIORITY, THREAD_CTRL_SLICE,
+                          &error);
+    TCLM_ASSERT((state == eSuccess), "");
+    TCLM_ASSERT((error == TCLE_THREAD_NONE), "");
+
+    /* Led߳ */
+    state = TclActivateThread(&ThreadLed, &error);
+    TCLM_ASSERT((state == eSuccess), "");
+    TCLM_ASSERT((error == TCLE_THREAD_NONE), "");
+
+    /* ߳ */
+    state = TclActivateThread(&ThreadCtrl, &error);
+    TCLM_ASSERT((state == eSuccess), "");
+    TCLM_ASSERT((error == TCLE_THREAD_NONE), "");
+}
+
+
+/* BOOT֮mainṩ */
+int main(void)
+{
+    /* עں˺,ں */
+    TclStartKernel(&AppSetupEntry,
+                   &CpuSetupEntry,
+                   &EvbSetupEntry,
+                   &EvbTraceEntry);
+    return 1;
+}
+
+#endif
+
@@ -38,7 +38,7 @@ static void ThreadLedOnEntry(TArgument arg)
 {
     TState state;
     TError error;
-    TBitMask pattern;
+    TFlagMask pattern;
     TOption option;
 
     while (eTrue)
@@ -74,7 +74,7 @@ static void ThreadLedOffEntry(TArgument arg)
 {
     TState state;
     TError error;
-    TBitMask pattern;
+    TFlagMask pattern;
     TOption option;
 
     while (eTrue)
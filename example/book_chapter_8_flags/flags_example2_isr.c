@@ -30,7 +30,7 @@ static void ThreadCtrlEntry(TArgument data)
 {
     TState state;
     TError error;
-    TBitMask pattern;
+    TFlagMask pattern;
     TOption option;
 
     while (eTrue)
@@ -32,7 +32,7 @@ static void ThreadLED1Entry(TArgument data)
 {
     TState state;
     TError error;
-    TBitMask pattern;
+    TFlagMask pattern;
     TOption option;
 
     while (eTrue)
@@ -62,7 +62,7 @@ static void ThreadLed2Entry(TArgument data)
 {
     TState state;
     TError error;
-    TBitMask pattern;
+    TFlagMask pattern;
     TOption option;
 
     while (eTrue)
@@ -92,7 +92,7 @@ static void ThreadLed3Entry(TArgument data)
 {
     TState state;
     TError error;
-    TBitMask pattern;
+    TFlagMask pattern;
     TOption option;
 
     while (eTrue)
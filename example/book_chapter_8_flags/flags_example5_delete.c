@@ -28,7 +28,7 @@ static void ThreadLedEntry(TArgument data)
 {
     TState state;
     TError error;
-    TBitMask pattern;
+    TFlagMask pattern;
     TOption option;
 
     while (eTrue)
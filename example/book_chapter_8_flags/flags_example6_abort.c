@@ -33,7 +33,7 @@ static void ThreadLed1Entry(TArgument data)
 {
     TState state;
     TError error;
-    TBitMask pattern;
+    TFlagMask pattern;
     TOption option;
 
     while (eTrue)
@@ -64,7 +64,7 @@ static void ThreadLed2Entry(TArgument data)
 {
     TState state;
     TError error;
-    TBitMask pattern;
+    TFlagMask pattern;
     TOption option;
 
     while (eTrue)
@@ -96,7 +96,7 @@ static void ThreadLed3Entry(TArgument data)
 {
     TState state;
     TError error;
-    TBitMask pattern;
+    TFlagMask pattern;
     TOption option;
 
     while (eTrue)
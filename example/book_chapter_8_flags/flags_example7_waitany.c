@@ -0,0 +1,188 @@
+#include "example.h"
+#include "trochili.h"
+
+#if (EVB_EXAMPLE == CH8_WAITANY_EXAMPLE)
+
+/* û̲߳ */
+#define THREAD_LED_STACK_BYTES  (512)
+#define THREAD_LED_PRIORITY     (5)
+#define THREAD_LED_SLICE        (20)
+
+#define THREAD_CTRL_STACK_BYTES (512)
+#define THREAD_CTRL_PRIORITY    (6)
+#define THREAD_CTRL_SLICE       (20)
+
+/* û̶߳ */
+static TThread ThreadLed;
+static TThread ThreadCtrl;
+
+/* û߳ջ */
+static TBase32 ThreadLedStack[THREAD_LED_STACK_BYTES/4];
+static TBase32 ThreadCtrlStack[THREAD_CTRL_STACK_BYTES/4];
+
+/* LED߳ͬʱȴIPCźLED1ʼLED2¼ǿLED3 */
+static TSemaphore LedSemaphore;
+static TMailBox LedMailbox;
+static TFlags LedFlags;
+
+#define LED3_ON_FLG   (0x1 << 0)
+#define LED3_OFF_FLG  (0x1 << 1)
+
+/* Led̵߳ */
+static void ThreadLedEntry(TArgument arg)
+{
+    TState state;
+    TError error;
+    TIpcWaitItem items[3];
+    TMail mail;
+    TFlagMask pattern;
+    TIndex index;
+
+    items[0].Type   = eWaitSemaphore;
+    items[0].Object = (void*)(&LedSemaphore);
+    items[0].Data   = (void*)0;
+    items[0].Option = TCLO_IPC_DUMMY;
+
+    items[1].Type   = eWaitMailBox;
+    items[1].Object = (void*)(&LedMailbox);
+    items[1].Data   = (void*)(&mail);
+    items[1].Option = TCLO_IPC_DUMMY;
+
+    items[2].Type   = eWaitFlags;
+    items[2].Object = (void*)(&LedFlags);
+    items[2].Data   = (void*)(&pattern);
+    items[2].Option = TCLO_IPC_OR | TCLO_IPC_CONSUME;
+
+    while (eTrue)
+    {
+        /* ÿεȴ֮ǰҪڴ¼ϣճɹ󱣴ʵʵõ¼ */
+        pattern = LED3_ON_FLG | LED3_OFF_FLG;
+
+        /* ĸȾʹĸգ1ûκζʱ */
+        state = TclWaitAny(items, 3U, &index, TCLO_IPC_WAIT | TCLO_IPC_TIMED,
+                           TCLM_MLS2TICKS(1000), &error);
+        if (state == eSuccess)
+        {
+            if (index == 0U)
+            {
+                EvbLedControl(LED1, LED_ON);
+            }
+            else if (index == 1U)
+            {
+                EvbLedControl(LED2, (TBase32)mail);
+            }
+            else
+            {
+                EvbLedControl(LED3, (pattern & LED3_ON_FLG) ? LED_ON : LED_OFF);
+            }
+            EVB_PRINTF("led thread woken by object %d\r\n", index);
+        }
+        else
+        {
+            TCLM_ASSERT((error == TCLE_IPC_TIMEO), "");
+            EvbLedControl(LED1, LED_OFF);
+            EVB_PRINTF("led thread timed out\r\n");
+        }
+    }
+}
+
+
+/* CTRL̵߳ */
+static void ThreadCtrlEntry(TArgument arg)
+{
+    TState state;
+    TError error;
+    TMail mail;
+    TBase32 round = 0U;
+
+    while (eTrue)
+    {
+        /* IPCÿ֮ͣһʱ䣬LED̵߳ȴʱ */
+        if (round % 3U == 0U)
+        {
+            state = TclReleaseSemaphore(&LedSemaphore, 0, 0, &error);
+            TCLM_ASSERT((error == TCLE_IPC_NONE), "");
+        }
+        else if (round % 3U == 1U)
+        {
+            mail = (TMail)((round & 0x4U) ? LED_ON : LED_OFF);
+            state = TclSendMail(&LedMailbox, (TMail*)(&mail), 0, 0, &error);
+            TCLM_ASSERT((error == TCLE_IPC_NONE), "");
+        }
+        else
+        {
+            state = TclSendFlags(&LedFlags, (round & 0x4U) ? LED3_ON_FLG : LED3_OFF_FLG, &error);
+            TCLM_ASSERT((error == TCLE_IPC_NONE), "");
+        }
+        TCLM_ASSERT((state == eSuccess), "");
+        round++;
+
+        state = TclDelayThread((TThread*)0,
+                               TCLM_MLS2TICKS((round % 3U == 0U) ? 1500 : 400), &error);
+        TCLM_ASSERT((state == eSuccess), "");
+        TCLM_ASSERT((error == TCLE_THREAD_NONE), "");
+    }
+}
+
+
+/* ûӦóں */
+static void AppSetupEntry(void)
+{
+    TState state;
+    TError error;
+
+    /* ʼIPC */
+    state = TclCreateSemaphore(&LedSemaphore, 0, 1, TCLP_IPC_DUMMY, &error);
+    TCLM_ASSERT((state == eSuccess), "");
+    TCLM_ASSERT((error == TCLE_IPC_NONE), "");
+
+    state = TclCreateMailBox(&LedMailbox, TCLP_IPC_DUMMY, &error);
+    TCLM_ASSERT((state == eSuccess), "");
+    TCLM_ASSERT((error == TCLE_IPC_NONE), "");
+
+    state = TclCreateFlags(&LedFlags, TCLP_IPC_DUMMY, &error);
+    TCLM_ASSERT((state == eSuccess), "");
+    TCLM_ASSERT((error == TCLE_IPC_NONE), "");
+
+    /* ʼLed豸߳ */
+    state = TclCreateThread(&ThreadLed,
+                          &ThreadLedEntry, (TArgument)0,
+                          ThreadLedStack, THREAD_LED_STACK_BYTES,
+                          THREAD_LED_PRIORITY, THREAD_LED_SLICE,
+                          &error);
+    TCLM_ASSERT((state == eSuccess), "");
+    TCLM_ASSERT((error == TCLE_THREAD_NONE), "");
+
+    /* ʼCTRL߳ */
+    state = TclCreateThread(&ThreadCtrl,
+                          &ThreadCtrlEntry, (TArgument)0,
+                          ThreadCtrlStack, THREAD_CTRL_STACK_BYTES,
+                          THREAD_CTRL_PRIORITY, THREAD_CTRL_SLICE,
+                          &error);
+    TCLM_ASSERT((state == eSuccess), "");
+    TCLM_ASSERT((error == TCLE_THREAD_NONE), "");
+
+    /* Led߳ */
+    state = TclActivateThread(&ThreadLed, &error);
+    TCLM_ASSERT((state == eSuccess), "");
+    TCLM_ASSERT((error == TCLE_THREAD_NONE), "");
+
+    /* CTRL߳ */
+    state = TclActivateThread(&ThreadCtrl, &error);
+    TCLM_ASSERT((state == eSuccess), "");
+    TCLM_ASSERT((error == TCLE_THREAD_NONE), "");
+}
+
+
+/* BOOT֮mainṩ */
+int main(void)
+{
+    /* עں˺,ں */
+    TclStartKernel(&AppSetupEntry,
+                   &CpuSetupEntry,
+                   &EvbSetupEntry,
+                   &EvbTraceEntry);
+    return 1;
+}
+
+#endif
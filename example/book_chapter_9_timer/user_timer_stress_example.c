@@ -0,0 +1,130 @@
+#include <stdio.h>
+#include "example.h"
+#include "trochili.h"
+
+#if (EVB_EXAMPLE == CH9_TIMER_STRESS_EXAMPLE)
+
+/* ߳ʱҪĲ */
+#define THREAD_MONITOR_STACK_BYTES  (512)
+#define THREAD_MONITOR_PRIORITY     (5)
+#define THREAD_MONITOR_SLICE        (32U)
+
+/* ͬʱеûʱĿͶʱڷΧ(ʱӽ)ÿʱͬʱ¼Լռ60ֽڣ
+   ĬĿGD32F190SRAMȷϿԶSTRESS_TIMER_NUMΪ1024UģĲ */
+#ifndef STRESS_TIMER_NUM
+#define STRESS_TIMER_NUM            (32U)
+#endif
+#define STRESS_PERIOD_MIN           (1U)
+#define STRESS_PERIOD_RANGE         (2000U)
+
+/* ߳̽ṹջ */
+static TThread ThreadMonitor;
+static TBase32 ThreadMonitorStack[THREAD_MONITOR_STACK_BYTES/4];
+
+/* ûʱṹԼÿʱһӦʱʱ̣Ϊ0ʾûеʱ */
+static TTimer    StressTimer[STRESS_TIMER_NUM];
+static TTimeTick StressMatch[STRESS_TIMER_NUM];
+
+/* ʱصͳ */
+static TBase32 StressCallbacks = 0U;
+static TBase32 StressErrors = 0U;
+
+/* жʱõĻص鶨ʱǷϸյʱʱ̴ʱʱֻɻص¼
+   ߳ʱʱȡĺʱܷ֮ʱжϣ¼ */
+static void StressTimerRoutine(TArgument data)
+{
+    TTimeTick jiffies;
+    TIndex index = (TIndex)data;
+
+    TclGetTimeJiffies(&jiffies);
+    if ((StressMatch[index] != 0U) && (jiffies != StressMatch[index]))
+    {
+        StressErrors++;
+    }
+    StressMatch[index] = jiffies + StressTimer[index].PeriodTicks;
+    StressCallbacks++;
+}
+
+/* ߳ȫʱȻÿӡһͳƽ */
+static void ThreadMonitorEntry(TArgument data)
+{
+    TState state;
+    TError error;
+    TIndex index;
+    TTimeTick period;
+    char str[64];
+
+    for (index = 0U; index < STRESS_TIMER_NUM; index++)
+    {
+        /* ڴֲʹʱڸʱֵĲַͬ */
+        period = STRESS_PERIOD_MIN + (index * 7919U) % STRESS_PERIOD_RANGE;
+        state = TclCreateTimer(&StressTimer[index],
+                               TCLP_TIMER_PERIODIC|TCLP_TIMER_URGENT,
+                               period,
+                               &StressTimerRoutine,
+                               (TArgument)index,
+                               &error);
+        TCLM_ASSERT((state == eSuccess), "");
+        TCLM_ASSERT((error == TCLE_TIMER_NONE), "");
+    }
+
+    for (index = 0U; index < STRESS_TIMER_NUM; index++)
+    {
+        state = TclStartTimer(&StressTimer[index], 0U, &error);
+        TCLM_ASSERT((state == eSuccess), "");
+        TCLM_ASSERT((error == TCLE_TIMER_NONE), "");
+    }
+
+    while (eTrue)
+    {
+        state = TclDelayThread((TThread*)0, TCLM_MLS2TICKS(1000), &error);
+        TCLM_ASSERT((state == eSuccess), "");
+        TCLM_ASSERT((error == TCLE_THREAD_NONE), "");
+
+        sprintf(str, "timers %u callbacks %u errors %u\r\n",
+                (unsigned int)STRESS_TIMER_NUM,
+                (unsigned int)StressCallbacks,
+                (unsigned int)StressErrors);
+        TclTrace(str);
+    }
+}
+
+
+/* ûӦں */
+static void AppSetupEntry(void)
+{
+    TState state;
+    TError error;
+
+    /* ʼ߳ */
+    state = TclCreateThread(&ThreadMonitor,
+                            &ThreadMonitorEntry,
+                            (TArgument)0,
+                            ThreadMonitorStack,
+                            THREAD_MONITOR_STACK_BYTES,
+                            THREAD_MONITOR_PRIORITY,
+                            THREAD_MONITOR_SLICE,
+                            &error);
+    TCLM_ASSERT((state == eSuccess), "");
+    TCLM_ASSERT((error == TCLE_THREAD_NONE), "");
+
+    /* ߳ */
+    state = TclActivateThread(&ThreadMonitor, &error);
+    TCLM_ASSERT((state == eSuccess), "");
+    TCLM_ASSERT((error == TCLE_THREAD_NONE), "");
+}
+
+
+/* BOOT֮mainṩ */
+int main(void)
+{
+    /* עں˺,ں */
+    TclStartKernel(&AppSetupEntry,
+                   &CpuSetupEntry,
+                   &EvbSetupEntry,
+                   &EvbTraceEntry);
+
+    return 1;
+}
+
+#endif
@@ -22,6 +22,10 @@
 #define CH5_MUTEX_EXAMPLE3         (52)       /* FLUSH                */
 #define CH5_MUTEX_EXAMPLE4         (54)       /* DELETE               */
 #define CH5_MUTEX_EXAMPLE5         (56)       /* ABORT                */
+#define CH5_MUTEX_INHERIT_EXAMPLE  (57)       /* ȼ̳       */
+#define CH5_RWLOCK_EXAMPLE1        (58)       /* д               */
+#define CH5_CONDVAR_EXAMPLE1       (59)       /*              */
+#define CH5_BARRIER_EXAMPLE1       (55)       /* ߳             */
 
 #define CH6_MAILBOX_EXAMPLE1       (61)       /* 첽ʼշ     */
 #define CH6_MAILBOX_EXAMPLE2       (62)       /* KEY ISR              */
@@ -42,6 +46,7 @@
 #define CH7_MESSAGE_EXAMPLE7       (77)       /* FLUSH                */
 #define CH7_MESSAGE_EXAMPLE8       (78)       /* DELETE               */
 #define CH7_MESSAGE_EXAMPLE9       (79)       /* ABORT                */
+#define CH7_MSGBUF_EXAMPLE1        (70)       /* 䳤Ϣ       */
 
 #define CH8_FLAGS_EXAMPLE1         (81)
 #define CH8_FLAGS_EXAMPLE2         (82)       /* KEY ISR              */
@@ -49,21 +54,36 @@
 #define CH8_FLAGS_EXAMPLE4         (84)       /* FLUSH                */
 #define CH8_FLAGS_EXAMPLE5         (85)       /* DELETE               */
 #define CH8_FLAGS_EXAMPLE6         (86)       /* ABORT                */
+#define CH8_WAITANY_EXAMPLE        (87)       /* ͬʱȴIPC  */
 
 #define CH9_TIMER_BASIC_EXAMPLE    (91)
 #define CH9_TIMER_CONFIG_EXAMPLE   (92)
 #define CH9_TIMER_LAGTICKS_EXAMPLE (93)
 #define CH9_TIMER_URGENT_EXAMPLE   (94)
+#define CH9_TIMER_STRESS_EXAMPLE   (95)
 
 #define CH10_IRQ_ISR_EXAMPLE       (101)      /* IRQ  ISR             */
 #define CH10_IRQ_ASR_EXAMPLE       (102)      /* IRQ  ASR             */
 #define CH10_IRQ_DAEMON_EXAMPLE    (103)      /* IRQ  DAEMON          */
+#define CH10_IRQ_CHANNEL_EXAMPLE   (104)      /* ISRдͨ    */
 
 #define CH11_MEMORY_POOL_EXAMPLE   (111)
 #define CH11_MEMORY_BUDDY_EXAMPLE  (112)
+#define CH11_MEMORY_TLSF_EXAMPLE   (113)
+#define CH11_MEMORY_SLAB_EXAMPLE   (114)
+#define CH11_MEMORY_HEAP_EXAMPLE   (115)
 
 #define CH13_BOARD_TEST_EXAMPLE    (131)
 
+/* Thread-Metric ܲԼ */
+#define BENCH_TM_COOPERATIVE          (201)
+#define BENCH_TM_PREEMPTIVE           (202)
+#define BENCH_TM_INTERRUPT            (203)
+#define BENCH_TM_INTERRUPT_PREEMPTION (204)
+#define BENCH_TM_MESSAGE              (205)
+#define BENCH_TM_SYNCHRONIZATION      (206)
+#define BENCH_TM_MEMORY               (207)
+
 
 
 #define EVB_EXAMPLE                CH2_THREAD_EXAMPLE5
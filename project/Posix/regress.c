@@ -0,0 +1,1517 @@
+/*************************************************************************************************
+ *                                     Trochili RTOS Kernel                                      *
+ *                                  Copyright(C) 2016 LIUXUMING                                  *
+ *                                       www.trochili.com                                        *
+ *************************************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "trochili.h"
+
+/* عԣmake checkɲСÿһ׳ںΪ
+   κμʧܶӡλòԷ0ֵ˳ */
+
+#define REGRESS_CHECK(cond) \
+    do { if (!(cond)) { printf("FAIL %s:%d %s\n", __FILE__, __LINE__, #cond); exit(1); } } while (0)
+
+#define REGRESS_STACK_BYTES    (2048)
+#define REGRESS_PRIORITY       (5)
+#define REGRESS_SLICE          (10)
+
+/* ع߳ */
+static TThread ThreadRegress;
+static TBase32 ThreadRegressStack[REGRESS_STACK_BYTES/4];
+
+/* ɾ߳ */
+#define WORKER_STACKS          (40)
+static TThread ThreadWorker;
+static TBase32 ThreadWorkerStack[WORKER_STACKS][REGRESS_STACK_BYTES/4];
+static volatile TBase32 WorkerRuns;
+
+
+static void ThreadWorkerEntry(TArgument arg)
+{
+    TError error;
+
+    WorkerRuns++;
+    TclDeactivateThread((TThread*)0, &error);
+}
+
+
+/* òͬ߳ջɾ̣߳߳ɾͷ */
+static void RegressThreadChurn(void)
+{
+    TState state;
+    TError error;
+    TIndex round;
+
+    WorkerRuns = 0U;
+    for (round = 0U; round < 2U * WORKER_STACKS; round++)
+    {
+        state = TclCreateThread(&ThreadWorker, &ThreadWorkerEntry, (TArgument)round,
+                                ThreadWorkerStack[round % WORKER_STACKS], REGRESS_STACK_BYTES,
+                                REGRESS_PRIORITY - 1, REGRESS_SLICE, &error);
+        REGRESS_CHECK(state == eSuccess);
+        state = TclActivateThread(&ThreadWorker, &error);
+        REGRESS_CHECK(state == eSuccess);
+        state = TclDeleteThread(&ThreadWorker, &error);
+        REGRESS_CHECK(state == eSuccess);
+    }
+    REGRESS_CHECK(WorkerRuns == 2U * WORKER_STACKS);
+}
+
+
+#if (TCLC_THREAD_NOTIFY_ENABLE)
+static volatile TBase32 NotifyValue;
+static volatile TError NotifyError;
+
+static void ThreadNotifyEntry(TArgument arg)
+{
+    TBase32 value;
+    TError error;
+
+    TclWaitNotify(~0U, &value, TCLO_NOTIFY_WAIT, 0U, &error);
+    NotifyError = error;
+    NotifyValue = value;
+    TclDeactivateThread((TThread*)0, &error);
+}
+
+
+/* ޵ȴ֪̲ܱͨ߳TclResumeThreadѣȴʱû֪ͨTCLE_THREAD_EMPTY */
+static void RegressNotifyWait(void)
+{
+    TState state;
+    TError error;
+    TBase32 value;
+
+    state = TclWaitNotify(~0U, &value, 0U, 0U, &error);
+    REGRESS_CHECK((state == eFailure) && (error == TCLE_THREAD_EMPTY));
+
+    NotifyValue = 0U;
+    NotifyError = TCLE_THREAD_FAULT;
+    state = TclCreateThread(&ThreadWorker, &ThreadNotifyEntry, (TArgument)0,
+                            ThreadWorkerStack[0], REGRESS_STACK_BYTES,
+                            REGRESS_PRIORITY - 1, REGRESS_SLICE, &error);
+    REGRESS_CHECK(state == eSuccess);
+    state = TclActivateThread(&ThreadWorker, &error);
+    REGRESS_CHECK(state == eSuccess);
+
+    state = TclResumeThread(&ThreadWorker, &error);
+    REGRESS_CHECK((state == eFailure) && (error == TCLE_THREAD_STATUS));
+    REGRESS_CHECK(NotifyError == TCLE_THREAD_FAULT);
+
+    state = TclNotifyThread(&ThreadWorker, 0x5AU, TCLO_NOTIFY_SET_BITS, &error);
+    REGRESS_CHECK(state == eSuccess);
+    REGRESS_CHECK((NotifyError == TCLE_THREAD_NONE) && (NotifyValue == 0x5AU));
+
+    state = TclDeleteThread(&ThreadWorker, &error);
+    REGRESS_CHECK(state == eSuccess);
+}
+#endif
+
+
+#if (TCLC_TIMER_ENABLE)
+#define WHEEL_TIMERS           (10)
+static TTimer RegressTimer[WHEEL_TIMERS + 1];
+static volatile TTimeTick TimerFired[WHEEL_TIMERS + 1];
+static volatile TBase32 TimerCount[WHEEL_TIMERS + 1];
+static volatile TBase32 TimerErrors;
+
+/* ʱڷֲڵһʱֺ漸ʱֵı߽࣬Ƕʱڸ֮ǨƵ */
+static const TTimeTick TimerTicks[WHEEL_TIMERS] =
+{
+    1U, 2U, 31U, 32U, 33U, 63U, 64U, 65U, 100U, 1030U
+};
+
+static void RegressTimerRoutine(TArgument data)
+{
+    TTimeTick jiffies;
+
+    TclGetTimeJiffies(&jiffies);
+    if ((TimerCount[data] != 0U) &&
+            (jiffies != TimerFired[data] + RegressTimer[data].PeriodTicks))
+    {
+        TimerErrors++;
+    }
+    TimerFired[data] = jiffies;
+    TimerCount[data]++;
+}
+
+
+/* ʱǡʱ̼϶ʱڵǸĵʱڶʱÿμͬ
+   ֹͣĶʱٵʱ */
+static void RegressTimerWheel(void)
+{
+    TState state;
+    TError error;
+    TTimeTick before[WHEEL_TIMERS + 1];
+    TTimeTick after[WHEEL_TIMERS + 1];
+    TIndex i;
+
+    TimerErrors = 0U;
+    for (i = 0U; i <= WHEEL_TIMERS; i++)
+    {
+        TimerCount[i] = 0U;
+        state = TclCreateTimer(&RegressTimer[i],
+                               (i == WHEEL_TIMERS) ? (TCLP_TIMER_PERIODIC | TCLP_TIMER_URGENT) :
+                               TCLP_TIMER_URGENT,
+                               (i == WHEEL_TIMERS) ? 33U : TimerTicks[i],
+                               &RegressTimerRoutine, (TArgument)i, &error);
+        REGRESS_CHECK(state == eSuccess);
+    }
+
+    /* ȡĺʱܷ֮ʱжϣʱʱֻζķΧ */
+    for (i = 0U; i <= WHEEL_TIMERS; i++)
+    {
+        TclGetTimeJiffies(&before[i]);
+        state = TclStartTimer(&RegressTimer[i], 0U, &error);
+        REGRESS_CHECK(state == eSuccess);
+        TclGetTimeJiffies(&after[i]);
+    }
+
+    /* ֹͣһûеʱĶʱ */
+    state = TclStopTimer(&RegressTimer[8], &error);
+    REGRESS_CHECK(state == eSuccess);
+
+    while (TimerCount[WHEEL_TIMERS - 1U] == 0U)
+    {
+        state = TclDelayThread((TThread*)0, TCLM_MLS2TICKS(100), &error);
+        REGRESS_CHECK(state == eSuccess);
+    }
+
+    for (i = 0U; i < WHEEL_TIMERS; i++)
+    {
+        if (i == 8U)
+        {
+            REGRESS_CHECK(TimerCount[i] == 0U);
+        }
+        else
+        {
+            REGRESS_CHECK(TimerCount[i] == 1U);
+            REGRESS_CHECK((TimerFired[i] >= before[i] + TimerTicks[i]) &&
+                          (TimerFired[i] <= after[i] + TimerTicks[i]));
+        }
+    }
+    REGRESS_CHECK((TimerCount[WHEEL_TIMERS] >= 30U) && (TimerErrors == 0U));
+
+    state = TclStopTimer(&RegressTimer[WHEEL_TIMERS], &error);
+    REGRESS_CHECK(state == eSuccess);
+    for (i = 0U; i <= WHEEL_TIMERS; i++)
+    {
+        state = TclDeleteTimer(&RegressTimer[i], &error);
+        REGRESS_CHECK(state == eSuccess);
+    }
+}
+#endif
+
+
+#if ((TCLC_IPC_ENABLE) && (TCLC_IPC_FLAGS_ENABLE))
+#define FLAGS_WAITERS          (3)
+static TFlags RegressFlags;
+static TThread ThreadFlags[FLAGS_WAITERS];
+static volatile TBase32 FlagsOrder[FLAGS_WAITERS];
+static volatile TBase32 FlagsWoken;
+
+static void ThreadFlagsEntry(TArgument arg)
+{
+    TError error;
+    TFlagMask pattern;
+
+    /* ȵ̵߳ȴŸ¼λ */
+    pattern = (TFlagMask)0x1 << (FLAGS_WAITERS - 1U - arg);
+    TclReceiveFlags(&RegressFlags, &pattern, TCLO_IPC_OR | TCLO_IPC_WAIT, 0U, &error);
+    FlagsOrder[FlagsWoken] = arg;
+    FlagsWoken++;
+    TclDeactivateThread((TThread*)0, &error);
+}
+
+
+/* FIFOʽ¼һ߳ʱ̵߳ĵ˳ѣǰ¼λ˳ */
+static void RegressFlagsOrder(void)
+{
+    TState state;
+    TError error;
+    TIndex i;
+
+    state = TclCreateFlags(&RegressFlags, TCLP_IPC_DUMMY, &error);
+    REGRESS_CHECK(state == eSuccess);
+
+    FlagsWoken = 0U;
+    for (i = 0U; i < FLAGS_WAITERS; i++)
+    {
+        state = TclCreateThread(&ThreadFlags[i], &ThreadFlagsEntry, (TArgument)i,
+                                ThreadWorkerStack[i], REGRESS_STACK_BYTES,
+                                REGRESS_PRIORITY - 1, REGRESS_SLICE, &error);
+        REGRESS_CHECK(state == eSuccess);
+        state = TclActivateThread(&ThreadFlags[i], &error);
+        REGRESS_CHECK(state == eSuccess);
+    }
+
+    state = TclSendFlags(&RegressFlags, ((TFlagMask)0x1 << FLAGS_WAITERS) - 1U, &error);
+    REGRESS_CHECK(state == eSuccess);
+    REGRESS_CHECK(FlagsWoken == FLAGS_WAITERS);
+    for (i = 0U; i < FLAGS_WAITERS; i++)
+    {
+        REGRESS_CHECK(FlagsOrder[i] == i);
+        state = TclDeleteThread(&ThreadFlags[i], &error);
+        REGRESS_CHECK(state == eSuccess);
+    }
+
+    state = TclDeleteFlags(&RegressFlags, &error);
+    REGRESS_CHECK(state == eSuccess);
+}
+
+
+/* ¼λ(64λ¼ʱǵ63λ)Ҳܱ͡ȴȡߣսдTFlagMask */
+static void ThreadFlagsHighEntry(TArgument arg)
+{
+    TError error;
+    TFlagMask pattern;
+
+    pattern = ((TFlagMask)0x1 << (FLAGS_BITS - 1U)) | (TFlagMask)0x1;
+    TclReceiveFlags(&RegressFlags, &pattern, TCLO_IPC_AND | TCLO_IPC_WAIT | TCLO_IPC_CONSUME,
+                    0U, &error);
+    FlagsOrder[0] = (pattern == (((TFlagMask)0x1 << (FLAGS_BITS - 1U)) | (TFlagMask)0x1));
+    FlagsWoken++;
+    TclDeactivateThread((TThread*)0, &error);
+}
+
+
+static void RegressFlagsHigh(void)
+{
+    TState state;
+    TError error;
+    TFlagMask pattern;
+
+    state = TclCreateFlags(&RegressFlags, TCLP_IPC_DUMMY, &error);
+    REGRESS_CHECK(state == eSuccess);
+
+    FlagsWoken = 0U;
+    FlagsOrder[0] = 0U;
+    state = TclCreateThread(&ThreadFlags[0], &ThreadFlagsHighEntry, (TArgument)0,
+                            ThreadWorkerStack[0], REGRESS_STACK_BYTES,
+                            REGRESS_PRIORITY - 1, REGRESS_SLICE, &error);
+    REGRESS_CHECK(state == eSuccess);
+    state = TclActivateThread(&ThreadFlags[0], &error);
+    REGRESS_CHECK(state == eSuccess);
+
+    state = TclSendFlags(&RegressFlags, (TFlagMask)0x1, &error);
+    REGRESS_CHECK((state == eSuccess) && (FlagsWoken == 0U));
+    state = TclSendFlags(&RegressFlags, (TFlagMask)0x1 << (FLAGS_BITS - 1U), &error);
+    REGRESS_CHECK((state == eSuccess) && (FlagsWoken == 1U) && (FlagsOrder[0] == 1U));
+
+    /* ¼Ѿȡ */
+    pattern = (TFlagMask)0x1 << (FLAGS_BITS - 1U);
+    state = TclReceiveFlags(&RegressFlags, &pattern, TCLO_IPC_OR, 0U, &error);
+    REGRESS_CHECK(state == eFailure);
+
+    state = TclDeleteThread(&ThreadFlags[0], &error);
+    REGRESS_CHECK(state == eSuccess);
+    state = TclDeleteFlags(&RegressFlags, &error);
+    REGRESS_CHECK(state == eSuccess);
+}
+#endif
+
+
+#if ((TCLC_IPC_ENABLE) && (TCLC_IPC_MUTEX_ENABLE))
+#define CHAIN_THREADS          (3)
+static TMutex RegressMutex[2];
+static TThread ThreadChain[CHAIN_THREADS];
+
+/* 0߳ռ0Ż1߳ռ1Żȴ0Ż2̵߳ȴ1Ż */
+static void ThreadChainEntry(TArgument arg)
+{
+    TError error;
+
+    if (arg > 0U)
+    {
+        TclLockMutex(&RegressMutex[1], TCLO_IPC_WAIT, 0U, &error);
+    }
+    if (arg < 2U)
+    {
+        TclLockMutex(&RegressMutex[0], TCLO_IPC_WAIT, 0U, &error);
+    }
+    if (arg == 0U)
+    {
+        TclDelayThread((TThread*)0, TCLM_MLS2TICKS(50), &error);
+    }
+    if (arg < 2U)
+    {
+        TclFreeMutex(&RegressMutex[0], &error);
+    }
+    if (arg > 0U)
+    {
+        TclFreeMutex(&RegressMutex[1], &error);
+    }
+    TclDeactivateThread((TThread*)0, &error);
+}
+
+
+/* ޸ڼ̳Э黥ϵ̵߳ȼµȼݣʱҲ */
+static void RegressMutexInherit(void)
+{
+    TState state;
+    TError error;
+    TIndex i;
+
+    for (i = 0U; i < 2U; i++)
+    {
+        state = TclCreateMutex(&RegressMutex[i], 0U, TCLP_IPC_INHERIT | TCLP_IPC_PREEMP_PRIMIQ,
+                               &error);
+        REGRESS_CHECK(state == eSuccess);
+    }
+
+    for (i = 0U; i < CHAIN_THREADS; i++)
+    {
+        state = TclCreateThread(&ThreadChain[i], &ThreadChainEntry, (TArgument)i,
+                                ThreadWorkerStack[i], REGRESS_STACK_BYTES,
+                                REGRESS_PRIORITY + 3 - i, REGRESS_SLICE, &error);
+        REGRESS_CHECK(state == eSuccess);
+        state = TclActivateThread(&ThreadChain[i], &error);
+        REGRESS_CHECK(state == eSuccess);
+        state = TclDelayThread((TThread*)0, TCLM_MLS2TICKS(10), &error);
+        REGRESS_CHECK(state == eSuccess);
+    }
+    REGRESS_CHECK(ThreadChain[0].Priority == REGRESS_PRIORITY + 1);
+
+    state = TclSetThreadPriority(&ThreadChain[2], REGRESS_PRIORITY - 1, &error);
+    REGRESS_CHECK(state == eSuccess);
+    REGRESS_CHECK(ThreadChain[1].Priority == REGRESS_PRIORITY - 1);
+    REGRESS_CHECK(ThreadChain[0].Priority == REGRESS_PRIORITY - 1);
+
+    state = TclSetThreadPriority(&ThreadChain[2], REGRESS_PRIORITY + 4, &error);
+    REGRESS_CHECK(state == eSuccess);
+    REGRESS_CHECK(ThreadChain[1].Priority == REGRESS_PRIORITY + 2);
+    REGRESS_CHECK(ThreadChain[0].Priority == REGRESS_PRIORITY + 2);
+
+    state = TclDelayThread((TThread*)0, TCLM_MLS2TICKS(100), &error);
+    REGRESS_CHECK(state == eSuccess);
+    for (i = 0U; i < CHAIN_THREADS; i++)
+    {
+        REGRESS_CHECK(ThreadChain[i].Priority == ThreadChain[i].BasePriority);
+        state = TclDeleteThread(&ThreadChain[i], &error);
+        REGRESS_CHECK(state == eSuccess);
+    }
+
+    for (i = 0U; i < 2U; i++)
+    {
+        state = TclDeleteMutex(&RegressMutex[i], &error);
+        REGRESS_CHECK(state == eSuccess);
+    }
+}
+
+
+#if (TCLC_IPC_CONDVAR_ENABLE)
+static TCondVar RegressCondVar;
+static volatile TBase32 CondStep;
+static volatile TBase32 CondOwnerRuns;
+static volatile TBase32 CondWaiterRuns;
+
+/* 0߳ռлһֱ1߳ϵȴ */
+static void ThreadCondEntry(TArgument arg)
+{
+    TError error;
+
+    TclLockMutex(&RegressMutex[0], TCLO_IPC_WAIT, 0U, &error);
+    if (arg == 0U)
+    {
+        while (CondStep == 0U)
+        {
+            ;
+        }
+        CondOwnerRuns++;
+    }
+    else
+    {
+        TclWaitCondVar(&RegressCondVar, &RegressMutex[0], TCLO_IPC_WAIT, 0U, &error);
+        CondWaiterRuns++;
+    }
+    TclFreeMutex(&RegressMutex[0], &error);
+    TclDeactivateThread((TThread*)0, &error);
+}
+
+
+/* ֪ͨʱȴ̱̳߳ȼľ̸֪̣߳ͨ߳ռ */
+static void RegressCondVarInherit(void)
+{
+    TState state;
+    TError error;
+    TIndex i;
+
+    state = TclCreateMutex(&RegressMutex[0], 0U, TCLP_IPC_INHERIT | TCLP_IPC_PREEMP_PRIMIQ,
+                           &error);
+    REGRESS_CHECK(state == eSuccess);
+    state = TclCreateCondVar(&RegressCondVar, TCLP_IPC_DUMMY, &error);
+    REGRESS_CHECK(state == eSuccess);
+
+    CondStep = 0U;
+    CondOwnerRuns = 0U;
+    CondWaiterRuns = 0U;
+    for (i = 0U; i < 2U; i++)
+    {
+        state = TclCreateThread(&ThreadChain[i], &ThreadCondEntry, (TArgument)i,
+                                ThreadWorkerStack[i], REGRESS_STACK_BYTES,
+                                (i == 0U) ? (REGRESS_PRIORITY + 1) : (REGRESS_PRIORITY - 1),
+                                REGRESS_SLICE, &error);
+        REGRESS_CHECK(state == eSuccess);
+    }
+
+    /* ȴ߳߳ռл󱻱߳ռ־ */
+    state = TclActivateThread(&ThreadChain[1], &error);
+    REGRESS_CHECK(state == eSuccess);
+    state = TclActivateThread(&ThreadChain[0], &error);
+    REGRESS_CHECK(state == eSuccess);
+    state = TclDelayThread((TThread*)0, TCLM_MLS2TICKS(10), &error);
+    REGRESS_CHECK(state == eSuccess);
+    REGRESS_CHECK(ThreadChain[0].Status == eThreadReady);
+
+    CondStep = 1U;
+    state = TclSignalCondVar(&RegressCondVar, &error);
+    REGRESS_CHECK(state == eSuccess);
+    REGRESS_CHECK((CondOwnerRuns == 1U) && (CondWaiterRuns == 1U));
+
+    /* ߳ͷŻָԭȼ˳֮ɾ */
+    state = TclDelayThread((TThread*)0, TCLM_MLS2TICKS(10), &error);
+    REGRESS_CHECK(state == eSuccess);
+    for (i = 0U; i < 2U; i++)
+    {
+        REGRESS_CHECK(ThreadChain[i].Priority == ThreadChain[i].BasePriority);
+        state = TclDeleteThread(&ThreadChain[i], &error);
+        REGRESS_CHECK(state == eSuccess);
+    }
+
+    state = TclDeleteCondVar(&RegressCondVar, &error);
+    REGRESS_CHECK(state == eSuccess);
+    state = TclDeleteMutex(&RegressMutex[0], &error);
+    REGRESS_CHECK(state == eSuccess);
+}
+
+static volatile TBase32 CondOrder[CHAIN_THREADS];
+static volatile TBase32 CondWoken;
+
+/* ϵȴʱ¼˳ԼǷռ˻ */
+static void ThreadCondWaitEntry(TArgument arg)
+{
+    TError error;
+    TState state;
+
+    TclLockMutex(&RegressMutex[0], TCLO_IPC_WAIT, 0U, &error);
+    state = TclWaitCondVar(&RegressCondVar, &RegressMutex[0], TCLO_IPC_WAIT, 0U, &error);
+    if ((state == eSuccess) && (RegressMutex[0].Owner == &ThreadChain[arg]))
+    {
+        CondOrder[CondWoken] = arg;
+        CondWoken++;
+    }
+    TclFreeMutex(&RegressMutex[0], &error);
+    TclDeactivateThread((TThread*)0, &error);
+}
+
+
+/* 㲥ʱȴ̰߳˳ת뻥У֪ͨͷŻ
+   ȴʱ̷߳ʱͬռл */
+static void RegressCondVarBroadcast(void)
+{
+    TState state;
+    TError error;
+    TIndex i;
+
+    state = TclCreateMutex(&RegressMutex[0], 0U, TCLP_IPC_INHERIT, &error);
+    REGRESS_CHECK(state == eSuccess);
+    state = TclCreateCondVar(&RegressCondVar, TCLP_IPC_DUMMY, &error);
+    REGRESS_CHECK(state == eSuccess);
+
+    state = TclSignalCondVar(&RegressCondVar, &error);
+    REGRESS_CHECK(state == eSuccess);
+    state = TclLockMutex(&RegressMutex[0], TCLO_IPC_WAIT, 0U, &error);
+    REGRESS_CHECK(state == eSuccess);
+    state = TclWaitCondVar(&RegressCondVar, &RegressMutex[0], TCLO_IPC_WAIT | TCLO_IPC_TIMED,
+                           2U, &error);
+    REGRESS_CHECK((state == eFailure) && (error == TCLE_IPC_TIMEO));
+    REGRESS_CHECK(RegressMutex[0].Owner == &ThreadRegress);
+    state = TclFreeMutex(&RegressMutex[0], &error);
+    REGRESS_CHECK(state == eSuccess);
+
+    CondWoken = 0U;
+    for (i = 0U; i < 2U; i++)
+    {
+        state = TclCreateThread(&ThreadChain[i], &ThreadCondWaitEntry, (TArgument)i,
+                                ThreadWorkerStack[i], REGRESS_STACK_BYTES,
+                                REGRESS_PRIORITY - 1, REGRESS_SLICE, &error);
+        REGRESS_CHECK(state == eSuccess);
+        state = TclActivateThread(&ThreadChain[i], &error);
+        REGRESS_CHECK(state == eSuccess);
+    }
+
+    state = TclLockMutex(&RegressMutex[0], TCLO_IPC_WAIT, 0U, &error);
+    REGRESS_CHECK(state == eSuccess);
+    state = TclBroadcastCondVar(&RegressCondVar, &error);
+    REGRESS_CHECK(state == eSuccess);
+    REGRESS_CHECK((CondWoken == 0U) && (ThreadChain[0].Status == eThreadBlocked) &&
+                  (ThreadChain[1].Status == eThreadBlocked));
+    state = TclFreeMutex(&RegressMutex[0], &error);
+    REGRESS_CHECK(state == eSuccess);
+    REGRESS_CHECK((CondWoken == 2U) && (CondOrder[0] == 0U) && (CondOrder[1] == 1U));
+
+    for (i = 0U; i < 2U; i++)
+    {
+        state = TclDeleteThread(&ThreadChain[i], &error);
+        REGRESS_CHECK(state == eSuccess);
+    }
+    state = TclDeleteCondVar(&RegressCondVar, &error);
+    REGRESS_CHECK(state == eSuccess);
+    state = TclDeleteMutex(&RegressMutex[0], &error);
+    REGRESS_CHECK(state == eSuccess);
+}
+#endif
+
+#if (TCLC_IPC_RWLOCK_ENABLE)
+static TRwLock RegressRw;
+static volatile TBase32 RwOrder[CHAIN_THREADS];
+static volatile TBase32 RwCount;
+static volatile TPriority RwWriterPriority;
+
+/* 0߳д1߳¼Ⱥ˳ */
+static void ThreadRwEntry(TArgument arg)
+{
+    TError error;
+    TState state;
+
+    if (arg == 0U)
+    {
+        state = TclLockRwWrite(&RegressRw, TCLO_IPC_WAIT, 0U, &error);
+        RwWriterPriority = ThreadChain[0].Priority;
+    }
+    else
+    {
+        state = TclLockRwRead(&RegressRw, TCLO_IPC_WAIT, 0U, &error);
+    }
+    if (state == eSuccess)
+    {
+        RwOrder[RwCount] = arg;
+        RwCount++;
+        TclFreeRwLock(&RegressRw, &error);
+    }
+    TclDeactivateThread((TThread*)0, &error);
+}
+
+
+/* дȲдߵȴʱµĶҲҪȴд컨ȼ
+   ֱΪдǶ׵дܽ */
+static void RegressRwLock(void)
+{
+    TState state;
+    TError error;
+    TIndex i;
+
+    state = TclCreateRwLock(&RegressRw, REGRESS_PRIORITY - 2, TCLP_IPC_WRITER_PREF, &error);
+    REGRESS_CHECK(state == eSuccess);
+
+    RwCount = 0U;
+    state = TclLockRwRead(&RegressRw, TCLO_IPC_WAIT, 0U, &error);
+    REGRESS_CHECK(state == eSuccess);
+    for (i = 0U; i < 2U; i++)
+    {
+        state = TclCreateThread(&ThreadChain[i], &ThreadRwEntry, (TArgument)i,
+                                ThreadWorkerStack[i + 1U], REGRESS_STACK_BYTES,
+                                REGRESS_PRIORITY - 1, REGRESS_SLICE, &error);
+        REGRESS_CHECK(state == eSuccess);
+        state = TclActivateThread(&ThreadChain[i], &error);
+        REGRESS_CHECK(state == eSuccess);
+        REGRESS_CHECK(ThreadChain[i].Status == eThreadBlocked);
+    }
+
+    state = TclFreeRwLock(&RegressRw, &error);
+    REGRESS_CHECK(state == eSuccess);
+    REGRESS_CHECK((RwCount == 2U) && (RwOrder[0] == 0U) && (RwOrder[1] == 1U));
+    REGRESS_CHECK(RwWriterPriority == REGRESS_PRIORITY - 2);
+    REGRESS_CHECK(ThreadChain[0].Priority == REGRESS_PRIORITY - 1);
+
+    state = TclLockRwRead(&RegressRw, TCLO_IPC_WAIT, 0U, &error);
+    REGRESS_CHECK(state == eSuccess);
+    state = TclUpgradeRwLock(&RegressRw, TCLO_IPC_WAIT, 0U, &error);
+    REGRESS_CHECK((state == eSuccess) && (ThreadRegress.Priority == REGRESS_PRIORITY - 2));
+    state = TclLockRwRead(&RegressRw, TCLO_IPC_WAIT, 0U, &error);
+    REGRESS_CHECK((state == eFailure) && (error == TCLE_IPC_FORBIDDEN));
+    state = TclLockRwWrite(&RegressRw, TCLO_IPC_WAIT, 0U, &error);
+    REGRESS_CHECK(state == eSuccess);
+    state = TclDowngradeRwLock(&RegressRw, &error);
+    REGRESS_CHECK((state == eFailure) && (error == TCLE_IPC_FORBIDDEN));
+    state = TclFreeRwLock(&RegressRw, &error);
+    REGRESS_CHECK(state == eSuccess);
+    state = TclDowngradeRwLock(&RegressRw, &error);
+    REGRESS_CHECK(state == eSuccess);
+    REGRESS_CHECK((ThreadRegress.Priority == REGRESS_PRIORITY) && (RegressRw.Readers == 1U));
+    state = TclFreeRwLock(&RegressRw, &error);
+    REGRESS_CHECK((state == eSuccess) && (RegressRw.Readers == 0U));
+
+    for (i = 0U; i < 2U; i++)
+    {
+        state = TclDeleteThread(&ThreadChain[i], &error);
+        REGRESS_CHECK(state == eSuccess);
+    }
+    state = TclDeleteRwLock(&RegressRw, &error);
+    REGRESS_CHECK(state == eSuccess);
+}
+#endif
+
+#endif
+
+
+#if ((TCLC_IPC_ENABLE) && (TCLC_IPC_BARRIER_ENABLE))
+#define BARRIER_THREADS        (2)
+static TBarrier RegressBarrier;
+static TThread ThreadBarrier[BARRIER_THREADS];
+static volatile TBase32 BarrierRounds[BARRIER_THREADS];
+static volatile TError BarrierError[BARRIER_THREADS];
+static volatile TTimeTick BarrierTimeo;
+
+/* ϻ֣BarrierTimeoΪ0ʱֻһʱ޵ȴ */
+static void ThreadBarrierEntry(TArgument arg)
+{
+    TError error;
+    TState state;
+    TIndex round;
+
+    for (round = 0U; round < 2U; round++)
+    {
+        if (BarrierTimeo > 0U)
+        {
+            state = TclWaitBarrier(&RegressBarrier, TCLO_IPC_WAIT | TCLO_IPC_TIMED, BarrierTimeo,
+                                   &error);
+        }
+        else
+        {
+            state = TclWaitBarrier(&RegressBarrier, TCLO_IPC_WAIT, 0U, &error);
+        }
+        BarrierError[arg] = error;
+        if (state != eSuccess)
+        {
+            break;
+        }
+        BarrierRounds[arg]++;
+    }
+    TclDeactivateThread((TThread*)0, &error);
+}
+
+
+static void StartBarrierThreads(TBase32 number, TTimeTick timeo)
+{
+    TState state;
+    TError error;
+    TIndex i;
+
+    BarrierTimeo = timeo;
+    for (i = 0U; i < number; i++)
+    {
+        BarrierRounds[i] = 0U;
+        BarrierError[i] = TCLE_IPC_FAULT;
+        state = TclCreateThread(&ThreadBarrier[i], &ThreadBarrierEntry, (TArgument)i,
+                                ThreadWorkerStack[i], REGRESS_STACK_BYTES,
+                                REGRESS_PRIORITY - 1, REGRESS_SLICE, &error);
+        REGRESS_CHECK(state == eSuccess);
+        state = TclActivateThread(&ThreadBarrier[i], &error);
+        REGRESS_CHECK(state == eSuccess);
+    }
+}
+
+
+static void StopBarrierThreads(TBase32 number)
+{
+    TState state;
+    TError error;
+    TIndex i;
+
+    for (i = 0U; i < number; i++)
+    {
+        state = TclDeleteThread(&ThreadBarrier[i], &error);
+        REGRESS_CHECK(state == eSuccess);
+    }
+}
+
+
+/* 󵽴̲߳ѱọ̈̄߳ʱ̲߳뵽Ŀλʹȴ߳ʧܷ */
+static void RegressBarrierWait(void)
+{
+    TState state;
+    TError error;
+    TIndex i;
+
+    state = TclCreateBarrier(&RegressBarrier, BARRIER_THREADS + 1U, TCLP_IPC_DUMMY, &error);
+    REGRESS_CHECK(state == eSuccess);
+
+    StartBarrierThreads(BARRIER_THREADS, 0U);
+    for (i = 0U; i < 2U; i++)
+    {
+        REGRESS_CHECK(RegressBarrier.Arrived == BARRIER_THREADS);
+        state = TclWaitBarrier(&RegressBarrier, TCLO_IPC_WAIT, 0U, &error);
+        REGRESS_CHECK(state == eSuccess);
+    }
+    for (i = 0U; i < BARRIER_THREADS; i++)
+    {
+        REGRESS_CHECK((BarrierRounds[i] == 2U) && (BarrierError[i] == TCLE_IPC_NONE));
+    }
+    REGRESS_CHECK(RegressBarrier.Arrived == 0U);
+    StopBarrierThreads(BARRIER_THREADS);
+
+    StartBarrierThreads(1U, 2U);
+    state = TclDelayThread((TThread*)0, TCLM_MLS2TICKS(50), &error);
+    REGRESS_CHECK(state == eSuccess);
+    REGRESS_CHECK((BarrierError[0] == TCLE_IPC_TIMEO) && (RegressBarrier.Arrived == 0U));
+    StopBarrierThreads(1U);
+
+    StartBarrierThreads(1U, 0U);
+    state = TclResetBarrier(&RegressBarrier, &error);
+    REGRESS_CHECK(state == eSuccess);
+    REGRESS_CHECK((BarrierError[0] == TCLE_IPC_RESET) && (RegressBarrier.Arrived == 0U));
+    StopBarrierThreads(1U);
+
+    state = TclDeleteBarrier(&RegressBarrier, &error);
+    REGRESS_CHECK(state == eSuccess);
+}
+#endif
+
+
+#if ((TCLC_IPC_ENABLE) && (TCLC_IPC_MSGBUF_ENABLE))
+#define MSGBUF_BYTES           (64U)
+static TMsgBuffer RegressMsgBuf;
+static TBase32 RegressMsgBufData[MSGBUF_BYTES / 4];
+static volatile TBase32 MsgBufLength;
+
+static void ThreadMsgBufEntry(TArgument arg)
+{
+    TError error;
+    TState state;
+    void* pAddr;
+    TBase32 length;
+
+    if (arg == 0U)
+    {
+        /* ռ䲻ʱʱռѾԤ */
+        state = TclReserveMsgBuffer(&RegressMsgBuf, 16U, &pAddr, TCLO_IPC_WAIT, 0U, &error);
+        if (state == eSuccess)
+        {
+            memset(pAddr, 0xA5, 16U);
+            TclCommitMsgBuffer(&RegressMsgBuf, 16U, &error);
+        }
+    }
+    else
+    {
+        /* ûм¼ʱʱ¼ͳѾȡ */
+        state = TclPeekMsgBuffer(&RegressMsgBuf, &pAddr, &length, TCLO_IPC_WAIT, 0U, &error);
+        if (state == eSuccess)
+        {
+            MsgBufLength = length;
+            TclReleaseMsgBuffer(&RegressMsgBuf, &error);
+        }
+    }
+    TclDeactivateThread((TThread*)0, &error);
+}
+
+
+/* ¼Ų»βʱƵʼλãд̺߳Ͷ̱߳ʱѾԤȡ */
+static void RegressMsgBuffer(void)
+{
+    TState state;
+    TError error;
+    TBase32 length;
+    void* pAddr;
+    void* pWrap;
+    TIndex i;
+
+    state = TclCreateMsgBuffer(&RegressMsgBuf, (void*)RegressMsgBufData, MSGBUF_BYTES,
+                               TCLP_IPC_DUMMY, &error);
+    REGRESS_CHECK(state == eSuccess);
+
+    /* ύĳȿСԤĳ */
+    state = TclReserveMsgBuffer(&RegressMsgBuf, 20U, &pAddr, 0U, 0U, &error);
+    REGRESS_CHECK(state == eSuccess);
+    state = TclCommitMsgBuffer(&RegressMsgBuf, 10U, &error);
+    REGRESS_CHECK(state == eSuccess);
+    state = TclPeekMsgBuffer(&RegressMsgBuf, &pWrap, &length, 0U, 0U, &error);
+    REGRESS_CHECK((state == eSuccess) && (pWrap == pAddr) && (length == 10U));
+    state = TclReleaseMsgBuffer(&RegressMsgBuf, &error);
+    REGRESS_CHECK(state == eSuccess);
+
+    /* 28ֽڵļ¼֮βֻʣ8ֽڣ¼Ƶʼλ */
+    for (i = 0U; i < 2U; i++)
+    {
+        state = TclReserveMsgBuffer(&RegressMsgBuf, 24U, &pAddr, 0U, 0U, &error);
+        REGRESS_CHECK(state == eSuccess);
+        memset(pAddr, (int)i, 24U);
+        state = TclCommitMsgBuffer(&RegressMsgBuf, 24U, &error);
+        REGRESS_CHECK(state == eSuccess);
+    }
+    state = TclReserveMsgBuffer(&RegressMsgBuf, 20U, &pAddr, 0U, 0U, &error);
+    REGRESS_CHECK((state == eFailure) && (error == TCLE_IPC_INVALID_STATUS));
+    state = TclPeekMsgBuffer(&RegressMsgBuf, &pAddr, &length, 0U, 0U, &error);
+    REGRESS_CHECK((state == eSuccess) && (length == 24U) && (*(TByte*)pAddr == 0U));
+    state = TclReleaseMsgBuffer(&RegressMsgBuf, &error);
+    REGRESS_CHECK(state == eSuccess);
+
+    state = TclReserveMsgBuffer(&RegressMsgBuf, 20U, &pWrap, 0U, 0U, &error);
+    REGRESS_CHECK((state == eSuccess) && (pWrap == (void*)(&RegressMsgBufData[1])));
+    state = TclCommitMsgBuffer(&RegressMsgBuf, 20U, &error);
+    REGRESS_CHECK(state == eSuccess);
+
+    state = TclPeekMsgBuffer(&RegressMsgBuf, &pAddr, &length, 0U, 0U, &error);
+    REGRESS_CHECK((state == eSuccess) && (length == 24U) && (*(TByte*)pAddr == 1U));
+    state = TclReleaseMsgBuffer(&RegressMsgBuf, &error);
+    REGRESS_CHECK(state == eSuccess);
+    state = TclPeekMsgBuffer(&RegressMsgBuf, &pAddr, &length, 0U, 0U, &error);
+    REGRESS_CHECK((state == eSuccess) && (length == 20U) && (pAddr == pWrap));
+    state = TclReleaseMsgBuffer(&RegressMsgBuf, &error);
+    REGRESS_CHECK(state == eSuccess);
+    REGRESS_CHECK((RegressMsgBuf.Used == 0U) && (RegressMsgBuf.Entries == 0U));
+
+    /* ļ¼Զ޷ */
+    state = TclReserveMsgBuffer(&RegressMsgBuf, MSGBUF_BYTES, &pAddr, TCLO_IPC_WAIT, 0U, &error);
+    REGRESS_CHECK((state == eFailure) && (error == TCLE_IPC_INVALID_VALUE));
+
+    /* ʱд߳ͷż¼ʱͷߴԤռ */
+    state = TclReserveMsgBuffer(&RegressMsgBuf, MSGBUF_BYTES - 4U, &pAddr, 0U, 0U, &error);
+    REGRESS_CHECK(state == eSuccess);
+    state = TclCommitMsgBuffer(&RegressMsgBuf, MSGBUF_BYTES - 4U, &error);
+    REGRESS_CHECK(state == eSuccess);
+
+    state = TclCreateThread(&ThreadWorker, &ThreadMsgBufEntry, (TArgument)0,
+                            ThreadWorkerStack[0], REGRESS_STACK_BYTES,
+                            REGRESS_PRIORITY - 1, REGRESS_SLICE, &error);
+    REGRESS_CHECK(state == eSuccess);
+    state = TclActivateThread(&ThreadWorker, &error);
+    REGRESS_CHECK(state == eSuccess);
+    REGRESS_CHECK(ThreadWorker.Status == eThreadBlocked);
+
+    state = TclPeekMsgBuffer(&RegressMsgBuf, &pAddr, &length, 0U, 0U, &error);
+    REGRESS_CHECK(state == eSuccess);
+    state = TclReleaseMsgBuffer(&RegressMsgBuf, &error);
+    REGRESS_CHECK(state == eSuccess);
+    state = TclPeekMsgBuffer(&RegressMsgBuf, &pAddr, &length, 0U, 0U, &error);
+    REGRESS_CHECK((state == eSuccess) && (length == 16U) && (*(TByte*)pAddr == 0xA5U));
+    state = TclReleaseMsgBuffer(&RegressMsgBuf, &error);
+    REGRESS_CHECK(state == eSuccess);
+    state = TclDeleteThread(&ThreadWorker, &error);
+    REGRESS_CHECK(state == eSuccess);
+
+    /* ʱ߳ύ¼ʱύߴȡü¼ */
+    MsgBufLength = 0U;
+    state = TclCreateThread(&ThreadWorker, &ThreadMsgBufEntry, (TArgument)1,
+                            ThreadWorkerStack[0], REGRESS_STACK_BYTES,
+                            REGRESS_PRIORITY - 1, REGRESS_SLICE, &error);
+    REGRESS_CHECK(state == eSuccess);
+    state = TclActivateThread(&ThreadWorker, &error);
+    REGRESS_CHECK(state == eSuccess);
+    REGRESS_CHECK(ThreadWorker.Status == eThreadBlocked);
+
+    state = TclReserveMsgBuffer(&RegressMsgBuf, 8U, &pAddr, 0U, 0U, &error);
+    REGRESS_CHECK(state == eSuccess);
+    state = TclCommitMsgBuffer(&RegressMsgBuf, 5U, &error);
+    REGRESS_CHECK(state == eSuccess);
+    REGRESS_CHECK((MsgBufLength == 5U) && (RegressMsgBuf.Entries == 0U));
+    state = TclDeleteThread(&ThreadWorker, &error);
+    REGRESS_CHECK(state == eSuccess);
+
+    state = TclDeleteMsgBuffer(&RegressMsgBuf, &error);
+    REGRESS_CHECK(state == eSuccess);
+}
+#endif
+
+
+#if ((TCLC_IPC_ENABLE) && (TCLC_IPC_MQUE_ENABLE))
+#define MQ_CAPACITY            (4)
+static TMsgQueue RegressMQ;
+static void* RegressMQPool[MQ_CAPACITY * TCLC_IPC_MQUE_LEVELS];
+static TMessage MQGot[8];
+static volatile TBase32 MQGotCount;
+
+static void ThreadMQEntry(TArgument arg)
+{
+    TError error;
+    TBase32 got;
+
+    TclReceiveMessages(&RegressMQ, MQGot, 8U, &got, TCLO_IPC_WAIT, 0U, &error);
+    MQGotCount = got;
+    TclDeactivateThread((TThread*)0, &error);
+}
+
+
+/* շڶʱֻܴĲ֣Ḻ̌߳һϢʱһȡȫϢ */
+static void RegressMQBatch(void)
+{
+    TState state;
+    TError error;
+    TMessage msgs[6];
+    TMessage got[8];
+    TBase32 count;
+    TIndex i;
+
+    state = TclCreateMsgQueue(&RegressMQ, RegressMQPool, MQ_CAPACITY, TCLP_IPC_DUMMY, &error);
+    REGRESS_CHECK(state == eSuccess);
+    for (i = 0U; i < 6U; i++)
+    {
+        msgs[i] = (TMessage)(TAddr)(i + 1U);
+    }
+
+    state = TclSendMessages(&RegressMQ, msgs, 6U, &count, 0U, 0U, &error);
+    REGRESS_CHECK((state == eSuccess) && (count == MQ_CAPACITY));
+    state = TclSendMessages(&RegressMQ, msgs, 6U, &count, 0U, 0U, &error);
+    REGRESS_CHECK((state == eFailure) && (count == 0U));
+
+    state = TclReceiveMessages(&RegressMQ, got, 3U, &count, 0U, 0U, &error);
+    REGRESS_CHECK((state == eSuccess) && (count == 3U));
+    state = TclReceiveMessages(&RegressMQ, &got[3], 8U, &count, 0U, 0U, &error);
+    REGRESS_CHECK((state == eSuccess) && (count == 1U));
+    for (i = 0U; i < MQ_CAPACITY; i++)
+    {
+        REGRESS_CHECK(got[i] == msgs[i]);
+    }
+    state = TclReceiveMessages(&RegressMQ, got, 8U, &count, 0U, 0U, &error);
+    REGRESS_CHECK((state == eFailure) && (count == 0U));
+
+    MQGotCount = 0U;
+    state = TclCreateThread(&ThreadWorker, &ThreadMQEntry, (TArgument)0,
+                            ThreadWorkerStack[0], REGRESS_STACK_BYTES,
+                            REGRESS_PRIORITY - 1, REGRESS_SLICE, &error);
+    REGRESS_CHECK(state == eSuccess);
+    state = TclActivateThread(&ThreadWorker, &error);
+    REGRESS_CHECK(state == eSuccess);
+
+    state = TclSendMessages(&RegressMQ, msgs, 3U, &count, TCLO_IPC_WAIT, 0U, &error);
+    REGRESS_CHECK((state == eSuccess) && (count == 3U));
+    REGRESS_CHECK(MQGotCount == 3U);
+    for (i = 0U; i < 3U; i++)
+    {
+        REGRESS_CHECK(MQGot[i] == msgs[i]);
+    }
+
+    state = TclDeleteThread(&ThreadWorker, &error);
+    REGRESS_CHECK(state == eSuccess);
+    state = TclDeleteMsgQueue(&RegressMQ, &error);
+    REGRESS_CHECK(state == eSuccess);
+}
+#endif
+
+
+#if ((TCLC_IPC_ENABLE) && (TCLC_IPC_CHANNEL_ENABLE))
+#define CHANNEL_CAPACITY       (4U)
+static TChannel RegressChannel;
+static TBase32 RegressChannelRing[CHANNEL_CAPACITY][2];
+static TBase32 ChannelItem[2];
+static volatile TError ChannelError;
+
+static void ThreadChannelEntry(TArgument arg)
+{
+    TError error;
+
+    TclReadChannel(&RegressChannel, (void*)ChannelItem, TCLO_IPC_WAIT, 0U, &error);
+    ChannelError = error;
+    TclDeactivateThread((TThread*)0, &error);
+}
+
+
+/* ͨʱдʧܶԪذд˳߱д뻽ѺԪ */
+static void RegressChannelRead(void)
+{
+    TState state;
+    TError error;
+    TBase32 item[2];
+    TBase32 expect = 0U;
+    TIndex i;
+
+    state = TclCreateChannel(&RegressChannel, (void*)RegressChannelRing, CHANNEL_CAPACITY,
+                             sizeof(item), &error);
+    REGRESS_CHECK(state == eSuccess);
+
+    /* дֶдǼƵʼλõ */
+    for (i = 0U; i < 3U * CHANNEL_CAPACITY; i++)
+    {
+        item[0] = i;
+        item[1] = ~i;
+        state = TclWriteChannel(&RegressChannel, (void*)item, &error);
+        REGRESS_CHECK(state == eSuccess);
+        if ((i % CHANNEL_CAPACITY) == (CHANNEL_CAPACITY - 1U))
+        {
+            state = TclWriteChannel(&RegressChannel, (void*)item, &error);
+            REGRESS_CHECK((state == eFailure) && (error == TCLE_IPC_INVALID_STATUS));
+            while (TclReadChannel(&RegressChannel, (void*)item, 0U, 0U, &error) == eSuccess)
+            {
+                REGRESS_CHECK((item[0] == expect) && (item[1] == ~expect));
+                expect++;
+            }
+            REGRESS_CHECK(error == TCLE_IPC_INVALID_STATUS);
+        }
+    }
+    REGRESS_CHECK(expect == 3U * CHANNEL_CAPACITY);
+
+    state = TclReadChannel(&RegressChannel, (void*)item, TCLO_IPC_WAIT | TCLO_IPC_TIMED, 2U,
+                           &error);
+    REGRESS_CHECK((state == eFailure) && (error == TCLE_IPC_TIMEO));
+    REGRESS_CHECK(RegressChannel.Waiting == eFalse);
+
+    ChannelError = TCLE_IPC_FAULT;
+    state = TclCreateThread(&ThreadWorker, &ThreadChannelEntry, (TArgument)0,
+                            ThreadWorkerStack[0], REGRESS_STACK_BYTES,
+                            REGRESS_PRIORITY - 1, REGRESS_SLICE, &error);
+    REGRESS_CHECK(state == eSuccess);
+    state = TclActivateThread(&ThreadWorker, &error);
+    REGRESS_CHECK(state == eSuccess);
+    REGRESS_CHECK((ThreadWorker.Status == eThreadBlocked) && (RegressChannel.Waiting == eTrue));
+
+    item[0] = 0x5AU;
+    item[1] = 0xA5U;
+    state = TclWriteChannel(&RegressChannel, (void*)item, &error);
+    REGRESS_CHECK(state == eSuccess);
+    REGRESS_CHECK((ChannelError == TCLE_IPC_NONE) && (ChannelItem[0] == 0x5AU) &&
+                  (ChannelItem[1] == 0xA5U));
+    REGRESS_CHECK((RegressChannel.Waiting == eFalse) &&
+                  (RegressChannel.Head == RegressChannel.Tail));
+
+    state = TclDeleteThread(&ThreadWorker, &error);
+    REGRESS_CHECK(state == eSuccess);
+    state = TclDeleteChannel(&RegressChannel, &error);
+    REGRESS_CHECK(state == eSuccess);
+}
+#endif
+
+
+#if ((TCLC_IPC_ENABLE) && (TCLC_IPC_WAITANY_ENABLE) && (TCLC_IPC_SEMAPHORE_ENABLE) && \
+     (TCLC_IPC_MQUE_ENABLE) && (TCLC_IPC_FLAGS_ENABLE))
+static TSemaphore AnySemaphore;
+static TMsgQueue AnyMQ;
+static void* AnyMQPool[2 * TCLC_IPC_MQUE_LEVELS];
+static TFlags AnyFlags;
+static TIpcWaitItem AnyItems[3];
+static TMessage AnyMessage;
+static TFlagMask AnyPattern;
+static volatile TIndex AnyIndex;
+static volatile TError AnyError;
+
+static void SetupAnyItems(void)
+{
+    AnyItems[0].Type   = eWaitSemaphore;
+    AnyItems[0].Object = (void*)(&AnySemaphore);
+    AnyItems[0].Data   = (void*)0;
+    AnyItems[0].Option = TCLO_IPC_DUMMY;
+
+    AnyItems[1].Type   = eWaitMsgQueue;
+    AnyItems[1].Object = (void*)(&AnyMQ);
+    AnyItems[1].Data   = (void*)(&AnyMessage);
+    AnyItems[1].Option = TCLO_IPC_DUMMY;
+
+    AnyItems[2].Type   = eWaitFlags;
+    AnyItems[2].Object = (void*)(&AnyFlags);
+    AnyItems[2].Data   = (void*)(&AnyPattern);
+    AnyItems[2].Option = TCLO_IPC_OR | TCLO_IPC_CONSUME;
+
+    AnyPattern = 0x6U;
+    AnyMessage = (TMessage)0;
+}
+
+
+static void ThreadAnyEntry(TArgument arg)
+{
+    TError error;
+    TIndex index = 0xFFU;
+
+    TclWaitAny(AnyItems, 3U, &index, TCLO_IPC_WAIT, 0U, &error);
+    AnyIndex = index;
+    AnyError = error;
+    TclDeactivateThread((TThread*)0, &error);
+}
+
+
+/* ѾĶ˳̽գ̱߳һѺ뿪ȫ */
+static void RegressWaitAny(void)
+{
+    TState state;
+    TError error;
+    TMessage msg = (TMessage)(TAddr)0x5AU;
+    TIndex index = 0xFFU;
+
+    state = TclCreateSemaphore(&AnySemaphore, 0U, 1U, TCLP_IPC_DUMMY, &error);
+    REGRESS_CHECK(state == eSuccess);
+    state = TclCreateMsgQueue(&AnyMQ, AnyMQPool, 2U, TCLP_IPC_DUMMY, &error);
+    REGRESS_CHECK(state == eSuccess);
+    state = TclCreateFlags(&AnyFlags, TCLP_IPC_DUMMY, &error);
+    REGRESS_CHECK(state == eSuccess);
+
+    SetupAnyItems();
+    state = TclSendMessage(&AnyMQ, &msg, 0U, 0U, &error);
+    REGRESS_CHECK(state == eSuccess);
+    state = TclWaitAny(AnyItems, 3U, &index, TCLO_IPC_WAIT, 0U, &error);
+    REGRESS_CHECK((state == eSuccess) && (index == 1U) && (AnyMessage == msg));
+
+    SetupAnyItems();
+    state = TclWaitAny(AnyItems, 3U, &index, TCLO_IPC_WAIT | TCLO_IPC_TIMED, 2U, &error);
+    REGRESS_CHECK((state == eFailure) && (error == TCLE_IPC_TIMEO));
+
+    SetupAnyItems();
+    AnyIndex = 0xFFU;
+    AnyError = TCLE_IPC_FAULT;
+    state = TclCreateThread(&ThreadWorker, &ThreadAnyEntry, (TArgument)0,
+                            ThreadWorkerStack[0], REGRESS_STACK_BYTES,
+                            REGRESS_PRIORITY - 1, REGRESS_SLICE, &error);
+    REGRESS_CHECK(state == eSuccess);
+    state = TclActivateThread(&ThreadWorker, &error);
+    REGRESS_CHECK(state == eSuccess);
+    REGRESS_CHECK(ThreadWorker.Status == eThreadBlocked);
+
+    state = TclSendFlags(&AnyFlags, 0x4U, &error);
+    REGRESS_CHECK(state == eSuccess);
+    REGRESS_CHECK((AnyIndex == 2U) && (AnyError == TCLE_IPC_NONE) && (AnyPattern == 0x4U));
+
+    /* ѵ߳Ѿ뿪УźϢڶ */
+    state = TclReleaseSemaphore(&AnySemaphore, 0U, 0U, &error);
+    REGRESS_CHECK((state == eSuccess) && (AnySemaphore.Value == 1U));
+    state = TclSendMessage(&AnyMQ, &msg, 0U, 0U, &error);
+    REGRESS_CHECK(state == eSuccess);
+    state = TclReceiveMessage(&AnyMQ, &AnyMessage, 0U, 0U, &error);
+    REGRESS_CHECK((state == eSuccess) && (AnyMessage == msg));
+
+    state = TclDeleteThread(&ThreadWorker, &error);
+    REGRESS_CHECK(state == eSuccess);
+    state = TclDeleteFlags(&AnyFlags, &error);
+    REGRESS_CHECK(state == eSuccess);
+    state = TclDeleteMsgQueue(&AnyMQ, &error);
+    REGRESS_CHECK(state == eSuccess);
+    state = TclDeleteSemaphore(&AnySemaphore, &error);
+    REGRESS_CHECK(state == eSuccess);
+}
+#endif
+
+
+#if ((TCLC_MEMORY_ENABLE) && (TCLC_MEMORY_SLAB_ENABLE) && \
+     (TCLC_MEMORY_POOL_ENABLE) && (TCLC_MEMORY_BUDDY_ENABLE))
+#define BUDDY_PAGE_SIZE        (512)
+#define BUDDY_PAGES            (128)
+static TMemBuddy RegressBuddy;
+static TBase32 RegressBuddyData[BUDDY_PAGES * BUDDY_PAGE_SIZE / 4];
+static TByte RegressBuddyTags[BUDDY_PAGES];
+
+/* ڴҳǱڵṩУռڴȫڴҳΪһڴ */
+static void RegressBuddyCapacity(void)
+{
+    TState state;
+    TError error;
+    void* pAddr;
+
+    state = TclCreateMemBuddy(&RegressBuddy, (TChar*)RegressBuddyData, BUDDY_PAGES,
+                              BUDDY_PAGE_SIZE, RegressBuddyTags, &error);
+    REGRESS_CHECK(state == eSuccess);
+    state = TclMallocBuddyMem(&RegressBuddy, BUDDY_PAGES * BUDDY_PAGE_SIZE, &pAddr, &error);
+    REGRESS_CHECK((state == eSuccess) && (pAddr == (void*)RegressBuddyData));
+    state = TclFreeBuddyMem(&RegressBuddy, pAddr, &error);
+    REGRESS_CHECK(state == eSuccess);
+    state = TclDeleteMemBuddy(&RegressBuddy, &error);
+    REGRESS_CHECK(state == eSuccess);
+}
+
+
+/* ̵̬߳Ĵɾֻһ߳ͬʱ */
+static void RegressDynamicThread(void)
+{
+    TState state;
+    TError error;
+    TIndex round;
+    TMemSlab cache = {0};
+    TThread* pThread;
+
+    state = TclCreateMemBuddy(&RegressBuddy, (TChar*)RegressBuddyData, BUDDY_PAGES,
+                              BUDDY_PAGE_SIZE, RegressBuddyTags, &error);
+    REGRESS_CHECK(state == eSuccess);
+    state = TclCreateSlabCache(&cache, TCLM_THREAD_OBJ_BYTES(REGRESS_STACK_BYTES), 2U,
+                               (TMemPool*)0, &RegressBuddy, (TSlabCtor)0, (TSlabDtor)0, &error);
+    REGRESS_CHECK(state == eSuccess);
+
+    WorkerRuns = 0U;
+    for (round = 0U; round < 60U; round++)
+    {
+        state = TclCreateThreadDynamic(&cache, &pThread, &ThreadWorkerEntry, (TArgument)round,
+                                       REGRESS_PRIORITY - 1, REGRESS_SLICE, &error);
+        REGRESS_CHECK(state == eSuccess);
+        state = TclActivateThread(pThread, &error);
+        REGRESS_CHECK(state == eSuccess);
+        state = TclDeleteThreadDynamic(&cache, pThread, &error);
+        REGRESS_CHECK(state == eSuccess);
+    }
+    REGRESS_CHECK(WorkerRuns == 60U);
+
+    state = TclDeleteSlabCache(&cache, &error);
+    REGRESS_CHECK(state == eSuccess);
+    state = TclDeleteMemBuddy(&RegressBuddy, &error);
+    REGRESS_CHECK(state == eSuccess);
+}
+
+
+/* 󻺴ܾظͷźͲĵַͬһᱻ */
+static void RegressSlabFree(void)
+{
+    TState state;
+    TError error;
+    TMemSlab cache = {0};
+    void* pObject1;
+    void* pObject2;
+    void* pObject3;
+
+    state = TclCreateMemBuddy(&RegressBuddy, (TChar*)RegressBuddyData, BUDDY_PAGES,
+                              BUDDY_PAGE_SIZE, RegressBuddyTags, &error);
+    REGRESS_CHECK(state == eSuccess);
+    state = TclCreateSlabCache(&cache, 40U, 4U, (TMemPool*)0, &RegressBuddy,
+                               (TSlabCtor)0, (TSlabDtor)0, &error);
+    REGRESS_CHECK(state == eSuccess);
+
+    state = TclMallocSlabObject(&cache, &pObject1, &error);
+    REGRESS_CHECK(state == eSuccess);
+    state = TclMallocSlabObject(&cache, &pObject2, &error);
+    REGRESS_CHECK(state == eSuccess);
+
+    state = TclFreeSlabObject(&cache, pObject1, &error);
+    REGRESS_CHECK(state == eSuccess);
+    state = TclFreeSlabObject(&cache, pObject1, &error);
+    REGRESS_CHECK((state == eFailure) && (error == TCLE_MEMORY_DBLFREE));
+    state = TclFreeSlabObject(&cache, (TChar*)pObject2 + 8, &error);
+    REGRESS_CHECK((state == eFailure) && (error == TCLE_MEMORY_BADADDR));
+    state = TclFreeSlabObject(&cache, &cache, &error);
+    REGRESS_CHECK((state == eFailure) && (error == TCLE_MEMORY_BADADDR));
+    REGRESS_CHECK(cache.ObjInuse == 1U);
+
+    /* ܾͷûƻηõͬĶ */
+    state = TclMallocSlabObject(&cache, &pObject1, &error);
+    REGRESS_CHECK(state == eSuccess);
+    state = TclMallocSlabObject(&cache, &pObject3, &error);
+    REGRESS_CHECK(state == eSuccess);
+    REGRESS_CHECK((pObject1 != pObject3) && (pObject2 != pObject3) && (pObject1 != pObject2));
+
+    state = TclFreeSlabObject(&cache, pObject1, &error);
+    REGRESS_CHECK(state == eSuccess);
+    state = TclFreeSlabObject(&cache, pObject2, &error);
+    REGRESS_CHECK(state == eSuccess);
+    state = TclFreeSlabObject(&cache, pObject3, &error);
+    REGRESS_CHECK(state == eSuccess);
+    state = TclDeleteSlabCache(&cache, &error);
+    REGRESS_CHECK(state == eSuccess);
+    state = TclDeleteMemBuddy(&RegressBuddy, &error);
+    REGRESS_CHECK(state == eSuccess);
+}
+#endif
+
+
+#if ((TCLC_MEMORY_ENABLE) && (TCLC_MEMORY_TLSF_ENABLE))
+static TMemTlsf RegressTlsf;
+static TBase32 RegressTlsfData[1024];
+
+/* ͷŵڴڵĿڴϲȫͷ֮ѻָһڴ飻
+   ǷַظͷűܾµСʱԭչ߰ */
+static void RegressTlsfMerge(void)
+{
+    TState state;
+    TError error;
+    TTlsfInfo origin;
+    TTlsfInfo info;
+    void* pAddr[3];
+    void* pNew;
+    TIndex i;
+
+    state = TclCreateMemTlsf(&RegressTlsf, (void*)RegressTlsfData, sizeof(RegressTlsfData),
+                             &error);
+    REGRESS_CHECK(state == eSuccess);
+    state = TclGetTlsfInfo(&RegressTlsf, &origin, &error);
+    REGRESS_CHECK((state == eSuccess) && (origin.FreeBlocks == 1U) && (origin.Fragment == 0U));
+
+    for (i = 0U; i < 3U; i++)
+    {
+        state = TclMallocTlsfMem(&RegressTlsf, 100U * (i + 1U), &pAddr[i], &error);
+        REGRESS_CHECK(state == eSuccess);
+        REGRESS_CHECK(((TAddr)pAddr[i] % sizeof(void*)) == 0U);
+        memset(pAddr[i], 0x3C + (int)i, 100U * (i + 1U));
+    }
+
+    state = TclFreeTlsfMem(&RegressTlsf, pAddr[1], &error);
+    REGRESS_CHECK(state == eSuccess);
+    state = TclFreeTlsfMem(&RegressTlsf, pAddr[1], &error);
+    REGRESS_CHECK((state == eFailure) && (error == TCLE_MEMORY_DBLFREE));
+    state = TclFreeTlsfMem(&RegressTlsf, (TChar*)pAddr[0] + 8, &error);
+    REGRESS_CHECK((state == eFailure) && (error == TCLE_MEMORY_BADADDR));
+    state = TclGetTlsfInfo(&RegressTlsf, &info, &error);
+    REGRESS_CHECK((state == eSuccess) && (info.FreeBlocks == 2U) && (info.Fragment > 0U));
+
+    /* һڴв㹻ʱԭչ */
+    state = TclReallocTlsfMem(&RegressTlsf, pAddr[0], 250U, &pNew, &error);
+    REGRESS_CHECK((state == eSuccess) && (pNew == pAddr[0]));
+
+    /* ԭطŲʱƵµڴ飬ԭݱ */
+    state = TclReallocTlsfMem(&RegressTlsf, pAddr[0], 1000U, &pNew, &error);
+    REGRESS_CHECK((state == eSuccess) && (pNew != pAddr[0]));
+    for (i = 0U; i < 100U; i++)
+    {
+        REGRESS_CHECK(((TByte*)pNew)[i] == 0x3CU);
+    }
+    pAddr[0] = pNew;
+
+    state = TclMallocTlsfMem(&RegressTlsf, sizeof(RegressTlsfData), &pNew, &error);
+    REGRESS_CHECK((state == eFailure) && (error == TCLE_MEMORY_NOMEM));
+
+    state = TclFreeTlsfMem(&RegressTlsf, pAddr[0], &error);
+    REGRESS_CHECK(state == eSuccess);
+    state = TclFreeTlsfMem(&RegressTlsf, pAddr[2], &error);
+    REGRESS_CHECK(state == eSuccess);
+    state = TclGetTlsfInfo(&RegressTlsf, &info, &error);
+    REGRESS_CHECK((state == eSuccess) && (info.FreeBlocks == 1U) && (info.UsedBytes == 0U));
+    REGRESS_CHECK((info.FreeBytes == origin.FreeBytes) && (info.Fragment == 0U));
+
+    state = TclDeleteMemTlsf(&RegressTlsf, &error);
+    REGRESS_CHECK(state == eSuccess);
+}
+#endif
+
+
+#if ((TCLC_MEMORY_ENABLE) && (TCLC_MEMORY_HEAP_ENABLE) && (TCLC_MEMORY_POOL_ENABLE))
+#define HEAP_MIN_SIZE          (16U)
+static TMemHeap RegressHeap;
+static TBase32 RegressHeapPages[2] = {4U, 4U};
+static TBase32 RegressHeapData[(4U * HEAP_MIN_SIZE + 4U * 2U * HEAP_MIN_SIZE) / 4];
+
+/* ڴûͷʱٷּڴ */
+static void RegressHeapDelete(void)
+{
+    TState state;
+    TError error;
+    void* pAddr;
+
+    state = TclCreateMemHeap(&RegressHeap, (void*)RegressHeapData, 2U, HEAP_MIN_SIZE,
+                             RegressHeapPages, TCLP_MEMORY_DUMMY, &error);
+    REGRESS_CHECK(state == eSuccess);
+    state = TclMalloc(&RegressHeap, 20U, &pAddr, &error);
+    REGRESS_CHECK(state == eSuccess);
+
+    state = TclDeleteMemHeap(&RegressHeap, &error);
+    REGRESS_CHECK((state == eFailure) && (error == TCLE_MEMORY_FAULT));
+
+    state = TclFree(&RegressHeap, pAddr, &error);
+    REGRESS_CHECK(state == eSuccess);
+    state = TclDeleteMemHeap(&RegressHeap, &error);
+    REGRESS_CHECK(state == eSuccess);
+}
+#endif
+
+
+/* иع */
+static void ThreadRegressEntry(TArgument arg)
+{
+    RegressThreadChurn();
+    printf("thread churn ok\n");
+
+#if (TCLC_THREAD_NOTIFY_ENABLE)
+    RegressNotifyWait();
+    printf("notify wait ok\n");
+#endif
+
+#if (TCLC_TIMER_ENABLE)
+    RegressTimerWheel();
+    printf("timer wheel ok\n");
+#endif
+
+#if ((TCLC_IPC_ENABLE) && (TCLC_IPC_FLAGS_ENABLE))
+    RegressFlagsOrder();
+    printf("flags order ok\n");
+    RegressFlagsHigh();
+    printf("flags high bit ok\n");
+#endif
+
+#if ((TCLC_IPC_ENABLE) && (TCLC_IPC_MUTEX_ENABLE))
+    RegressMutexInherit();
+    printf("mutex inherit ok\n");
+#if (TCLC_IPC_CONDVAR_ENABLE)
+    RegressCondVarInherit();
+    printf("condvar inherit ok\n");
+    RegressCondVarBroadcast();
+    printf("condvar broadcast ok\n");
+#endif
+#if (TCLC_IPC_RWLOCK_ENABLE)
+    RegressRwLock();
+    printf("rwlock ok\n");
+#endif
+#endif
+
+#if ((TCLC_IPC_ENABLE) && (TCLC_IPC_BARRIER_ENABLE))
+    RegressBarrierWait();
+    printf("barrier wait ok\n");
+#endif
+
+#if ((TCLC_IPC_ENABLE) && (TCLC_IPC_MSGBUF_ENABLE))
+    RegressMsgBuffer();
+    printf("message buffer ok\n");
+#endif
+
+#if ((TCLC_IPC_ENABLE) && (TCLC_IPC_MQUE_ENABLE))
+    RegressMQBatch();
+    printf("message batch ok\n");
+#endif
+
+#if ((TCLC_IPC_ENABLE) && (TCLC_IPC_CHANNEL_ENABLE))
+    RegressChannelRead();
+    printf("channel read ok\n");
+#endif
+
+#if ((TCLC_IPC_ENABLE) && (TCLC_IPC_WAITANY_ENABLE) && (TCLC_IPC_SEMAPHORE_ENABLE) && \
+     (TCLC_IPC_MQUE_ENABLE) && (TCLC_IPC_FLAGS_ENABLE))
+    RegressWaitAny();
+    printf("wait any ok\n");
+#endif
+
+#if ((TCLC_MEMORY_ENABLE) && (TCLC_MEMORY_SLAB_ENABLE) && \
+     (TCLC_MEMORY_POOL_ENABLE) && (TCLC_MEMORY_BUDDY_ENABLE))
+    RegressBuddyCapacity();
+    printf("buddy capacity ok\n");
+    RegressDynamicThread();
+    printf("dynamic thread ok\n");
+    RegressSlabFree();
+    printf("slab free ok\n");
+#endif
+
+#if ((TCLC_MEMORY_ENABLE) && (TCLC_MEMORY_TLSF_ENABLE))
+    RegressTlsfMerge();
+    printf("tlsf merge ok\n");
+#endif
+
+#if ((TCLC_MEMORY_ENABLE) && (TCLC_MEMORY_HEAP_ENABLE) && (TCLC_MEMORY_POOL_ENABLE))
+    RegressHeapDelete();
+    printf("heap delete ok\n");
+#endif
+
+    printf("PASS\n");
+    exit(0);
+}
+
+
+static void AppSetupEntry(void)
+{
+    TState state;
+    TError error;
+
+    state = TclCreateThread(&ThreadRegress, &ThreadRegressEntry, (TArgument)0,
+                            ThreadRegressStack, REGRESS_STACK_BYTES,
+                            REGRESS_PRIORITY, REGRESS_SLICE, &error);
+    REGRESS_CHECK(state == eSuccess);
+    state = TclActivateThread(&ThreadRegress, &error);
+    REGRESS_CHECK(state == eSuccess);
+}
+
+
+static void BoardSetupEntry(void)
+{
+}
+
+
+static void TraceEntry(const char* pNote)
+{
+    printf("%s\n", pNote);
+}
+
+
+int main(void)
+{
+    setvbuf(stdout, (char*)0, _IONBF, 0);
+    TclStartKernel(&AppSetupEntry, &CpuSetupEntry, &BoardSetupEntry, &TraceEntry);
+    return 1;
+}
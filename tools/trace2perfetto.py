@@ -0,0 +1,177 @@
+#!/usr/bin/env python3
+"""Convert a Trochili kernel trace dump into Chrome/Perfetto trace JSON.
+
+The input is a raw copy of the kernel's uTraceBuffer (TTraceBuffer), either
+dumped by a debugger or sent by the application using TclGetTraceBuffer().
+Open the output at https://ui.perfetto.dev or chrome://tracing.
+
+    python3 trace2perfetto.py trace.bin -o trace.json --name 3=Led --name 4=Key
+"""
+
+import argparse
+import json
+import struct
+import sys
+
+TRACE_MAGIC = 0x45435254
+HEADER = struct.Struct("<5I")
+RECORD = struct.Struct("<IBBHI")
+
+EV_SWITCH = 1
+EV_BLOCK = 2
+EV_UNBLOCK = 3
+EV_TIMER = 4
+EV_IRQ_ENTER = 5
+EV_IRQ_LEAVE = 6
+EV_IRQ_POST = 7
+EV_MALLOC = 8
+EV_FREE = 9
+
+PID_THREAD = 1
+PID_IRQ = 2
+PID_TIMER = 3
+
+MEM_NAMES = {0: "pool", 1: "buddy", 2: "tlsf", 3: "slab", 4: "heap"}
+TIMER_TYPES = {0: "thread", 1: "ipc", 2: "user"}
+
+
+def load(path):
+    with open(path, "rb") as f:
+        blob = f.read()
+    if len(blob) < HEADER.size:
+        sys.exit("%s: too short for a trace header" % path)
+    magic, capacity, freq, head, _enabled = HEADER.unpack_from(blob, 0)
+    if magic != TRACE_MAGIC:
+        sys.exit("%s: bad magic 0x%08x, not a Trochili trace buffer" % (path, magic))
+    if len(blob) < HEADER.size + capacity * RECORD.size:
+        sys.exit("%s: truncated, expected %d records" % (path, capacity))
+
+    # once the ring has wrapped, the oldest record sits at Head
+    if head <= capacity:
+        order = range(head)
+    else:
+        order = [(head + i) % capacity for i in range(capacity)]
+    records = [RECORD.unpack_from(blob, HEADER.size + i * RECORD.size) for i in order]
+    return freq, head, records
+
+
+def unwrap(records):
+    """Turn 32-bit wrapping stamps into a monotonic 64-bit count starting at 0."""
+    total = 0
+    last = None
+    for stamp, event, extra, obj, data in records:
+        if last is not None:
+            total += (stamp - last) & 0xFFFFFFFF
+        last = stamp
+        yield total, event, extra, obj, data
+
+
+def convert(freq, records, names):
+    scale = 1e6 / freq
+    events = []
+    threads = set()
+    irqs = set()
+    timers = set()
+
+    running = None
+    running_since = 0.0
+    ts = 0.0
+
+    def close_running(now):
+        if running is not None:
+            events.append({"name": names.get(running, "thread %d" % running), "ph": "X",
+                           "pid": PID_THREAD, "tid": running,
+                           "ts": running_since, "dur": now - running_since})
+
+    def instant(name, pid, tid, now, args):
+        events.append({"name": name, "ph": "i", "s": "t", "pid": pid, "tid": tid,
+                       "ts": now, "args": args})
+
+    for cycles, event, extra, obj, data in unwrap(records):
+        ts = cycles * scale
+        if event == EV_SWITCH:
+            if running is None:
+                running, running_since = obj, 0.0
+            close_running(ts)
+            threads.update((obj, data))
+            running, running_since = data, ts
+        elif event == EV_BLOCK:
+            threads.add(obj)
+            instant("block", PID_THREAD, obj, ts, {"queue": "0x%08x" % data})
+        elif event == EV_UNBLOCK:
+            threads.add(obj)
+            instant("unblock", PID_THREAD, obj, ts, {"queue": "0x%08x" % data, "error": extra})
+        elif event == EV_TIMER:
+            timers.add(obj)
+            args = {"type": TIMER_TYPES.get(extra, extra)}
+            if data:
+                args["thread"] = data
+            instant("expire", PID_TIMER, obj, ts, args)
+        elif event == EV_IRQ_ENTER:
+            irqs.add(obj)
+            events.append({"name": "irq %d" % obj, "ph": "B", "pid": PID_IRQ, "tid": obj, "ts": ts})
+        elif event == EV_IRQ_LEAVE:
+            irqs.add(obj)
+            events.append({"name": "irq %d" % obj, "ph": "E", "pid": PID_IRQ, "tid": obj, "ts": ts,
+                           "args": {"retv": extra}})
+        elif event == EV_IRQ_POST:
+            instant("irq request", PID_IRQ, 0xFFFF, ts,
+                    {"priority": obj, "entry": "0x%08x" % data})
+            irqs.add(0xFFFF)
+        elif event in (EV_MALLOC, EV_FREE):
+            tid = running if running is not None else 0
+            threads.add(tid)
+            args = {"allocator": MEM_NAMES.get(extra, extra), "addr": "0x%08x" % data}
+            if event == EV_MALLOC:
+                args["length"] = obj
+            instant("malloc" if event == EV_MALLOC else "free", PID_THREAD, tid, ts, args)
+        else:
+            sys.stderr.write("unknown event %d at %.3fus ignored\n" % (event, ts))
+    close_running(ts)
+
+    meta = [
+        {"name": "process_name", "ph": "M", "pid": PID_THREAD, "args": {"name": "Threads"}},
+        {"name": "process_name", "ph": "M", "pid": PID_IRQ, "args": {"name": "Interrupts"}},
+        {"name": "process_name", "ph": "M", "pid": PID_TIMER, "args": {"name": "Timers"}},
+    ]
+    for tid in sorted(threads):
+        meta.append({"name": "thread_name", "ph": "M", "pid": PID_THREAD, "tid": tid,
+                     "args": {"name": names.get(tid, "thread %d" % tid)}})
+    for tid in sorted(irqs):
+        meta.append({"name": "thread_name", "ph": "M", "pid": PID_IRQ, "tid": tid,
+                     "args": {"name": "requests" if tid == 0xFFFF else "irq %d" % tid}})
+    for tid in sorted(timers):
+        meta.append({"name": "thread_name", "ph": "M", "pid": PID_TIMER, "tid": tid,
+                     "args": {"name": "timer %d" % tid}})
+    return {"traceEvents": meta + events, "displayTimeUnit": "ns"}
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("dump", help="raw TTraceBuffer dump")
+    parser.add_argument("-o", "--output", help="output JSON file (default: stdout)")
+    parser.add_argument("--freq", type=float,
+                        help="timestamp frequency in Hz, overrides the value in the dump")
+    parser.add_argument("--name", action="append", default=[], metavar="ID=NAME",
+                        help="name a thread by its ThreadID, may be repeated")
+    args = parser.parse_args()
+
+    names = {}
+    for item in args.name:
+        tid, _, name = item.partition("=")
+        names[int(tid, 0)] = name
+
+    freq, head, records = load(args.dump)
+    freq = args.freq or freq
+    trace = convert(freq, records, names)
+    sys.stderr.write("%d events written, %d records lost to wrap-around\n"
+                     % (len(records), max(0, head - len(records))))
+
+    out = open(args.output, "w") if args.output else sys.stdout
+    json.dump(trace, out)
+    if args.output:
+        out.close()
+
+
+if __name__ == "__main__":
+    main()
@@ -9,9 +9,12 @@
 #include "tcl.types.h"
 
 extern void CpuSetupEntry(void);
+extern void CpuSetIrqPriority(TIndex irqn);
+extern void CpuRaiseIrq(TIndex irqn);
 extern void CpuStartTickClock(void);
 extern void CpuBuildThreadStack(TAddr32* pTop, void* pStack, TBase32 bytes,
                                 void* pEntry, TArgument argument);
+extern void CpuReleaseThreadStack(TAddr32* pTop);
 extern void CpuConfirmThreadSwitch(void);
 extern void CpuCancelThreadSwitch(void);
 extern void CpuDisableInt(void);
@@ -20,6 +23,10 @@ extern void CpuEnterCritical(TReg32* pValue);
 extern void CpuLeaveCritical(TReg32 value);
 extern void CpuLoadIdleThread(void);
 extern TPriority CpuCalcHiPRIO(TBase32 data);
+extern TBase32 CpuCountLeadZeros(TBase32 data);
+extern void CpuDataBarrier(void);
+extern TTimeTick CpuTicklessSleep(TTimeTick ticks);
+extern TBase32 CpuGetCycleCount(void);
 
 #endif /* _TCLC_CPU_H */
 
@@ -0,0 +1,26 @@
+/*************************************************************************************************
+ *                                     Trochili RTOS Kernel                                      *
+ *                                  Copyright(C) 2016 LIUXUMING                                  *
+ *                                       www.trochili.com                                        *
+ *************************************************************************************************/
+#ifndef _TCL_POSIX_H
+#define _TCL_POSIX_H
+
+/* ֲҪILP32뻷(gcc -m32)ںеַTBase32/TAddr32ֱ֮ת */
+
+/* ߳Ŀں̺߳û߳Ŀ֮ */
+#ifndef TCLC_POSIX_CONTEXT_NUM
+#define TCLC_POSIX_CONTEXT_NUM       (32U)
+#endif
+
+/* ߳ʵʹõջСźŴͿ⺯ҪMCUöջռ */
+#ifndef TCLC_POSIX_STACK_BYTES
+#define TCLC_POSIX_STACK_BYTES       (64U*1024U)
+#endif
+
+/* źģⲿж */
+#define     POSIX_USR1_IRQID         (00) /* SIGUSR1                                                  */
+#define     POSIX_USR2_IRQID         (01) /* SIGUSR2                                                  */
+
+#endif /* _TCL_POSIX_H */
+
@@ -0,0 +1,34 @@
+/*************************************************************************************************
+ *                                     Trochili RTOS Kernel                                      *
+ *                                  Copyright(C) 2016 LIUXUMING                                  *
+ *                                       www.trochili.com                                        *
+ *************************************************************************************************/
+#ifndef _TCL_BARRIER_H
+#define _TCL_BARRIER_H
+
+#include "tcl.types.h"
+#include "tcl.config.h"
+#include "tcl.ipc.h"
+#include "tcl.thread.h"
+
+#if ((TCLC_IPC_ENABLE)&&(TCLC_IPC_BARRIER_ENABLE))
+
+/* ߳Ͻṹ */
+struct BarrierDef
+{
+    TProperty Property;      /* ߳ϵĵȲԵ */
+    TBase32   Count;         /* ÿҪϵ߳Ŀ       */
+    TBase32   Arrived;       /* Ѿ߳Ŀ       */
+    TIpcQueue Queue;         /* ߳ϵ߳       */
+};
+typedef struct BarrierDef TBarrier;
+
+extern TState xBarrierCreate(TBarrier* pBarrier, TBase32 count, TProperty property, TError* pError);
+extern TState xBarrierDelete(TBarrier* pBarrier, TError* pError);
+extern TState xBarrierReset(TBarrier* pBarrier, TError* pError);
+extern TState xBarrierWait(TBarrier* pBarrier, TOption option, TTimeTick timeo, TError* pError);
+
+#endif
+
+#endif /* _TCL_BARRIER_H */
+
@@ -0,0 +1,43 @@
+/*************************************************************************************************
+ *                                     Trochili RTOS Kernel                                      *
+ *                                  Copyright(C) 2016 LIUXUMING                                  *
+ *                                       www.trochili.com                                        *
+ *************************************************************************************************/
+#ifndef _TCL_CHANNEL_H
+#define _TCL_CHANNEL_H
+
+#include "tcl.types.h"
+#include "tcl.config.h"
+#include "tcl.object.h"
+#include "tcl.ipc.h"
+#include "tcl.thread.h"
+
+#if ((TCLC_IPC_ENABLE) && (TCLC_IPC_CHANNEL_ENABLE))
+
+/* ߵ߻ͨṹ壬
+   Headֻ޸ģTailֻ޸ģ߶ļֵͨеԪĿ */
+struct ChannelDef
+{
+    TProperty         Property;  /* ͨ                                 */
+    TByte*            Buffer;    /* ûṩĻλ                         */
+    TBase32           Size;      /* ÿԪصֽ                             */
+    TBase32           Capacity;  /* ɵԪĿ2    */
+    volatile TBase32  Head;      /* ѾдԪؼ                           */
+    volatile TBase32  Tail;      /* ѾԪؼ                           */
+    volatile TBool    Waiting;   /* ׼Ѿ״̬           */
+    TIpcQueue         Queue;     /* ͨ߳Уֻ̻߳     */
+};
+typedef struct ChannelDef TChannel;
+
+extern TState xChannelCreate(TChannel* pChannel, void* pAddr, TBase32 capacity, TBase32 size,
+                             TError* pError);
+extern TState xChannelDelete(TChannel* pChannel, TError* pError);
+extern TState xChannelFlush(TChannel* pChannel, TError* pError);
+extern TState xChannelWrite(TChannel* pChannel, void* pData, TError* pError);
+extern TState xChannelRead(TChannel* pChannel, void* pData, TOption option, TTimeTick timeo,
+                           TError* pError);
+
+#endif
+
+#endif /* _TCL_CHANNEL_H */
+
@@ -0,0 +1,36 @@
+/*************************************************************************************************
+ *                                     Trochili RTOS Kernel                                      *
+ *                                  Copyright(C) 2016 LIUXUMING                                  *
+ *                                       www.trochili.com                                        *
+ *************************************************************************************************/
+#ifndef _TCL_CONDVAR_H
+#define _TCL_CONDVAR_H
+
+#include "tcl.types.h"
+#include "tcl.config.h"
+#include "tcl.ipc.h"
+#include "tcl.thread.h"
+#include "tcl.mutex.h"
+
+#if ((TCLC_IPC_ENABLE)&&(TCLC_IPC_MUTEX_ENABLE)&&(TCLC_IPC_CONDVAR_ENABLE))
+
+/* ṹ */
+struct CondVarDef
+{
+    TProperty Property;      /* ĵȲԵ */
+    TIpcQueue Queue;         /* ߳       */
+};
+typedef struct CondVarDef TCondVar;
+
+extern TState xCondVarCreate(TCondVar* pCondVar, TProperty property, TError* pError);
+extern TState xCondVarDelete(TCondVar* pCondVar, TError* pError);
+extern TState xCondVarFlush(TCondVar* pCondVar, TError* pError);
+extern TState xCondVarWait(TCondVar* pCondVar, TMutex* pMutex, TOption option, TTimeTick timeo,
+                           TError* pError);
+extern TState xCondVarSignal(TCondVar* pCondVar, TError* pError);
+extern TState xCondVarBroadcast(TCondVar* pCondVar, TError* pError);
+
+#endif
+
+#endif /* _TCL_CONDVAR_H */
+
@@ -13,12 +13,28 @@
 
 #if ((TCLC_IPC_ENABLE) && (TCLC_IPC_FLAGS_ENABLE))
 
+/* ¼Ͷ壬¼λþ */
+#if (TCLC_IPC_FLAGS_64BIT_ENABLE)
+typedef unsigned long long TFlagMask;
+#define FLAGS_BITS           (64U)
+#else
+typedef TBitMask TFlagMask;
+#define FLAGS_BITS           (32U)
+#endif
+
 /* ¼ǽṹ */
 struct FlagsDef
 {
-    TProperty Property;  /* ̵߳ĵȲԵ   */
-    TBitMask  Value;     /* ¼ǵĵǰ¼       */
-    TIpcQueue Queue;     /* ¼ǵ߳     */
+    TProperty Property;               /* ̵߳ĵȲԵ                   */
+    TFlagMask Value;                  /* ¼ǵĵǰ¼                       */
+    TIpcQueue Queue;                  /* ¼ǵ߳                     */
+#if (TCLC_IPC_FLAGS_INDEX_ENABLE)
+    TFlagMask WaitMask;               /* ȴλǿյ¼λͼ(ƫ)         */
+    TFlagMask AnyMask;                /* λORʽȴ̹߳ĵ¼λͼ         */
+    TObjNode* Waiters[FLAGS_BITS];    /* ȴλ߳                 */
+    TObjNode* AnyWaiters;             /* ORʽȴ¼λ߳       */
+    TBase32   Sequence;               /* ̵߳ĵ˳                     */
+#endif
 };
 typedef struct FlagsDef TFlags;
 
@@ -26,9 +42,15 @@ extern TState xFlagsCreate(TFlags* pFlags, TProperty property, TError* pError);
 extern TState xFlagsDelete(TFlags* pFlags, TError* pError);
 extern TState xFlagsReset(TFlags* pFlags, TError* pError);
 extern TState xFlagsFlush(TFlags* pFlags, TError* pError);
-extern TState xFlagsSend(TFlags* pFlags, TBitMask pattern, TError* pError);
-extern TState xFlagsReceive(TFlags* pFlags, TBitMask* pPattern,
+extern TState xFlagsSend(TFlags* pFlags, TFlagMask pattern, TError* pError);
+extern TState xFlagsReceive(TFlags* pFlags, TFlagMask* pPattern,
                             TOption option, TTimeTick timeo, TError* pError);
+#if (TCLC_IPC_WAITANY_ENABLE)
+extern TState uFlagsTryReceive(TFlags* pFlags, TFlagMask* pPattern, TOption option, TError* pError);
+#endif
+#if (TCLC_IPC_FLAGS_INDEX_ENABLE)
+extern void uFlagsEnterIndex(TIpcContext* pContext);
+#endif
 
 #endif
 
@@ -12,12 +12,28 @@
 
 #if (TCLC_IPC_ENABLE)
 
+#if (TCLC_IPC_PRIORITY_INDEX_ENABLE)
+/* IPCȼֶṹ塣ֶǰȼͬһȼ߳
+   вȳ¼ÿȼһ߳̽ڵ㣬λͼ(TCLC_LOWEST_PRIORITY-n)
+   λʾȼn߳ */
+struct IpcPriorityIndexDef
+{
+    TBitMask   PriorityMask;                     /* ֶ߳ȼ                 */
+    TObjNode*  Tail[TCLC_PRIORITY_NUM];          /* ȼһ߳̽ڵ               */
+};
+typedef struct IpcPriorityIndexDef TIpcPriorityIndex;
+#endif
+
 /* IPC߳нṹ */
 struct IpcBlockedQueueDef
 {
     TProperty* Property;                         /* ߳                           */
     TObjNode*  PrimaryHandle;                    /* л̷ֶ߳                       */
     TObjNode*  AuxiliaryHandle;                  /* и̷ֶ߳                       */
+#if (TCLC_IPC_PRIORITY_INDEX_ENABLE)
+    TIpcPriorityIndex PrimaryIndex;              /* ̷ֶ߳ȼ                   */
+    TIpcPriorityIndex AuxiliaryIndex;            /* ̷ֶ߳ȼ                   */
+#endif
 };
 typedef struct IpcBlockedQueueDef TIpcQueue;
 
@@ -43,21 +59,33 @@ typedef struct IpcBlockedQueueDef TIpcQueue;
 #define IPC_PROP_READY           (TProperty)(0x1<<0)       /* IPCѾʼ                        */
 #define IPC_PROP_PREEMP_AUXIQ    (TProperty)(0x1<<1)       /* ߳вȼȷ         */
 #define IPC_PROP_PREEMP_PRIMIQ   (TProperty)(0x1<<2)       /* ߳вȼȷ         */
+#define IPC_PROP_INHERIT         (TProperty)(0x1<<3)       /* ȼ̳Э                   */
+#define IPC_PROP_WRITER_PREF     (TProperty)(0x1<<4)       /* ддȲ                     */
+#define IPC_PROP_OVERWRITE       (TProperty)(0x1<<5)       /* øǲԣʼ滻ʼ         */
 #define IPC_PROP_AUXIQ_AVAIL     (TProperty)(0x1<<17)      /* ߳ڱ߳         */
 #define IPC_PROP_PRIMQ_AVAIL     (TProperty)(0x1<<18)      /* ߳ڱ߳         */
 
 #define IPC_VALID_SEMN_PROP      (IPC_PROP_PREEMP_PRIMIQ)
-#define IPC_VALID_MUTEX_PROP     (IPC_PROP_PREEMP_PRIMIQ)
-#define IPC_VALID_MBOX_PROP      (IPC_PROP_PREEMP_PRIMIQ | IPC_PROP_PREEMP_AUXIQ)
+#define IPC_VALID_MUTEX_PROP     (IPC_PROP_PREEMP_PRIMIQ | IPC_PROP_INHERIT)
+#define IPC_VALID_MBOX_PROP      (IPC_PROP_PREEMP_PRIMIQ | IPC_PROP_PREEMP_AUXIQ | IPC_PROP_OVERWRITE)
 #define IPC_VALID_MQUE_PROP      (IPC_PROP_PREEMP_PRIMIQ | IPC_PROP_PREEMP_AUXIQ)
 #define IPC_VALID_FLAG_PROP      (IPC_PROP_PREEMP_PRIMIQ)
+#define IPC_VALID_MBUF_PROP      (IPC_PROP_PREEMP_PRIMIQ | IPC_PROP_PREEMP_AUXIQ)
+#define IPC_VALID_RWLOCK_PROP    (IPC_PROP_PREEMP_PRIMIQ | IPC_PROP_PREEMP_AUXIQ | IPC_PROP_WRITER_PREF)
+#define IPC_VALID_COND_PROP      (IPC_PROP_PREEMP_PRIMIQ)
+#define IPC_VALID_BARR_PROP      (IPC_PROP_PREEMP_PRIMIQ)
 
 
 #define IPC_RESET_SEMN_PROP      (IPC_PROP_READY | IPC_PROP_PREEMP_PRIMIQ)
-#define IPC_RESET_MUTEX_PROP     (IPC_PROP_READY | IPC_PROP_PREEMP_PRIMIQ)
-#define IPC_RESET_MBOX_PROP      (IPC_PROP_READY | IPC_PROP_PREEMP_PRIMIQ | IPC_PROP_PREEMP_AUXIQ)
+#define IPC_RESET_MUTEX_PROP     (IPC_PROP_READY | IPC_PROP_PREEMP_PRIMIQ | IPC_PROP_INHERIT)
+#define IPC_RESET_MBOX_PROP      (IPC_PROP_READY | IPC_PROP_PREEMP_PRIMIQ | IPC_PROP_PREEMP_AUXIQ | \
+                                  IPC_PROP_OVERWRITE)
 #define IPC_RESET_MQUE_PROP      (IPC_PROP_READY | IPC_PROP_PREEMP_PRIMIQ | IPC_PROP_PREEMP_AUXIQ)
 #define IPC_RESET_FLAG_PROP      (IPC_PROP_READY | IPC_PROP_PREEMP_PRIMIQ)
+#define IPC_RESET_MBUF_PROP      (IPC_PROP_READY | IPC_PROP_PREEMP_PRIMIQ | IPC_PROP_PREEMP_AUXIQ)
+#define IPC_RESET_RWLOCK_PROP    (IPC_PROP_READY | IPC_PROP_PREEMP_PRIMIQ | IPC_PROP_PREEMP_AUXIQ | \
+                                  IPC_PROP_WRITER_PREF)
+#define IPC_RESET_BARR_PROP      (IPC_PROP_READY | IPC_PROP_PREEMP_PRIMIQ)
 
 
 /* ߳IPCѡں˴ʹ */
@@ -69,30 +97,44 @@ typedef struct IpcBlockedQueueDef TIpcQueue;
 #define IPC_OPT_AND              (TOption)(0x1<<4)       /* ¼ǲAND                  */
 #define IPC_OPT_OR               (TOption)(0x1<<5)       /* ¼ǲOR                   */
 #define IPC_OPT_CONSUME          (TOption)(0x1<<6)       /* ¼ʹ                               */
+#define IPC_OPT_LEVEL_SHIFT      (8U)                    /* Ϣȼѡеλ                   */
+#define IPC_OPT_LEVEL_MASK       (TOption)(0x1F<<8)      /* ϢʹãϢȼ0Ϊ        */
+#define IPC_OPT_LEVEL(n)         ((TOption)(((TOption)(n)) << IPC_OPT_LEVEL_SHIFT) & IPC_OPT_LEVEL_MASK)
 
 #define IPC_OPT_SEMAPHORE        (TOption)(0x1<<16)      /* ߳ź߳       */
 #define IPC_OPT_MUTEX            (TOption)(0x1<<17)      /* ߳ڻ߳       */
 #define IPC_OPT_MAILBOX          (TOption)(0x1<<18)      /* ߳߳         */
 #define IPC_OPT_MSGQUEUE         (TOption)(0x1<<19)      /* ߳Ϣе߳     */
 #define IPC_OPT_FLAGS            (TOption)(0x1<<20)      /* ߳¼ǵ߳     */
+#define IPC_OPT_MSGBUF           (TOption)(0x1<<21)      /* ߳Ϣ߳   */
+#define IPC_OPT_WAITANY          (TOption)(0x1<<22)      /* ߳ͬʱڶ߳       */
 
 #define IPC_OPT_USE_AUXIQ        (TOption)(0x1<<23)      /* ߳߳еĸ         */
 #define IPC_OPT_READ_DATA        (TOption)(0x1<<24)      /* ʼϢ                           */
 #define IPC_OPT_WRITE_DATA       (TOption)(0x1<<25)      /* ʼϢ                           */
+#define IPC_OPT_CHANNEL          (TOption)(0x1<<26)      /* ߳ڵߵͨ       */
+#define IPC_OPT_RWLOCK           (TOption)(0x1<<27)      /* ߳ڶд߳       */
+#define IPC_OPT_CONDVAR          (TOption)(0x1<<28)      /* ߳߳     */
+#define IPC_OPT_BARRIER          (TOption)(0x1<<29)      /* ߳߳ϵ߳     */
 
 #define IPC_VALID_SEMN_OPT       (IPC_OPT_ISR|IPC_OPT_WAIT|IPC_OPT_TIMED)
 #define IPC_VALID_MUTEX_OPT      (IPC_OPT_WAIT|IPC_OPT_TIMED)
 #define IPC_VALID_MBOX_OPT       (IPC_OPT_ISR|IPC_OPT_WAIT|IPC_OPT_TIMED|IPC_OPT_UARGENT)
-#define IPC_VALID_MSGQ_OPT       (IPC_OPT_ISR|IPC_OPT_WAIT|IPC_OPT_TIMED|IPC_OPT_UARGENT)
+#define IPC_VALID_MSGQ_OPT       (IPC_OPT_ISR|IPC_OPT_WAIT|IPC_OPT_TIMED|IPC_OPT_UARGENT|\
+                                  IPC_OPT_LEVEL_MASK)
 #define IPC_VALID_FLAG_OPT       (IPC_OPT_ISR|IPC_OPT_WAIT|IPC_OPT_TIMED|\
                                   IPC_OPT_AND|IPC_OPT_OR|IPC_OPT_CONSUME)
+#define IPC_VALID_MBUF_OPT       (IPC_OPT_ISR|IPC_OPT_WAIT|IPC_OPT_TIMED)
+#define IPC_VALID_CHNL_OPT       (IPC_OPT_ISR|IPC_OPT_WAIT|IPC_OPT_TIMED)
+#define IPC_VALID_RWLOCK_OPT     (IPC_OPT_WAIT|IPC_OPT_TIMED)
+#define IPC_VALID_COND_OPT       (IPC_OPT_WAIT|IPC_OPT_TIMED)
+#define IPC_VALID_BARR_OPT       (IPC_OPT_WAIT|IPC_OPT_TIMED)
 
 
 
 /* NOTE: not compliant MISRA2004 18.4: Unions shall not be used. */
 union IpcDataDef
 {
-    TBase32  Value;                                /* 汻ݱĵֵַַ               */
     void*  Addr1;                                /* ָ¼ǵһָ                     */
     void** Addr2;                                /* ָϢʼĶָ                 */
 };
@@ -110,18 +152,30 @@ struct IpcContextDef
     TError*      Error;                           /* IPCĴ                      */
     void*        Owner;                           /* IPC߳                            */
     TObjNode     ObjNode;                         /* ߳IPCеڵ                  */
+#if (TCLC_IPC_WAITANY_ENABLE)
+    struct IpcContextDef* Sibling;                /* ͬʱȴIPCʱһ        */
+#endif
+#if ((TCLC_IPC_FLAGS_ENABLE) && (TCLC_IPC_FLAGS_INDEX_ENABLE))
+    TObjNode     FlagsNode;                       /* ߳¼ǵȴλĽڵ           */
+    TBase32      FlagsSeq;                        /* ߳¼ϵĵ˳           */
+#endif
 };
 typedef struct IpcContextDef TIpcContext;
 
+extern void uIpcInitQueue(TIpcQueue* pQueue, TProperty* pProperty);
 extern void uIpcInitContext(TIpcContext* pContext, void* pOwner);
-extern void uIpcSaveContext(TIpcContext* pContext, void* pIpc, TBase32 data, TBase32 len, TOption option,
+extern void uIpcSaveContext(TIpcContext* pContext, void* pIpc, void* pData, TBase32 len, TOption option,
                             TState* pState, TError* pError);
 extern void uIpcCleanContext(TIpcContext* pContext);
 extern void uIpcBlockThread(TIpcContext* pContext, TIpcQueue* pQueue, TTimeTick ticks);
+#if (TCLC_IPC_WAITANY_ENABLE)
+extern void uIpcBlockThreadAny(TIpcContext* pContext, TTimeTick ticks);
+#endif
 extern void uIpcUnblockThread(TIpcContext* pContext,  TState state, TError error, TBool* pHiRP);
 extern void uIpcUnblockAll(TIpcQueue* pQueue, TState state, TError error,
                            void** pData2, TBool* pHiRP);
 extern void uIpcSetPriority(TIpcContext* pContext, TPriority priority);
+extern void uIpcMoveThread(TIpcContext* pContext, void* pIpc, TIpcQueue* pQueue, TOption option);
 
 #endif
 
@@ -47,6 +47,9 @@ extern TState xMailBoxDelete(TMailBox* pMailbox, TError* pError);
 extern TState xMailBoxFlush(TMailBox* pMailbox, TError* pError);
 extern TState xMailboxReset(TMailBox* pMailbox, TError* pError);
 extern TState xMailBoxBroadcast(TMailBox* pMailbox, TMail* pMail2, TError* pError);
+#if (TCLC_IPC_WAITANY_ENABLE)
+extern TState uMailBoxTryReceive(TMailBox* pMailbox, TMail* pMail2, TBool* pHiRP, TError* pError);
+#endif
 
 #endif
 
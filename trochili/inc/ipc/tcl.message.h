@@ -39,10 +39,17 @@ struct MessageQueueCB
 {
     TProperty Property;      /* Ϣ       */
     void**    MsgPool;       /* Ϣ             */
-    TBase32     Capacity;      /* Ϣ           */
-    TBase32     MsgEntries;    /* ϢϢĿ   */
+    TBase32   Capacity;      /* Ϣ           */
+    TBase32   MsgEntries;    /* ϢϢĿ   */
+#if (TCLC_IPC_MQUE_LEVELS > 1U)
+    TBitMask  LevelMask;                           /* ǿȼλͼ0λӦȼ */
+    TIndex    LevelHead[TCLC_IPC_MQUE_LEVELS];     /* ȼζдָλ          */
+    TIndex    LevelTail[TCLC_IPC_MQUE_LEVELS];     /* ȼζжָλ          */
+    TBase32   LevelEntries[TCLC_IPC_MQUE_LEVELS];  /* ȼζϢĿ        */
+#else
     TIndex    Head;          /* Ϣдָλ     */
     TIndex    Tail;          /* Ϣжָλ     */
+#endif
     TMQStatus Status;        /* Ϣ״̬           */
     TIpcQueue Queue;         /* Ϣе߳ */
 };
@@ -56,10 +63,17 @@ extern TState xMQReceive(TMsgQueue* pMsgQue, TMessage* pMsg2,
                                 TOption option, TTimeTick timeo, TError* pError);
 extern TState xMQSend(TMsgQueue* pMsgQue, TMessage* pMsg2,
                              TOption option, TTimeTick timeo, TError* pError);
+extern TState xMQReceiveBatch(TMsgQueue* pMsgQue, TMessage* pMsgs, TBase32 max, TBase32* pGot,
+                              TOption option, TTimeTick timeo, TError* pError);
+extern TState xMQSendBatch(TMsgQueue* pMsgQue, TMessage* pMsgs, TBase32 n, TBase32* pSent,
+                           TOption option, TTimeTick timeo, TError* pError);
 extern TState xMQBroadcast(TMsgQueue* pMsgQue, TMessage* pMsg2, TError* pError);
 extern TState xMQDelete(TMsgQueue* pMsgQue, TError* pError);
 extern TState xMQReset(TMsgQueue* pMsgQue, TError* pError);
 extern TState xMQFlush(TMsgQueue* pMsgQue, TError* pError);
+#if (TCLC_IPC_WAITANY_ENABLE)
+extern TState uMsgQueueTryReceive(TMsgQueue* pMsgQue, TMessage* pMsg2, TBool* pHiRP, TError* pError);
+#endif
 
 #endif
 
@@ -0,0 +1,54 @@
+/*************************************************************************************************
+ *                                     Trochili RTOS Kernel                                      *
+ *                                  Copyright(C) 2016 LIUXUMING                                  *
+ *                                       www.trochili.com                                        *
+ *************************************************************************************************/
+#ifndef _TCL_MSGBUF_H
+#define _TCL_MSGBUF_H
+
+#include "tcl.types.h"
+#include "tcl.config.h"
+#include "tcl.object.h"
+#include "tcl.ipc.h"
+#include "tcl.thread.h"
+
+#if ((TCLC_IPC_ENABLE)&&(TCLC_IPC_MSGBUF_ENABLE))
+
+/* Ϣ¼ڻа4ֽڶ룬ÿ¼ǰһ32λͷ */
+#define MSGBUF_ALIGN_BYTES    (4U)
+#define MSGBUF_HEAD_BYTES     (sizeof(TBase32))
+#define MSGBUF_WRAP_MARK      (0xFFFFFFFFU)      /* Ʊǣָʱػʼλ */
+
+/* Ϣṹ */
+struct MsgBufferDef
+{
+    TProperty Property;      /* Ϣ                         */
+    TByte*    Buffer;        /* ûṩĻλ                       */
+    TBase32   Capacity;      /* λֽ                           */
+    TBase32   Used;          /* Ѿύļ¼ռõֽ(ͷ) */
+    TBase32   Entries;       /* Ѿύδͷŵļ¼Ŀ               */
+    TIndex    Head;          /* дλãһ¼￪ʼ               */
+    TIndex    Tail;          /* λãһ¼￪ʼ             */
+    TIndex    Reserved;      /* Ԥ¼λ                           */
+    TBase32   ReservedBytes; /* Ԥֽ0ʾûԤ              */
+    TBase32   PeekedBytes;   /* ڶȡļ¼ռõֽ0ʾûжȡ  */
+    TIpcQueue Queue;         /* Ϣ߳                   */
+};
+typedef struct MsgBufferDef TMsgBuffer;
+
+extern TState xMsgBufCreate(TMsgBuffer* pMsgBuf, void* pAddr, TBase32 bytes, TProperty property,
+                            TError* pError);
+extern TState xMsgBufDelete(TMsgBuffer* pMsgBuf, TError* pError);
+extern TState xMsgBufReset(TMsgBuffer* pMsgBuf, TError* pError);
+extern TState xMsgBufFlush(TMsgBuffer* pMsgBuf, TError* pError);
+extern TState xMsgBufReserve(TMsgBuffer* pMsgBuf, TBase32 length, void** pAddr2,
+                             TOption option, TTimeTick timeo, TError* pError);
+extern TState xMsgBufCommit(TMsgBuffer* pMsgBuf, TBase32 length, TError* pError);
+extern TState xMsgBufPeek(TMsgBuffer* pMsgBuf, void** pAddr2, TBase32* pLength,
+                          TOption option, TTimeTick timeo, TError* pError);
+extern TState xMsgBufRelease(TMsgBuffer* pMsgBuf, TError* pError);
+
+#endif
+
+#endif /* _TCL_MSGBUF_H */
+
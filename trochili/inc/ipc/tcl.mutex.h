@@ -18,7 +18,7 @@ struct MutexDef
     TProperty Property;      /* ̵߳ĵȲԵ */
     TThread*  Owner;         /* ռлźָ߳       */
     TBase32   Nest;          /* źǶ׼         */
-    TPriority Priority;      /* ceiling value                  */
+    TPriority Priority;      /* 컨ȼ߼̳еõȼ */
     TIpcQueue Queue;         /* ź߳       */
     TObjNode  LockNode;      /* ɻ             */   
 };
@@ -30,6 +30,11 @@ extern TState xMutexLock(TMutex* pMutex, TOption option, TTimeTick timeo, TError
 extern TState xMutexFree(TMutex* pMutex, TError* pError);
 extern TState xMutexReset(TMutex* pMutex, TError* pError);
 extern TState xMutexFlush(TMutex* pMutex, TError* pError);
+extern void uMutexResetPriority(TMutex* pMutex, TPriority priority, TBool* pHiRP);
+#if (TCLC_IPC_CONDVAR_ENABLE)
+extern TState uMutexRelease(TMutex* pMutex, TBase32* pNest, TBool* pHiRP, TError* pError);
+extern void uMutexHandOver(TMutex* pMutex, TIpcContext* pContext, TBool* pHiRP);
+#endif
 
 #endif
 
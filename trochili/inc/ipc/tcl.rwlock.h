@@ -0,0 +1,44 @@
+/*************************************************************************************************
+ *                                     Trochili RTOS Kernel                                      *
+ *                                  Copyright(C) 2016 LIUXUMING                                  *
+ *                                       www.trochili.com                                        *
+ *************************************************************************************************/
+#ifndef _TCL_RWLOCK_H
+#define _TCL_RWLOCK_H
+
+#include "tcl.types.h"
+#include "tcl.object.h"
+#include "tcl.ipc.h"
+#include "tcl.thread.h"
+
+#if ((TCLC_IPC_ENABLE)&&(TCLC_IPC_MUTEX_ENABLE)&&(TCLC_IPC_RWLOCK_ENABLE))
+
+/* дṹ壬ȴд߳ڻУȴ߳ڸ */
+struct RwLockDef
+{
+    TProperty Property;      /* дĵȲԵ         */
+    TThread*  Writer;        /* ռдָ߳                 */
+    TBase32   Nest;          /* дǶ׼                   */
+    TBase32   Readers;       /* ռеĴ                   */
+    TThread*  Upgrader;      /* ڵȴѶΪд߳     */
+    TPriority Priority;      /* д컨ȼ                 */
+    TIpcQueue Queue;         /* д߳               */
+    TObjNode  LockNode;      /* д߳еĽڵ           */
+};
+typedef struct RwLockDef TRwLock;
+
+extern TState xRwLockCreate(TRwLock* pRwLock, TPriority priority, TProperty property,
+                            TError* pError);
+extern TState xRwLockDelete(TRwLock* pRwLock, TError* pError);
+extern TState xRwLockReset(TRwLock* pRwLock, TError* pError);
+extern TState xRwLockFlush(TRwLock* pRwLock, TError* pError);
+extern TState xRwLockRead(TRwLock* pRwLock, TOption option, TTimeTick timeo, TError* pError);
+extern TState xRwLockWrite(TRwLock* pRwLock, TOption option, TTimeTick timeo, TError* pError);
+extern TState xRwLockFree(TRwLock* pRwLock, TError* pError);
+extern TState xRwLockUpgrade(TRwLock* pRwLock, TOption option, TTimeTick timeo, TError* pError);
+extern TState xRwLockDowngrade(TRwLock* pRwLock, TError* pError);
+
+#endif
+
+#endif /*_TCL_RWLOCK_H*/
+
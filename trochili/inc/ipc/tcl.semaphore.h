@@ -31,6 +31,9 @@ extern TState xSemaphoreReset(TSemaphore* pSemaphore, TError* pError);
 extern TState xSemaphoreRelease(TSemaphore* pSemaphore, TOption option, TTimeTick timeo, TError* pError);
 extern TState xSemaphoreObtain(TSemaphore* pSemaphore, TOption option, TTimeTick timeo, TError* pError);
 extern TState xSemaphoreFlush(TSemaphore* pSemaphore, TError* pError);
+#if (TCLC_IPC_WAITANY_ENABLE)
+extern TState uSemaphoreTryObtain(TSemaphore* pSemaphore, TBool* pHiRP, TError* pError);
+#endif
 #endif
 
 #endif /*_TCL_SEMAPHORE_H*/
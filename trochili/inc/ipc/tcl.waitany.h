@@ -0,0 +1,44 @@
+/*************************************************************************************************
+ *                                     Trochili RTOS Kernel                                      *
+ *                                  Copyright(C) 2016 LIUXUMING                                  *
+ *                                       www.trochili.com                                        *
+ *************************************************************************************************/
+#ifndef _TCL_WAITANY_H
+#define _TCL_WAITANY_H
+
+#include "tcl.types.h"
+#include "tcl.config.h"
+#include "tcl.ipc.h"
+
+#if ((TCLC_IPC_ENABLE)&&(TCLC_IPC_WAITANY_ENABLE))
+
+/* ȴֵ֧IPC */
+enum IpcWaitTypeDef
+{
+    eWaitSemaphore = 0,      /* üź                                   */
+    eWaitMailBox,            /* ȡʼ                                   */
+    eWaitMsgQueue,           /* ϢжȡϢ                               */
+    eWaitFlags               /* ¼                                     */
+};
+typedef enum IpcWaitTypeDef TIpcWaitType;
+
+/* ȴʱÿIPCStateErrorContextԱںʹ */
+struct IpcWaitItemDef
+{
+    TIpcWaitType Type;       /* IPC                                      */
+    void*        Object;     /* IPCַ                                      */
+    void*        Data;       /* ʼϢĵַ¼ǵ         */
+    TOption      Option;     /* ¼ǵĽշʽ(AND/OR/CONSUME)               */
+    TState       State;      /* IPCķʽ                              */
+    TError       Error;      /* IPCϸʽ                          */
+    TIpcContext  Context;    /* ߳ڸIPCʱʹõ              */
+};
+typedef struct IpcWaitItemDef TIpcWaitItem;
+
+extern TState xIpcWaitAny(TIpcWaitItem* pItems, TBase32 number, TIndex* pIndex,
+                          TOption option, TTimeTick timeo, TError* pError);
+
+#endif
+
+#endif /* _TCL_WAITANY_H */
+
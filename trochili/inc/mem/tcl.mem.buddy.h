@@ -12,22 +12,30 @@
 
 #if ((TCLC_MEMORY_ENABLE) && (TCLC_MEMORY_BUDDY_ENABLE))
 
-#define MEM_BUDDY_PAGE_TAGS  ((TCLC_MEMORY_BUDDY_PAGES + 31u) >> 5u)
-#define MEM_BUDDY_NODE_TAGS (TCLC_MEMORY_BUDDY_PAGES * 2u - 1u)
+#define MEM_BUDDY_ORDERS    (32U)
+
+/* ڴڵ㣬ڿڴҳ */
+struct BuddyNodeDef
+{
+    struct BuddyNodeDef* Next;
+    struct BuddyNodeDef* Prev;
+};
+typedef struct BuddyNodeDef TBuddyNode;
 
 typedef struct MemBuddyDef
 {
-    TProperty Property;                       /* ڴҳ                      */
-    TChar*    PageAddr;                       /* ڴʼַ            */
-    TBase32   PageSize;                       /* ڴҳС                        */
-    TBase32   PageNbr;                        /* ڴҳĿ                        */
-    TBase32   PageAvail;                      /* ڴҳĿ                    */
-    TBitMask  PageTags[MEM_BUDDY_PAGE_TAGS];  /* ڴҳǷñ                */
-    TBase32   NodeNbr;
-    TByte     NodeTags[MEM_BUDDY_NODE_TAGS];
+    TProperty   Property;                     /* ڴҳ                      */
+    TChar*      PageAddr;                     /* ڴʼַ            */
+    TBase32     PageSize;                     /* ڴҳС                        */
+    TBase32     PageNbr;                      /* ڴҳĿ                        */
+    TBase32     PageAvail;                    /* ڴҳĿ                    */
+    TByte*      PageTags;                     /* ڴҳ飬ɵṩ      */
+    TBase32     OrderMap;                     /* ǿտ                  */
+    TBuddyNode* FreeList[MEM_BUDDY_ORDERS];   /* ÿӦĿڴ      */
 } TMemBuddy;
 
-extern TState xBuddyCreate(TMemBuddy* pBuddy, TChar* pAddr, TBase32 pages, TBase32 pagesize, TError* pError);
+extern TState xBuddyCreate(TMemBuddy* pBuddy, TChar* pAddr, TBase32 pages, TBase32 pagesize,
+                           TByte* pTags, TError* pError);
 extern TState xBuddyDelete(TMemBuddy* pBuddy, TError* pError);
 extern TState xBuddyMemMalloc(TMemBuddy* pBuddy, TBase32 length, void** pAddr, TError* pError);
 extern TState xBuddyMemFree(TMemBuddy* pBuddy, void* pAddr, TError* pError);
@@ -0,0 +1,65 @@
+/*************************************************************************************************
+ *                                     Trochili RTOS Kernel                                      *
+ *                                  Copyright(C) 2016 LIUXUMING                                  *
+ *                                       www.trochili.com                                        *
+ *************************************************************************************************/
+#ifndef _TCLC_MEMORY_HEAP_H
+#define _TCLC_MEMORY_HEAP_H
+
+#include "tcl.types.h"
+#include "tcl.config.h"
+#include "tcl.memory.h"
+#include "tcl.mem.pool.h"
+#include "tcl.mem.buddy.h"
+
+#if ((TCLC_MEMORY_ENABLE) && (TCLC_MEMORY_HEAP_ENABLE) && (TCLC_MEMORY_POOL_ENABLE))
+
+/* ּڴѽṹ塣iڴҳصҳССҳС2^iڴҳص
+   ˳ţͷڴʱֻݵַΧҵڴҳ */
+struct MemHeapDef
+{
+    TProperty  Property;                                 /* ּڴ           */
+    TBase32    Classes;                                  /* ڴҳؼ             */
+    TBase32    MinLog2;                                  /* СҳС(2ݴ)      */
+    TChar*     HeapAddr;                                 /* ʼַ     */
+    TChar*     HeapEnd;                                  /* Ľַ     */
+    TMemPool   Pools[TCLC_MEMORY_HEAP_CLASSES];          /* ڴҳ             */
+    TBase32    PageInuse[TCLC_MEMORY_HEAP_CLASSES];      /* ѷڴҳĿ     */
+    TBase32    PagePeak[TCLC_MEMORY_HEAP_CLASSES];       /* ѷҳʷֵ */
+    TBase32    Spills[TCLC_MEMORY_HEAP_CLASSES];         /* ʱתϼĴ */
+#if (TCLC_MEMORY_BUDDY_ENABLE)
+    TMemBuddy* pBuddy;                                   /* ڴʹõĻϵͳ   */
+    TBase32    BigInuse;                                 /* ϵͳѷĿ   */
+    TBase32    BigPeak;                                  /* ѷʷֵ   */
+#endif
+};
+typedef struct MemHeapDef TMemHeap;
+
+/* ּڴͳϢṹ */
+struct HeapInfoDef
+{
+    TBase32 Classes;                                     /* ڴҳؼ             */
+    TBase32 PageSize[TCLC_MEMORY_HEAP_CLASSES];          /* ڴҳС           */
+    TBase32 PageNbr[TCLC_MEMORY_HEAP_CLASSES];           /* ڴҳĿ           */
+    TBase32 PageInuse[TCLC_MEMORY_HEAP_CLASSES];         /* ѷڴҳĿ     */
+    TBase32 PagePeak[TCLC_MEMORY_HEAP_CLASSES];          /* ѷҳʷֵ */
+    TBase32 Spills[TCLC_MEMORY_HEAP_CLASSES];            /* ʱתϼĴ */
+    TBase32 BigInuse;                                    /* ϵͳѷĿ   */
+    TBase32 BigPeak;                                     /* ѷʷֵ   */
+};
+typedef struct HeapInfoDef THeapInfo;
+
+extern TState xHeapCreate(TMemHeap* pHeap, void* pAddr, TBase32 classes, TBase32 minsize,
+                          TBase32* pPages, TProperty property, TError* pError);
+extern TState xHeapDelete(TMemHeap* pHeap, TError* pError);
+#if (TCLC_MEMORY_BUDDY_ENABLE)
+extern TState xHeapSetFallback(TMemHeap* pHeap, TMemBuddy* pBuddy, TError* pError);
+#endif
+extern TState xHeapMemMalloc(TMemHeap* pHeap, TBase32 length, void** pAddr2, TError* pError);
+extern TState xHeapMemFree(TMemHeap* pHeap, void* pAddr, TError* pError);
+extern TState xHeapGetInfo(TMemHeap* pHeap, THeapInfo* pInfo, TError* pError);
+
+#endif
+
+#endif /* _TCLC_MEMORY_HEAP_H  */
+
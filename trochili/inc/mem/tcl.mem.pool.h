@@ -23,12 +23,14 @@ struct MemPoolDef
     TBase32   PageSize;                   /* ڴҳС                        */
     TBase32   PageNbr;                    /* ڴҳĿ                        */
     TBase32   PageAvail;                  /* ڴҳĿ                    */
+    TBase32   PageFresh;                  /* δڴҳʼ      */
     TBase32   PageTags[MEM_PAGE_TAGS];    /* ڴҳǷñ                */
-    TObjNode* PageList;                   /* ڴҳͷָ              */
+    void*     PageList;                   /* ѻڴҳ(LIFO)ͷָ  */
 };
 typedef struct MemPoolDef TMemPool;
 
-extern TState xMemPoolCreate(TMemPool* pPool, void* pData, TBase32 pages, TBase32 pgsize, TError* pError);
+extern TState xMemPoolCreate(TMemPool* pPool, void* pData, TBase32 pages, TBase32 pgsize,
+                             TProperty property, TError* pError);
 extern TState xMemPoolDelete(TMemPool* pPool, TError* pError);
 extern TState xPoolMemMalloc(TMemPool* pPool, void** pAddr2, TError* pError);
 extern TState xPoolMemFree (TMemPool* pPool, void* pAddr, TError* pError);
@@ -0,0 +1,57 @@
+/*************************************************************************************************
+ *                                     Trochili RTOS Kernel                                      *
+ *                                  Copyright(C) 2016 LIUXUMING                                  *
+ *                                       www.trochili.com                                        *
+ *************************************************************************************************/
+#ifndef _TCLC_MEMORY_SLAB_H
+#define _TCLC_MEMORY_SLAB_H
+
+#include "tcl.types.h"
+#include "tcl.config.h"
+#include "tcl.memory.h"
+#include "tcl.mem.pool.h"
+#include "tcl.mem.buddy.h"
+
+#if ((TCLC_MEMORY_ENABLE) && (TCLC_MEMORY_SLAB_ENABLE) && \
+     (TCLC_MEMORY_POOL_ENABLE) && (TCLC_MEMORY_BUDDY_ENABLE))
+
+/* 8ֽڶ룬߳ջ˫ݵĶҪ */
+#define SLAB_ALIGN_BYTES     (8U)
+#define SLAB_ALIGN(bytes)    (((bytes) + SLAB_ALIGN_BYTES - 1U) & ~(SLAB_ALIGN_BYTES - 1U))
+
+/* Ͷ */
+typedef void (*TSlabCtor)(void* pObject);
+typedef void (*TSlabDtor)(void* pObject);
+
+/* 󻺴ṹ塣ÿslabǴڴҳػ߻ϵͳһڴ棬ͷslabָ룬
+   ɸۣÿڶ֮󱣴жָͶ״̬ǣ˶
+   ͷ֮󣬹캯״̬ᱻƻظͷҲܱ */
+struct MemSlabDef
+{
+    TProperty  Property;                      /* 󻺴                      */
+    TBase32    ObjSize;                       /* ֽ                        */
+    TBase32    SlotSize;                      /* ֽ                      */
+    TBase32    SlabObjs;                      /* ÿslabеĶĿ              */
+    TBase32    SlabBytes;                     /* ÿslabֽ                  */
+    TMemPool*  pPool;                         /* ṩslabڴҳ                */
+    TMemBuddy* pBuddy;                        /* ṩslabĻϵͳ                */
+    TSlabCtor  Ctor;                          /* 캯                      */
+    TSlabDtor  Dtor;                          /*                       */
+    void*      FreeList;                      /* ж(LIFO)                */
+    void*      SlabList;                      /* slab                          */
+    TBase32    ObjAvail;                      /* жĿ                      */
+    TBase32    ObjInuse;                      /* ѷĿ                    */
+    TBase32    ObjPeak;                       /* ѷĿʷֵ        */
+};
+typedef struct MemSlabDef TMemSlab;
+
+extern TState xSlabCreate(TMemSlab* pSlab, TBase32 size, TBase32 objs, TMemPool* pPool,
+                          TMemBuddy* pBuddy, TSlabCtor ctor, TSlabDtor dtor, TError* pError);
+extern TState xSlabDelete(TMemSlab* pSlab, TError* pError);
+extern TState xSlabMalloc(TMemSlab* pSlab, void** pObject2, TError* pError);
+extern TState xSlabFree(TMemSlab* pSlab, void* pObject, TError* pError);
+
+#endif
+
+#endif /* _TCLC_MEMORY_SLAB_H  */
+
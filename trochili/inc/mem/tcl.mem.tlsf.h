@@ -0,0 +1,83 @@
+/*************************************************************************************************
+ *                                     Trochili RTOS Kernel                                      *
+ *                                  Copyright(C) 2016 LIUXUMING                                  *
+ *                                       www.trochili.com                                        *
+ *************************************************************************************************/
+#ifndef _TCLC_MEMORY_TLSF_H
+#define _TCLC_MEMORY_TLSF_H
+
+#include "tcl.types.h"
+#include "tcl.config.h"
+#include "tcl.memory.h"
+
+#if ((TCLC_MEMORY_ENABLE) && (TCLC_MEMORY_TLSF_ENABLE))
+
+/* 32λλͼһఴ1 << TCLC_MEMORY_TLSF_MAX_LOG2㣬ܳ31λ
+   ҲССһ(64λָ)ǵķΧ */
+#if (TCLC_MEMORY_TLSF_SLI_LOG2 > 5U)
+#error "TCLC_MEMORY_TLSF_SLI_LOG2 must not exceed 5"
+#endif
+#if ((TCLC_MEMORY_TLSF_MAX_LOG2 > 31U) || \
+     (TCLC_MEMORY_TLSF_MAX_LOG2 < (TCLC_MEMORY_TLSF_SLI_LOG2 + 3U)))
+#error "TCLC_MEMORY_TLSF_MAX_LOG2 out of range"
+#endif
+
+/* ڴߴ簴ָ볤ȶ룬Сһา[0, TLSF_SMALL_BYTES) */
+#define TLSF_ALIGN_BYTES     (sizeof(void*))
+#define TLSF_ALIGN_LOG2      ((sizeof(void*) == 8U) ? 3U : 2U)
+#define TLSF_SL_COUNT        (0x1U << TCLC_MEMORY_TLSF_SLI_LOG2)
+#define TLSF_FL_SHIFT        (TCLC_MEMORY_TLSF_SLI_LOG2 + TLSF_ALIGN_LOG2)
+#define TLSF_SMALL_BYTES     (0x1U << TLSF_FL_SHIFT)
+#define TLSF_FL_COUNT        (TCLC_MEMORY_TLSF_MAX_LOG2 - TLSF_FL_SHIFT + 1U)
+
+/* TLSFڴṹָֻڴʱЧռõڴ */
+struct TlsfBlockDef
+{
+    struct TlsfBlockDef* PrevPhys;            /* ַǰһڴ            */
+    TBase32              Size;                /* ֽλǿб    */
+    struct TlsfBlockDef* NextFree;            /* ͬһеһڴ      */
+    struct TlsfBlockDef* PrevFree;            /* ͬһеһڴ      */
+};
+typedef struct TlsfBlockDef TTlsfBlock;
+
+/* TLSFѿƿṹ */
+struct MemTlsfDef
+{
+    TProperty   Property;                     /* TLSF                        */
+    TChar*      HeapAddr;                     /* ڴʼַ            */
+    TBase32     HeapBytes;                    /* ڴֽ                */
+    TBase32     FreeBytes;                    /* ڴֽ֮        */
+    TBase32     UsedBytes;                    /* ѷڴֽ֮      */
+    TBase32     PeakBytes;                    /* ѷֽʷֵ          */
+    TBase32     FreeBlocks;                   /* ڴĿ                    */
+    TBase32     FlMap;                        /* һǿձ                  */
+    TBase32     SlMap[TLSF_FL_COUNT];         /* ǿձ                  */
+    TTlsfBlock* Blocks[TLSF_FL_COUNT][TLSF_SL_COUNT]; /* Ŀ    */
+};
+typedef struct MemTlsfDef TMemTlsf;
+
+/* TLSFͳϢṹ */
+struct TlsfInfoDef
+{
+    TBase32 HeapBytes;                        /* ڴֽ                */
+    TBase32 FreeBytes;                        /* ڴֽ֮        */
+    TBase32 UsedBytes;                        /* ѷڴֽ֮      */
+    TBase32 PeakBytes;                        /* ѷֽʷֵ          */
+    TBase32 FreeBlocks;                       /* ڴĿ                    */
+    TBase32 LargestFree;                      /* ڴֽ      */
+    TBase32 Fragment;                         /* Ƭ(ٷֱ)                    */
+};
+typedef struct TlsfInfoDef TTlsfInfo;
+
+extern TState xTlsfCreate(TMemTlsf* pTlsf, void* pAddr, TBase32 bytes, TError* pError);
+extern TState xTlsfDelete(TMemTlsf* pTlsf, TError* pError);
+extern TState xTlsfMemMalloc(TMemTlsf* pTlsf, TBase32 length, void** pAddr2, TError* pError);
+extern TState xTlsfMemFree(TMemTlsf* pTlsf, void* pAddr, TError* pError);
+extern TState xTlsfMemRealloc(TMemTlsf* pTlsf, void* pAddr, TBase32 length, void** pAddr2,
+                              TError* pError);
+extern TState xTlsfGetInfo(TMemTlsf* pTlsf, TTlsfInfo* pInfo, TError* pError);
+
+#endif
+
+#endif /* _TCLC_MEMORY_TLSF_H  */
+
@@ -20,7 +20,11 @@
 #define MEM_ERR_DBL_FREE           (0x1<<5)                      /* ͷŵڴûб       */
 #define MEM_ERR_POOL_FULL          (0x1<<6)                      /* ͷŵڴûб       */
 
-#define MEM_PROP_READY (0x1 << 0)
+#define MEM_PROP_NONE              (0x0U)
+#define MEM_PROP_READY             (0x1 << 0)                    /* ڴṹѾʼ     */
+#define MEM_PROP_ZERO_ALLOC        (0x1 << 1)                    /* ڴʱ             */
+#define MEM_PROP_ZERO_FREE         (0x1 << 2)                    /* ͷڴʱ             */
+#define MEM_VALID_POOL_PROP        (MEM_PROP_ZERO_ALLOC | MEM_PROP_ZERO_FREE)
 
 #endif
 
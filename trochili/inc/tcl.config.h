@@ -28,20 +28,52 @@
 #define TCLC_THREAD_STACK_BARRIER_VALUE (0x5A5A5A5A)
 #define TCLC_THREAD_STACK_ALARM_RATIO   (90U)         /* n%, ջʹֵٷֱ         */
 
+/* ֪߳ͨ */
+#define TCLC_THREAD_NOTIFY_ENABLE       (1)
+
 /* IPC */
 #define TCLC_IPC_ENABLE                 (1)
 #define TCLC_IPC_SEMAPHORE_ENABLE       (1)
 #define TCLC_IPC_MUTEX_ENABLE           (1)
+#define TCLC_IPC_RWLOCK_ENABLE          (1)           /* д,              */
+#define TCLC_IPC_CONDVAR_ENABLE         (1)           /* ,            */
+#define TCLC_IPC_BARRIER_ENABLE         (1)           /* ߳                       */
 #define TCLC_IPC_MAILBOX_ENABLE         (1)
 #define TCLC_IPC_MQUE_ENABLE            (1)
+#define TCLC_IPC_MQUE_LEVELS            (1U)          /* ϢȼĿ,1~32        */
 #define TCLC_IPC_FLAGS_ENABLE           (1)
+#define TCLC_IPC_FLAGS_INDEX_ENABLE     (1)           /* ¼ǰȴλ߳   */
+#define TCLC_IPC_FLAGS_64BIT_ENABLE     (0)           /* ¼ʹ64λTFlagMask        */
+#define TCLC_IPC_MSGBUF_ENABLE          (1)
+#define TCLC_IPC_CHANNEL_ENABLE         (1)           /* ߵͨ       */
+#define TCLC_IPC_WAITANY_ENABLE         (1)           /* ߳ͬʱȴIPC        */
 #define TCLC_IPC_FIFO_ENABLE            (1)
 #define TCLC_IPC_TIMER_ENABLE           (1)
+#define TCLC_IPC_PRIORITY_INDEX_ENABLE  (1)           /* ȼʹλͼ     */
 
 /* ʱ */
 #define TCLC_TIMER_ENABLE               (1)
 #define TCLC_TIMER_DAEMON_ENABLE        (1)
-#define TCLC_TIMER_WHEEL_SIZE           (32U)
+#define TCLC_TIMER_WHEEL_BITS           (5U)          /* ÿʱַĿλ       */
+#define TCLC_TIMER_WHEEL_SIZE           (0x1U << TCLC_TIMER_WHEEL_BITS)
+#define TCLC_TIMER_WHEEL_LEVELS         (4U)          /* ʱּ                     */
+
+/* ޽(tickless)ãֻIDLE߳̾ʱֹͣжϣֱĶʱʱ */
+#define TCLC_TICKLESS_ENABLE            (0)
+#define TCLC_TICKLESS_MIN_TICKS         (2U)          /* ߵٽ           */
+#define TCLC_TICKLESS_MAX_TICKS         (1000U)       /* ߵ           */
+
+/* ̽ãʹôڼͳں */
+#define TCLC_PROBE_ENABLE               (0)
+#define TCLC_PROBE_LATENCY_ENABLE       (1)           /* ߳лжϵASRͻӳ  */
+#define TCLC_PROBE_HISTOGRAM_BUCKETS    (8U)          /* ӳֱͼͰ               */
+#define TCLC_PROBE_BUCKET_SHIFT         (6U)          /* 0Ͱ2^n       */
+#define TCLC_PROBE_CPU_STATS_ENABLE     (1)           /* ̺߳жռõĴ     */
+
+/* ں¼¼ãԶƼ¼д뻷λתPerfettoʽ */
+#define TCLC_TRACE_ENABLE               (0)
+#define TCLC_TRACE_RECORDS              (256U)        /* ¼2    */
+#define TCLC_TRACE_CLOCK_FREQ           (TCLC_CPU_CLOCK_FREQ) /* ʱƵ         */
 
 /* жϹ */
 #define TCLC_IRQ_ENABLE                 (1)           /* ʹжϹ               */
@@ -53,7 +85,12 @@
 #define TCLC_MEMORY_POOL_ENABLE         (1)
 #define TCLC_MEMORY_POOL_PAGES          (256U)       /* ̶ҳСڴܹڴҳ */
 #define TCLC_MEMORY_BUDDY_ENABLE        (1)
-#define TCLC_MEMORY_BUDDY_PAGES         (64)         /* ڴ㷨ܹڴҳ         */
+#define TCLC_MEMORY_TLSF_ENABLE         (1)
+#define TCLC_MEMORY_TLSF_MAX_LOG2       (16U)        /* TLSFܹڴֽ(2ݴ)    */
+#define TCLC_MEMORY_TLSF_SLI_LOG2       (3U)         /* TLSFÿһµĶ(2ݴ)  */
+#define TCLC_MEMORY_SLAB_ENABLE         (1)          /* 󻺴棬ڴҳغͻڴ㷨     */
+#define TCLC_MEMORY_HEAP_ENABLE         (1)          /* ּڴѣڴҳ                 */
+#define TCLC_MEMORY_HEAP_CLASSES        (4U)         /* ּڴѵ                     */
 
 /* û첽жϷ߳ȼʱƬ */
 #define TCLC_IRQ_ASR_PRIORITY           (2U)
@@ -79,5 +116,12 @@
 #define TCLC_CPU_MINIMAL_STACK          (256U)
 #define TCLC_CPU_IRQ_NUM                (73)
 #define TCLC_CPU_CLOCK_FREQ             (72U*1024U*1024U)
+#define TCLC_CPU_IRQ_PRIO_BITS          (4U)          /* ʵֵжȼλ     */
+
+/* ںжȼޡٽֻȼֵСڸֵжϣֵС()ж
+   ԶᱻںƳ٣ЩжϵķܵκںAPI
+   עжʱں˰ѸжϵȼΪֵ
+   Ϊ0ʱٽȫж(PRIMASK) */
+#define TCLC_CPU_KERNEL_IRQ_PRIO        (8U)
 
 #endif /* _TCL_CONFIG_H */
@@ -11,6 +11,7 @@
 #include "tcl.cpu.h"
 #include "tcl.debug.h"
 #include "tcl.thread.h"
+#include "tcl.probe.h"
 
 #if (TCLC_IRQ_ENABLE)
 
@@ -37,6 +38,9 @@ typedef struct
     TISR       ISR;                                  /* ͬжϴ              */
     TThread*   ASR;                                  /* 첽жϴ߳              */
     TArgument  Argument;                             /* ж                  */
+#if ((TCLC_PROBE_ENABLE) && (TCLC_PROBE_LATENCY_ENABLE))
+    TLatencyStats Latency;                           /* жϵASRеӳͳ       */
+#endif
 } TIrqVector;
 
 /* ISRͶ */
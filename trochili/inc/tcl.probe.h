@@ -0,0 +1,85 @@
+/*************************************************************************************************
+ *                                     Trochili RTOS Kernel                                      *
+ *                                  Copyright(C) 2016 LIUXUMING                                  *
+ *                                       www.trochili.com                                        *
+ *************************************************************************************************/
+#ifndef _TCL_PROBE_H
+#define _TCL_PROBE_H
+
+#include "tcl.types.h"
+#include "tcl.config.h"
+
+#if (TCLC_PROBE_ENABLE)
+
+#define PROBE_ERR_NONE               (0x0U)
+#define PROBE_ERR_FAULT              (0x1<<0)           /* һԴ                          */
+#define PROBE_ERR_UNREADY            (0x1<<1)           /* ͳƵĶδʼ                */
+
+#if (TCLC_PROBE_LATENCY_ENABLE)
+/* ӳͳͶ */
+#define PROBE_LATENCY_SWITCH         (0U)               /* PendSV뵽˳лʱ  */
+#define PROBE_LATENCY_SCHEDULE       (1U)               /* ж˳ʱȵ߳*/
+#define PROBE_LATENCY_ASR            (2U)               /* xIrqEnterISRڵӦASRʼ   */
+#define PROBE_LATENCY_THREAD         (3U)               /* ߳̽еʼ          */
+#define PROBE_LATENCY_IRQ_OFF        (4U)               /* ٽĹжʱ            */
+
+/* ӳͳƽṹ壬λǴ */
+struct LatencyStatsDef
+{
+    TBase32 Count;                                      /*                             */
+    TBase32 Min;                                        /* Сӳ                            */
+    TBase32 Max;                                        /* ӳ                            */
+    TBase32 Histogram[TCLC_PROBE_HISTOGRAM_BUCKETS];    /* 2Ϊ׵Ķֱֲͼ             */
+};
+typedef struct LatencyStatsDef TLatencyStats;
+#endif
+
+#if (TCLC_PROBE_CPU_STATS_ENABLE)
+/* ռͳƽṹ */
+struct ThreadStatsDef
+{
+    TTimeStamp Cycles;                                  /* ۼռõĴ              */
+    TBase32    SwitchIn;                                /* леĴжϽ  */
+    TBase32    Preemptions;                             /* ھ״̬ʱлȥĴ      */
+    TBase32    Blocks;                                  /* ʱĴ  */
+};
+typedef struct ThreadStatsDef TThreadStats;
+#endif
+
+/* ߳̽ṹ */
+struct ThreadProbeDef
+{
+#if (TCLC_PROBE_LATENCY_ENABLE)
+    TBool          Pending;                             /* ߳Ѿûпʼ        */
+    TBase32        Stamp;                               /* ߳̾жϽʱڼ    */
+    TLatencyStats* pIrqStats;                           /* ̵߳жͳ        */
+    TLatencyStats  Latency;                             /* ̻߳ӳͳ                    */
+#endif
+#if (TCLC_PROBE_CPU_STATS_ENABLE)
+    TThreadStats   Stats;                               /* ̴߳ռͳ                  */
+#endif
+};
+typedef struct ThreadProbeDef TThreadProbe;
+
+extern void uProbeSwitchEnter(void);
+extern void uProbeSwitchLeave(void);
+extern void uProbeIrqOffEnter(void);
+extern void uProbeIrqOffLeave(void);
+
+#if (TCLC_PROBE_LATENCY_ENABLE)
+extern void uProbeThreadReady(TThreadProbe* pProbe);
+extern void uProbeIrqWakeup(TThreadProbe* pProbe, TLatencyStats* pStats, TBase32 stamp);
+extern void uProbeScheduleMark(void);
+extern TState xProbeGetLatency(TIndex type, TArgument object, TLatencyStats* pStats, TError* pError);
+#endif
+
+#if (TCLC_PROBE_CPU_STATS_ENABLE)
+struct ThreadDef;
+extern void uProbeIntrEnter(void);
+extern void uProbeIntrLeave(void);
+extern TState xProbeGetThreadStats(struct ThreadDef* pThread, TThreadStats* pStats, TError* pError);
+#endif
+
+#endif
+
+#endif /* _TCL_PROBE_H */
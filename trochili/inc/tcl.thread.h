@@ -11,6 +11,7 @@
 #include "tcl.object.h"
 #include "tcl.ipc.h"
 #include "tcl.timer.h"
+#include "tcl.probe.h"
 
 /* ߳д붨                 */
 #define THREAD_DIAG_NORMAL            (TBitMask)(0x0)     /* ߳                                */
@@ -26,6 +27,8 @@
 #define THREAD_ERR_FAULT              (TError)(0x1<<2)    /* һԴ󣬲              */
 #define THREAD_ERR_STATUS             (TError)(0x1<<3)    /* ߳״̬                            */
 #define THREAD_ERR_PRIORITY           (TError)(0x1<<4)    /* ߳ȼ                          */
+#define THREAD_ERR_TIMEO              (TError)(0x1<<5)    /* ȴ֪߳ͨʱ߱ȡ              */
+#define THREAD_ERR_EMPTY              (TError)(0x1<<6)    /* ûδȡߵ֪߳ͨ                  */
 
 
 /* ߳Զ                       */
@@ -70,6 +73,19 @@
     THREAD_ACAPI_SUSPEND |\
     THREAD_ACAPI_RESUME)
 
+/* ֪߳ͨѡ壬֪ͨʱֻѡһֵ֪ͨ·ʽ */
+#define THREAD_NOTIFY_GIVE            (TOption)(0x1<<0)   /* ֻ֪ͨ޸ֵ֪ͨ                */
+#define THREAD_NOTIFY_SET_BITS        (TOption)(0x1<<1)   /* ֵ֪ͨλλ                          */
+#define THREAD_NOTIFY_INCREMENT       (TOption)(0x1<<2)   /* ֵ֪ͨһ                              */
+#define THREAD_NOTIFY_OVERWRITE       (TOption)(0x1<<3)   /* ֵ֪ͨ                            */
+#define THREAD_NOTIFY_WAIT            (TOption)(0x1<<4)   /* û֪ͨʱȴ                      */
+#define THREAD_NOTIFY_TIMED           (TOption)(0x1<<5)   /* ʱ޵ȴ֪ͨ                            */
+#define THREAD_NOTIFY_DECREMENT       (TOption)(0x1<<6)   /* ȡֵ֪֪ͨͨһ    */
+
+/* ֪߳ͨ״̬ */
+#define THREAD_NOTIFY_PENDING         (TBitMask)(0x1<<0)  /* ߳δȡߵ֪ͨ                    */
+#define THREAD_NOTIFY_WAITING         (TBitMask)(0x1<<1)  /* ߳ڵȴ֪ͨ                        */
+
 /* ߳״̬  */
 enum ThreadStausdef
 {
@@ -126,6 +142,15 @@ struct ThreadDef
 #if ((TCLC_IPC_ENABLE) && (TCLC_IPC_MUTEX_ENABLE))
     TObjNode*     LockList;                  /* ߳ռеĶ                               */
 #endif
+
+#if (TCLC_THREAD_NOTIFY_ENABLE)
+    TBase32       NotifyValue;               /* ֵ֪߳ͨ                                       */
+    TBitMask      NotifyStatus;              /* ֪߳ͨ״̬                                     */
+#endif
+
+#if (TCLC_PROBE_ENABLE)
+    TThreadProbe  Probe;                     /* ߳ӳ̽                                     */
+#endif
     TThreadQueue* Queue;                     /* ̶ָ߳߳еָ                       */
     TBase32       ThreadID;                  /* ߳ID                                           */
     TObjNode      ObjNode;                   /* ߳ڶеĽڵ                               */
@@ -187,6 +212,11 @@ extern TState xThreadUndelay(TThread* pThread, TError* pError);
 extern TState xThreadYield(TError* pError);
 extern TState xThreadSetPriority(TThread* pThread, TPriority priority, TError* pError);
 extern TState xThreadSetTimeSlice(TThread* pThread, TTimeTick ticks, TError* pError);
+#if (TCLC_THREAD_NOTIFY_ENABLE)
+extern TState xThreadNotify(TThread* pThread, TBase32 value, TOption option, TError* pError);
+extern TState xThreadWaitNotify(TBase32 clear, TBase32* pValue, TOption option, TTimeTick timeo,
+                                TError* pError);
+#endif
 
 #endif /*_TCL_THREAD_H */
 
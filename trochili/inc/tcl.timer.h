@@ -67,7 +67,7 @@ typedef struct TimerDef TTimer;
 struct TimerListDef
 {
     TObjNode*    DormantHandle;
-    TObjNode*    ActiveHandle[TCLC_TIMER_WHEEL_SIZE];
+    TObjNode*    ActiveHandle[TCLC_TIMER_WHEEL_LEVELS][TCLC_TIMER_WHEEL_SIZE];
 #if (TCLC_TIMER_DAEMON_ENABLE)
     TObjNode*    ExpiredHandle;
 #endif
@@ -84,6 +84,9 @@ extern void uTimerConfig(TTimer* pTimer, TTimerType type, TTimeTick ticks);
 extern void uTimerStart(TTimer* pTimer, TTimeTick lagticks);
 extern void uTimerStop(TTimer* pTimer);
 extern void uTimerTickISR(void);
+#if (TCLC_TICKLESS_ENABLE)
+extern TTimeTick uTimerGetNextMatch(void);
+#endif
 
 extern TState xTimerCreate(TTimer* pTimer, TProperty property, TTimeTick ticks,
                            TTimerRoutine pRoutine, TArgument data, TError* pError);
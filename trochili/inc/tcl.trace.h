@@ -0,0 +1,83 @@
+/*************************************************************************************************
+ *                                     Trochili RTOS Kernel                                      *
+ *                                  Copyright(C) 2016 LIUXUMING                                  *
+ *                                       www.trochili.com                                        *
+ *************************************************************************************************/
+#ifndef _TCL_TRACE_H
+#define _TCL_TRACE_H
+
+#include "tcl.types.h"
+#include "tcl.config.h"
+
+#if (TCLC_TRACE_ENABLE)
+
+/* ¼ʶ߾ݴʶתļ "TRCE" */
+#define TRACE_MAGIC                  (0x45435254U)
+
+/* ں¼Ͷ壬¼иֶεĺ:
+   SWITCH    Object:ǰ߳ Extra:߳ȼ Data:߳
+   BLOCK     Object:߳     Extra:0              Data:IPCеַ
+   UNBLOCK   Object:߳     Extra:ý       Data:IPCеַ
+   TIMER     Object:ʱ   Extra:ʱ     Data:߳(ûʱΪ0)
+   IRQ_ENTER Object:жϺ   Extra:0              Data:0
+   IRQ_LEAVE Object:жϺ   Extra:ISRֵ      Data:0
+   IRQ_POST  Object:ȼ   Extra:0              Data:صַ
+   MALLOC    Object:     Extra:     Data:ڴַ
+   FREE      Object:0        Extra:     Data:ڴַ
+   ̺߳Ͷʱ(ThreadID/ID)¼ */
+#define TRACE_EVENT_SWITCH           (1U)               /* ̵߳                            */
+#define TRACE_EVENT_BLOCK            (2U)               /* ߳IPC                 */
+#define TRACE_EVENT_UNBLOCK          (3U)               /* ̴߳IPCϱ               */
+#define TRACE_EVENT_TIMER            (4U)               /* ʱʱ                          */
+#define TRACE_EVENT_IRQ_ENTER        (5U)               /* жϽ                            */
+#define TRACE_EVENT_IRQ_LEAVE        (6U)               /* ж˳                            */
+#define TRACE_EVENT_IRQ_POST         (7U)               /* ύж                        */
+#define TRACE_EVENT_MALLOC           (8U)               /* ڴ                            */
+#define TRACE_EVENT_FREE             (9U)               /* ڴͷ                            */
+
+/* ڴͶ */
+#define TRACE_MEM_POOL               (0U)               /* ̶ҳСڴ                */
+#define TRACE_MEM_BUDDY              (1U)               /* ڴ                      */
+#define TRACE_MEM_TLSF               (2U)               /* TLSF䳤ڴ                  */
+#define TRACE_MEM_SLAB               (3U)               /* 󻺴                            */
+#define TRACE_MEM_HEAP               (4U)               /* ּڴѣ¼ĳ    */
+
+/* ¼¼ṹ壬ÿ¼̶12ֽ */
+struct TraceRecordDef
+{
+    TBase32 Stamp;                                      /* ڼ                      */
+    TByte   Event;                                      /* ¼                            */
+    TByte   Extra;                                      /* ¼Ӳ                        */
+    TBase16 Object;                                     /* ¼                        */
+    TBase32 Data;                                       /* ¼                            */
+};
+typedef struct TraceRecordDef TTraceRecord;
+
+/* ¼λṹ壬ṹֱɵת߽ */
+struct TraceBufferDef
+{
+    TBase32      Magic;                                 /* ʶ                          */
+    TBase32      Records;                               /* (¼)                */
+    TBase32      Frequency;                             /* ʱƵ                      */
+    TBase32      Head;                                  /* дļ¼                    */
+    TBase32      Enabled;                               /* Ƿ¼¼                        */
+    TTraceRecord Record[TCLC_TRACE_RECORDS];            /* ¼¼                            */
+};
+typedef struct TraceBufferDef TTraceBuffer;
+
+extern TTraceBuffer uTraceBuffer;
+
+extern void uTraceModuleInit(void);
+extern void uTraceRecord(TBase32 event, TBase32 object, TBase32 extra, TBase32 data);
+extern void xTraceStart(void);
+extern void xTraceStop(void);
+extern void xTraceGetBuffer(void** pAddr, TBase32* pBytes);
+
+/* ں¼¼꣬߱Ѿٽ */
+#define KNL_TRACE(event, object, extra, data) \
+    uTraceRecord((TBase32)(event), (TBase32)(object), (TBase32)(extra), (TBase32)(data))
+#else
+#define KNL_TRACE(event, object, extra, data)
+#endif
+
+#endif /* _TCL_TRACE_H */
@@ -9,6 +9,7 @@
 /* Ͷ壬ںֲʱȷ */
 typedef unsigned char      TByte;
 typedef char               TChar;
+typedef unsigned short     TBase16;
 typedef unsigned int       TBase32;
 typedef unsigned int       TAddr32;
 typedef unsigned int       TReg32;
@@ -22,6 +23,10 @@ typedef unsigned long long TTimeStamp;
 typedef unsigned int       TError;
 typedef unsigned int       TArgument;
 
+/* ָȿ͡ں˶32λֶбַָЩֶλתʱͣ
+   ILP32ĿTAddr32ͬ64λҪַλڵ4Gռ */
+typedef unsigned long      TAddr;
+
 /* Ͷ                    */
 typedef enum
 {
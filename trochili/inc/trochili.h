@@ -16,12 +16,23 @@
 #include "tcl.debug.h"
 #include "tcl.ipc.h"
 #include "tcl.mutex.h"
+#include "tcl.rwlock.h"
+#include "tcl.condvar.h"
+#include "tcl.barrier.h"
 #include "tcl.semaphore.h"
 #include "tcl.mailbox.h"
 #include "tcl.message.h"
+#include "tcl.msgbuf.h"
+#include "tcl.channel.h"
+#include "tcl.waitany.h"
 #include "tcl.flags.h"
 #include "tcl.mem.pool.h"
 #include "tcl.mem.buddy.h"
+#include "tcl.mem.tlsf.h"
+#include "tcl.mem.slab.h"
+#include "tcl.mem.heap.h"
+#include "tcl.probe.h"
+#include "tcl.trace.h"
 
 
 #define TCLM_ASSERT KNL_ASSERT
@@ -52,6 +63,17 @@ extern void TclTrace(const char* pNote);
 #define TCLE_THREAD_FAULT            (THREAD_ERR_FAULT)
 #define TCLE_THREAD_STATUS           (THREAD_ERR_STATUS)
 #define TCLE_THREAD_PRIORITY         (THREAD_ERR_PRIORITY)
+#define TCLE_THREAD_TIMEO            (THREAD_ERR_TIMEO)
+#define TCLE_THREAD_EMPTY            (THREAD_ERR_EMPTY)
+
+/* ֪߳ͨѡûʹ */
+#define TCLO_NOTIFY_GIVE             (THREAD_NOTIFY_GIVE)
+#define TCLO_NOTIFY_SET_BITS         (THREAD_NOTIFY_SET_BITS)
+#define TCLO_NOTIFY_INCREMENT        (THREAD_NOTIFY_INCREMENT)
+#define TCLO_NOTIFY_OVERWRITE        (THREAD_NOTIFY_OVERWRITE)
+#define TCLO_NOTIFY_WAIT             (THREAD_NOTIFY_WAIT)
+#define TCLO_NOTIFY_TIMED            (THREAD_NOTIFY_TIMED)
+#define TCLO_NOTIFY_DECREMENT        (THREAD_NOTIFY_DECREMENT)
 
 extern TState TclCreateThread(TThread* pThread,
                             TThreadEntry pEntry,
@@ -76,6 +98,12 @@ extern TState TclDelayThread(TThread* pThread, TTimeTick ticks, TError* pError);
 extern TState TclUnDelayThread(TThread* pThread, TError* pError);
 #endif
 
+#if (TCLC_THREAD_NOTIFY_ENABLE)
+extern TState TclNotifyThread(TThread* pThread, TBase32 value, TOption option, TError* pError);
+extern TState TclWaitNotify(TBase32 clear, TBase32* pValue, TOption option, TTimeTick timeo,
+                            TError* pError);
+#endif
+
 #if (TCLC_TIMER_ENABLE)
 
 /* ûʱԶ壬ûʹ */
@@ -98,6 +126,38 @@ extern TState TclConfigTimer(TTimer* pTimer, TTimeTick ticks, TError* pError);
 #endif
 
 
+#if (TCLC_PROBE_ENABLE)
+
+/* ̽ûʹ */
+#define TCLE_PROBE_NONE            (PROBE_ERR_NONE)
+#define TCLE_PROBE_FAULT           (PROBE_ERR_FAULT)
+#define TCLE_PROBE_UNREADY         (PROBE_ERR_UNREADY)
+#endif
+
+#if ((TCLC_PROBE_ENABLE) && (TCLC_PROBE_LATENCY_ENABLE))
+
+/* ӳͳͶ壬ûʹ */
+#define TCLO_LATENCY_SWITCH        (PROBE_LATENCY_SWITCH)
+#define TCLO_LATENCY_SCHEDULE      (PROBE_LATENCY_SCHEDULE)
+#define TCLO_LATENCY_ASR           (PROBE_LATENCY_ASR)
+#define TCLO_LATENCY_THREAD        (PROBE_LATENCY_THREAD)
+#define TCLO_LATENCY_IRQ_OFF       (PROBE_LATENCY_IRQ_OFF)
+
+extern TState TclGetLatencyStats(TIndex type, TArgument object, TLatencyStats* pStats,
+                                 TError* pError);
+#endif
+
+#if ((TCLC_PROBE_ENABLE) && (TCLC_PROBE_CPU_STATS_ENABLE))
+extern TState TclGetThreadStats(TThread* pThread, TThreadStats* pStats, TError* pError);
+#endif
+
+#if (TCLC_TRACE_ENABLE)
+extern void TclStartTrace(void);
+extern void TclStopTrace(void);
+extern void TclGetTraceBuffer(void** pAddr, TBase32* pBytes);
+#endif
+
+
 #if (TCLC_IRQ_ENABLE)
 
 /* ISRֵ */
@@ -145,6 +205,9 @@ extern TState TclCancelIRQ(TIrq* pIRQ, TError* pError);
 #define TCLP_IPC_DUMMY           (IPC_PROPERTY)
 #define TCLP_IPC_PREEMP_AUXIQ    (IPC_PROP_PREEMP_AUXIQ)
 #define TCLP_IPC_PREEMP_PRIMIQ   (IPC_PROP_PREEMP_PRIMIQ)
+#define TCLP_IPC_INHERIT         (IPC_PROP_INHERIT)
+#define TCLP_IPC_WRITER_PREF     (IPC_PROP_WRITER_PREF)
+#define TCLP_IPC_OVERWRITE       (IPC_PROP_OVERWRITE)
 
 /* IPCѡûʹ */
 #define TCLO_IPC_DUMMY           (IPC_OPTION)
@@ -155,6 +218,7 @@ extern TState TclCancelIRQ(TIrq* pIRQ, TError* pError);
 #define TCLO_IPC_AND             (IPC_OPT_AND)
 #define TCLO_IPC_OR              (IPC_OPT_OR)
 #define TCLO_IPC_CONSUME         (IPC_OPT_CONSUME)
+#define TCLO_IPC_LEVEL(n)        (IPC_OPT_LEVEL(n))
 
 #endif
 
@@ -180,11 +244,41 @@ extern TState TclResetMutex(TMutex* pMutex, TError* pError);
 extern TState TclFlushMutex(TMutex* pMutex, TError* pError);
 #endif
 
+#if ((TCLC_IPC_ENABLE) && (TCLC_IPC_MUTEX_ENABLE) && (TCLC_IPC_RWLOCK_ENABLE))
+extern TState TclCreateRwLock(TRwLock* pRwLock, TPriority priority, TProperty property,
+                              TError* pError);
+extern TState TclDeleteRwLock(TRwLock* pRwLock, TError* pError);
+extern TState TclResetRwLock(TRwLock* pRwLock, TError* pError);
+extern TState TclFlushRwLock(TRwLock* pRwLock, TError* pError);
+extern TState TclLockRwRead(TRwLock* pRwLock, TOption option, TTimeTick timeo, TError* pError);
+extern TState TclLockRwWrite(TRwLock* pRwLock, TOption option, TTimeTick timeo, TError* pError);
+extern TState TclFreeRwLock(TRwLock* pRwLock, TError* pError);
+extern TState TclUpgradeRwLock(TRwLock* pRwLock, TOption option, TTimeTick timeo, TError* pError);
+extern TState TclDowngradeRwLock(TRwLock* pRwLock, TError* pError);
+#endif
+
+#if ((TCLC_IPC_ENABLE) && (TCLC_IPC_MUTEX_ENABLE) && (TCLC_IPC_CONDVAR_ENABLE))
+extern TState TclCreateCondVar(TCondVar* pCondVar, TProperty property, TError* pError);
+extern TState TclDeleteCondVar(TCondVar* pCondVar, TError* pError);
+extern TState TclFlushCondVar(TCondVar* pCondVar, TError* pError);
+extern TState TclWaitCondVar(TCondVar* pCondVar, TMutex* pMutex, TOption option, TTimeTick timeo,
+                             TError* pError);
+extern TState TclSignalCondVar(TCondVar* pCondVar, TError* pError);
+extern TState TclBroadcastCondVar(TCondVar* pCondVar, TError* pError);
+#endif
+
+#if ((TCLC_IPC_ENABLE) && (TCLC_IPC_BARRIER_ENABLE))
+extern TState TclCreateBarrier(TBarrier* pBarrier, TBase32 count, TProperty property, TError* pError);
+extern TState TclDeleteBarrier(TBarrier* pBarrier, TError* pError);
+extern TState TclResetBarrier(TBarrier* pBarrier, TError* pError);
+extern TState TclWaitBarrier(TBarrier* pBarrier, TOption option, TTimeTick timeo, TError* pError);
+#endif
+
 #if ((TCLC_IPC_ENABLE) && (TCLC_IPC_FLAGS_ENABLE))
 extern TState TclCreateFlags(TFlags* pFlags, TProperty property, TError* pError);
 extern TState TclDeleteFlags(TFlags* pFlags, TError* pError);
-extern TState TclSendFlags(TFlags* pFlags, TBitMask pattern, TError* pError);
-extern TState TclReceiveFlags(TFlags* pFlags, TBitMask* pPattern, TOption option,
+extern TState TclSendFlags(TFlags* pFlags, TFlagMask pattern, TError* pError);
+extern TState TclReceiveFlags(TFlags* pFlags, TFlagMask* pPattern, TOption option,
                               TTimeTick timeo, TError* pError);
 extern TState TclResetFlags(TFlags* pFlags, TError* pError);
 extern TState TclFlushFlags(TFlags* pFlags,  TError* pError);
@@ -212,11 +306,47 @@ extern TState TclReceiveMessage(TMsgQueue* pMsgQue, TMessage* pMsg2, TOption opt
 extern TState TclSendMessage(TMsgQueue* pMsgQue, TMessage* pMsg2, TOption option,
                              TTimeTick timeo, TError* pError);
 extern TState TclIsrSendMessage(TMsgQueue* pMsgQue, TMessage* pMsg2, TOption option);
+extern TState TclReceiveMessages(TMsgQueue* pMsgQue, TMessage* pMsgs, TBase32 max, TBase32* pGot,
+                                 TOption option, TTimeTick timeo, TError* pError);
+extern TState TclSendMessages(TMsgQueue* pMsgQue, TMessage* pMsgs, TBase32 n, TBase32* pSent,
+                              TOption option, TTimeTick timeo, TError* pError);
 extern TState TclBroadcastMessage(TMsgQueue* pMsgQue, TMessage* pMsg2, TError* pError);
 extern TState TclFlushMsgQueue(TMsgQueue* pMsgQue, TError* pError);
 extern TState TclResetMsgQueue(TMsgQueue* pMsgQue, TError* pError);
 #endif
 
+#if ((TCLC_IPC_ENABLE) && (TCLC_IPC_MSGBUF_ENABLE))
+extern TState TclCreateMsgBuffer(TMsgBuffer* pMsgBuf, void* pAddr, TBase32 bytes,
+                                 TProperty property, TError* pError);
+extern TState TclDeleteMsgBuffer(TMsgBuffer* pMsgBuf, TError* pError);
+extern TState TclReserveMsgBuffer(TMsgBuffer* pMsgBuf, TBase32 length, void** pAddr2,
+                                  TOption option, TTimeTick timeo, TError* pError);
+extern TState TclIsrReserveMsgBuffer(TMsgBuffer* pMsgBuf, TBase32 length, void** pAddr2);
+extern TState TclCommitMsgBuffer(TMsgBuffer* pMsgBuf, TBase32 length, TError* pError);
+extern TState TclPeekMsgBuffer(TMsgBuffer* pMsgBuf, void** pAddr2, TBase32* pLength,
+                               TOption option, TTimeTick timeo, TError* pError);
+extern TState TclIsrPeekMsgBuffer(TMsgBuffer* pMsgBuf, void** pAddr2, TBase32* pLength);
+extern TState TclReleaseMsgBuffer(TMsgBuffer* pMsgBuf, TError* pError);
+extern TState TclResetMsgBuffer(TMsgBuffer* pMsgBuf, TError* pError);
+extern TState TclFlushMsgBuffer(TMsgBuffer* pMsgBuf, TError* pError);
+#endif
+
+#if ((TCLC_IPC_ENABLE) && (TCLC_IPC_CHANNEL_ENABLE))
+extern TState TclCreateChannel(TChannel* pChannel, void* pAddr, TBase32 capacity, TBase32 size,
+                               TError* pError);
+extern TState TclDeleteChannel(TChannel* pChannel, TError* pError);
+extern TState TclFlushChannel(TChannel* pChannel, TError* pError);
+extern TState TclWriteChannel(TChannel* pChannel, void* pData, TError* pError);
+extern TState TclReadChannel(TChannel* pChannel, void* pData, TOption option, TTimeTick timeo,
+                             TError* pError);
+extern TState TclIsrReadChannel(TChannel* pChannel, void* pData);
+#endif
+
+#if ((TCLC_IPC_ENABLE) && (TCLC_IPC_WAITANY_ENABLE))
+extern TState TclWaitAny(TIpcWaitItem* pItems, TBase32 number, TIndex* pIndex,
+                         TOption option, TTimeTick timeo, TError* pError);
+#endif
+
 #if (TCLC_MEMORY_ENABLE)
 
 /* ڴûʹ */
@@ -226,21 +356,83 @@ extern TState TclResetMsgQueue(TMsgQueue* pMsgQue, TError* pError);
 #define TCLE_MEMORY_NOMEM           (MEM_ERR_NO_MEM)
 #define TCLE_MEMORY_BADADDR         (MEM_ERR_BAD_ADDR)
 #define TCLE_MEMORY_DBLFREE         (MEM_ERR_DBL_FREE)
+
+/* ڴҳԣûʹ */
+#define TCLP_MEMORY_DUMMY           (MEM_PROP_NONE)
+#define TCLP_MEMORY_ZERO_ALLOC      (MEM_PROP_ZERO_ALLOC)
+#define TCLP_MEMORY_ZERO_FREE       (MEM_PROP_ZERO_FREE)
 #endif
 
 #if (TCLC_MEMORY_ENABLE && TCLC_MEMORY_POOL_ENABLE)
-extern TState TclCreateMemoryPool(TMemPool* pPool, void* pAddr, TBase32 pages, TBase32 pgsize, TError* pError);
+extern TState TclCreateMemoryPool(TMemPool* pPool, void* pAddr, TBase32 pages, TBase32 pgsize,
+                                  TProperty property, TError* pError);
 extern TState TclDeleteMemoryPool(TMemPool* pPool, TError* pError);
 extern TState TclMallocPoolMemory (TMemPool* pPool, void** pAddr2, TError* pError);
 extern TState TclFreePoolMemory (TMemPool* pPool, void* pAddr, TError* pError);
 #endif
 
 #if (TCLC_MEMORY_ENABLE && TCLC_MEMORY_BUDDY_ENABLE)
-extern TState TclCreateMemBuddy(TMemBuddy* pBuddy, TChar* pAddr, TBase32 pages, TBase32 pagesize, TError* pError);
+extern TState TclCreateMemBuddy(TMemBuddy* pBuddy, TChar* pAddr, TBase32 pages, TBase32 pagesize,
+                                TByte* pTags, TError* pError);
 extern TState TclDeleteMemBuddy(TMemBuddy* pBuddy, TError* pError);
 extern TState TclMallocBuddyMem(TMemBuddy* pBuddy, int len, void** pAddr2, TError* pError);
 extern TState TclFreeBuddyMem(TMemBuddy* pBuddy,  void* pAddr, TError* pError);
 #endif
 
+#if (TCLC_MEMORY_ENABLE && TCLC_MEMORY_TLSF_ENABLE)
+extern TState TclCreateMemTlsf(TMemTlsf* pTlsf, void* pAddr, TBase32 bytes, TError* pError);
+extern TState TclDeleteMemTlsf(TMemTlsf* pTlsf, TError* pError);
+extern TState TclMallocTlsfMem(TMemTlsf* pTlsf, TBase32 len, void** pAddr2, TError* pError);
+extern TState TclFreeTlsfMem(TMemTlsf* pTlsf, void* pAddr, TError* pError);
+extern TState TclReallocTlsfMem(TMemTlsf* pTlsf, void* pAddr, TBase32 len, void** pAddr2,
+                                TError* pError);
+extern TState TclGetTlsfInfo(TMemTlsf* pTlsf, TTlsfInfo* pInfo, TError* pError);
+#endif
+
+#if ((TCLC_MEMORY_ENABLE) && (TCLC_MEMORY_SLAB_ENABLE) && \
+     (TCLC_MEMORY_POOL_ENABLE) && (TCLC_MEMORY_BUDDY_ENABLE))
+extern TState TclCreateSlabCache(TMemSlab* pSlab, TBase32 size, TBase32 objs, TMemPool* pPool,
+                                 TMemBuddy* pBuddy, TSlabCtor ctor, TSlabDtor dtor, TError* pError);
+extern TState TclDeleteSlabCache(TMemSlab* pSlab, TError* pError);
+extern TState TclMallocSlabObject(TMemSlab* pSlab, void** pObject2, TError* pError);
+extern TState TclFreeSlabObject(TMemSlab* pSlab, void* pObject, TError* pError);
+
+/* ̬ں˶ĶֽڴӦĶ󻺴 */
+#define TCLM_THREAD_OBJ_BYTES(stack)  (SLAB_ALIGN(sizeof(TThread)) + (stack))
+#define TCLM_TIMER_OBJ_BYTES          (sizeof(TTimer))
+#define TCLM_MQUE_OBJ_BYTES(capacity) \
+    (SLAB_ALIGN(sizeof(TMsgQueue)) + (capacity) * TCLC_IPC_MQUE_LEVELS * sizeof(void*))
+
+extern TState TclCreateThreadDynamic(TMemSlab* pCache, TThread** pThread2, TThreadEntry pEntry,
+                                     TArgument data, TPriority priority, TTimeTick ticks,
+                                     TError* pError);
+extern TState TclDeleteThreadDynamic(TMemSlab* pCache, TThread* pThread, TError* pError);
+
+#if (TCLC_TIMER_ENABLE)
+extern TState TclCreateTimerDynamic(TMemSlab* pCache, TTimer** pTimer2, TProperty property,
+                                    TTimeTick ticks, TTimerRoutine pRoutine, TArgument data,
+                                    TError* pError);
+extern TState TclDeleteTimerDynamic(TMemSlab* pCache, TTimer* pTimer, TError* pError);
+#endif
+
+#if ((TCLC_IPC_ENABLE) && (TCLC_IPC_MQUE_ENABLE))
+extern TState TclCreateMsgQueueDynamic(TMemSlab* pCache, TMsgQueue** pMsgQue2,
+                                       TProperty property, TError* pError);
+extern TState TclDeleteMsgQueueDynamic(TMemSlab* pCache, TMsgQueue* pMsgQue, TError* pError);
+#endif
+#endif
+
+#if ((TCLC_MEMORY_ENABLE) && (TCLC_MEMORY_HEAP_ENABLE) && (TCLC_MEMORY_POOL_ENABLE))
+extern TState TclCreateMemHeap(TMemHeap* pHeap, void* pAddr, TBase32 classes, TBase32 minsize,
+                               TBase32* pPages, TProperty property, TError* pError);
+extern TState TclDeleteMemHeap(TMemHeap* pHeap, TError* pError);
+#if (TCLC_MEMORY_BUDDY_ENABLE)
+extern TState TclSetHeapFallback(TMemHeap* pHeap, TMemBuddy* pBuddy, TError* pError);
+#endif
+extern TState TclMalloc(TMemHeap* pHeap, TBase32 len, void** pAddr2, TError* pError);
+extern TState TclFree(TMemHeap* pHeap, void* pAddr, TError* pError);
+extern TState TclGetHeapInfo(TMemHeap* pHeap, THeapInfo* pInfo, TError* pError);
+#endif
+
 #endif /* _TROCHILI_H */
 
@@ -11,12 +11,14 @@
 
 /* SysTick Ctrl & Status Reg.          */
 #define CM3_SYSTICK_CTRL     (0xE000E010)
+#define CM3_SYSTICK_COUNTFLAG (0x00010000)  /* Count to 0 since last read.      */
 #define CM3_SYSTICK_CLKSRC   (0x00000004)   /* Clock Source.                    */
 #define CM3_SYSTICK_INTEN    (0x00000002)   /* Interrupt enable.                */
 #define CM3_SYSTICK_ENABLE   (0x00000001)   /* Counter mode.                    */
 
 /* SysTick Reload  Value Reg.          */
 #define CM3_SYSTICK_RELOAD   (0xE000E014)
+#define CM3_SYSTICK_MAXLOAD  (0x00FFFFFF)   /* 24-bit counter.                  */
 
 /* SysTick Current Value Reg.          */
 #define CM3_SYSTICK_CURRENT  (0xE000E018)
@@ -31,10 +33,38 @@
 #define CM3_ICSR_PENDSTSET   (0x1<<26)       /* Value to trigger PendST exception.  */
 #define CM3_ICSR_PENDSTCLR   (0x1<<25)       /* Value to clear PendST exception.    */
 
-/* PendSV priority register            */
-#define CM3_PRIO_PENDSV      (0xE000ED22)
+/* System handler priority register 3 (PendSV & SysTick) */
+#define CM3_SHPR3            (0xE000ED20)
 #define CM3_PENDSV_PRIORITY  (0xFF)
 
+/* ںжȼ޶ӦBASEPRIֵSysTickʹȼ */
+#define CM3_KERNEL_BASEPRI   ((TCLC_CPU_KERNEL_IRQ_PRIO << (8U - TCLC_CPU_IRQ_PRIO_BITS)) & 0xFF)
+
+/* NVIC Interrupt Priority Reg., ÿⲿжռһֽ */
+#define CM3_NVIC_IPR         (0xE000E400)
+
+/* NVIC Interrupt Set-Pending Reg., ÿⲿжռһλд1Ӧж */
+#define CM3_NVIC_ISPR        (0xE000E200)
+
+/* Debug Exception and Monitor Control Reg. */
+#define CM3_DEMCR            (0xE000EDFC)
+#define CM3_DEMCR_TRCENA     (0x01000000)   /* Enable DWT and ITM.              */
+
+/* DWT Control & Cycle Count Reg.      */
+#define CM3_DWT_CTRL         (0xE0001000)
+#define CM3_DWT_CYCCNTENA    (0x00000001)   /* Enable cycle counter.            */
+#define CM3_DWT_CYCCNT       (0xE0001004)
+
+/* ļеPROBE_ENABLETCLC_PROBE_ENABLEһ£CpuSetupEntryļֵ */
+extern const TBase32 CpuAsmProbeEnable;
+
+/* ļеKERNEL_BASEPRICM3_KERNEL_BASEPRICpuSetupEntryļֵ
+   ֻʵBASEPRIĸ4λ */
+#if (TCLC_CPU_IRQ_PRIO_BITS != 4U)
+#error "GD32F190 implements 4 interrupt priority bits"
+#endif
+extern const TBase32 CpuAsmKernelBasePri;
+
 
 /*************************************************************************************************
  *  ܣں˽Ķʱ                                                                     *
@@ -50,6 +80,80 @@ void CpuStartTickClock(void)
     TCLM_SET_REG32(CM3_SYSTICK_CTRL, CM3_SYSTICK_CLKSRC|CM3_SYSTICK_INTEN|CM3_SYSTICK_ENABLE);
 }
 
+#if (TCLC_TICKLESS_ENABLE)
+extern void CpuWaitForInterrupt(void);
+
+/*************************************************************************************************
+ *  ܣֹͣжϲ                                                                 *
+ *  (1) ticks ƻߵĽ                                                             *
+ *  أڼ侭ĽʱǸж                                   *
+ *  ˵ڹж״̬µãWFIжϹʱȻỽѴ                                *
+ *************************************************************************************************/
+TTimeTick CpuTicklessSleep(TTimeTick ticks)
+{
+    TBase32 period = TCLC_CPU_CLOCK_FREQ / TCLC_TIME_TICK_RATE;
+    TBase32 ctrl;
+    TBase32 reload;
+    TBase32 current;
+    TBase32 passed;
+    TTimeTick elapsed;
+
+    /* SysTick24λƵߵĽ */
+    if (ticks > (CM3_SYSTICK_MAXLOAD / period))
+    {
+        ticks = CM3_SYSTICK_MAXLOAD / period;
+    }
+
+    /* ֹͣSysTickCTRLͬʱCOUNTFLAG */
+    ctrl = TCLM_GET_REG32(CM3_SYSTICK_CTRL);
+    TCLM_SET_REG32(CM3_SYSTICK_CTRL, ctrl & (~CM3_SYSTICK_ENABLE));
+    current = TCLM_GET_REG32(CM3_SYSTICK_CURRENT);
+
+    /* жѾ */
+    if ((ticks < 2U) || (TCLM_GET_REG32(CM3_ICSR) & CM3_ICSR_PENDSTSET))
+    {
+        TCLM_SET_REG32(CM3_SYSTICK_CTRL, ctrl | CM3_SYSTICK_ENABLE);
+        return 0U;
+    }
+
+    /* ʹSysTickڵticksı߽絽 */
+    reload = current + (TBase32)(ticks - 1U) * period;
+    TCLM_SET_REG32(CM3_SYSTICK_RELOAD, reload - 1u);
+    TCLM_SET_REG32(CM3_SYSTICK_CURRENT, 0U);
+    TCLM_SET_REG32(CM3_SYSTICK_CTRL, ctrl | CM3_SYSTICK_ENABLE);
+
+    CpuWaitForInterrupt();
+
+    ctrl = TCLM_GET_REG32(CM3_SYSTICK_CTRL);
+    TCLM_SET_REG32(CM3_SYSTICK_CTRL, ctrl & (~CM3_SYSTICK_ENABLE));
+    current = TCLM_GET_REG32(CM3_SYSTICK_CURRENT);
+
+    if (ctrl & CM3_SYSTICK_COUNTFLAG)
+    {
+        /* ʱѣһѾSysTickжϴ */
+        elapsed = ticks - 1U;
+        passed  = (reload - 1u) - current;
+        current = (passed < period) ? (period - passed) : 1U;
+    }
+    else
+    {
+        /* жǰѣѾĽı߽͵ǰʣļֵ */
+        elapsed = (ticks - 1U) - (current / period);
+        current = current % period;
+        current = (current == 0U) ? period : current;
+    }
+
+    /* ӵǰĵʣֵSysTickָĽ */
+    TCLM_SET_REG32(CM3_SYSTICK_RELOAD, current - 1u);
+    TCLM_SET_REG32(CM3_SYSTICK_CURRENT, 0U);
+    TCLM_SET_REG32(CM3_SYSTICK_CTRL, ctrl | CM3_SYSTICK_ENABLE);
+    TCLM_SET_REG32(CM3_SYSTICK_RELOAD, period - 1u);
+
+    return elapsed;
+}
+#endif
+
+
 /*************************************************************************************************
  *  ܣں˼صһ߳                                                                     *
  *                                                                                       *
@@ -128,6 +232,52 @@ void CpuBuildThreadStack(TAddr32* pTop, void* pStack, TBase32 bytes,
 }
 
 
+/*************************************************************************************************
+ *  ܣ߳ջͷź                                                                         *
+ *  (1) pTop      ߳ջַ                                                             *
+ *  أ                                                                                     *
+ *  ˵߳ȫ߳ջУûҪͷŵĴԴ                                 *
+ *************************************************************************************************/
+void CpuReleaseThreadStack(TAddr32* pTop)
+{
+}
+
+
+/*************************************************************************************************
+ *  ܣں˹жϵȼ                                                             *
+ *  (1) irqn      жϺ                                                                   *
+ *  أ                                                                                     *
+ *  ˵ںAPIжϱܱٽΣעжʱȼΪںжȼ  *
+ *        ޡҪӦʱӦÿԲעжԼøߵȼ                 *
+ *************************************************************************************************/
+void CpuSetIrqPriority(TIndex irqn)
+{
+#if (TCLC_CPU_KERNEL_IRQ_PRIO)
+    TAddr32 addr;
+    TBase32 shift;
+    TBase32 prio;
+
+    addr = CM3_NVIC_IPR + (irqn & (~0x3U));
+    shift = (irqn & 0x3U) * 8U;
+    prio = TCLM_GET_REG32(addr) & (~(0xFFU << shift));
+    prio |= (CM3_KERNEL_BASEPRI << shift);
+    TCLM_SET_REG32(addr, prio);
+#endif
+}
+
+
+/*************************************************************************************************
+ *  ܣʽⲿж                                                                 *
+ *  (1) irqn      жϺ                                                                   *
+ *  أ                                                                                     *
+ *  ˵Ĵֻд1λãҪ--д                                            *
+ *************************************************************************************************/
+void CpuRaiseIrq(TIndex irqn)
+{
+    TCLM_SET_REG32(CM3_NVIC_ISPR + (irqn >> 5U) * 4U, (0x1U << (irqn & 0x1FU)));
+}
+
+
 /*************************************************************************************************
  *  ܣʼ                                                                           *
  *                                                                                       *
@@ -136,11 +286,46 @@ void CpuBuildThreadStack(TAddr32* pTop, void* pStack, TBase32 bytes,
  *************************************************************************************************/
 void CpuSetupEntry(void)
 {
-    /* PENDSVжȼ */
-    TCLM_SET_REG32(CM3_PRIO_PENDSV, CM3_PENDSV_PRIORITY);
+    TBase32 prio;
+
+    /* ļtcl.config.hеںжȼ޲һʱٽ޷SysTick */
+    KNL_ASSERT((CpuAsmKernelBasePri == CM3_KERNEL_BASEPRI), "");
+
+    /* ̽òһʱļں˵̽òɶ */
+    KNL_ASSERT((CpuAsmProbeEnable == ((TCLC_PROBE_ENABLE) ? 1U : 0U)), "");
+
+    /* PENDSVжȼΪͣʹBASEPRIٽʱSysTickжϱܱٽΣ
+       ԰ȼΪںжȼ */
+    prio = TCLM_GET_REG32(CM3_SHPR3) & 0x0000FFFF;
+    prio |= (CM3_PENDSV_PRIORITY << 16);
+#if (TCLC_CPU_KERNEL_IRQ_PRIO)
+    prio |= (CM3_KERNEL_BASEPRI << 24);
+#endif
+    TCLM_SET_REG32(CM3_SHPR3, prio);
+
+#if ((TCLC_PROBE_ENABLE) || (TCLC_TRACE_ENABLE))
+    /* DWTڼ */
+    TCLM_SET_REG32(CM3_DEMCR, TCLM_GET_REG32(CM3_DEMCR) | CM3_DEMCR_TRCENA);
+    TCLM_SET_REG32(CM3_DWT_CYCCNT, 0U);
+    TCLM_SET_REG32(CM3_DWT_CTRL, TCLM_GET_REG32(CM3_DWT_CTRL) | CM3_DWT_CYCCNTENA);
+#endif
 }
 
 
+#if ((TCLC_PROBE_ENABLE) || (TCLC_TRACE_ENABLE))
+/*************************************************************************************************
+ *  ܣȡڼ                                                                     *
+ *                                                                                       *
+ *  أDWTڼĵǰֵ                                                                  *
+ *  ˵32λƺ޷żʱȻȷ                                     *
+ *************************************************************************************************/
+TBase32 CpuGetCycleCount(void)
+{
+    return TCLM_GET_REG32(CM3_DWT_CYCCNT);
+}
+#endif
+
+
 // hard fault handler in C,
 // with stack frame location as input parameter
 void hard_fault_handler_c(unsigned int * hardfault_args)
@@ -1,11 +1,33 @@
+; tcl.config.hеTCLC_PROBE_ENABLEһ£ļĩβCpuAsmProbeEnableCpuSetupEntry
+        GBLL    PROBE_ENABLE
+PROBE_ENABLE SETL {FALSE}
+
+; tcl.config.hеñһ:
+; KERNEL_BASEPRI = TCLC_CPU_KERNEL_IRQ_PRIO << (8 - TCLC_CPU_IRQ_PRIO_BITS)Ϊ0ʱٽʹPRIMASK
+; ļĩβCpuAsmKernelBasePriCpuSetupEntry飬߲һʱںʧ
+        GBLA    KERNEL_BASEPRI
+KERNEL_BASEPRI SETA 0x80
+        ASSERT  (KERNEL_BASEPRI :AND: 0xFFFFFF0F) = 0
+
 	    IMPORT  uKernelVariable
+        IF      PROBE_ENABLE
+        IMPORT  uProbeSwitchEnter
+        IMPORT  uProbeSwitchLeave
+        IMPORT  uProbeIrqOffEnter
+        IMPORT  uProbeIrqOffLeave
+        ENDIF
 
         EXPORT  CpuDisableInt
         EXPORT  CpuEnableInt
         EXPORT  CpuEnterCritical
         EXPORT  CpuLeaveCritical
         EXPORT  CpuCalcHiPRIO
+        EXPORT  CpuCountLeadZeros
+        EXPORT  CpuDataBarrier
+        EXPORT  CpuWaitForInterrupt
         EXPORT  PendSV_Handler
+        EXPORT  CpuAsmKernelBasePri
+        EXPORT  CpuAsmProbeEnable
 
         AREA |.text|, CODE, READONLY, ALIGN=2
         THUMB
@@ -17,6 +39,16 @@ CpuCalcHiPRIO
         CLZ     R0, R0
         BX      LR
 
+; ڴߴʹãΪ0ʱ32
+CpuCountLeadZeros
+        CLZ     R0, R0
+        BX      LR
+
+; ݽṹʹã֤֮ǰĴ洢֮Ĵ洢ɣñҲֹ
+CpuDataBarrier
+        DMB
+        BX      LR
+
 CpuDisableInt
         CPSID   I
         BX      LR
@@ -25,21 +57,79 @@ CpuEnableInt
         CPSIE   I
         BX      LR
 
+; BASEPRIεжϲܻWFIڼPRIMASKж
+CpuWaitForInterrupt
+        IF      KERNEL_BASEPRI != 0
+        MRS     R1, BASEPRI
+        CPSID   I
+        MOV     R0, #0
+        MSR     BASEPRI, R0
+        ENDIF
+        DSB
+        WFI
+        ISB
+        IF      KERNEL_BASEPRI != 0
+        MSR     BASEPRI, R1
+        CPSIE   I
+        ENDIF
+        BX      LR
+
 CpuEnterCritical
+    IF      KERNEL_BASEPRI != 0
+    MRS     R1, BASEPRI
+    STR     R1, [R0]
+    MOV     R2, #KERNEL_BASEPRI
+    MSR     BASEPRI, R2
+    ISB
+    ELSE
     MRS     R1, PRIMASK
     STR     R1, [R0]
     CPSID   I
+    ENDIF
+
+    IF      PROBE_ENABLE
+    CBNZ    R1, ENTER_CRITICAL_NESTED  ; ֻͳٽĹжʱ
+    PUSH    {R4, LR}
+    BL      uProbeIrqOffEnter
+    POP     {R4, LR}
+ENTER_CRITICAL_NESTED
+    ENDIF
+
     BX      LR
 
 CpuLeaveCritical
+    IF      PROBE_ENABLE
+    CBNZ    R0, LEAVE_CRITICAL_NESTED
+    PUSH    {R0, LR}
+    BL      uProbeIrqOffLeave
+    POP     {R0, LR}
+LEAVE_CRITICAL_NESTED
+    ENDIF
+
+    IF      KERNEL_BASEPRI != 0
+    MSR     BASEPRI, R0
+    ELSE
     MSR     PRIMASK, R0
+    ENDIF
     BX      LR
 
 
 ;Cortex-M3쳣ʱ,ԶѹջR0-R3,R12,LR(R14,ӼĴ),PSR(״̬Ĵ)PC(R15).
 ;PSPԶѹջҪ浽ջУǱ浽߳̽ṹ
 PendSV_Handler
+    IF      KERNEL_BASEPRI != 0
+    MOV     R0, #KERNEL_BASEPRI
+    MSR     BASEPRI, R0
+    ISB
+    ELSE
     CPSID   I
+    ENDIF
+
+    IF      PROBE_ENABLE
+    PUSH    {R4, LR}      ; R4ڱMSP 8ֽڶ
+    BL      uProbeSwitchEnter
+    POP     {R4, LR}
+    ENDIF
 
 ; ȡ߳
     LDR     R0,  =uKernelVariable
@@ -78,11 +168,23 @@ LOAD_NOMINEE_FILE
     ADDS    R3,  R3, #0x20 ; pspָжԶѹջջ
     MSR     PSP, R3
 
+    ; ̵߳R4-R11ѾָCᱣЩĴ
+    IF      PROBE_ENABLE
+    PUSH    {R4, LR}
+    BL      uProbeSwitchLeave
+    POP     {R4, LR}
+    ENDIF
+
     ; ϵ󣬴߳+Ȩģʽ+msp
     ; ڵһactivate񣬵pendsvжϺ󣬴handlerģʽʹmsp,
     ; ʱ׼ʹpsppspеr0...ЩĴҪ޸LRǿʹpsp
     ORR     LR, LR, #0x04
+    IF      KERNEL_BASEPRI != 0
+    MOV     R0, #0
+    MSR     BASEPRI, R0
+    ELSE
     CPSIE   I
+    ENDIF
     
     ;пܷжϣʱµĵǰ̵߳Ĳûȫָ̱߳жϵ龰ƣ
     ;ӲԶ沿ּĴ߳ջУĴڴС
@@ -100,4 +202,16 @@ LOAD_NOMINEE_FILE
     BX      LR
     ; غ󣬴ʹ߳+Ȩģʽ+pspֻ߳̾С
 
+; ʹõ̽úBASEPRIֵֻCpuSetupEntryȡ
+    ALIGN   4
+CpuAsmProbeEnable
+    IF      PROBE_ENABLE
+    DCD     1
+    ELSE
+    DCD     0
+    ENDIF
+
+CpuAsmKernelBasePri
+    DCD     KERNEL_BASEPRI
+
     END
\ No newline at end of file
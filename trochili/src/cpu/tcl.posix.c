@@ -0,0 +1,622 @@
+/*************************************************************************************************
+ *                                     Trochili RTOS Kernel                                      *
+ *                                  Copyright(C) 2016 LIUXUMING                                  *
+ *                                       www.trochili.com                                        *
+ *************************************************************************************************/
+#include <signal.h>
+#include <string.h>
+#include <time.h>
+#include <ucontext.h>
+#include <sys/time.h>
+
+#include "tcl.types.h"
+#include "tcl.config.h"
+#include "tcl.cpu.h"
+#include "tcl.debug.h"
+#include "tcl.kernel.h"
+#include "tcl.posix.h"
+
+/* źźģжϹ */
+#define POSIX_IRQ_TICK       (0x1<<0)        /* SIGALRM, ģSysTick              */
+#define POSIX_IRQ_USR1       (0x1<<1)        /* SIGUSR1, ģⲿж             */
+#define POSIX_IRQ_USR2       (0x1<<2)        /* SIGUSR2, ģⲿж             */
+
+/* ߳Ľṹ */
+typedef struct
+{
+    void*      Stack;                                     /* ߳ջַ,ʶ߳        */
+    void*      Entry;                                     /* ַ̺߳                   */
+    TArgument  Argument;                                  /* ̺߳                   */
+    ucontext_t Context;                                   /*                */
+    TBase32    HostStack[TCLC_POSIX_STACK_BYTES >> 2];    /* ߳ʵʹõջ           */
+} TPosixContext;
+
+static TPosixContext PosixContext[TCLC_POSIX_CONTEXT_NUM];
+
+/* ģPRIMASK, 1ʾжϱر */
+static volatile sig_atomic_t PosixIntMask = 0;
+
+/* ģPendSV */
+static volatile sig_atomic_t PosixSwitchPending = 0;
+
+/* жƳٴģж */
+static volatile TBitMask PosixIrqPending = 0U;
+
+#define POSIX_BARRIER() __atomic_signal_fence(__ATOMIC_SEQ_CST)
+
+/* еıţmainĲռñ */
+static TIndex PosixRunning = TCLC_POSIX_CONTEXT_NUM;
+
+/* Ѿͷŵǻеıţлܻ֮ */
+static TIndex PosixZombie = TCLC_POSIX_CONTEXT_NUM;
+
+/* ͨ߳ջ¼ıŻ */
+#define POSIX_SLOT(thread)    (*(TBase32*)(TAddr)((thread)->StackTop))
+#define POSIX_CONTEXT(thread) (&(PosixContext[POSIX_SLOT(thread)]))
+
+static void ServicePending(void);
+
+
+/*************************************************************************************************
+ *  ܣձƳͷŵ                                                             *
+ *                                                                                       *
+ *  أ                                                                                     *
+ *  ˵߳ԼбעʱĻʹУл֮         *
+ *************************************************************************************************/
+static void ReapContext(void)
+{
+    TPosixContext* pContext;
+
+    if ((PosixZombie != TCLC_POSIX_CONTEXT_NUM) && (PosixZombie != PosixRunning))
+    {
+        pContext = &(PosixContext[PosixZombie]);
+        memset(pContext, 0, sizeof(TPosixContext) - sizeof(pContext->HostStack));
+        PosixZombie = TCLC_POSIX_CONTEXT_NUM;
+    }
+}
+
+
+/*************************************************************************************************
+ *  ܣ߳ں                                                                       *
+ *  (1) slot ߳ı                                                            *
+ *  أ                                                                                     *
+ *  ˵̵߳һαʱڹж״̬ģPendSVǰĿжϲ                     *
+ *************************************************************************************************/
+static void PosixThreadEntry(int slot)
+{
+    TPosixContext* pContext = &(PosixContext[slot]);
+
+    ReapContext();
+#if (TCLC_PROBE_ENABLE)
+    uProbeSwitchLeave();
+#endif
+    CpuEnableInt();
+    ((void (*)(TArgument))(pContext->Entry))(pContext->Argument);
+
+    /* ̺߳Ӧ÷ */
+    uDebugPanic("", __FILE__, __FUNCTION__, __LINE__);
+}
+
+
+/*************************************************************************************************
+ *  ܣ߳л                                                                     *
+ *                                                                                       *
+ *  أ                                                                                     *
+ *  ˵ӦCortex-M3ֲеPendSV_Handlerڹж״̬µ                      *
+ *************************************************************************************************/
+static void SwitchThread(void)
+{
+    TThread* pCurrent = uKernelVariable.CurrentThread;
+    TThread* pNominee = uKernelVariable.NomineeThread;
+
+#if (TCLC_PROBE_ENABLE)
+    uProbeSwitchEnter();
+#endif
+
+    /* Nominee״̬Ϊ */
+    pNominee->Status = eThreadRunning;
+    PosixRunning = POSIX_SLOT(pNominee);
+
+    /* uThreadCurrentuThreadNomineeֱӼuThreadNominee */
+    if (pCurrent == pNominee)
+    {
+        setcontext(&(POSIX_CONTEXT(pNominee)->Context));
+    }
+
+    uKernelVariable.CurrentThread = pNominee;
+
+    /* uThreadCurrent߳ûбʼҪ */
+    if (!(pCurrent->Property & THREAD_PROP_READY))
+    {
+        setcontext(&(POSIX_CONTEXT(pNominee)->Context));
+    }
+
+    swapcontext(&(POSIX_CONTEXT(pCurrent)->Context), &(POSIX_CONTEXT(pNominee)->Context));
+
+    /* ߳ʱ൱PendSV */
+    ReapContext();
+#if (TCLC_PROBE_ENABLE)
+    uProbeSwitchLeave();
+#endif
+}
+
+
+/*************************************************************************************************
+ *  ܣģжϷַ                                                                       *
+ *  (1) irq ģжϹ                                                               *
+ *  أ                                                                                     *
+ *  ˵                                                                                       *
+ *************************************************************************************************/
+static void DispatchIrq(TBitMask irq)
+{
+    if (irq & POSIX_IRQ_TICK)
+    {
+        uKernelEnterIntrState();
+        xKernelTickISR();
+        uKernelLeaveIntrState();
+    }
+
+#if (TCLC_IRQ_ENABLE)
+    if (irq & POSIX_IRQ_USR1)
+    {
+        uKernelEnterIntrState();
+        xIrqEnterISR(POSIX_USR1_IRQID);
+        uKernelLeaveIntrState();
+    }
+
+    if (irq & POSIX_IRQ_USR2)
+    {
+        uKernelEnterIntrState();
+        xIrqEnterISR(POSIX_USR2_IRQID);
+        uKernelLeaveIntrState();
+    }
+#endif
+}
+
+
+/*************************************************************************************************
+ *  ܣģжϺ߳л                                                     *
+ *                                                                                       *
+ *  أ                                                                                     *
+ *  ˵ģж߳лPendSVȼӦʱжϴڴ״̬   *
+ *************************************************************************************************/
+static void ServicePending(void)
+{
+    TBitMask irq;
+
+    while ((PosixIrqPending != 0U) || (PosixSwitchPending != 0))
+    {
+        PosixIntMask = 1;
+        POSIX_BARRIER();
+
+        irq = __atomic_exchange_n(&PosixIrqPending, 0U, __ATOMIC_SEQ_CST);
+        if (irq != 0U)
+        {
+            DispatchIrq(irq);
+        }
+
+        if (PosixSwitchPending != 0)
+        {
+            PosixSwitchPending = 0;
+            SwitchThread();
+        }
+
+        POSIX_BARRIER();
+        PosixIntMask = 0;
+    }
+}
+
+
+/*************************************************************************************************
+ *  ܣźŴ                                                                       *
+ *  (1) signo źű                                                                     *
+ *  أ                                                                                     *
+ *  ˵źŴֱڱж̵߳ջϣCortex-M3PSPԶѹջΪһ£       *
+ *        ǰڹж״ֻ̬¼жϹǣжʱ                       *
+ *        ߳лźŴеswapcontextɣPOSIX֤첽źŰȫġ   *
+ *        㣺ֻģжϴʱлʱжϵĴ벻ں˺ͱļУglibc            *
+ *        swapcontextͬʱͻָź֣߳ʱصźŴУ        *
+ *        sigreturnָԭ֡жϵִ߳printf֮಻libc  *
+ *        л߳ٵͬһǲȫģCortex-M3жռһӦҪԼ    *
+ *************************************************************************************************/
+static void PosixSignalHandler(int signo)
+{
+    TBitMask irq;
+
+    irq = (signo == SIGALRM) ? POSIX_IRQ_TICK :
+          ((signo == SIGUSR1) ? POSIX_IRQ_USR1 : POSIX_IRQ_USR2);
+    __atomic_fetch_or(&PosixIrqPending, irq, __ATOMIC_SEQ_CST);
+
+    if (PosixIntMask == 0)
+    {
+        ServicePending();
+    }
+}
+
+
+/*************************************************************************************************
+ *  ܣں˽Ķʱ                                                                     *
+ *                                                                                       *
+ *  أ                                                                                     *
+ *  ˵ʹITIMER_REALʱSIGALRMźΪϵͳ                                     *
+ *************************************************************************************************/
+void CpuStartTickClock(void)
+{
+    struct itimerval value;
+
+    value.it_interval.tv_sec  = 0;
+    value.it_interval.tv_usec = 1000000U / TCLC_TIME_TICK_RATE;
+    value.it_value = value.it_interval;
+    setitimer(ITIMER_REAL, &value, (struct itimerval*)0);
+}
+
+
+#if (TCLC_TICKLESS_ENABLE)
+/*************************************************************************************************
+ *  ܣֹͣжϲ                                                                 *
+ *  (1) ticks ƻߵĽ                                                             *
+ *  أڼ侭ĽʱǸж                                   *
+ *  ˵ڹж״̬µãsigsuspendģWFI                                            *
+ *************************************************************************************************/
+TTimeTick CpuTicklessSleep(TTimeTick ticks)
+{
+    struct itimerval value;
+    sigset_t mask;
+    sigset_t wait;
+    TTimeTick period = 1000000U / TCLC_TIME_TICK_RATE;
+    TTimeTick remain;
+    TTimeTick elapsed;
+
+    /* ģжѾ */
+    if ((ticks < 2U) || (PosixIrqPending != 0U))
+    {
+        return 0U;
+    }
+
+    sigemptyset(&mask);
+    sigaddset(&mask, SIGALRM);
+    sigaddset(&mask, SIGUSR1);
+    sigaddset(&mask, SIGUSR2);
+    sigemptyset(&wait);
+    sigprocmask(SIG_BLOCK, &mask, (sigset_t*)0);
+
+    /* ʹʱڵticksı߽絽ڣ֮԰ */
+    getitimer(ITIMER_REAL, &value);
+    remain = (TTimeTick)value.it_value.tv_sec * 1000000U + value.it_value.tv_usec;
+    remain += (ticks - 1U) * period;
+    value.it_value.tv_sec  = remain / 1000000U;
+    value.it_value.tv_usec = remain % 1000000U;
+    setitimer(ITIMER_REAL, &value, (struct itimerval*)0);
+
+    /* ȴģж */
+    while (PosixIrqPending == 0U)
+    {
+        sigsuspend(&wait);
+    }
+
+    getitimer(ITIMER_REAL, &value);
+    remain = (TTimeTick)value.it_value.tv_sec * 1000000U + value.it_value.tv_usec;
+    if (PosixIrqPending & POSIX_IRQ_TICK)
+    {
+        /* ʱѣһѾĽжϴ */
+        elapsed = ticks - 1U;
+    }
+    else
+    {
+        /* жǰѣѾĽıָ߽λ */
+        elapsed = (ticks - 1U) - (remain / period);
+        remain = remain % period;
+        remain = (remain == 0U) ? period : remain;
+        value.it_value.tv_sec  = 0;
+        value.it_value.tv_usec = remain;
+        setitimer(ITIMER_REAL, &value, (struct itimerval*)0);
+    }
+
+    sigprocmask(SIG_UNBLOCK, &mask, (sigset_t*)0);
+    return elapsed;
+}
+#endif
+
+
+/*************************************************************************************************
+ *  ܣں˼صһ߳                                                                     *
+ *                                                                                       *
+ *  أ                                                                                     *
+ *  ˵߳CpuEnableInt()бأmainı                         *
+ *************************************************************************************************/
+void CpuLoadIdleThread(void)
+{
+    PosixSwitchPending = 1;
+}
+
+
+/*************************************************************************************************
+ *  ܣ̵߳                                                                           *
+ *                                                                                       *
+ *  أ                                                                                     *
+ *  ˵                                                                                       *
+ *************************************************************************************************/
+void CpuConfirmThreadSwitch(void)
+{
+    PosixSwitchPending = 1;
+}
+
+
+/*************************************************************************************************
+ *  ܣȡ̵߳                                                                           *
+ *                                                                                       *
+ *  أ                                                                                     *
+ *  ˵                                                                                       *
+ *************************************************************************************************/
+void CpuCancelThreadSwitch(void)
+{
+    PosixSwitchPending = 0;
+}
+
+
+/*************************************************************************************************
+ *  ܣ߳ջĳʼ                                                           *
+ *  (1) pTop      ߳ջַ                                                             *
+ *        (2) pStack    ߳ջ׵ַ                                                             *
+ *        (3) bytes     ߳ջСԽΪλ                                                   *
+ *        (4) pEntry    ַ̺߳                                                             *
+ *        (5) argument  ̺߳                                                             *
+ *  أ                                                                                     *
+ *  ˵߳ʵԴջϣں߳ջֻıţ                 *
+ *        ں˵ջ߼ȻЧͬһ߳ջٴγʼʱԭ             *
+ *************************************************************************************************/
+void CpuBuildThreadStack(TAddr32* pTop, void* pStack, TBase32 bytes,
+                         void* pEntry, TArgument argument)
+{
+    TBase32* pTemp;
+    TPosixContext* pContext;
+    TIndex slot;
+
+    /* Ҹ߳ջӦģûһе */
+    for (slot = 0U; slot < TCLC_POSIX_CONTEXT_NUM; slot++)
+    {
+        if (PosixContext[slot].Stack == pStack)
+        {
+            break;
+        }
+    }
+    if (slot == TCLC_POSIX_CONTEXT_NUM)
+    {
+        for (slot = 0U; slot < TCLC_POSIX_CONTEXT_NUM; slot++)
+        {
+            if (PosixContext[slot].Stack == (void*)0)
+            {
+                break;
+            }
+        }
+    }
+    if (slot == TCLC_POSIX_CONTEXT_NUM)
+    {
+        uDebugPanic("", __FILE__, __FUNCTION__, __LINE__);
+    }
+
+    /* ߳ģ̵߳һαʱPosixThreadEntryʼ */
+    pContext = &(PosixContext[slot]);
+    pContext->Stack    = pStack;
+    pContext->Entry    = pEntry;
+    pContext->Argument = argument;
+    getcontext(&(pContext->Context));
+    pContext->Context.uc_stack.ss_sp   = (void*)(pContext->HostStack);
+    pContext->Context.uc_stack.ss_size = sizeof(pContext->HostStack);
+    pContext->Context.uc_link          = (ucontext_t*)0;
+    sigemptyset(&(pContext->Context.uc_sigmask));
+    makecontext(&(pContext->Context), (void (*)(void))PosixThreadEntry, 1, (int)slot);
+
+    /* ߳ջ¼ı */
+    pTemp = (TBase32*)((TChar*)pStack + bytes);
+    *(--pTemp) = (TBase32)slot;
+
+    *pTop = (TAddr32)(TAddr)pTemp;
+}
+
+
+/*************************************************************************************************
+ *  ܣ߳ջͷź                                                                         *
+ *  (1) pTop      ߳ջַ                                                             *
+ *  أ                                                                                     *
+ *  ˵̱߳עʱͷռõģ̬̻߳𽥺ľġ           *
+ *        ߳жעԼʱĻУҪл֮ٻգ       *
+ *        Ŀл֮ǰͱµ߳                                         *
+ *************************************************************************************************/
+void CpuReleaseThreadStack(TAddr32* pTop)
+{
+    TPosixContext* pContext;
+    TIndex slot;
+
+    slot = *(TBase32*)(TAddr)(*pTop);
+    if (slot == PosixRunning)
+    {
+        PosixZombie = slot;
+    }
+    else
+    {
+        pContext = &(PosixContext[slot]);
+        memset(pContext, 0, sizeof(TPosixContext) - sizeof(pContext->HostStack));
+    }
+    *pTop = 0U;
+}
+
+
+/*************************************************************************************************
+ *  ܣеȼ                                                             *
+ *  (1) data ȼλͼ                                                                    *
+ *  أ͵λbitţλͼΪ0ʱ32                                                     *
+ *  ˵ȼCortex-M3RBIT+CLZָ                                                      *
+ *************************************************************************************************/
+TPriority CpuCalcHiPRIO(TBase32 data)
+{
+    return (TPriority)((data == 0U) ? 32U : __builtin_ctz(data));
+}
+
+
+/*************************************************************************************************
+ *  ܣλbit֮ǰ0ĸ                                                     *
+ *  (1) data                                                                   *
+ *  أǰ0ĸΪ0ʱ32                                                           *
+ *  ˵ȼCortex-M3CLZָ                                                               *
+ *************************************************************************************************/
+TBase32 CpuCountLeadZeros(TBase32 data)
+{
+    return (TBase32)((data == 0U) ? 32U : __builtin_clz(data));
+}
+
+
+/*************************************************************************************************
+ *  ܣݴ洢                                                                           *
+ *                                                                                       *
+ *  أ                                                                                     *
+ *  ˵ȼCortex-M3DMBָ                                                               *
+ *************************************************************************************************/
+void CpuDataBarrier(void)
+{
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+}
+
+
+/*************************************************************************************************
+ *  ܣرմж                                                                         *
+ *                                                                                       *
+ *  أ                                                                                     *
+ *  ˵                                                                                       *
+ *************************************************************************************************/
+void CpuDisableInt(void)
+{
+    PosixIntMask = 1;
+    POSIX_BARRIER();
+}
+
+
+/*************************************************************************************************
+ *  ܣ򿪴ж                                                                         *
+ *                                                                                       *
+ *  أ                                                                                     *
+ *  ˵жʱģжϺ߳л                                             *
+ *************************************************************************************************/
+void CpuEnableInt(void)
+{
+    POSIX_BARRIER();
+    PosixIntMask = 0;
+    ServicePending();
+}
+
+
+/*************************************************************************************************
+ *  ܣٽ                                                                             *
+ *  (1) pValue ٽ֮ǰж״̬                                                *
+ *  أ                                                                                     *
+ *  ˵                                                                                       *
+ *************************************************************************************************/
+void CpuEnterCritical(TReg32* pValue)
+{
+    *pValue = (TReg32)PosixIntMask;
+    PosixIntMask = 1;
+    POSIX_BARRIER();
+
+#if (TCLC_PROBE_ENABLE)
+    if (*pValue == 0U)
+    {
+        uProbeIrqOffEnter();
+    }
+#endif
+}
+
+
+/*************************************************************************************************
+ *  ܣ˳ٽ                                                                             *
+ *  (1) value ٽ֮ǰж״̬                                                     *
+ *  أ                                                                                     *
+ *  ˵                                                                                       *
+ *************************************************************************************************/
+void CpuLeaveCritical(TReg32 value)
+{
+    POSIX_BARRIER();
+    if (value == 0U)
+    {
+#if (TCLC_PROBE_ENABLE)
+        uProbeIrqOffLeave();
+#endif
+        PosixIntMask = 0;
+        ServicePending();
+    }
+}
+
+
+/*************************************************************************************************
+ *  ܣں˹жϵȼ                                                             *
+ *  (1) irqn      жϺ                                                                   *
+ *  أ                                                                                     *
+ *  ˵ģж϶źʵ֣ٽȫźţҪȼ                             *
+ *************************************************************************************************/
+void CpuSetIrqPriority(TIndex irqn)
+{
+}
+
+
+/*************************************************************************************************
+ *  ܣʽⲿж                                                                 *
+ *  (1) irqn      жϺ                                                                   *
+ *  أ                                                                                     *
+ *  ˵򱾽̷ͶӦźţⲿźžͬģжϴ                     *
+ *************************************************************************************************/
+void CpuRaiseIrq(TIndex irqn)
+{
+    if (irqn == POSIX_USR1_IRQID)
+    {
+        raise(SIGUSR1);
+    }
+    else if (irqn == POSIX_USR2_IRQID)
+    {
+        raise(SIGUSR2);
+    }
+}
+
+
+/*************************************************************************************************
+ *  ܣʼ                                                                           *
+ *                                                                                       *
+ *  أ                                                                                     *
+ *  ˵עģSysTickⲿжϵźŴ                                                *
+ *************************************************************************************************/
+void CpuSetupEntry(void)
+{
+    struct sigaction action;
+
+    memset(&action, 0, sizeof(action));
+    action.sa_handler = PosixSignalHandler;
+    action.sa_flags   = SA_RESTART;
+    sigemptyset(&(action.sa_mask));
+    sigaddset(&(action.sa_mask), SIGALRM);
+    sigaddset(&(action.sa_mask), SIGUSR1);
+    sigaddset(&(action.sa_mask), SIGUSR2);
+
+    sigaction(SIGALRM, &action, (struct sigaction*)0);
+    sigaction(SIGUSR1, &action, (struct sigaction*)0);
+    sigaction(SIGUSR2, &action, (struct sigaction*)0);
+}
+
+
+#if ((TCLC_PROBE_ENABLE) || (TCLC_TRACE_ENABLE))
+/*************************************************************************************************
+ *  ܣȡڼ                                                                     *
+ *                                                                                       *
+ *  أTCLC_CPU_CLOCK_FREQʱȡ32λ                              *
+ *  ˵ûпֲڼѵʱӻĿ괦ӳͳƺ       *
+ *        TCLC_TRACE_CLOCK_FREQĵλCortex-M3ֲһ                                         *
+ *************************************************************************************************/
+TBase32 CpuGetCycleCount(void)
+{
+    struct timespec now;
+    unsigned long long cycles;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    cycles = (unsigned long long)now.tv_sec * TCLC_CPU_CLOCK_FREQ +
+             (unsigned long long)now.tv_nsec * TCLC_CPU_CLOCK_FREQ / 1000000000ULL;
+    return (TBase32)cycles;
+}
+#endif
+
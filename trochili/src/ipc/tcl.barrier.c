@@ -0,0 +1,243 @@
+/*************************************************************************************************
+ *                                     Trochili RTOS Kernel                                      *
+ *                                  Copyright(C) 2016 LIUXUMING                                  *
+ *                                       www.trochili.com                                        *
+ *************************************************************************************************/
+#include <string.h>
+
+#include "tcl.types.h"
+#include "tcl.config.h"
+#include "tcl.cpu.h"
+#include "tcl.debug.h"
+#include "tcl.kernel.h"
+#include "tcl.ipc.h"
+#include "tcl.barrier.h"
+
+#if ((TCLC_IPC_ENABLE)&&(TCLC_IPC_BARRIER_ENABLE))
+
+/*************************************************************************************************
+ *  : ͳ߳ϵ߳Ŀ                                                         *
+ *  : (1) pBarrier ߳Ͻṹַ                                                          *
+ *  : е߳Ŀ                                                                   *
+ *  ˵ʱֹ߱߳Ѿ뿪Уܻûüв޸ĵ             *
+ *        ڵʱҪͳ                                           *
+ *************************************************************************************************/
+static TBase32 CountWaiters(TBarrier* pBarrier)
+{
+    TBase32 count = 0U;
+    TObjNode* pNode;
+
+    pNode = pBarrier->Queue.PrimaryHandle;
+    if (pNode != (TObjNode*)0)
+    {
+        do
+        {
+            count++;
+            pNode = pNode->Next;
+        }
+        while (pNode != pBarrier->Queue.PrimaryHandle);
+    }
+
+    return count;
+}
+
+
+/*************************************************************************************************
+ *  : ̵߳ϲȴ߳                                                             *
+ *  : (1) pBarrier ߳Ͻṹַ                                                          *
+ *        (2) option   ȴ߳ϵģʽ                                                        *
+ *        (3) timeo    ʱģʽµȴ߳ϵʱ޳                                      *
+ *        (4) pError   ϸý                                                              *
+ *  : (1) eSuccess ɹ                                                                  *
+ *        (2) eFailure ʧ                                                                  *
+ *        (3) eError                                                                     *
+ *  ˵(1) 󵽴̲߳һλѱȫȴ̣߳漴һ֣             *
+ *        (2) ȴʱֹ߱߳˳ֻϣ뵽߳Ŀ                         *
+ *************************************************************************************************/
+TState xBarrierWait(TBarrier* pBarrier, TOption option, TTimeTick timeo, TError* pError)
+{
+    TState state = eFailure;
+    TError error = IPC_ERR_UNREADY;
+    TBool HiRP = eFalse;
+    TIpcContext* pContext;
+    TReg32 imask;
+
+    CpuEnterCritical(&imask);
+
+    if ((pBarrier->Property & IPC_PROP_READY) && (uKernelVariable.State == eThreadState))
+    {
+        if (pBarrier->Arrived + 1U >= pBarrier->Count)
+        {
+            pBarrier->Arrived = CountWaiters(pBarrier);
+        }
+
+        if (pBarrier->Arrived + 1U >= pBarrier->Count)
+        {
+            /* ֻɣȫȴ߳ */
+            pBarrier->Arrived = 0U;
+            uIpcUnblockAll(&(pBarrier->Queue), eSuccess, IPC_ERR_NONE, (void**)0, &HiRP);
+            uThreadPreempt(HiRP);
+
+            error = IPC_ERR_NONE;
+            state = eSuccess;
+        }
+        else
+        {
+            error = IPC_ERR_INVALID_STATUS;
+            if ((option & IPC_OPT_WAIT) && (uKernelVariable.Schedulable == eTrue))
+            {
+                pBarrier->Arrived++;
+
+                /* õǰ̵߳IPCĽṹַ */
+                pContext = &(uKernelVariable.CurrentThread->IpcContext);
+
+                /* 趨߳ڵȴԴϢ */
+                uIpcSaveContext(pContext, (void*)pBarrier, (void*)0, 0U, (option | IPC_OPT_BARRIER),
+                                &state, &error);
+
+                /* ǰ߳ڸ߳ϵ */
+                uIpcBlockThread(pContext, &(pBarrier->Queue), timeo);
+
+                /* ǰ̷߳ȣ̵ִ߳ */
+                uThreadSchedule();
+
+                CpuLeaveCritical(imask);
+                /* ʱ˴һεȣǰ߳ѾIPCС
+                   ʼִб̣߳ٴδ߳ʱӱС*/
+                CpuEnterCritical(&imask);
+
+                /* ̹߳Ϣ */
+                uIpcCleanContext(pContext);
+
+                /* ʱֹ߱ʱ˳ֻϣϱɾʱٷ */
+                if ((state != eSuccess) && (error != IPC_ERR_DELETE))
+                {
+                    pBarrier->Arrived = CountWaiters(pBarrier);
+                }
+            }
+        }
+    }
+
+    CpuLeaveCritical(imask);
+
+    *pError = error;
+    return state;
+}
+
+
+/*************************************************************************************************
+ *  : ߳                                                                           *
+ *  : (1) pBarrier ߳Ͻṹַ                                                          *
+ *        (2) pError   ϸý                                                              *
+ *  : (1) eSuccess ɹ                                                                  *
+ *        (2) eFailure ʧ                                                                  *
+ *  ˵ڵȴ߳ȫIPC_ERR_RESETʧܷأ¿ʼ                            *
+ *************************************************************************************************/
+TState xBarrierReset(TBarrier* pBarrier, TError* pError)
+{
+    TState state = eFailure;
+    TError error = IPC_ERR_UNREADY;
+    TBool HiRP = eFalse;
+    TReg32 imask;
+
+    CpuEnterCritical(&imask);
+
+    if (pBarrier->Property & IPC_PROP_READY)
+    {
+        /* ϵеȴ̶߳ͷţ̵߳ĵȴIPC_ERR_RESET */
+        uIpcUnblockAll(&(pBarrier->Queue), eFailure, IPC_ERR_RESET, (void**)0, &HiRP);
+
+        pBarrier->Property &= IPC_RESET_BARR_PROP;
+        pBarrier->Arrived = 0U;
+
+        /* Է߳ռ */
+        uThreadPreempt(HiRP);
+
+        error = IPC_ERR_NONE;
+        state = eSuccess;
+    }
+
+    CpuLeaveCritical(imask);
+
+    *pError = error;
+    return state;
+}
+
+
+/*************************************************************************************************
+ *  : ߳Ͻʼ                                                                     *
+ *  : (1) pBarrier ߳Ͻṹַ                                                          *
+ *        (2) pError   ϸý                                                              *
+ *  : (1) eSuccess ɹ                                                                  *
+ *        (2) eFailure ʧ                                                                  *
+ *  ˵                                                                                       *
+ *************************************************************************************************/
+TState xBarrierDelete(TBarrier* pBarrier, TError* pError)
+{
+    TState state = eFailure;
+    TError error = IPC_ERR_UNREADY;
+    TBool HiRP = eFalse;
+    TReg32 imask;
+
+    CpuEnterCritical(&imask);
+
+    if (pBarrier->Property & IPC_PROP_READY)
+    {
+        /* ϵеȴ̶߳ͷţ̵߳ĵȴIPC_ERR_DELETE */
+        uIpcUnblockAll(&(pBarrier->Queue), eFailure, IPC_ERR_DELETE, (void**)0, &HiRP);
+
+        /* ߳϶ȫ */
+        memset(pBarrier, 0U, sizeof(TBarrier));
+
+        /* Է߳ռ */
+        uThreadPreempt(HiRP);
+
+        error = IPC_ERR_NONE;
+        state = eSuccess;
+    }
+
+    CpuLeaveCritical(imask);
+
+    *pError = error;
+    return state;
+}
+
+
+/*************************************************************************************************
+ *  : ʼ߳                                                                         *
+ *  : (1) pBarrier ߳Ͻṹַ                                                          *
+ *        (2) count    ÿҪϵ߳Ŀ                                                    *
+ *        (3) property ߳ϵĳʼ                                                        *
+ *        (4) pError   ϸý                                                              *
+ *  : (1) eSuccess ɹ                                                                  *
+ *        (2) eFailure ʧ                                                                  *
+ *  ˵                                                                                       *
+ *************************************************************************************************/
+TState xBarrierCreate(TBarrier* pBarrier, TBase32 count, TProperty property, TError* pError)
+{
+    TState state = eFailure;
+    TError error = IPC_ERR_FAULT;
+    TReg32 imask;
+
+    CpuEnterCritical(&imask);
+
+    if (!(pBarrier->Property & IPC_PROP_READY))
+    {
+        property |= IPC_PROP_READY;
+        pBarrier->Property = property;
+        pBarrier->Count    = count;
+        pBarrier->Arrived  = 0U;
+        uIpcInitQueue(&(pBarrier->Queue), &(pBarrier->Property));
+
+        error = IPC_ERR_NONE;
+        state = eSuccess;
+    }
+
+    CpuLeaveCritical(imask);
+
+    *pError = error;
+    return state;
+}
+
+#endif
+
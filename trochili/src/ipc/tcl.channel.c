@@ -0,0 +1,338 @@
+/*************************************************************************************************
+ *                                     Trochili RTOS Kernel                                      *
+ *                                  Copyright(C) 2016 LIUXUMING                                  *
+ *                                       www.trochili.com                                        *
+ *************************************************************************************************/
+#include <string.h>
+
+#include "tcl.types.h"
+#include "tcl.config.h"
+#include "tcl.cpu.h"
+#include "tcl.debug.h"
+#include "tcl.thread.h"
+#include "tcl.kernel.h"
+#include "tcl.ipc.h"
+#include "tcl.channel.h"
+
+#if ((TCLC_IPC_ENABLE) && (TCLC_IPC_CHANNEL_ENABLE))
+
+/* ԪؼڻжӦĵַ */
+#define CHANNEL_SLOT(chnl, count) \
+    ((chnl)->Buffer + ((count) & ((chnl)->Capacity - 1U)) * (chnl)->Size)
+
+
+/*************************************************************************************************
+ *  ܣԴͨжһԪ                                                               *
+ *  (1) pChannel ͨṹַ                                                              *
+ *        (2) pData    Ԫصĵַ                                                            *
+ *        (3) pError   ϸý                                                              *
+ *  : (1) eFailure ʧ                                                                  *
+ *        (2) eSuccess ɹ                                                                  *
+ *  ˵ֻߵãҪٽȸٸTail߿Tailʱλõ   *
+ *        Ѿٱʹ                                                                     *
+ *************************************************************************************************/
+static TState TryReadChannel(TChannel* pChannel, void* pData, TError* pError)
+{
+    TState state = eFailure;
+    TBase32 tail;
+
+    tail = pChannel->Tail;
+    if (pChannel->Head != tail)
+    {
+        /* ֤Head֮ŶȡԪ */
+        CpuDataBarrier();
+        memcpy(pData, CHANNEL_SLOT(pChannel, tail), pChannel->Size);
+        CpuDataBarrier();
+        pChannel->Tail = tail + 1U;
+
+        *pError = IPC_ERR_NONE;
+        state = eSuccess;
+    }
+    else
+    {
+        *pError = IPC_ERR_INVALID_STATUS;
+    }
+
+    return state;
+}
+
+
+/*************************************************************************************************
+ *  ܣͨϵ߳                                                           *
+ *  (1) pChannel ͨṹַ                                                              *
+ *  أ                                                                                     *
+ *  ˵ֻ˵ȴʱ߲Żñں                                     *
+ *************************************************************************************************/
+static void WakeConsumer(TChannel* pChannel)
+{
+    TBool HiRP = eFalse;
+    TIpcContext* pContext;
+    TReg32 imask;
+
+    CpuEnterCritical(&imask);
+
+    /* ߿Ѿڽٽ֮ǰԪضû */
+    pChannel->Waiting = eFalse;
+    if (pChannel->Queue.PrimaryHandle != (TObjNode*)0)
+    {
+        pContext = (TIpcContext*)(pChannel->Queue.PrimaryHandle->Owner);
+        uIpcUnblockThread(pContext, eSuccess, IPC_ERR_NONE, &HiRP);
+
+        /* Է߳ռ */
+        uThreadPreempt(HiRP);
+    }
+
+    CpuLeaveCritical(imask);
+}
+
+
+/*************************************************************************************************
+ *  : ߳/ISRͨдһԪ                                                             *
+ *  : (1) pChannel ͨṹַ                                                              *
+ *        (2) pData    Ԫصַ                                                                  *
+ *        (3) pError   ϸý                                                              *
+ *  : (1) eFailure ʧ                                                                  *
+ *        (2) eSuccess ɹ                                                                  *
+ *  ˵ֻһ(һISRһ߳)áͨʱֱӷʧܣߴӲ      *
+ *        ֻڵȴʱŽٽ                                                       *
+ *************************************************************************************************/
+TState xChannelWrite(TChannel* pChannel, void* pData, TError* pError)
+{
+    TState state = eFailure;
+    TError error = IPC_ERR_UNREADY;
+    TBase32 head;
+
+    if (pChannel->Property & IPC_PROP_READY)
+    {
+        head = pChannel->Head;
+        if ((head - pChannel->Tail) < pChannel->Capacity)
+        {
+            /* ԪݱHead֮ǰд */
+            memcpy(CHANNEL_SLOT(pChannel, head), pData, pChannel->Size);
+            CpuDataBarrier();
+            pChannel->Head = head + 1U;
+
+            /* Headĸ±WaitingĶȡߵĲ˳෴Ӷᶪʧ */
+            CpuDataBarrier();
+            if (pChannel->Waiting == eTrue)
+            {
+                WakeConsumer(pChannel);
+            }
+
+            error = IPC_ERR_NONE;
+            state = eSuccess;
+        }
+        else
+        {
+            error = IPC_ERR_INVALID_STATUS;
+        }
+    }
+
+    *pError = error;
+    return state;
+}
+
+
+/*************************************************************************************************
+ *  : ߳/ISRͨһԪ                                                             *
+ *  : (1) pChannel ͨṹַ                                                              *
+ *        (2) pData    Ԫصĵַ                                                            *
+ *        (3) option   ͨģʽ                                                            *
+ *        (4) timeo    ʱģʽ·ͨʱ޳                                          *
+ *        (5) pError   ϸý                                                              *
+ *  : (1) eFailure ʧ                                                                  *
+ *        (2) eSuccess ɹ                                                                  *
+ *  ˵ֻһߵáͨǿʱٽͨʱȴ               *
+ *        ٽ¼һΣȻΪղ                                               *
+ *************************************************************************************************/
+TState xChannelRead(TChannel* pChannel, void* pData, TOption option, TTimeTick timeo,
+                    TError* pError)
+{
+    TState state = eFailure;
+    TError error = IPC_ERR_UNREADY;
+    TIpcContext* pContext;
+    TReg32 imask;
+
+    if (pChannel->Property & IPC_PROP_READY)
+    {
+        state = TryReadChannel(pChannel, pData, &error);
+
+        /* ֻ̻߳²̵߳ʱ߲ſȴ */
+        if ((state == eFailure) && (!(option & IPC_OPT_ISR)) && (option & IPC_OPT_WAIT) &&
+                (uKernelVariable.State == eThreadState))
+        {
+            /* ȴ֮дԪһѲ */
+            pChannel->Waiting = eTrue;
+            CpuDataBarrier();
+
+            CpuEnterCritical(&imask);
+
+            state = TryReadChannel(pChannel, pData, &error);
+            if ((state == eFailure) && (uKernelVariable.Schedulable == eTrue) &&
+                    (pChannel->Property & IPC_PROP_READY))
+            {
+                /* õǰ̵߳IPCĽṹַ */
+                pContext = &(uKernelVariable.CurrentThread->IpcContext);
+
+                /* ̹߳Ϣ */
+                option |= IPC_OPT_CHANNEL | IPC_OPT_READ_DATA;
+                uIpcSaveContext(pContext, (void*)pChannel, (void*)pData, pChannel->Size,
+                                option, &state, &error);
+
+                /* ǰ߳ڸͨ */
+                uIpcBlockThread(pContext, &(pChannel->Queue), timeo);
+
+                /* ǰ̷߳ȣ̵ִ߳ */
+                uThreadSchedule();
+
+                CpuLeaveCritical(imask);
+                /* ʱ˴һεȣǰ߳ѾIPCС
+                ʼִб̣߳ٴδ߳ʱӱС*/
+                CpuEnterCritical(&imask);
+
+                /* ̹߳Ϣ */
+                uIpcCleanContext(pContext);
+
+                /* ߻ʱԪѾͨ */
+                if (state == eSuccess)
+                {
+                    state = TryReadChannel(pChannel, pData, &error);
+                }
+            }
+
+            pChannel->Waiting = eFalse;
+
+            CpuLeaveCritical(imask);
+        }
+    }
+
+    *pError = error;
+    return state;
+}
+
+
+/*************************************************************************************************
+ *  : ͨʼ                                                                         *
+ *  : (1) pChannel ͨṹַ                                                              *
+ *        (2) pAddr    λַ                                                            *
+ *        (3) capacity ɵԪĿ2                                 *
+ *        (4) size     ÿԪصֽ                                                          *
+ *        (5) pError   ϸý                                                              *
+ *  : (1) eSuccess ɹ                                                                  *
+ *        (2) eFailure ʧ                                                                  *
+ *  ˵                                                                                       *
+ *************************************************************************************************/
+TState xChannelCreate(TChannel* pChannel, void* pAddr, TBase32 capacity, TBase32 size,
+                      TError* pError)
+{
+    TState state = eFailure;
+    TError error = IPC_ERR_FAULT;
+    TReg32 imask;
+
+    CpuEnterCritical(&imask);
+
+    if (!(pChannel->Property & IPC_PROP_READY))
+    {
+        if ((capacity == 0U) || (capacity & (capacity - 1U)) || (size == 0U))
+        {
+            error = IPC_ERR_INVALID_VALUE;
+        }
+        else
+        {
+            pChannel->Property = IPC_PROP_READY;
+            pChannel->Buffer   = (TByte*)pAddr;
+            pChannel->Size     = size;
+            pChannel->Capacity = capacity;
+            pChannel->Head     = 0U;
+            pChannel->Tail     = 0U;
+            pChannel->Waiting  = eFalse;
+
+            uIpcInitQueue(&(pChannel->Queue), &(pChannel->Property));
+
+            error = IPC_ERR_NONE;
+            state = eSuccess;
+        }
+    }
+
+    CpuLeaveCritical(imask);
+
+    *pError = error;
+    return state;
+}
+
+
+/*************************************************************************************************
+ *  ܣͨע                                                                           *
+ *  룺(1) pChannel  ͨṹַ                                                             *
+ *        (2) pError    ϸý                                                             *
+ *  أ(1) eSuccess  ɹ                                                                 *
+ *        (2) eFailure  ʧ                                                                 *
+ *  ˵߱뱣֤ߺ߶ٷͨ                                             *
+ *************************************************************************************************/
+TState xChannelDelete(TChannel* pChannel, TError* pError)
+{
+    TState state = eFailure;
+    TError error = IPC_ERR_UNREADY;
+    TBool HiRP = eFalse;
+    TReg32 imask;
+
+    CpuEnterCritical(&imask);
+
+    if (pChannel->Property & IPC_PROP_READY)
+    {
+        /* ͷţȴTCLE_IPC_DELETE */
+        uIpcUnblockAll(&(pChannel->Queue), eFailure, IPC_ERR_DELETE, (void**)0, &HiRP);
+
+        /* ͨȫ */
+        memset(pChannel, 0U, sizeof(TChannel));
+
+        /* Է߳ռ */
+        uThreadPreempt(HiRP);
+
+        error = IPC_ERR_NONE;
+        state = eSuccess;
+    }
+
+    CpuLeaveCritical(imask);
+
+    *pError = error;
+    return state;
+}
+
+
+/*************************************************************************************************
+ *  ܣֹͨ                                                                       *
+ *  룺(1) pChannel  ͨṹַ                                                             *
+ *        (2) pError    ϸý                                                             *
+ *  أ(1) eSuccess  ɹ                                                                 *
+ *        (2) eFailure  ʧ                                                                 *
+ *  ˵߱ѣȴTCLE_IPC_FLUSHͨеԪرֲ                     *
+ *************************************************************************************************/
+TState xChannelFlush(TChannel* pChannel, TError* pError)
+{
+    TState state = eFailure;
+    TError error = IPC_ERR_UNREADY;
+    TBool HiRP = eFalse;
+    TReg32 imask;
+
+    CpuEnterCritical(&imask);
+
+    if (pChannel->Property & IPC_PROP_READY)
+    {
+        uIpcUnblockAll(&(pChannel->Queue), eFailure, IPC_ERR_FLUSH, (void**)0, &HiRP);
+
+        /* Է߳ռ */
+        uThreadPreempt(HiRP);
+
+        error = IPC_ERR_NONE;
+        state = eSuccess;
+    }
+
+    CpuLeaveCritical(imask);
+
+    *pError = error;
+    return state;
+}
+
+#endif
+
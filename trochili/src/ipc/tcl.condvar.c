@@ -0,0 +1,305 @@
+/*************************************************************************************************
+ *                                     Trochili RTOS Kernel                                      *
+ *                                  Copyright(C) 2016 LIUXUMING                                  *
+ *                                       www.trochili.com                                        *
+ *************************************************************************************************/
+#include <string.h>
+
+#include "tcl.types.h"
+#include "tcl.config.h"
+#include "tcl.cpu.h"
+#include "tcl.debug.h"
+#include "tcl.kernel.h"
+#include "tcl.ipc.h"
+#include "tcl.mutex.h"
+#include "tcl.condvar.h"
+
+#if ((TCLC_IPC_ENABLE)&&(TCLC_IPC_MUTEX_ENABLE)&&(TCLC_IPC_CONDVAR_ENABLE))
+
+/*************************************************************************************************
+ *  : еһ߳                                                       *
+ *  : (1) pContext ȴ̵߳IPC                                                       *
+ *        (2) pHiRP    Ƿиȼ                                                      *
+ *  :                                                                                      *
+ *  ˵ȴ߳Ҫ»ͷŵĻֱӰ                           *
+ *        Ѿɾʱֻ߳                                                         *
+ *************************************************************************************************/
+static void WakeWaiter(TIpcContext* pContext, TBool* pHiRP)
+{
+    TMutex* pMutex;
+
+    pMutex = (TMutex*)(pContext->Data.Addr1);
+    if (pMutex->Property & IPC_PROP_READY)
+    {
+        uMutexHandOver(pMutex, pContext, pHiRP);
+    }
+    else
+    {
+        uIpcUnblockThread(pContext, eSuccess, IPC_ERR_NONE, pHiRP);
+    }
+}
+
+
+/*************************************************************************************************
+ *  : ߳ͷŻȴ                                                           *
+ *  : (1) pCondVar ṹַ                                                          *
+ *        (2) pMutex   ǰ߳ռеĻ                                                      *
+ *        (3) option   ȴģʽ                                                        *
+ *        (4) timeo    ʱģʽµȴʱ޳                                      *
+ *        (5) pError   ϸý                                                              *
+ *  : (1) eSuccess ɹ                                                                  *
+ *        (2) eFailure ʧ                                                                  *
+ *        (3) eError                                                                     *
+ *  ˵(1) ͷŻͽͬһٽɣᶪʧ֪ͨ               *
+ *        (2) ۵ȴΣʱ̶߳ռлǶҲָ               *
+ *        (3) ֪ͨ߳ͨ״ֱ̬ת뻥Уͷʱű         *
+ *************************************************************************************************/
+TState xCondVarWait(TCondVar* pCondVar, TMutex* pMutex, TOption option, TTimeTick timeo,
+                    TError* pError)
+{
+    TState state = eFailure;
+    TError error = IPC_ERR_UNREADY;
+    TBool HiRP = eFalse;
+    TBase32 nest = 0U;
+    TIpcContext* pContext;
+    TError lockerr;
+    TReg32 imask;
+
+    CpuEnterCritical(&imask);
+
+    if ((pCondVar->Property & IPC_PROP_READY) && (pMutex->Property & IPC_PROP_READY) &&
+            (uKernelVariable.State == eThreadState))
+    {
+        error = IPC_ERR_FORBIDDEN;
+        if ((option & IPC_OPT_WAIT) && (uKernelVariable.Schedulable == eTrue) &&
+                (pMutex->Owner == uKernelVariable.CurrentThread))
+        {
+            /* ͷŻֱܱӽ߳ */
+            uMutexRelease(pMutex, &nest, &HiRP, &error);
+
+            /* õǰ̵߳IPCĽṹַ */
+            pContext = &(uKernelVariable.CurrentThread->IpcContext);
+
+            /* 趨߳ڵȴԴϢͬʱ¼Ҫ»õĻ */
+            uIpcSaveContext(pContext, (void*)pCondVar, (void*)pMutex, 0U,
+                            (option | IPC_OPT_CONDVAR), &state, &error);
+
+            /* ǰ߳ڸ */
+            uIpcBlockThread(pContext, &(pCondVar->Queue), timeo);
+
+            /* ǰ̷߳ȣ̵ִ߳ */
+            uThreadSchedule();
+
+            CpuLeaveCritical(imask);
+            /* ʱ˴һεȣǰ߳ѾIPCС
+               ʼִб̣߳ٴδ߳ʱӱС*/
+            CpuEnterCritical(&imask);
+
+            /* ̹߳Ϣ */
+            uIpcCleanContext(pContext);
+
+            /* ʱֹ߱ȴʱ߳ûеõҪ»û */
+            if (pMutex->Owner != uKernelVariable.CurrentThread)
+            {
+                CpuLeaveCritical(imask);
+                xMutexLock(pMutex, IPC_OPT_WAIT, 0U, &lockerr);
+                CpuEnterCritical(&imask);
+            }
+
+            /* ָǶ */
+            if (pMutex->Owner == uKernelVariable.CurrentThread)
+            {
+                pMutex->Nest = nest;
+            }
+        }
+    }
+
+    CpuLeaveCritical(imask);
+
+    *pError = error;
+    return state;
+}
+
+
+/*************************************************************************************************
+ *  : ֪ͨһȴ߳                                                         *
+ *  : (1) pCondVar ṹַ                                                          *
+ *        (2) pError   ϸý                                                              *
+ *  : (1) eSuccess ɹ                                                                  *
+ *        (2) eFailure ʧ                                                                  *
+ *  ˵û̵߳ȴʱ֪ͨ                                                             *
+ *************************************************************************************************/
+TState xCondVarSignal(TCondVar* pCondVar, TError* pError)
+{
+    TState state = eFailure;
+    TError error = IPC_ERR_UNREADY;
+    TBool HiRP = eFalse;
+    TReg32 imask;
+
+    CpuEnterCritical(&imask);
+
+    if (pCondVar->Property & IPC_PROP_READY)
+    {
+        if (pCondVar->Property & IPC_PROP_PRIMQ_AVAIL)
+        {
+            WakeWaiter((TIpcContext*)(pCondVar->Queue.PrimaryHandle->Owner), &HiRP);
+            uThreadPreempt(HiRP);
+        }
+
+        error = IPC_ERR_NONE;
+        state = eSuccess;
+    }
+
+    CpuLeaveCritical(imask);
+
+    *pError = error;
+    return state;
+}
+
+
+/*************************************************************************************************
+ *  : 㲥ȫȴ߳                                                         *
+ *  : (1) pCondVar ṹַ                                                          *
+ *        (2) pError   ϸý                                                              *
+ *  : (1) eSuccess ɹ                                                                  *
+ *        (2) eFailure ʧ                                                                  *
+ *  ˵ȴ̰߳˳ת뻥Уһ               *
+ *************************************************************************************************/
+TState xCondVarBroadcast(TCondVar* pCondVar, TError* pError)
+{
+    TState state = eFailure;
+    TError error = IPC_ERR_UNREADY;
+    TBool HiRP = eFalse;
+    TReg32 imask;
+
+    CpuEnterCritical(&imask);
+
+    if (pCondVar->Property & IPC_PROP_READY)
+    {
+        while (pCondVar->Queue.PrimaryHandle != (TObjNode*)0)
+        {
+            WakeWaiter((TIpcContext*)(pCondVar->Queue.PrimaryHandle->Owner), &HiRP);
+        }
+        uThreadPreempt(HiRP);
+
+        error = IPC_ERR_NONE;
+        state = eSuccess;
+    }
+
+    CpuLeaveCritical(imask);
+
+    *pError = error;
+    return state;
+}
+
+
+/*************************************************************************************************
+ *  ܣֹ,ϵ߳ȫֹ                      *
+ *  (1) pCondVar ṹַ                                                          *
+ *        (2) pError   ϸý                                                              *
+ *  : (1) eSuccess ɹ                                                                  *
+ *        (2) eFailure ʧ                                                                  *
+ *  ˵ѵ߳ڷǰ»û                                                     *
+ *************************************************************************************************/
+TState xCondVarFlush(TCondVar* pCondVar, TError* pError)
+{
+    TState state = eFailure;
+    TError error = IPC_ERR_UNREADY;
+    TBool HiRP = eFalse;
+    TReg32 imask;
+
+    CpuEnterCritical(&imask);
+
+    if (pCondVar->Property & IPC_PROP_READY)
+    {
+        /* ϵеȴ̶߳ͷţ̵߳ĵȴIPC_ERR_FLUSH */
+        uIpcUnblockAll(&(pCondVar->Queue), eFailure, IPC_ERR_FLUSH, (void**)0, &HiRP);
+
+        /* Է߳ռ */
+        uThreadPreempt(HiRP);
+
+        error = IPC_ERR_NONE;
+        state = eSuccess;
+    }
+
+    CpuLeaveCritical(imask);
+
+    *pError = error;
+    return state;
+}
+
+
+/*************************************************************************************************
+ *  : ʼ                                                                     *
+ *  : (1) pCondVar ṹַ                                                          *
+ *        (2) pError   ϸý                                                              *
+ *  : (1) eSuccess ɹ                                                                  *
+ *        (2) eFailure ʧ                                                                  *
+ *  ˵                                                                                       *
+ *************************************************************************************************/
+TState xCondVarDelete(TCondVar* pCondVar, TError* pError)
+{
+    TState state = eFailure;
+    TError error = IPC_ERR_UNREADY;
+    TBool HiRP = eFalse;
+    TReg32 imask;
+
+    CpuEnterCritical(&imask);
+
+    if (pCondVar->Property & IPC_PROP_READY)
+    {
+        /* ϵеȴ̶߳ͷţ̵߳ĵȴIPC_ERR_DELETE */
+        uIpcUnblockAll(&(pCondVar->Queue), eFailure, IPC_ERR_DELETE, (void**)0, &HiRP);
+
+        /* ȫ */
+        memset(pCondVar, 0U, sizeof(TCondVar));
+
+        /* Է߳ռ */
+        uThreadPreempt(HiRP);
+
+        error = IPC_ERR_NONE;
+        state = eSuccess;
+    }
+
+    CpuLeaveCritical(imask);
+
+    *pError = error;
+    return state;
+}
+
+
+/*************************************************************************************************
+ *  : ʼ                                                                         *
+ *  : (1) pCondVar ṹַ                                                          *
+ *        (2) property ĳʼ                                                        *
+ *        (3) pError   ϸý                                                              *
+ *  : (1) eSuccess ɹ                                                                  *
+ *        (2) eFailure ʧ                                                                  *
+ *  ˵                                                                                       *
+ *************************************************************************************************/
+TState xCondVarCreate(TCondVar* pCondVar, TProperty property, TError* pError)
+{
+    TState state = eFailure;
+    TError error = IPC_ERR_FAULT;
+    TReg32 imask;
+
+    CpuEnterCritical(&imask);
+
+    if (!(pCondVar->Property & IPC_PROP_READY))
+    {
+        property |= IPC_PROP_READY;
+        pCondVar->Property = property;
+        uIpcInitQueue(&(pCondVar->Queue), &(pCondVar->Property));
+
+        error = IPC_ERR_NONE;
+        state = eSuccess;
+    }
+
+    CpuLeaveCritical(imask);
+
+    *pError = error;
+    return state;
+}
+
+#endif
+
@@ -16,11 +16,223 @@
 
 #if ((TCLC_IPC_ENABLE) && (TCLC_IPC_FLAGS_ENABLE))
 
-static TState TryReceiveFlags(TFlags* pFlags, TBitMask* pPattern, TOption option, TError* pError);
-static TState ReceiveFlags(TFlags* pFlags, TBitMask* pPattern, TOption option, TTimeTick timeo,
+static TState TryReceiveFlags(TFlags* pFlags, TFlagMask* pPattern, TOption option, TError* pError);
+static TState ReceiveFlags(TFlags* pFlags, TFlagMask* pPattern, TOption option, TTimeTick timeo,
                            TReg32* pIMask, TError* pError);
-static TState TrySendFlags(TFlags* pFlags, TBitMask pattern, TBool* pHiRP,  TError* pError);
-static TState SendFlags(TFlags* pFlags, TBitMask pattern, TError* pError);
+static TState TrySendFlags(TFlags* pFlags, TFlagMask pattern, TBool* pHiRP,  TError* pError);
+static TState SendFlags(TFlags* pFlags, TFlagMask pattern, TError* pError);
+
+#if (TCLC_IPC_FLAGS_INDEX_ENABLE)
+/*************************************************************************************************
+ *  ܣ¼бСλ¼                                                         *
+ *  (1) mask     ¼飬Ϊ0                                                           *
+ *  أСλ¼ı                                                               *
+ *  ˵                                                                                       *
+ *************************************************************************************************/
+static TIndex GetLowestFlag(TFlagMask mask)
+{
+    TIndex bit;
+
+#if (TCLC_IPC_FLAGS_64BIT_ENABLE)
+    if ((TBase32)mask != 0U)
+    {
+        bit = (TIndex)CpuCalcHiPRIO((TBase32)mask);
+    }
+    else
+    {
+        bit = 32U + (TIndex)CpuCalcHiPRIO((TBase32)(mask >> 32));
+    }
+#else
+    bit = (TIndex)CpuCalcHiPRIO(mask);
+#endif
+
+    return bit;
+}
+
+
+/*************************************************************************************************
+ *  ܣ̰߳ȴ¼¼ǵĵȴλ                                     *
+ *  (1) pContext ߳¼ϵIPC                                           *
+ *  أ                                                                                     *
+ *  ˵ANDʽ̹߳ȱٵıС¼ϣֻ¼ʱҪ¼飻      *
+ *        ORʽֻȴһ¼̹߳ڸ¼ϣȴ¼̹߳ڹϡ             *
+ *        ȴλ򣬻˳ɷ¼ʱ                                       *
+ *************************************************************************************************/
+static void FileWaiter(TIpcContext* pContext)
+{
+    TFlags* pFlags;
+    TFlagMask pattern;
+    TIndex bit;
+
+    pFlags = (TFlags*)(pContext->Object);
+    pattern = *((TFlagMask*)(pContext->Data.Addr1));
+    if (pContext->Option & IPC_OPT_AND)
+    {
+        pattern &= ~(pFlags->Value);
+    }
+
+    if ((pattern != 0U) &&
+            ((pContext->Option & IPC_OPT_AND) || ((pattern & (pattern - 1U)) == 0U)))
+    {
+        bit = GetLowestFlag(pattern);
+        pFlags->WaitMask |= ((TFlagMask)0x1 << bit);
+        uObjQueueAddFifoNode(&(pFlags->Waiters[bit]), &(pContext->FlagsNode), eQuePosTail);
+    }
+    else
+    {
+        pFlags->AnyMask |= pattern;
+        uObjQueueAddFifoNode(&(pFlags->AnyWaiters), &(pContext->FlagsNode), eQuePosTail);
+    }
+}
+
+
+/*************************************************************************************************
+ *  ܣ߳ʱ¼ǵĵȴλ                                                 *
+ *  (1) pContext ߳¼ϵIPC                                           *
+ *  أ                                                                                     *
+ *  ˵¼̵߳ĵ˳FIFOʽ°յ˳̣߳ȼʽͬȼ߳Ҳ   *
+ *        ˳                                                                           *
+ *************************************************************************************************/
+void uFlagsEnterIndex(TIpcContext* pContext)
+{
+    TFlags* pFlags;
+
+    pFlags = (TFlags*)(pContext->Object);
+    pContext->FlagsSeq = pFlags->Sequence;
+    pFlags->Sequence++;
+    FileWaiter(pContext);
+}
+
+
+/*************************************************************************************************
+ *  ܣȽѡ̵߳Ļ˳                                                             *
+ *  (1) pFlags   ¼ǵĵַ                                                            *
+ *        (2) pNode1   ѡ̵߳ĵȴλڵ                                                  *
+ *        (3) pNode2   ѡ̵߳ĵȴλڵ                                                  *
+ *  أeTrueʾpNode1ӦpNode2                                                    *
+ *  ˵ȼʽȱȽ߳ȼȻȽϵ˳˳Ż֮ȻȷȽ         *
+ *************************************************************************************************/
+static TBool WaiterBefore(TFlags* pFlags, TObjNode* pNode1, TObjNode* pNode2)
+{
+    TBool before;
+    TBase32 seq1;
+    TBase32 seq2;
+
+    seq1 = ((TIpcContext*)(pNode1->Owner))->FlagsSeq;
+    seq2 = ((TIpcContext*)(pNode2->Owner))->FlagsSeq;
+    before = (TBool)((seq1 - seq2) >= 0x80000000U);
+
+    if ((pFlags->Property & IPC_PROP_PREEMP_PRIMIQ) && (*(pNode1->Data) != *(pNode2->Data)))
+    {
+        before = (TBool)(*(pNode1->Data) < *(pNode2->Data));
+    }
+
+    return before;
+}
+
+
+/*************************************************************************************************
+ *  ܣȴλеȫڵƵѡĿͷ                                             *
+ *  (1) pHandle2 ȴλͷָĵַ                                                    *
+ *        (2) pList2   ѡͷָĵַ                                                      *
+ *  أ                                                                                     *
+ *  ˵ѡNextָӡ0βĵʱ                                *
+ *************************************************************************************************/
+static void CollectWaiters(TObjNode** pHandle2, TObjNode** pList2)
+{
+    TObjNode* pNode;
+
+    while (*pHandle2 != (TObjNode*)0)
+    {
+        pNode = *pHandle2;
+        uObjQueueRemoveNode(pHandle2, pNode);
+        pNode->Next = *pList2;
+        *pList2 = pNode;
+    }
+}
+
+
+/*************************************************************************************************
+ *  ܣջ˳ѡ                                                               *
+ *  (1) pFlags   ¼ǵĵַ                                                            *
+ *        (2) pList    ѡĵһڵ                                                      *
+ *  أĵһڵ                                                                     *
+ *  ˵Եϵ鲢򣬲ʹõݹͶڴ棬kѡ̺߳ʱO(k*log(k))               *
+ *************************************************************************************************/
+static TObjNode* SortWaiters(TFlags* pFlags, TObjNode* pList)
+{
+    TObjNode* pLeft;
+    TObjNode* pRight;
+    TObjNode* pTail;
+    TObjNode* pNode;
+    TBase32 width = 1U;
+    TBase32 merges;
+    TBase32 lsize;
+    TBase32 rsize;
+
+    do
+    {
+        pLeft = pList;
+        pList = (TObjNode*)0;
+        pTail = (TObjNode*)0;
+        merges = 0U;
+
+        /* ÿκϲγΪwidth */
+        while (pLeft != (TObjNode*)0)
+        {
+            merges++;
+            pRight = pLeft;
+            lsize = 0U;
+            while ((pRight != (TObjNode*)0) && (lsize < width))
+            {
+                lsize++;
+                pRight = pRight->Next;
+            }
+            rsize = width;
+
+            while ((lsize > 0U) || ((rsize > 0U) && (pRight != (TObjNode*)0)))
+            {
+                /* ֻҲڵϸǰʱȡҲڵ㣬֤ȶ */
+                if ((lsize == 0U) ||
+                        ((rsize > 0U) && (pRight != (TObjNode*)0) &&
+                         (WaiterBefore(pFlags, pRight, pLeft) == eTrue)))
+                {
+                    pNode = pRight;
+                    pRight = pRight->Next;
+                    rsize--;
+                }
+                else
+                {
+                    pNode = pLeft;
+                    pLeft = pLeft->Next;
+                    lsize--;
+                }
+
+                if (pTail != (TObjNode*)0)
+                {
+                    pTail->Next = pNode;
+                }
+                else
+                {
+                    pList = pNode;
+                }
+                pTail = pNode;
+            }
+            pLeft = pRight;
+        }
+
+        if (pTail != (TObjNode*)0)
+        {
+            pTail->Next = (TObjNode*)0;
+        }
+        width <<= 1U;
+    }
+    while (merges > 1U);
+
+    return pList;
+}
+#endif
+
 
 /*************************************************************************************************
  *  ܣԽ¼                                                                       *
@@ -32,11 +244,11 @@ static TState SendFlags(TFlags* pFlags, TBitMask pattern, TError* pError);
  *        (2) eSuccess ɹ                                                                  *
  *  ˵                                                                                       *
  *************************************************************************************************/
-static TState TryReceiveFlags(TFlags* pFlags, TBitMask* pPattern, TOption option, TError* pError)
+static TState TryReceiveFlags(TFlags* pFlags, TFlagMask* pPattern, TOption option, TError* pError)
 {
     TState state;
-    TBitMask match;
-    TBitMask pattern;
+    TFlagMask match;
+    TFlagMask pattern;
 
     pattern = *pPattern;
     match = (pFlags->Value) & pattern;
@@ -63,6 +275,100 @@ static TState TryReceiveFlags(TFlags* pFlags, TBitMask* pPattern, TOption option
 }
 
 
+#if (TCLC_IPC_FLAGS_INDEX_ENABLE)
+/*************************************************************************************************
+ *  ܣԷ¼                                                                       *
+ *  (1) pFlags   ¼ǵĵַ                                                            *
+ *        (2) pPattern Ҫ͵ıǵ                                                      *
+ *        (3) pHiRP    Ƿںлѹ߳                                                *
+ *        (4) pError   ϸý                                                              *
+ *  : (1) eFailure ʧ                                                                  *
+ *        (2) eSuccess ɹ                                                                  *
+ *  ˵ֻȴ¼·¼ཻ̣߳յȲ֮μ飬Բ     *
+ *        ߳¼ȴλ                                                                 *
+ *************************************************************************************************/
+static TState TrySendFlags(TFlags* pFlags, TFlagMask pattern, TBool* pHiRP, TError* pError)
+{
+    TObjNode* pList = (TObjNode*)0;
+    TObjNode* pNode;
+    TFlagMask candidate;
+    TFlagMask mask;
+    TFlagMask* pTemp;
+    TIndex bit;
+    TOption option;
+    TState state;
+    TIpcContext* pContext;
+
+    /* ¼ǷҪ */
+    mask = pFlags->Value | pattern;
+    if (mask != pFlags->Value)
+    {
+        *pError = IPC_ERR_NONE;
+        state = eSuccess;
+
+        /* ¼͵¼ */
+        pFlags->Value |= pattern;
+
+        /* ȡ·¼ϵ߳ */
+        candidate = pattern & pFlags->WaitMask;
+        pFlags->WaitMask &= ~candidate;
+        while (candidate != 0U)
+        {
+            bit = GetLowestFlag(candidate);
+            candidate &= ~((TFlagMask)0x1 << bit);
+            CollectWaiters(&(pFlags->Waiters[bit]), &pList);
+        }
+
+        /* ORʽȴ¼ֻ߳ڿʱűȡ */
+        if (pattern & pFlags->AnyMask)
+        {
+            pFlags->AnyMask = 0U;
+            CollectWaiters(&(pFlags->AnyWaiters), &pList);
+        }
+        pList = SortWaiters(pFlags, pList);
+
+        /* μѡ̣߳ѣµ¼¹ȴλ */
+        while (pList != (TObjNode*)0)
+        {
+            pNode = pList;
+            pList = pNode->Next;
+            pNode->Next = (TObjNode*)0;
+
+            pContext = (TIpcContext*)(pNode->Owner);
+            option = pContext->Option;
+            pTemp = (TFlagMask*)(pContext->Data.Addr1);
+
+            /*  õҪ¼ */
+            mask = pFlags->Value & (*pTemp);
+            if (((option & IPC_OPT_AND) && (mask == *pTemp)) ||
+                    ((option & IPC_OPT_OR) && (mask != 0U)))
+            {
+                *pTemp = mask;
+                uIpcUnblockThread(pContext, eSuccess, IPC_ERR_NONE, pHiRP);
+
+                /* ĳЩ¼ */
+                if (option & IPC_OPT_CONSUME)
+                {
+                    pFlags->Value &= (~mask);
+                }
+            }
+            else
+            {
+                FileWaiter(pContext);
+            }
+        }
+    }
+    else
+    {
+        *pError = IPC_ERR_FLAGS ;
+        state = eError;
+    }
+
+    return state;
+}
+
+#else
+
 /*************************************************************************************************
  *  ܣԷ¼                                                                       *
  *  (1) pFlags   ¼ǵĵַ                                                            *
@@ -73,15 +379,15 @@ static TState TryReceiveFlags(TFlags* pFlags, TBitMask* pPattern, TOption option
  *        (2) eSuccess ɹ                                                                  *
  *  ˵                                                                                       *
  *************************************************************************************************/
-static TState TrySendFlags(TFlags* pFlags, TBitMask pattern, TBool* pHiRP, TError* pError)
+static TState TrySendFlags(TFlags* pFlags, TFlagMask pattern, TBool* pHiRP, TError* pError)
 {
     TObjNode* pHead = (TObjNode*)0;
     TObjNode* pTail = (TObjNode*)0;
     TObjNode* pCurrent = (TObjNode*)0;
-    TBitMask mask = 0U;
+    TFlagMask mask = 0U;
     TBool match = eFalse;
     TOption option;
-    TBitMask* pTemp;
+    TFlagMask* pTemp;
     TState state;
     TIpcContext* pContext;
 
@@ -110,7 +416,7 @@ static TState TrySendFlags(TFlags* pFlags, TBitMask pattern, TBool* pHiRP, TErro
                 /* õȴ¼ǵ̺߳ص¼ڵ */
                 pContext =  (TIpcContext*)(pCurrent->Owner);
                 option = pContext->Option;
-                pTemp = (TBitMask*)(pContext->Data.Addr1);
+                pTemp = (TFlagMask*)(pContext->Data.Addr1);
 
                 /*  õҪ¼ */
                 mask = pFlags->Value & (*pTemp);
@@ -144,6 +450,7 @@ static TState TrySendFlags(TFlags* pFlags, TBitMask pattern, TBool* pHiRP, TErro
 
     return state;
 }
+#endif
 
 
 /*************************************************************************************************
@@ -158,7 +465,7 @@ static TState TrySendFlags(TFlags* pFlags, TBitMask pattern, TBool* pHiRP, TErro
  *        (2) eSuccess ɹ                                                                  *
  *  ˵                                                                                       *
  *************************************************************************************************/
-static TState ReceiveFlags(TFlags* pFlags, TBitMask* pPattern, TOption option, TTimeTick timeo,
+static TState ReceiveFlags(TFlags* pFlags, TFlagMask* pPattern, TOption option, TTimeTick timeo,
                            TReg32* pIMask, TError* pError)
 {
     TState state = eFailure;
@@ -182,12 +489,15 @@ static TState ReceiveFlags(TFlags* pFlags, TBitMask* pPattern, TOption option, T
                 pContext = &(uKernelVariable.CurrentThread->IpcContext);
 
                 /* ̹߳Ϣ */
-                uIpcSaveContext(pContext, (void*)pFlags, (TBase32)pPattern, sizeof(TBase32), 
+                uIpcSaveContext(pContext, (void*)pFlags, (void*)pPattern, sizeof(TFlagMask), 
                                 option | IPC_OPT_FLAGS, &state, pError);
 
                 /* ǰ߳ڸ,ȡ̻߳̽߳У
                 עIPC̹߳߳״̬ */
                 uIpcBlockThread(pContext, &(pFlags->Queue), timeo);
+#if (TCLC_IPC_FLAGS_INDEX_ENABLE)
+                uFlagsEnterIndex(pContext);
+#endif
 
                 /* ǰ߳ȣִ̼߳ */
                 uThreadSchedule();
@@ -216,7 +526,7 @@ static TState ReceiveFlags(TFlags* pFlags, TBitMask* pPattern, TOption option, T
  *        (2) eSuccess   ɹ                                                                *
  *  ˵ǰ߳                                                             *
  *************************************************************************************************/
-static TState SendFlags(TFlags* pFlags, TBitMask pattern, TError* pError)
+static TState SendFlags(TFlags* pFlags, TFlagMask pattern, TError* pError)
 {
     TState state = eFailure;
     TBool HiRP = eFalse;
@@ -253,7 +563,7 @@ static TState SendFlags(TFlags* pFlags, TBitMask pattern, TError* pError)
  *        (2) eSuccess ɹ                                                                  *
  *  ˵                                                                                       *
  *************************************************************************************************/
-TState xFlagsReceive(TFlags* pFlags, TBitMask* pPattern, TOption option, TTimeTick timeo,
+TState xFlagsReceive(TFlags* pFlags, TFlagMask* pPattern, TOption option, TTimeTick timeo,
                      TError* pError)
 {
     TState state = eFailure;
@@ -296,7 +606,7 @@ TState xFlagsReceive(TFlags* pFlags, TBitMask* pPattern, TOption option, TTimeTi
  *        (2) eSuccess   ɹ                                                                *
  *  ˵ǰ߳,Բ̻߳ISR                               *
  *************************************************************************************************/
-TState xFlagsSend(TFlags* pFlags, TBitMask pattern, TError* pError)
+TState xFlagsSend(TFlags* pFlags, TFlagMask pattern, TError* pError)
 {
     TState state = eFailure;
     TError error = IPC_ERR_UNREADY;
@@ -340,6 +650,10 @@ TState xFlagsReset(TFlags* pFlags, TError* pError)
 
         pFlags->Property &= IPC_RESET_FLAG_PROP;
         pFlags->Value = 0U;
+#if (TCLC_IPC_FLAGS_INDEX_ENABLE)
+        pFlags->WaitMask = 0U;
+        pFlags->AnyMask = 0U;
+#endif
 
         /* Է߳ռ */
         uThreadPreempt(HiRP);
@@ -407,6 +721,9 @@ TState xFlagsCreate(TFlags* pFlags, TProperty property, TError* pError)
     TState state = eFailure;
     TError error = IPC_ERR_FAULT;
     TReg32 imask;
+#if (TCLC_IPC_FLAGS_INDEX_ENABLE)
+    TIndex i;
+#endif
 
     CpuEnterCritical(&imask);
 
@@ -416,9 +733,18 @@ TState xFlagsCreate(TFlags* pFlags, TProperty property, TError* pError)
         pFlags->Property = property;
         pFlags->Value = 0U;
 
-        pFlags->Queue.PrimaryHandle   = (TObjNode*)0;
-        pFlags->Queue.AuxiliaryHandle = (TObjNode*)0;
-        pFlags->Queue.Property        = &(pFlags->Property);
+        uIpcInitQueue(&(pFlags->Queue), &(pFlags->Property));
+
+#if (TCLC_IPC_FLAGS_INDEX_ENABLE)
+        pFlags->WaitMask = 0U;
+        pFlags->AnyMask = 0U;
+        pFlags->AnyWaiters = (TObjNode*)0;
+        pFlags->Sequence = 0U;
+        for (i = 0U; i < FLAGS_BITS; i++)
+        {
+            pFlags->Waiters[i] = (TObjNode*)0;
+        }
+#endif
 
         state = eSuccess;
         error = IPC_ERR_NONE;
@@ -496,5 +822,26 @@ void xFlagsQuery(TFlags* pFlags, TFlags* pData, TError* pError)
     *pError = error;
 }
 
+
+#if (TCLC_IPC_WAITANY_ENABLE)
+/*************************************************************************************************
+ *  : ȴʱԽ¼                                                           *
+ *  : (1) pFlags   ¼ǵĵַ                                                            *
+ *        (2) pPattern Ҫյıǵ                                                      *
+ *        (3) option   ¼ǵĲ                                                        *
+ *        (4) pError   ϸý                                                              *
+ *  : (1) eSuccess ɹ                                                                  *
+ *        (2) eFailure ʧ                                                                  *
+ *  ˵ֻ߳ͬʱȴIPCʱ                                                    *
+ *************************************************************************************************/
+TState uFlagsTryReceive(TFlags* pFlags, TFlagMask* pPattern, TOption option, TError* pError)
+{
+    TState state;
+
+    state = TryReceiveFlags(pFlags, pPattern, option, pError);
+    return state;
+}
+#endif
+
 #endif
 
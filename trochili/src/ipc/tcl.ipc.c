@@ -5,8 +5,10 @@
  *************************************************************************************************/
 #include "tcl.types.h"
 #include "tcl.config.h"
+#include "tcl.cpu.h"
 #include "tcl.object.h"
 #include "tcl.debug.h"
+#include "tcl.trace.h"
 #include "tcl.kernel.h"
 #include "tcl.timer.h"
 #include "tcl.thread.h"
@@ -14,6 +16,80 @@
 
 #if (TCLC_IPC_ENABLE)
 
+#if (TCLC_IPC_PRIORITY_INDEX_ENABLE)
+/* ȼλͼжӦλȼԽλԽ */
+#define IPC_PRIORITY_BIT(p)  ((TBitMask)0x1 << (TCLC_LOWEST_PRIORITY - (p)))
+
+/*************************************************************************************************
+ *  ܣȼڵ뵽ȼֶ                                     *
+ *  (1) pHandle2 ֶָͷָָ                                                    *
+ *        (2) pIndex   ֶȼ                                                          *
+ *        (3) pNode    ڵָ                                                                  *
+ *  أ                                                                                     *
+ *  ˵½ڵͬȼڵ֮λͼв½ڵȼȼֶεβڵ½ڵ *
+ *        ǰҪ                                                                 *
+ *************************************************************************************************/
+static void AddPriorityNode(TObjNode** pHandle2, TIpcPriorityIndex* pIndex, TObjNode* pNode)
+{
+    TPriority priority;
+    TBitMask  mask;
+    TObjNode* pPrev;
+
+    KNL_ASSERT((pNode->Handle == (TObjNode**)0), "");
+
+    priority = (TPriority)(*(pNode->Data));
+    mask = pIndex->PriorityMask & (~(IPC_PRIORITY_BIT(priority) - 1U));
+    if (mask != (TBitMask)0)
+    {
+        pPrev = pIndex->Tail[TCLC_LOWEST_PRIORITY - CpuCalcHiPRIO(mask)];
+        pNode->Prev = pPrev;
+        pNode->Next = pPrev->Next;
+        pNode->Next->Prev = pNode;
+        pPrev->Next = pNode;
+        pNode->Handle = pHandle2;
+    }
+    else
+    {
+        /* ½ڵȼȶнڵ㶼(߶Ϊ)ΪµĶͷ */
+        uObjQueueAddFifoNode(pHandle2, pNode, eQuePosHead);
+    }
+
+    pIndex->Tail[priority] = pNode;
+    pIndex->PriorityMask |= IPC_PRIORITY_BIT(priority);
+}
+
+
+/*************************************************************************************************
+ *  ܣڵӰȼֶƳͬʱάȼ                             *
+ *  (1) pHandle2 ֶָͷָָ                                                    *
+ *        (2) pIndex   ֶȼ                                                          *
+ *        (3) pNode    ڵָ                                                                  *
+ *  أ                                                                                     *
+ *  ˵ڵȼֶʱͬ                                                   *
+ *************************************************************************************************/
+static void RemovePriorityNode(TObjNode** pHandle2, TIpcPriorityIndex* pIndex, TObjNode* pNode)
+{
+    TPriority priority;
+
+    priority = (TPriority)(*(pNode->Data));
+    if (pIndex->Tail[priority] == pNode)
+    {
+        /* ڵǱȼֶεβڵ㣬ǰͬȼǰΪµβڵ㣬ֶΪ */
+        if ((pNode != *pHandle2) && (*(pNode->Prev->Data) == priority))
+        {
+            pIndex->Tail[priority] = pNode->Prev;
+        }
+        else
+        {
+            pIndex->Tail[priority] = (TObjNode*)0;
+            pIndex->PriorityMask &= ~IPC_PRIORITY_BIT(priority);
+        }
+    }
+
+    uObjQueueRemoveNode(pHandle2, pNode);
+}
+#endif
+
 /*************************************************************************************************
  *  ܣ̼߳뵽ָIPC߳                                                    *
  *  (1) pQueue   IPCеַ                                                               *
@@ -30,7 +106,11 @@ static void EnterBlockedQueue(TIpcQueue* pQueue, TIpcContext* pContext)
     {
         if (property &IPC_PROP_PREEMP_AUXIQ)
         {
+#if (TCLC_IPC_PRIORITY_INDEX_ENABLE)
+            AddPriorityNode(&(pQueue->AuxiliaryHandle), &(pQueue->AuxiliaryIndex), &(pContext->ObjNode));
+#else
             uObjQueueAddPriorityNode(&(pQueue->AuxiliaryHandle), &(pContext->ObjNode));
+#endif
         }
         else
         {
@@ -42,7 +122,11 @@ static void EnterBlockedQueue(TIpcQueue* pQueue, TIpcContext* pContext)
     {
         if (property &IPC_PROP_PREEMP_PRIMIQ)
         {
+#if (TCLC_IPC_PRIORITY_INDEX_ENABLE)
+            AddPriorityNode(&(pQueue->PrimaryHandle), &(pQueue->PrimaryIndex), &(pContext->ObjNode));
+#else
             uObjQueueAddPriorityNode(&(pQueue->PrimaryHandle), &(pContext->ObjNode));
+#endif
         }
         else
         {
@@ -74,7 +158,17 @@ static void LeaveBlockedQueue(TIpcQueue* pQueue, TIpcContext* pContext)
     /* ̴ָ߳ķֶȡ */
     if ((pContext->Option) & IPC_OPT_USE_AUXIQ)
     {
-        uObjQueueRemoveNode(&(pQueue->AuxiliaryHandle), &(pContext->ObjNode));
+#if (TCLC_IPC_PRIORITY_INDEX_ENABLE)
+        if (property & IPC_PROP_PREEMP_AUXIQ)
+        {
+            RemovePriorityNode(&(pQueue->AuxiliaryHandle), &(pQueue->AuxiliaryIndex),
+                               &(pContext->ObjNode));
+        }
+        else
+#endif
+        {
+            uObjQueueRemoveNode(&(pQueue->AuxiliaryHandle), &(pContext->ObjNode));
+        }
         if (pQueue->AuxiliaryHandle == (TObjNode*)0)
         {
             property &= ~IPC_PROP_AUXIQ_AVAIL;
@@ -82,7 +176,17 @@ static void LeaveBlockedQueue(TIpcQueue* pQueue, TIpcContext* pContext)
     }
     else
     {
-        uObjQueueRemoveNode(&(pQueue->PrimaryHandle), &(pContext->ObjNode));
+#if (TCLC_IPC_PRIORITY_INDEX_ENABLE)
+        if (property & IPC_PROP_PREEMP_PRIMIQ)
+        {
+            RemovePriorityNode(&(pQueue->PrimaryHandle), &(pQueue->PrimaryIndex),
+                               &(pContext->ObjNode));
+        }
+        else
+#endif
+        {
+            uObjQueueRemoveNode(&(pQueue->PrimaryHandle), &(pContext->ObjNode));
+        }
         if (pQueue->PrimaryHandle == (TObjNode*)0)
         {
             property &= ~IPC_PROP_PRIMQ_AVAIL;
@@ -91,6 +195,14 @@ static void LeaveBlockedQueue(TIpcQueue* pQueue, TIpcContext* pContext)
 
     *(pQueue->Property) = property;
 
+    /* ̻߳¼ǵĵȴλУһƳ */
+#if ((TCLC_IPC_FLAGS_ENABLE) && (TCLC_IPC_FLAGS_INDEX_ENABLE))
+    if (pContext->FlagsNode.Handle != (TObjNode**)0)
+    {
+        uObjQueueRemoveNode(pContext->FlagsNode.Handle, &(pContext->FlagsNode));
+    }
+#endif
+
     /* ߳ */
     pContext->Queue = (TIpcQueue*)0;
 }
@@ -122,6 +234,7 @@ void uIpcBlockThread(TIpcContext* pContext, TIpcQueue* pQueue, TTimeTick ticks)
     uThreadLeaveQueue(uKernelVariable.ThreadReadyQueue, pThread);
     uThreadEnterQueue(uKernelVariable.ThreadAuxiliaryQueue, pThread, eQuePosTail);
     pThread->Status = eThreadBlocked;
+    KNL_TRACE(TRACE_EVENT_BLOCK, pThread->ThreadID, 0U, pQueue);
 
     /* ̷߳ */
     EnterBlockedQueue(pQueue, pContext);
@@ -140,6 +253,57 @@ void uIpcBlockThread(TIpcContext* pContext, TIpcQueue* pQueue, TTimeTick ticks)
 }
 
 
+#if (TCLC_IPC_WAITANY_ENABLE)
+/*************************************************************************************************
+ *  ܣ߳ͬʱԴ                                                         *
+ *  (1) pContext ߳ԴIPCģͨSiblingԱIPC               *
+ *        (2) ticks    Դȴʱ                                                              *
+ *  أ                                                                                     *
+ *  ˵ÿIPCڵǰѾú(QueueԱ)                         *
+ *        ߳ԴĲκУֻڳʱǿƽ                           *
+ *************************************************************************************************/
+void uIpcBlockThreadAny(TIpcContext* pContext, TTimeTick ticks)
+{
+    TThread* pThread;
+    TIpcContext* pCursor;
+
+    KNL_ASSERT((uKernelVariable.State != eIntrState), "");
+
+    /* ̷߳ں̸߳ */
+    pThread = (TThread*)(pContext->Owner);
+
+    /* ֻдھ״̬̲߳ſԱ */
+    if (pThread->Status != eThreadRunning)
+    {
+        uDebugPanic("", __FILE__, __FUNCTION__, __LINE__);
+    }
+
+    uThreadLeaveQueue(uKernelVariable.ThreadReadyQueue, pThread);
+    uThreadEnterQueue(uKernelVariable.ThreadAuxiliaryQueue, pThread, eQuePosTail);
+    pThread->Status = eThreadBlocked;
+    KNL_TRACE(TRACE_EVENT_BLOCK, pThread->ThreadID, 0U, pContext->Sibling->Queue);
+
+    /* ̷߳ÿIPC */
+    for (pCursor = pContext->Sibling; pCursor != (TIpcContext*)0; pCursor = pCursor->Sibling)
+    {
+        EnterBlockedQueue(pCursor->Queue, pCursor);
+    }
+
+    /* ҪͳʼҴ߳ڷԴʱ޶ʱ */
+#if (TCLC_TIMER_ENABLE && TCLC_IPC_TIMER_ENABLE)
+    if ((pContext->Option & IPC_OPT_TIMED) && (ticks > 0U))
+    {
+        /* ò̶߳ʱ */
+        uTimerConfig(&(pThread->Timer), eIpcTimer, ticks);
+        uTimerStart(&(pThread->Timer), 0U);
+    }
+#else
+    ticks = ticks;
+#endif
+}
+#endif
+
+
 /*************************************************************************************************
  *  ܣIPCָ߳                                                            *
  *  (1) pThread ̵ַ߳                                                                   *
@@ -152,6 +316,9 @@ void uIpcBlockThread(TIpcContext* pContext, TIpcQueue* pQueue, TTimeTick ticks)
 void uIpcUnblockThread(TIpcContext* pContext, TState state, TError error, TBool* pHiRP)
 {
     TThread* pThread;
+#if (TCLC_IPC_WAITANY_ENABLE)
+    TIpcContext* pCursor;
+#endif
 
     /* ̴߳IPCԴƳ뵽ں߳̾,
     ǰ̸߳ոձУδ߳л
@@ -181,9 +348,24 @@ void uIpcUnblockThread(TIpcContext* pContext, TState state, TError error, TBool*
        ߳ٴνʱҪ̵ָ߳ʱӽ¼ʱ */
     pThread->Ticks  = pThread->BaseTicks;
     pThread->Status = eThreadReady;
+    KNL_TRACE(TRACE_EVENT_UNBLOCK, pThread->ThreadID, error, pContext->Queue);
 
-    /* ̴߳Ƴ */
-    LeaveBlockedQueue(pContext->Queue, pContext);
+    /* ̴߳ƳͬʱȴIPC߳ҪȫƳ
+       pContextĳIPCģҲ߳Դ(ʱ߱ǿƽ) */
+#if (TCLC_IPC_WAITANY_ENABLE)
+    if (pContext->Option & IPC_OPT_WAITANY)
+    {
+        for (pCursor = pThread->IpcContext.Sibling; pCursor != (TIpcContext*)0;
+                pCursor = pCursor->Sibling)
+        {
+            LeaveBlockedQueue(pCursor->Queue, pCursor);
+        }
+    }
+    else
+#endif
+    {
+        LeaveBlockedQueue(pContext->Queue, pContext);
+    }
 
     /* ̷߳ԴĽʹ */
     *(pContext->State) = state;
@@ -208,6 +390,45 @@ void uIpcUnblockThread(TIpcContext* pContext, TState state, TError error, TBool*
 }
 
 
+/*************************************************************************************************
+ *  ܣֱ߳תƵһIPC                                          *
+ *  (1) pContext ̵߳IPC                                                           *
+ *        (2) pIpc     µIPCַ                                                           *
+ *        (3) pQueue   µ߳еַ                                                      *
+ *        (4) option   µʹõĲ                                            *
+ *  أ                                                                                     *
+ *  ˵̱߳״̬УҲͲᷢ߳л                         *
+ *        ߳ԭĵȴʱϣµõȴ                                       *
+ *************************************************************************************************/
+void uIpcMoveThread(TIpcContext* pContext, void* pIpc, TIpcQueue* pQueue, TOption option)
+{
+    TThread* pThread;
+
+    pThread = (TThread*)(pContext->Owner);
+
+    /* ֻд״̬̲߳ſԱת */
+    if (pThread->Status != eThreadBlocked)
+    {
+        uDebugPanic("", __FILE__, __FUNCTION__, __LINE__);
+    }
+
+    /* ȡ̵߳ʱ޶ʱ */
+#if ((TCLC_IPC_TIMER_ENABLE) && (TCLC_TIMER_ENABLE))
+    if (pContext->Option & IPC_OPT_TIMED)
+    {
+        KNL_ASSERT((pThread->Timer.Type == eIpcTimer), "");
+        uTimerStop(&(pThread->Timer));
+    }
+#endif
+
+    LeaveBlockedQueue(pContext->Queue, pContext);
+
+    pContext->Object = pIpc;
+    pContext->Option = option & (~IPC_OPT_TIMED);
+    EnterBlockedQueue(pQueue, pContext);
+}
+
+
 /*************************************************************************************************
  *  ܣѡеȫ߳                                                           *
  *  (1) pQueue  ̶߳нṹַ                                                           *
@@ -248,44 +469,111 @@ void uIpcUnblockAll(TIpcQueue* pQueue, TState state, TError error, void** pData2
 }
 
 
+/*************************************************************************************************
+ *  ܣĽڵȼֶƳ߷Ż                                           *
+ *  (1) pContext ߳IPCĽṹַ                                                     *
+ *        (2) enter    eTrueʾŻطֶУeFalseʾƳֶ                                 *
+ *  أ                                                                                     *
+ *  ˵ڵķֶȳ򲻱ش                                         *
+ *************************************************************************************************/
+static void ResortContext(TIpcContext* pContext, TBool enter)
+{
+    TProperty property;
+    TIpcQueue* pQueue;
+    TObjNode** pHandle2;
+    TBool preemptive;
+#if (TCLC_IPC_PRIORITY_INDEX_ENABLE)
+    TIpcPriorityIndex* pIndex;
+#endif
+
+    pQueue = pContext->Queue;
+    property = *(pQueue->Property);
+    if (pContext->Option & IPC_OPT_USE_AUXIQ)
+    {
+        pHandle2 = &(pQueue->AuxiliaryHandle);
+        preemptive = (property & IPC_PROP_PREEMP_AUXIQ) ? eTrue : eFalse;
+#if (TCLC_IPC_PRIORITY_INDEX_ENABLE)
+        pIndex = &(pQueue->AuxiliaryIndex);
+#endif
+    }
+    else
+    {
+        pHandle2 = &(pQueue->PrimaryHandle);
+        preemptive = (property & IPC_PROP_PREEMP_PRIMIQ) ? eTrue : eFalse;
+#if (TCLC_IPC_PRIORITY_INDEX_ENABLE)
+        pIndex = &(pQueue->PrimaryIndex);
+#endif
+    }
+
+    if (preemptive == eTrue)
+    {
+        if (enter == eTrue)
+        {
+#if (TCLC_IPC_PRIORITY_INDEX_ENABLE)
+            AddPriorityNode(pHandle2, pIndex, &(pContext->ObjNode));
+#else
+            uObjQueueAddPriorityNode(pHandle2, &(pContext->ObjNode));
+#endif
+        }
+        else
+        {
+#if (TCLC_IPC_PRIORITY_INDEX_ENABLE)
+            RemovePriorityNode(pHandle2, pIndex, &(pContext->ObjNode));
+#else
+            uObjQueueRemoveNode(pHandle2, &(pContext->ObjNode));
+#endif
+        }
+    }
+}
+
+
 /*************************************************************************************************
  *  ܣı䴦IPCе̵߳ȼ                                                    *
  *  (1) pThread  ߳̽ṹַ                                                              *
  *        (2) priority Դȴʱ                                                              *
  *  أ                                                                                     *
- *  ˵߳вȼԣ̴߳ƳȻ޸ȼ,*
- *        ٷŻԭСȳ򲻱ش                                       *
+ *  ˵߳вȼԣ̴߳ƳȻ޸       *
+ *        ȼٷŻԭСȳ򲻱ش                               *
+ *        ͬʱȴIPC߳Ҫÿеλ                              *
  *************************************************************************************************/
 void uIpcSetPriority(TIpcContext* pContext, TPriority priority)
 {
-    TProperty property;
-    TIpcQueue* pQueue;
     TThread* pThread;
+#if (TCLC_IPC_WAITANY_ENABLE)
+    TIpcContext* pCursor;
+#endif
 
-    pQueue = pContext->Queue;
     pThread = (TThread*)(pContext->Owner);
 
-    /* Ϊ߳Ϊ״̬Կֱں̸߳޸̵߳ȼ */
-    pThread->Priority = priority;
+    /* ߳ͬʱں̸߳УҲǰȼֶеģ
+       ̱߳밴ԭȼƳУ޸ȼ֮ٷŻ */
+    uThreadLeaveQueue(uKernelVariable.ThreadAuxiliaryQueue, pThread);
 
-    /* ʵ°߳IPCλ */
-    property = *(pContext->Queue->Property);
-    if (pContext->Option & IPC_OPT_USE_AUXIQ)
+#if (TCLC_IPC_WAITANY_ENABLE)
+    if (pContext->Option & IPC_OPT_WAITANY)
     {
-        if (property & IPC_PROP_PREEMP_AUXIQ)
+        for (pCursor = pContext->Sibling; pCursor != (TIpcContext*)0; pCursor = pCursor->Sibling)
         {
-            uObjQueueRemoveNode(&(pQueue->AuxiliaryHandle), &(pContext->ObjNode));
-            uObjQueueAddPriorityNode(&(pQueue->AuxiliaryHandle), &(pContext->ObjNode));
+            ResortContext(pCursor, eFalse);
+        }
+
+        pThread->Priority = priority;
+
+        for (pCursor = pContext->Sibling; pCursor != (TIpcContext*)0; pCursor = pCursor->Sibling)
+        {
+            ResortContext(pCursor, eTrue);
         }
     }
     else
+#endif
     {
-        if (property & IPC_PROP_PREEMP_PRIMIQ)
-        {
-            uObjQueueRemoveNode(&(pQueue->PrimaryHandle), &(pContext->ObjNode));
-            uObjQueueAddPriorityNode(&(pQueue->PrimaryHandle), &(pContext->ObjNode));
-        }
+        /* ʵ°߳IPCλãȳ򲻱ش */
+        ResortContext(pContext, eFalse);
+        pThread->Priority = priority;
+        ResortContext(pContext, eTrue);
     }
+
+    uThreadEnterQueue(uKernelVariable.ThreadAuxiliaryQueue, pThread, eQuePosTail);
 }
 
 
@@ -293,20 +581,20 @@ void uIpcSetPriority(TIpcContext* pContext, TPriority priority)
  *  ܣ趨̵߳IPCϢ                                                            *
  *  (1) pThread ߳̽ṹַ                                                               *
  *        (2) pIpc    ڲIPCĵַ                                                    *
- *        (3) data    ָĿָָ                                                 *
+ *        (3) pData   ָĿָָ                                                 *
  *        (4) len     ݵĳ                                                                 *
  *        (5) option  IPCʱĸֲ                                                    *
  *        (6) state   IPCʽ                                                            *
  *        (7) pError  ϸý                                                               *
  *  أ                                                                                     *
- *  ˵dataָָ룬ҪͨIPCݵ߳̿ռָ                        *
+ *  ˵pDataָָ룬ҪͨIPCݵ߳̿ռָ                       *
  *************************************************************************************************/
-void uIpcSaveContext(TIpcContext* pContext, void* pIpc, TBase32 data, TBase32 len,
+void uIpcSaveContext(TIpcContext* pContext, void* pIpc, void* pData, TBase32 len,
                      TOption option, TState* pState, TError* pError)
 {
     pContext->Object     = pIpc;
     pContext->Queue      = (TIpcQueue*)0;
-    pContext->Data.Value = data;
+    pContext->Data.Addr1 = pData;
     pContext->Length     = len;
     pContext->Option     = option;
     pContext->State      = pState;
@@ -326,11 +614,43 @@ void uIpcCleanContext(TIpcContext* pContext)
 {
     pContext->Object     = (void*)0;
     pContext->Queue      = (TIpcQueue*)0;
-    pContext->Data.Value = 0U;
+    pContext->Data.Addr1 = (void*)0;
     pContext->Length     = 0U;
     pContext->Option     = IPC_OPTION;
     pContext->State      = (TState*)0;
     pContext->Error      = (TError*)0;
+#if (TCLC_IPC_WAITANY_ENABLE)
+    pContext->Sibling    = (TIpcContext*)0;
+#endif
+}
+
+
+/*************************************************************************************************
+ *  ܣʼIPC߳                                                                  *
+ *  (1) pQueue    IPC߳нṹַ                                                  *
+ *        (2) pProperty IPCԵַ                                                          *
+ *  أ                                                                                     *
+ *  ˵                                                                                       *
+ *************************************************************************************************/
+void uIpcInitQueue(TIpcQueue* pQueue, TProperty* pProperty)
+{
+#if (TCLC_IPC_PRIORITY_INDEX_ENABLE)
+    TBase32 i;
+#endif
+
+    pQueue->Property        = pProperty;
+    pQueue->PrimaryHandle   = (TObjNode*)0;
+    pQueue->AuxiliaryHandle = (TObjNode*)0;
+
+#if (TCLC_IPC_PRIORITY_INDEX_ENABLE)
+    pQueue->PrimaryIndex.PriorityMask   = (TBitMask)0;
+    pQueue->AuxiliaryIndex.PriorityMask = (TBitMask)0;
+    for (i = 0U; i < TCLC_PRIORITY_NUM; i++)
+    {
+        pQueue->PrimaryIndex.Tail[i]   = (TObjNode*)0;
+        pQueue->AuxiliaryIndex.Tail[i] = (TObjNode*)0;
+    }
+#endif
 }
 
 
@@ -349,7 +669,7 @@ void uIpcInitContext(TIpcContext* pContext, void* pOwner)
     pContext->Owner      = pOwner;
     pContext->Object     = (void*)0;
     pContext->Queue      = (TIpcQueue*)0;
-    pContext->Data.Value = 0U;
+    pContext->Data.Addr1 = (void*)0;
     pContext->Length     = 0U;
     pContext->Option     = IPC_OPTION;
     pContext->State      = (TState*)0;
@@ -360,6 +680,16 @@ void uIpcInitContext(TIpcContext* pContext, void* pOwner)
     pContext->ObjNode.Handle = (TObjNode**)0;
     pContext->ObjNode.Data   = (TBase32*)(&(pThread->Priority));
     pContext->ObjNode.Owner  = (void*)pContext;
+#if (TCLC_IPC_WAITANY_ENABLE)
+    pContext->Sibling        = (TIpcContext*)0;
+#endif
+#if ((TCLC_IPC_FLAGS_ENABLE) && (TCLC_IPC_FLAGS_INDEX_ENABLE))
+    pContext->FlagsNode.Next   = (TObjNode*)0;
+    pContext->FlagsNode.Prev   = (TObjNode*)0;
+    pContext->FlagsNode.Handle = (TObjNode**)0;
+    pContext->FlagsNode.Data   = (TBase32*)(&(pThread->Priority));
+    pContext->FlagsNode.Owner  = (void*)pContext;
+#endif
 }
 
 #endif
@@ -95,7 +95,7 @@ static TState TryReceiveMail(TMailBox* pMailbox, void** pMail2, TBool* pHiRP, TE
  *        (4) pError   ϸý                                                              *
  *  : (1) eFailure ʧ                                                                  *
  *        (2) eSuccess ɹ                                                                  *
- *  ˵                                                                                       *
+ *  ˵ǲԵʱʼ滻ʼȡǵõµʼ                         *
  *************************************************************************************************/
 static TState TrySendMail(TMailBox* pMailbox, void** pMail2, TBool* pHiRP, TError* pError)
 {
@@ -130,6 +130,14 @@ static TState TrySendMail(TMailBox* pMailbox, void** pMail2, TBool* pHiRP, TErro
         state = eSuccess;
 
     }
+    /* ǲԵֻµʼʼǳɹԷ߳Ҳ */
+    else if (pMailbox->Property & IPC_PROP_OVERWRITE)
+    {
+        pMailbox->Mail = *pMail2;
+
+        *pError = IPC_ERR_NONE;
+        state = eSuccess;
+    }
     else
     {
         /* Ѿʼˣٷʼ */
@@ -194,7 +202,7 @@ static TState ReceiveMail(TMailBox* pMailbox, TMail* pMail2, TOption option, TTi
                 pContext = &(uKernelVariable.CurrentThread->IpcContext);
 
                 /* ̹߳Ϣ */
-                uIpcSaveContext(pContext, (void*)pMailbox, (TBase32)pMail2, sizeof(TBase32),
+                uIpcSaveContext(pContext, (void*)pMailbox, (void*)pMail2, sizeof(TBase32),
                                 option | IPC_OPT_MAILBOX | IPC_OPT_READ_DATA,
                                 &state, pError);
 
@@ -279,7 +287,7 @@ static TState SendMail(TMailBox* pMailbox, TMail* pMail2, TOption option, TTimeT
                 pContext = &(uKernelVariable.CurrentThread->IpcContext);
 
                 /* ̹߳Ϣ */
-                uIpcSaveContext(pContext, (void*)pMailbox, (TBase32)pMail2, sizeof(TBase32),
+                uIpcSaveContext(pContext, (void*)pMailbox, (void*)pMail2, sizeof(TBase32),
                                 option | IPC_OPT_MAILBOX | IPC_OPT_WRITE_DATA, &state, pError);
 
                 /* ǰ߳ڸ */
@@ -536,9 +544,7 @@ TState xMailBoxCreate(TMailBox* pMailbox, TProperty property, TError* pError)
         pMailbox->Status = eMailBoxEmpty;
         pMailbox->Mail = (void*)0;
 
-        pMailbox->Queue.PrimaryHandle   = (TObjNode*)0;
-        pMailbox->Queue.AuxiliaryHandle = (TObjNode*)0;
-        pMailbox->Queue.Property        = &(pMailbox->Property);
+        uIpcInitQueue(&(pMailbox->Queue), &(pMailbox->Property));
 
         error = IPC_ERR_NONE;
         state = eSuccess;
@@ -590,5 +596,25 @@ TState xMailBoxDelete(TMailBox* pMailbox, TError* pError)
 }
 
 
+#if (TCLC_IPC_WAITANY_ENABLE)
+/*************************************************************************************************
+ *  : ȴʱԶȡеʼ                                                       *
+ *  : (1) pMailbox ṹַ                                                              *
+ *        (2) pMail2   ʼṹַָ                                                *
+ *        (3) pHiRP    Ƿںлѹ߳                                                *
+ *        (4) pError   ϸý                                                              *
+ *  : (1) eSuccess ɹ                                                                  *
+ *        (2) eFailure ʧ                                                                  *
+ *  ˵ֻ߳ͬʱȴIPCʱ                                                    *
+ *************************************************************************************************/
+TState uMailBoxTryReceive(TMailBox* pMailbox, TMail* pMail2, TBool* pHiRP, TError* pError)
+{
+    TState state;
+
+    state = TryReceiveMail(pMailbox, (void**)pMail2, pHiRP, pError);
+    return state;
+}
+#endif
+
 #endif
 
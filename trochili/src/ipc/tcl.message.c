@@ -16,27 +16,150 @@
 
 #if ((TCLC_IPC_ENABLE)&&(TCLC_IPC_MQUE_ENABLE))
 
-static void SaveMessage(TMsgQueue* pMsgQue, void** pMsg2, TMsgType type);
+static void ClearMessages(TMsgQueue* pMsgQue);
+static void SaveMessage(TMsgQueue* pMsgQue, void** pMsg2, TOption option);
 static void ConsumeMessage(TMsgQueue* pMsgQue, void** pMsg2);
 static TState TryReceiveMessage(TMsgQueue* pMsgQue, void** pMsg2, TBool* pHiRP, TError* pError);
 static TState ReceiveMessage(TMsgQueue* pMsgQue, TMessage* pMsg2, TOption option, TTimeTick timeo,
                              TReg32* pIMask, TError* pError);
-static TState TrySendMessage(TMsgQueue* pMsgQue, void** pMsg2, TMsgType type, TBool* pHiRP,
+static TState TrySendMessage(TMsgQueue* pMsgQue, void** pMsg2, TOption option, TBool* pHiRP,
                              TError* pError);
 static TState SendMessage(TMsgQueue* pMsgQue, TMessage* pMsg2, TOption option, TTimeTick
                           timeo, TReg32* pIMask, TError* pError);
 
+/*************************************************************************************************
+ *  ܣϢеϢ                                                                   *
+ *  (1) pMsgQue Ϣнṹָ                                                           *
+ *  أ                                                                                     *
+ *  ˵                                                                                       *
+ *************************************************************************************************/
+static void ClearMessages(TMsgQueue* pMsgQue)
+{
+#if (TCLC_IPC_MQUE_LEVELS > 1U)
+    TIndex level;
+
+    pMsgQue->LevelMask = 0U;
+    for (level = 0U; level < TCLC_IPC_MQUE_LEVELS; level++)
+    {
+        pMsgQue->LevelHead[level] = 0U;
+        pMsgQue->LevelTail[level] = 0U;
+        pMsgQue->LevelEntries[level] = 0U;
+    }
+#else
+    pMsgQue->Head = 0U;
+    pMsgQue->Tail = 0U;
+#endif
+    pMsgQue->MsgEntries = 0U;
+    pMsgQue->Status = eMQEmpty;
+}
+
+
+#if (TCLC_IPC_MQUE_LEVELS > 1U)
 /*************************************************************************************************
  *  ܣϢ浽Ϣ                                                                   *
  *  (1) pMsgQue Ϣнṹָ                                                           *
  *        (2) pMsg2   Ϣṹַָ                                                 *
- *        (3) type    ϢͣϢͨϢ                                           *
+ *        (3) option  ϢѡϢȼͽ                                   *
+ *  أ                                                                                     *
+ *  ˵(1) ÿȼԼĻζУռϢCapacityԪͨϢȼ   *
+ *            еĶͷϢȼеĶβȱȡ                           *
+ *        (2) ÷Χȼȼ                                               *
+ *        (3) ܴϢ״̬                                                       *
+ *************************************************************************************************/
+static void SaveMessage(TMsgQueue* pMsgQue, void** pMsg2, TOption option)
+{
+    TIndex level;
+    void** pPool;
+
+    if (option & IPC_OPT_UARGENT)
+    {
+        level = 0U;
+        pPool = pMsgQue->MsgPool;
+        if (pMsgQue->LevelTail[0] == 0U)
+        {
+            pMsgQue->LevelTail[0] = pMsgQue->Capacity - 1U;
+        }
+        else
+        {
+            pMsgQue->LevelTail[0]--;
+        }
+        *(pPool + pMsgQue->LevelTail[0]) = *pMsg2;
+    }
+    else
+    {
+        level = (TIndex)((option & IPC_OPT_LEVEL_MASK) >> IPC_OPT_LEVEL_SHIFT);
+        if (level >= TCLC_IPC_MQUE_LEVELS)
+        {
+            level = TCLC_IPC_MQUE_LEVELS - 1U;
+        }
+
+        pPool = pMsgQue->MsgPool + level * pMsgQue->Capacity;
+        *(pPool + pMsgQue->LevelHead[level]) = *pMsg2;
+        pMsgQue->LevelHead[level]++;
+        if (pMsgQue->LevelHead[level] == pMsgQue->Capacity)
+        {
+            pMsgQue->LevelHead[level] = 0U;
+        }
+    }
+
+    /* ϢϢĿͷǿȼλͼ */
+    pMsgQue->LevelEntries[level]++;
+    pMsgQue->LevelMask |= (TBitMask)(0x1U << level);
+    pMsgQue->MsgEntries++;
+}
+
+
+/*************************************************************************************************
+ *  ܣϢϢж                                                                 *
+ *  (1) pMsgQue Ϣнṹָ                                                           *
+ *        (2) pMsg2   Ϣṹַָ                                                 *
+ *  أ                                                                                     *
+ *  ˵(1) ͨǿȼλͼҵߵķǿȼӸȼеĶβȡ                   *
+ *        (2) ܴϢ״̬                                                       *
+ *************************************************************************************************/
+static void ConsumeMessage(TMsgQueue* pMsgQue, void** pMsg2)
+{
+    TIndex level;
+    void** pPool;
+
+    level = CpuCalcHiPRIO(pMsgQue->LevelMask);
+    pPool = pMsgQue->MsgPool + level * pMsgQue->Capacity;
+
+    /* ϢжȡһϢǰ߳ */
+    *pMsg2 = *(pPool + pMsgQue->LevelTail[level]);
+
+    /* ϢϢĿ */
+    pMsgQue->MsgEntries--;
+    pMsgQue->LevelEntries[level]--;
+    if (pMsgQue->LevelEntries[level] == 0U)
+    {
+        pMsgQue->LevelMask &= ~((TBitMask)(0x1U << level));
+    }
+
+    /* ϢеϢдα */
+    pMsgQue->LevelTail[level]++;
+    if (pMsgQue->LevelTail[level] == pMsgQue->Capacity)
+    {
+        pMsgQue->LevelTail[level] = 0U;
+    }
+}
+
+#else
+/*************************************************************************************************
+ *  ܣϢ浽Ϣ                                                                   *
+ *  (1) pMsgQue Ϣнṹָ                                                           *
+ *        (2) pMsg2   Ϣṹַָ                                                 *
+ *        (3) option  Ϣѡ                                               *
  *  أ                                                                                     *
  *  ˵(1) ϢͲͬϢ浽Ϣжͷ߶β                                 *
  *        (2) ܴϢ״̬                                                       *
  *************************************************************************************************/
-static void SaveMessage(TMsgQueue* pMsgQue, void** pMsg2, TMsgType type)
+static void SaveMessage(TMsgQueue* pMsgQue, void** pMsg2, TOption option)
 {
+    TMsgType type;
+
+    type = (option & IPC_OPT_UARGENT) ? eUrgentMessage : eNormalMessage;
+
     /* ͨϢֱӷ͵Ϣͷ */
     if (type == eNormalMessage)
     {
@@ -89,6 +212,7 @@ static void ConsumeMessage(TMsgQueue* pMsgQue, void** pMsg2)
         pMsgQue->Tail = 0U;
     }
 }
+#endif
 
 
 /*************************************************************************************************
@@ -110,7 +234,6 @@ static void ConsumeMessage(TMsgQueue* pMsgQue, void** pMsg2)
  */
 static TState TryReceiveMessage(TMsgQueue* pMsgQue, void** pMsg2, TBool* pHiRP, TError* pError)
 {
-    TMsgType type;
     TState state;
     TIpcContext* pContext = (TIpcContext*)0;
 
@@ -145,15 +268,12 @@ static TState TryReceiveMessage(TMsgQueue* pMsgQue, void** pMsg2, TBool* pHiRP,
         {
             uIpcUnblockThread(pContext, eSuccess, IPC_ERR_NONE, pHiRP);
 
-            /* ߳ķֶжϢ */
-            type = ((pContext->Option) & IPC_OPT_UARGENT) ? eUrgentMessage : eNormalMessage;
-
-            /* ҽ̷߳͵ϢдϢ */
-            SaveMessage(pMsgQue, pContext->Data.Addr2, type);
+            /* ҽ̷߳͵ϢķѡдϢ */
+            SaveMessage(pMsgQue, pContext->Data.Addr2, pContext->Option);
         }
         else
         {
-            pMsgQue->Status = (pMsgQue->Tail == pMsgQue->Head) ? eMQEmpty : eMQPartial;
+            pMsgQue->Status = (pMsgQue->MsgEntries == 0U) ? eMQEmpty : eMQPartial;
         }
 
         /* ̳߳ɹȡϢб */
@@ -165,7 +285,7 @@ static TState TryReceiveMessage(TMsgQueue* pMsgQue, void** pMsg2, TBool* pHiRP,
     {
         /* ϢжȡһϢǰ߳ */
         ConsumeMessage(pMsgQue, pMsg2);
-        pMsgQue->Status = (pMsgQue->Tail == pMsgQue->Head) ? eMQEmpty : eMQPartial;
+        pMsgQue->Status = (pMsgQue->MsgEntries == 0U) ? eMQEmpty : eMQPartial;
 
         *pError = IPC_ERR_NONE;
         state = eSuccess;
@@ -179,14 +299,14 @@ static TState TryReceiveMessage(TMsgQueue* pMsgQue, void** pMsg2, TBool* pHiRP,
  *  ܣ߳/ISRϢзϢ                                                       *
  *  (1) pMsgQue Ϣеĵַ                                                             *
  *        (2) pMsg2   Ϣṹַָ                                                 *
- *        (3) type    Ϣ                                                                   *
+ *        (3) option  Ϣѡ                                                             *
  *        (4) pHiRP   ǷҪ̵߳ȱ                                                       *
  *        (5) pError  ϸý                                                               *
  *  : (1) eFailure   ʧ                                                                *
  *        (2) eSuccess   ɹ                                                                *
  *  ˵                                                                                       *
  *************************************************************************************************/
-static TState TrySendMessage(TMsgQueue* pMsgQue, void** pMsg2, TMsgType type, TBool* pHiRP,
+static TState TrySendMessage(TMsgQueue* pMsgQue, void** pMsg2, TOption option, TBool* pHiRP,
                              TError* pError)
 {
     TState state;
@@ -218,8 +338,8 @@ static TState TrySendMessage(TMsgQueue* pMsgQue, void** pMsg2, TMsgType type, TB
         else
         {
             /* ̷߳͵ϢдϢ */
-            SaveMessage(pMsgQue, pMsg2, type);
-            pMsgQue->Status = (pMsgQue->Tail == pMsgQue->Head) ? eMQFull : eMQPartial;
+            SaveMessage(pMsgQue, pMsg2, option);
+            pMsgQue->Status = (pMsgQue->MsgEntries == pMsgQue->Capacity) ? eMQFull : eMQPartial;
         }
 
         *pError = IPC_ERR_NONE;
@@ -229,13 +349,13 @@ static TState TrySendMessage(TMsgQueue* pMsgQue, void** pMsg2, TMsgType type, TB
         /* if (mq->Status == eMQPartial) */
     {
         /* ̷߳͵ϢдϢ */
-        SaveMessage(pMsgQue, pMsg2, type);
+        SaveMessage(pMsgQue, pMsg2, option);
 
         /* ϢпյϢе1ô״̬ӿֱӵ eMQFull
            Ϣн eMQPartial ״̬ */
         /* ϢͨϢдܵϢн eMQFull
            ״̬߱ eMQPartial ״̬ */
-        pMsgQue->Status = (pMsgQue->Tail == pMsgQue->Head) ? eMQFull : eMQPartial;
+        pMsgQue->Status = (pMsgQue->MsgEntries == pMsgQue->Capacity) ? eMQFull : eMQPartial;
 
         *pError = IPC_ERR_NONE;
         state = eSuccess;
@@ -294,7 +414,7 @@ static TState ReceiveMessage(TMsgQueue* pMsgQue, TMessage* pMsg2, TOption option
 
                 /* ̹߳Ϣ */
                 option |= IPC_OPT_MSGQUEUE | IPC_OPT_READ_DATA;
-                uIpcSaveContext(pContext, (void*)pMsgQue, (TBase32)pMsg2, sizeof(TBase32), option, &state, pError);
+                uIpcSaveContext(pContext, (void*)pMsgQue, (void*)pMsg2, sizeof(TBase32), option, &state, pError);
 
                 /* ǰ߳ڸϢе,ȡ߳̽PrimaryQueue */
                 uIpcBlockThread(pContext, &(pMsgQue->Queue), timeo);
@@ -334,11 +454,9 @@ static TState SendMessage(TMsgQueue* pMsgQue, TMessage* pMsg2, TOption option, T
 {
     TBool HiRP = eFalse;
     TState state;
-    TMsgType type;
     TIpcContext* pContext;
 
-    type = (option & IPC_OPT_UARGENT) ? eUrgentMessage : eNormalMessage;
-    state = TrySendMessage(pMsgQue, (void**)pMsg2, type, &HiRP, pError);
+    state = TrySendMessage(pMsgQue, (void**)pMsg2, option, &HiRP, pError);
 
     /* ǰܷ߳Ϣ,ֱӴӺ;
        ǰ̲ܷ߳Ϣǲõ̷طҲֱӷأ
@@ -373,7 +491,7 @@ static TState SendMessage(TMsgQueue* pMsgQue, TMessage* pMsg2, TOption option, T
 
                 /* ̹߳Ϣ */
                 option |= IPC_OPT_MSGQUEUE | IPC_OPT_WRITE_DATA;
-                uIpcSaveContext(pContext, (void*)pMsgQue, (TBase32)pMsg2,  sizeof(TBase32), option, &state, pError);
+                uIpcSaveContext(pContext, (void*)pMsgQue, (void*)pMsg2,  sizeof(TBase32), option, &state, pError);
 
                 /* ǰ߳ڸϢе */
                 uIpcBlockThread(pContext, &(pMsgQue->Queue), timeo);
@@ -459,7 +577,6 @@ TState xMQSend(TMsgQueue* pMsgQue, TMessage* pMsg2, TOption option, TTimeTick ti
     TState state = eFailure;
     TError error = IPC_ERR_UNREADY;
     TBool HiRP = eFalse;
-    TMsgType type;
     TReg32 imask;
 
     CpuEnterCritical(&imask);
@@ -472,8 +589,7 @@ TState xMQSend(TMsgQueue* pMsgQue, TMessage* pMsg2, TOption option, TTimeTick ti
             /* жisrУǰ߳δ߾ȼ̣߳Ҳδشں˾̶߳С
             isrеTrySendMessage()õHiRPκ塣*/
             KNL_ASSERT((uKernelVariable.State == eIntrState),"");
-            type = (option & IPC_OPT_UARGENT) ? eUrgentMessage : eNormalMessage;
-            state = TrySendMessage(pMsgQue, (void**)pMsg2, type, &HiRP, &error);
+            state = TrySendMessage(pMsgQue, (void**)pMsg2, option, &HiRP, &error);
         }
         else
         {
@@ -488,6 +604,153 @@ TState xMQSend(TMsgQueue* pMsgQue, TMessage* pMsg2, TOption option, TTimeTick ti
 }
 
 
+/*************************************************************************************************
+ *  : ߳/ISRһδϢнնϢ                                               *
+ *  : (1) pMsgQue  Ϣнṹַ                                                          *
+ *        (2) pMsgs    Ϣ                                                            *
+ *        (3) max      յϢĿ                                                        *
+ *        (4) pGot     ʵʽյϢĿ                                                        *
+ *        (5) option   Ϣеģʽ                                                        *
+ *        (6) timeo    ʱģʽ·Ϣеʱ޳                                      *
+ *        (7) pError   ϸý                                                              *
+ *  : (1) eFailure ʧ                                                                  *
+ *        (2) eSuccess ɹٽյһϢ                                              *
+ *  ˵ͬһٽϢѵķ߳ͳһһεȡ                 *
+ *        ϢΪʱֻΪһϢѺٽնеϢ                   *
+ *************************************************************************************************/
+TState xMQReceiveBatch(TMsgQueue* pMsgQue, TMessage* pMsgs, TBase32 max, TBase32* pGot,
+                       TOption option, TTimeTick timeo, TError* pError)
+{
+    TState state = eFailure;
+    TError error = IPC_ERR_UNREADY;
+    TBase32 count = 0U;
+    TBool  HiRP = eFalse;
+    TReg32 imask;
+
+    CpuEnterCritical(&imask);
+
+    if (pMsgQue->Property & IPC_PROP_READY)
+    {
+        /* ԷʽնеϢѵķ߳ݲ */
+        while (count < max)
+        {
+            if (TryReceiveMessage(pMsgQue, (void**)(&(pMsgs[count])), &HiRP, &error) == eFailure)
+            {
+                break;
+            }
+            count++;
+        }
+
+        /* һϢҲûյʱ̻߳°ͨʽյһϢҪʱ */
+        if ((count == 0U) && (!(option & IPC_OPT_ISR)))
+        {
+            state = ReceiveMessage(pMsgQue, &(pMsgs[0]), option, timeo, &imask, &error);
+            if (state == eSuccess)
+            {
+                count = 1U;
+                while (count < max)
+                {
+                    if (TryReceiveMessage(pMsgQue, (void**)(&(pMsgs[count])), &HiRP, &error) ==
+                            eFailure)
+                    {
+                        break;
+                    }
+                    count++;
+                }
+            }
+        }
+
+        if (count > 0U)
+        {
+            /* λѵֻ߳һε */
+            uThreadPreempt(HiRP);
+            error = IPC_ERR_NONE;
+            state = eSuccess;
+        }
+    }
+
+    CpuLeaveCritical(imask);
+
+    *pGot = count;
+    *pError = error;
+    return state;
+}
+
+
+/*************************************************************************************************
+ *  : ߳/ISRһϢзͶϢ                                               *
+ *  : (1) pMsgQue  Ϣнṹַ                                                          *
+ *        (2) pMsgs    ͵Ϣ                                                          *
+ *        (3) n        ͵ϢĿ                                                          *
+ *        (4) pSent    ʵʷ͵ϢĿ                                                        *
+ *        (5) option   Ϣеģʽ                                                        *
+ *        (6) timeo    ʱģʽ·Ϣеʱ޳                                      *
+ *        (7) pError   ϸý                                                              *
+ *  : (1) eFailure ʧ                                                                  *
+ *        (2) eSuccess ɹٷһϢ                                              *
+ *  ˵ͬһٽڰ˳ϢѵĽ߳ͳһһεȡ       *
+ *        ϢʱֻΪһϢѺٷͶɵϢ                   *
+ *        ϢͷһϢĽ˳˳෴                       *
+ *************************************************************************************************/
+TState xMQSendBatch(TMsgQueue* pMsgQue, TMessage* pMsgs, TBase32 n, TBase32* pSent,
+                    TOption option, TTimeTick timeo, TError* pError)
+{
+    TState state = eFailure;
+    TError error = IPC_ERR_UNREADY;
+    TBase32 count = 0U;
+    TBool HiRP = eFalse;
+    TReg32 imask;
+
+    CpuEnterCritical(&imask);
+
+    if (pMsgQue->Property & IPC_PROP_READY)
+    {
+        /* ԷʽͶܹɵϢѵĽ߳ݲ */
+        while (count < n)
+        {
+            if (TrySendMessage(pMsgQue, (void**)(&(pMsgs[count])), option, &HiRP, &error) == eFailure)
+            {
+                break;
+            }
+            count++;
+        }
+
+        /* һϢҲûзʱ̻߳°ͨʽ͵һϢҪʱ */
+        if ((count == 0U) && (n > 0U) && (!(option & IPC_OPT_ISR)))
+        {
+            state = SendMessage(pMsgQue, &(pMsgs[0]), option, timeo, &imask, &error);
+            if (state == eSuccess)
+            {
+                count = 1U;
+                while (count < n)
+                {
+                    if (TrySendMessage(pMsgQue, (void**)(&(pMsgs[count])), option, &HiRP, &error) ==
+                            eFailure)
+                    {
+                        break;
+                    }
+                    count++;
+                }
+            }
+        }
+
+        if (count > 0U)
+        {
+            /* λѵֻ߳һε */
+            uThreadPreempt(HiRP);
+            error = IPC_ERR_NONE;
+            state = eSuccess;
+        }
+    }
+
+    CpuLeaveCritical(imask);
+
+    *pSent = count;
+    *pError = error;
+    return state;
+}
+
+
 /*************************************************************************************************
  *  ܣϢгʼ                                                                     *
  *  룺(1) pMsgQue   Ϣнṹַ                                                         *
@@ -497,7 +760,7 @@ TState xMQSend(TMsgQueue* pMsgQue, TMessage* pMsg2, TOption option, TTimeTick ti
  *        (5) pError    ϸý                                                             *
  *  أ(1) eSuccess  ɹ                                                                 *
  *        (2) eFailure  ʧ                                                                 *
- *  ˵                                                                                       *
+ *  ˵˶ϢȼʱϢСcapacity*TCLC_IPC_MQUE_LEVELS                *
  *************************************************************************************************/
 TState xMQCreate(TMsgQueue* pMsgQue, void** pPool2, TBase32 capacity, TProperty property,
                  TError* pError)
@@ -514,14 +777,9 @@ TState xMQCreate(TMsgQueue* pMsgQue, void** pPool2, TBase32 capacity, TProperty
         pMsgQue->Property = property;
         pMsgQue->Capacity = capacity;
         pMsgQue->MsgPool = pPool2;
-        pMsgQue->MsgEntries = 0U;
-        pMsgQue->Head = 0U;
-        pMsgQue->Tail = 0U;
-        pMsgQue->Status = eMQEmpty;
+        ClearMessages(pMsgQue);
 
-        pMsgQue->Queue.PrimaryHandle   = (TObjNode*)0;
-        pMsgQue->Queue.AuxiliaryHandle = (TObjNode*)0;
-        pMsgQue->Queue.Property        = &(pMsgQue->Property);
+        uIpcInitQueue(&(pMsgQue->Queue), &(pMsgQue->Property));
 
         error = IPC_ERR_NONE;
         state = eSuccess;
@@ -597,10 +855,7 @@ TState xMQReset(TMsgQueue* pMsgQue, TError* pError)
 
         /* Ϣнṹ */
         pMsgQue->Property &= IPC_RESET_MQUE_PROP;
-        pMsgQue->MsgEntries = 0U;
-        pMsgQue->Head = 0U;
-        pMsgQue->Tail = 0U;
-        pMsgQue->Status = eMQEmpty;
+        ClearMessages(pMsgQue);
 
         /* Է߳ռ */
         uThreadPreempt(HiRP);
@@ -699,5 +954,25 @@ TState xMQBroadcast(TMsgQueue* pMsgQue, TMessage* pMsg2, TError* pError)
 }
 
 
+#if (TCLC_IPC_WAITANY_ENABLE)
+/*************************************************************************************************
+ *  : ȴʱԴϢжȡϢ                                                     *
+ *  : (1) pMsgQue Ϣеĵַ                                                             *
+ *        (2) pMsg2   Ϣṹַָ                                                 *
+ *        (3) pHiRP   ǷҪ̵߳ȱ                                                       *
+ *        (4) pError  ϸý                                                               *
+ *  : (1) eSuccess ɹ                                                                  *
+ *        (2) eFailure ʧ                                                                  *
+ *  ˵ֻ߳ͬʱȴIPCʱ                                                    *
+ *************************************************************************************************/
+TState uMsgQueueTryReceive(TMsgQueue* pMsgQue, TMessage* pMsg2, TBool* pHiRP, TError* pError)
+{
+    TState state;
+
+    state = TryReceiveMessage(pMsgQue, (void**)pMsg2, pHiRP, pError);
+    return state;
+}
+#endif
+
 #endif
 
@@ -0,0 +1,648 @@
+/*************************************************************************************************
+ *                                     Trochili RTOS Kernel                                      *
+ *                                  Copyright(C) 2016 LIUXUMING                                  *
+ *                                       www.trochili.com                                        *
+ *************************************************************************************************/
+#include <string.h>
+
+#include "tcl.types.h"
+#include "tcl.config.h"
+#include "tcl.cpu.h"
+#include "tcl.debug.h"
+#include "tcl.thread.h"
+#include "tcl.kernel.h"
+#include "tcl.ipc.h"
+#include "tcl.msgbuf.h"
+
+#if ((TCLC_IPC_ENABLE)&&(TCLC_IPC_MSGBUF_ENABLE))
+
+/* ΪlenϢ¼ڻռõֽ */
+#define MSGBUF_RECORD_BYTES(len) \
+    (MSGBUF_HEAD_BYTES + (((len) + MSGBUF_ALIGN_BYTES - 1U) & (~(MSGBUF_ALIGN_BYTES - 1U))))
+
+/* ָλõĳͷ */
+#define MSGBUF_HEAD(buf, pos)    (*((TBase32*)((buf)->Buffer + (pos))))
+
+
+/*************************************************************************************************
+ *  ܣϢΪһ¼ԤĴ洢ռ                                             *
+ *  (1) pMsgBuf Ϣṹַ                                                         *
+ *        (2) length  Ϣ                                                                   *
+ *        (3) pAddr2  Ϣ洢ַָ                                                 *
+ *  أ(1) eTrue   Ԥɹ                                                                   *
+ *        (2) eFalse  ռ䲻                                                                   *
+ *  ˵¼ţβŲʱӻʼλÿʼţβʣռύʱ     *
+ *        дƱ                                                                           *
+ *************************************************************************************************/
+static TBool ReserveSpace(TMsgBuffer* pMsgBuf, TBase32 length, void** pAddr2)
+{
+    TBase32 bytes;
+    TBool   avail = eFalse;
+    TIndex  pos = 0U;
+
+    bytes = MSGBUF_RECORD_BYTES(length);
+
+    /* ûκμ¼ʱͷʼʹãνĻ */
+    if (pMsgBuf->Used == 0U)
+    {
+        pMsgBuf->Head = 0U;
+        pMsgBuf->Tail = 0U;
+    }
+
+    if (pMsgBuf->Used < pMsgBuf->Capacity)
+    {
+        if (pMsgBuf->Head >= pMsgBuf->Tail)
+        {
+            /* пռֳɻβͻͷ */
+            if (bytes <= (pMsgBuf->Capacity - pMsgBuf->Head))
+            {
+                pos = pMsgBuf->Head;
+                avail = eTrue;
+            }
+            else if (bytes <= pMsgBuf->Tail)
+            {
+                pos = 0U;
+                avail = eTrue;
+            }
+            else
+            {
+                avail = eFalse;
+            }
+        }
+        else
+        {
+            /* пռֻдλúͶλ֮һ */
+            if (bytes <= (pMsgBuf->Tail - pMsgBuf->Head))
+            {
+                pos = pMsgBuf->Head;
+                avail = eTrue;
+            }
+        }
+    }
+
+    if (avail == eTrue)
+    {
+        pMsgBuf->Reserved = pos;
+        pMsgBuf->ReservedBytes = bytes;
+        *pAddr2 = (void*)(pMsgBuf->Buffer + pos + MSGBUF_HEAD_BYTES);
+    }
+
+    return avail;
+}
+
+
+/*************************************************************************************************
+ *  ܣȡϢһ¼                                                         *
+ *  (1) pMsgBuf Ϣṹַ                                                         *
+ *        (2) pAddr2  Ϣ洢ַָ                                                 *
+ *  أ                                                                                     *
+ *  ˵ǰȷϻм¼ûڶȡļ¼                                     *
+ *************************************************************************************************/
+static void PeekRecord(TMsgBuffer* pMsgBuf, void** pAddr2)
+{
+    /* λƱʱͷβʣռ䲢ػʼλ */
+    if (MSGBUF_HEAD(pMsgBuf, pMsgBuf->Tail) == MSGBUF_WRAP_MARK)
+    {
+        pMsgBuf->Used -= (pMsgBuf->Capacity - pMsgBuf->Tail);
+        pMsgBuf->Tail = 0U;
+    }
+
+    pMsgBuf->PeekedBytes = MSGBUF_RECORD_BYTES(MSGBUF_HEAD(pMsgBuf, pMsgBuf->Tail));
+    *pAddr2 = (void*)(pMsgBuf->Buffer + pMsgBuf->Tail + MSGBUF_HEAD_BYTES);
+}
+
+
+/*************************************************************************************************
+ *  ܣԻϢеһ߳                                               *
+ *  (1) pMsgBuf Ϣṹַ                                                         *
+ *        (2) pHiRP   ǷҪ̵߳ȱ                                                       *
+ *  أ                                                                                     *
+ *  ˵ڻ֮߳ǰȡһ¼                                                 *
+ *************************************************************************************************/
+static void WakeupReader(TMsgBuffer* pMsgBuf, TBool* pHiRP)
+{
+    TIpcContext* pContext;
+
+    if ((pMsgBuf->Property & IPC_PROP_PRIMQ_AVAIL) &&
+            (pMsgBuf->Entries > 0U) && (pMsgBuf->PeekedBytes == 0U))
+    {
+        pContext = (TIpcContext*)(pMsgBuf->Queue.PrimaryHandle->Owner);
+        PeekRecord(pMsgBuf, pContext->Data.Addr2);
+        uIpcUnblockThread(pContext, eSuccess, IPC_ERR_NONE, pHiRP);
+    }
+}
+
+
+/*************************************************************************************************
+ *  ܣԻϢдеһ߳                                               *
+ *  (1) pMsgBuf Ϣṹַ                                                         *
+ *        (2) pHiRP   ǷҪ̵߳ȱ                                                       *
+ *  أ                                                                                     *
+ *  ˵ڻ֮߳ǰԤ洢ռ䣬ͷ߳̿ռ䲻ʱ߳Ҳᱻ       *
+ *************************************************************************************************/
+static void WakeupWriter(TMsgBuffer* pMsgBuf, TBool* pHiRP)
+{
+    TIpcContext* pContext;
+
+    if ((pMsgBuf->Property & IPC_PROP_AUXIQ_AVAIL) && (pMsgBuf->ReservedBytes == 0U))
+    {
+        pContext = (TIpcContext*)(pMsgBuf->Queue.AuxiliaryHandle->Owner);
+        if (ReserveSpace(pMsgBuf, pContext->Length, pContext->Data.Addr2) == eTrue)
+        {
+            uIpcUnblockThread(pContext, eSuccess, IPC_ERR_NONE, pHiRP);
+        }
+    }
+}
+
+
+/*************************************************************************************************
+ *  ܣ߳/ISRϢԤ洢ռ                                                 *
+ *  (1) pMsgBuf Ϣṹַ                                                         *
+ *        (2) length  Ϣ                                                                   *
+ *        (3) pAddr2  Ϣ洢ַָ                                                 *
+ *        (4) pError  ϸý                                                               *
+ *  أ(1) eFailure ʧ                                                                  *
+ *        (2) eSuccess ɹ                                                                  *
+ *  ˵ͬһʱֻһԤ߳ڵȴԤʱµҲܲ                       *
+ *************************************************************************************************/
+static TState TryReserveMsgBuf(TMsgBuffer* pMsgBuf, TBase32 length, void** pAddr2, TError* pError)
+{
+    TState state = eFailure;
+
+    if (MSGBUF_RECORD_BYTES(length) > pMsgBuf->Capacity)
+    {
+        *pError = IPC_ERR_INVALID_VALUE;
+    }
+    else if ((pMsgBuf->ReservedBytes != 0U) || (pMsgBuf->Property & IPC_PROP_AUXIQ_AVAIL))
+    {
+        *pError = IPC_ERR_INVALID_STATUS;
+    }
+    else if (ReserveSpace(pMsgBuf, length, pAddr2) == eFalse)
+    {
+        *pError = IPC_ERR_INVALID_STATUS;
+    }
+    else
+    {
+        *pError = IPC_ERR_NONE;
+        state = eSuccess;
+    }
+
+    return state;
+}
+
+
+/*************************************************************************************************
+ *  ܣ߳/ISRԶȡϢһ¼                                             *
+ *  (1) pMsgBuf Ϣṹַ                                                         *
+ *        (2) pAddr2  Ϣ洢ַָ                                                 *
+ *        (3) pLength Ϣȵı                                                         *
+ *        (4) pError  ϸý                                                               *
+ *  أ(1) eFailure ʧ                                                                  *
+ *        (2) eSuccess ɹ                                                                  *
+ *  ˵ͬһʱֻȡһ¼ͷ֮ܶȡһ                                     *
+ *************************************************************************************************/
+static TState TryPeekMsgBuf(TMsgBuffer* pMsgBuf, void** pAddr2, TBase32* pLength, TError* pError)
+{
+    TState state = eFailure;
+
+    if ((pMsgBuf->Entries == 0U) || (pMsgBuf->PeekedBytes != 0U))
+    {
+        *pError = IPC_ERR_INVALID_STATUS;
+    }
+    else
+    {
+        PeekRecord(pMsgBuf, pAddr2);
+        *pLength = MSGBUF_HEAD(pMsgBuf, pMsgBuf->Tail);
+
+        *pError = IPC_ERR_NONE;
+        state = eSuccess;
+    }
+
+    return state;
+}
+
+
+/*************************************************************************************************
+ *  : ߳/ISRϢԤ洢ռ                                                     *
+ *  : (1) pMsgBuf  Ϣṹַ                                                        *
+ *        (2) length   Ϣ                                                                  *
+ *        (3) pAddr2   Ϣ洢ַָ                                                *
+ *        (4) option   Ϣģʽ                                                      *
+ *        (5) timeo    ʱģʽ·Ϣʱ޳                                    *
+ *        (6) pError   ϸý                                                              *
+ *  : (1) eFailure ʧ                                                                  *
+ *        (2) eSuccess ɹ                                                                  *
+ *  ˵ռ䲻ʱ߳ڸУ߳ͷż¼ʱԤٽ份               *
+ *************************************************************************************************/
+TState xMsgBufReserve(TMsgBuffer* pMsgBuf, TBase32 length, void** pAddr2,
+                      TOption option, TTimeTick timeo, TError* pError)
+{
+    TState state = eFailure;
+    TError error = IPC_ERR_UNREADY;
+    TIpcContext* pContext;
+    TReg32 imask;
+
+    CpuEnterCritical(&imask);
+
+    if (pMsgBuf->Property & IPC_PROP_READY)
+    {
+        state = TryReserveMsgBuf(pMsgBuf, length, pAddr2, &error);
+
+        /* ֻ̻߳²̵߳ʱԤʧ̲ܵ߳ſȴ
+           ҪĿռ䳬ʱԶ޷㣬Ҳ */
+        if ((state == eFailure) && (error == IPC_ERR_INVALID_STATUS) &&
+                (!(option & IPC_OPT_ISR)) && (option & IPC_OPT_WAIT) &&
+                (uKernelVariable.State == eThreadState) &&
+                (uKernelVariable.Schedulable == eTrue))
+        {
+            /* õǰ̵߳IPCĽṹַ */
+            pContext = &(uKernelVariable.CurrentThread->IpcContext);
+
+            /* ̹߳Ϣд߳̽AuxiliaryQueue */
+            option |= IPC_OPT_MSGBUF | IPC_OPT_WRITE_DATA | IPC_OPT_USE_AUXIQ;
+            uIpcSaveContext(pContext, (void*)pMsgBuf, (void*)pAddr2, length, option,
+                            &state, &error);
+
+            /* ǰ߳ڸϢ */
+            uIpcBlockThread(pContext, &(pMsgBuf->Queue), timeo);
+
+            /* ǰ̷߳ȣ̵ִ߳ */
+            uThreadSchedule();
+
+            CpuLeaveCritical(imask);
+            /* ʱ˴һεȣǰ߳ѾIPCС
+            ʼִб̣߳ٴδ߳ʱӱС*/
+            CpuEnterCritical(&imask);
+
+            /* ̹߳Ϣ */
+            uIpcCleanContext(pContext);
+        }
+    }
+
+    CpuLeaveCritical(imask);
+
+    *pError = error;
+    return state;
+}
+
+
+/*************************************************************************************************
+ *  : ύѾԤϢ¼                                                                 *
+ *  : (1) pMsgBuf  Ϣṹַ                                                        *
+ *        (2) length   ϢʵʳȣܳԤʱĳ                                      *
+ *        (3) pError   ϸý                                                              *
+ *  : (1) eFailure ʧ                                                                  *
+ *        (2) eSuccess ɹ                                                                  *
+ *  ˵lengthΪ0ʱȡԤ¼̺߳ISRԵ                                   *
+ *************************************************************************************************/
+TState xMsgBufCommit(TMsgBuffer* pMsgBuf, TBase32 length, TError* pError)
+{
+    TState state = eFailure;
+    TError error = IPC_ERR_UNREADY;
+    TBool HiRP = eFalse;
+    TBase32 bytes;
+    TReg32 imask;
+
+    CpuEnterCritical(&imask);
+
+    if (pMsgBuf->Property & IPC_PROP_READY)
+    {
+        bytes = MSGBUF_RECORD_BYTES(length);
+        if (pMsgBuf->ReservedBytes == 0U)
+        {
+            error = IPC_ERR_INVALID_STATUS;
+        }
+        else if (bytes > pMsgBuf->ReservedBytes)
+        {
+            error = IPC_ERR_INVALID_VALUE;
+        }
+        else
+        {
+            if (length > 0U)
+            {
+                /* Ԥλòдλ˵¼Ƶ˻ʼλãβдƱ */
+                if (pMsgBuf->Reserved != pMsgBuf->Head)
+                {
+                    MSGBUF_HEAD(pMsgBuf, pMsgBuf->Head) = MSGBUF_WRAP_MARK;
+                    pMsgBuf->Used += (pMsgBuf->Capacity - pMsgBuf->Head);
+                }
+
+                MSGBUF_HEAD(pMsgBuf, pMsgBuf->Reserved) = length;
+                pMsgBuf->Head = pMsgBuf->Reserved + bytes;
+                if (pMsgBuf->Head == pMsgBuf->Capacity)
+                {
+                    pMsgBuf->Head = 0U;
+                }
+                pMsgBuf->Used += bytes;
+                pMsgBuf->Entries++;
+            }
+            pMsgBuf->ReservedBytes = 0U;
+
+            /* ¼¼Խȴȡ̣߳ԤȴԤ߳Ҳл */
+            WakeupReader(pMsgBuf, &HiRP);
+            WakeupWriter(pMsgBuf, &HiRP);
+
+            /* Է߳ռ */
+            uThreadPreempt(HiRP);
+
+            error = IPC_ERR_NONE;
+            state = eSuccess;
+        }
+    }
+
+    CpuLeaveCritical(imask);
+
+    *pError = error;
+    return state;
+}
+
+
+/*************************************************************************************************
+ *  : ߳/ISRȡϢһ¼                                                 *
+ *  : (1) pMsgBuf  Ϣṹַ                                                        *
+ *        (2) pAddr2   Ϣ洢ַָ                                                *
+ *        (3) pLength  Ϣȵı                                                        *
+ *        (4) option   Ϣģʽ                                                      *
+ *        (5) timeo    ʱģʽ·Ϣʱ޳                                    *
+ *        (6) pError   ϸý                                                              *
+ *  : (1) eFailure ʧ                                                                  *
+ *        (2) eSuccess ɹ                                                                  *
+ *  ˵¼ڻֱͷţûм¼ʱ߳ڻ                               *
+ *************************************************************************************************/
+TState xMsgBufPeek(TMsgBuffer* pMsgBuf, void** pAddr2, TBase32* pLength,
+                   TOption option, TTimeTick timeo, TError* pError)
+{
+    TState state = eFailure;
+    TError error = IPC_ERR_UNREADY;
+    TIpcContext* pContext;
+    TReg32 imask;
+
+    CpuEnterCritical(&imask);
+
+    if (pMsgBuf->Property & IPC_PROP_READY)
+    {
+        state = TryPeekMsgBuf(pMsgBuf, pAddr2, pLength, &error);
+
+        if ((state == eFailure) && (!(option & IPC_OPT_ISR)) && (option & IPC_OPT_WAIT) &&
+                (uKernelVariable.State == eThreadState) &&
+                (uKernelVariable.Schedulable == eTrue))
+        {
+            /* õǰ̵߳IPCĽṹַ */
+            pContext = &(uKernelVariable.CurrentThread->IpcContext);
+
+            /* ̹߳Ϣ߳̽PrimaryQueue */
+            option |= IPC_OPT_MSGBUF | IPC_OPT_READ_DATA;
+            uIpcSaveContext(pContext, (void*)pMsgBuf, (void*)pAddr2, 0U, option,
+                            &state, &error);
+
+            /* ǰ߳ڸϢ */
+            uIpcBlockThread(pContext, &(pMsgBuf->Queue), timeo);
+
+            /* ǰ̷߳ȣ̵ִ߳ */
+            uThreadSchedule();
+
+            CpuLeaveCritical(imask);
+            /* ʱ˴һεȣǰ߳ѾIPCС
+            ʼִб̣߳ٴδ߳ʱӱС*/
+            CpuEnterCritical(&imask);
+
+            /* ̹߳Ϣ */
+            uIpcCleanContext(pContext);
+
+            /* Ѿ汾߳ȡü¼¼ȱڼ¼ĳͷ */
+            if (state == eSuccess)
+            {
+                *pLength = *((TBase32*)((TByte*)(*pAddr2) - MSGBUF_HEAD_BYTES));
+            }
+        }
+    }
+
+    CpuLeaveCritical(imask);
+
+    *pError = error;
+    return state;
+}
+
+
+/*************************************************************************************************
+ *  : ͷڶȡϢ¼                                                                 *
+ *  : (1) pMsgBuf  Ϣṹַ                                                        *
+ *        (2) pError   ϸý                                                              *
+ *  : (1) eFailure ʧ                                                                  *
+ *        (2) eSuccess ɹ                                                                  *
+ *  ˵̺߳ISRԵ                                                                    *
+ *************************************************************************************************/
+TState xMsgBufRelease(TMsgBuffer* pMsgBuf, TError* pError)
+{
+    TState state = eFailure;
+    TError error = IPC_ERR_UNREADY;
+    TBool HiRP = eFalse;
+    TReg32 imask;
+
+    CpuEnterCritical(&imask);
+
+    if (pMsgBuf->Property & IPC_PROP_READY)
+    {
+        if (pMsgBuf->PeekedBytes == 0U)
+        {
+            error = IPC_ERR_INVALID_STATUS;
+        }
+        else
+        {
+            pMsgBuf->Tail += pMsgBuf->PeekedBytes;
+            if (pMsgBuf->Tail == pMsgBuf->Capacity)
+            {
+                pMsgBuf->Tail = 0U;
+            }
+            pMsgBuf->Used -= pMsgBuf->PeekedBytes;
+            pMsgBuf->Entries--;
+            pMsgBuf->PeekedBytes = 0U;
+
+            /* һ¼Խȴȡ̣߳ͷŵĿռԽȴԤ߳ */
+            WakeupReader(pMsgBuf, &HiRP);
+            WakeupWriter(pMsgBuf, &HiRP);
+
+            /* Է߳ռ */
+            uThreadPreempt(HiRP);
+
+            error = IPC_ERR_NONE;
+            state = eSuccess;
+        }
+    }
+
+    CpuLeaveCritical(imask);
+
+    *pError = error;
+    return state;
+}
+
+
+/*************************************************************************************************
+ *  ܣϢʼ                                                                   *
+ *  룺(1) pMsgBuf   Ϣṹַ                                                       *
+ *        (2) pAddr     λַ4ֽڶ                                            *
+ *        (3) bytes     λֽ4ֽȡ                                        *
+ *        (4) property  Ϣ̵߳Ȳ                                                   *
+ *        (5) pError    ϸý                                                             *
+ *  أ(1) eSuccess  ɹ                                                                 *
+ *        (2) eFailure  ʧ                                                                 *
+ *  ˵                                                                                       *
+ *************************************************************************************************/
+TState xMsgBufCreate(TMsgBuffer* pMsgBuf, void* pAddr, TBase32 bytes, TProperty property,
+                     TError* pError)
+{
+    TState state = eFailure;
+    TError error = IPC_ERR_FAULT;
+    TReg32 imask;
+
+    CpuEnterCritical(&imask);
+
+    if (!(pMsgBuf->Property & IPC_PROP_READY))
+    {
+        property |= IPC_PROP_READY;
+        pMsgBuf->Property      = property;
+        pMsgBuf->Buffer        = (TByte*)pAddr;
+        pMsgBuf->Capacity      = bytes & (~(MSGBUF_ALIGN_BYTES - 1U));
+        pMsgBuf->Used          = 0U;
+        pMsgBuf->Entries       = 0U;
+        pMsgBuf->Head          = 0U;
+        pMsgBuf->Tail          = 0U;
+        pMsgBuf->Reserved      = 0U;
+        pMsgBuf->ReservedBytes = 0U;
+        pMsgBuf->PeekedBytes   = 0U;
+
+        uIpcInitQueue(&(pMsgBuf->Queue), &(pMsgBuf->Property));
+
+        error = IPC_ERR_NONE;
+        state = eSuccess;
+    }
+
+    CpuLeaveCritical(imask);
+
+    *pError = error;
+    return state;
+}
+
+
+/*************************************************************************************************
+ *  ܣϢע                                                                     *
+ *  룺(1) pMsgBuf   Ϣṹַ                                                       *
+ *        (2) pError    ϸý                                                             *
+ *  أ(1) eSuccess  ɹ                                                                 *
+ *        (2) eFailure  ʧ                                                                 *
+ *  ˵                                                                                       *
+ *************************************************************************************************/
+TState xMsgBufDelete(TMsgBuffer* pMsgBuf, TError* pError)
+{
+    TState state = eFailure;
+    TError error = IPC_ERR_UNREADY;
+    TBool HiRP = eFalse;
+    TReg32 imask;
+
+    CpuEnterCritical(&imask);
+
+    if (pMsgBuf->Property & IPC_PROP_READY)
+    {
+        /* ϵеȴ̶߳ͷţ̵߳ĵȴTCLE_IPC_DELETE */
+        uIpcUnblockAll(&(pMsgBuf->Queue), eFailure, IPC_ERR_DELETE, (void**)0, &HiRP);
+
+        /* Ϣȫ */
+        memset(pMsgBuf, 0U, sizeof(TMsgBuffer));
+
+        /* Է߳ռ */
+        uThreadPreempt(HiRP);
+
+        error = IPC_ERR_NONE;
+        state = eSuccess;
+    }
+
+    CpuLeaveCritical(imask);
+
+    *pError = error;
+    return state;
+}
+
+
+/*************************************************************************************************
+ *  ܣϢú                                                                     *
+ *  룺(1) pMsgBuf   Ϣṹַ                                                       *
+ *        (2) pError    ϸý                                                             *
+ *  أ(1) eSuccess  ɹ                                                                 *
+ *        (2) eFailure  ʧ                                                                 *
+ *  ˵еļ¼Ԥڶȡļ¼ȫ                                           *
+ *************************************************************************************************/
+TState xMsgBufReset(TMsgBuffer* pMsgBuf, TError* pError)
+{
+    TState state = eFailure;
+    TError error = IPC_ERR_UNREADY;
+    TBool HiRP = eFalse;
+    TReg32 imask;
+
+    CpuEnterCritical(&imask);
+
+    if (pMsgBuf->Property & IPC_PROP_READY)
+    {
+        /* ϵеȴ̶߳ͷţ̵߳ĵȴTCLE_IPC_RESET */
+        uIpcUnblockAll(&(pMsgBuf->Queue), eFailure, IPC_ERR_RESET, (void**)0, &HiRP);
+
+        /* Ϣṹ */
+        pMsgBuf->Property &= IPC_RESET_MBUF_PROP;
+        pMsgBuf->Used          = 0U;
+        pMsgBuf->Entries       = 0U;
+        pMsgBuf->Head          = 0U;
+        pMsgBuf->Tail          = 0U;
+        pMsgBuf->Reserved      = 0U;
+        pMsgBuf->ReservedBytes = 0U;
+        pMsgBuf->PeekedBytes   = 0U;
+
+        /* Է߳ռ */
+        uThreadPreempt(HiRP);
+
+        error = IPC_ERR_NONE;
+        state = eSuccess;
+    }
+
+    CpuLeaveCritical(imask);
+
+    *pError = error;
+    return state;
+}
+
+
+/*************************************************************************************************
+ *  ܣϢֹ,Ϣе߳ȫֹ                  *
+ *  (1) pMsgBuf  Ϣṹַ                                                        *
+ *        (2) pError   ϸý                                                              *
+ *  أ(1) eSuccess ɹ                                                                      *
+ *        (2) eFailure ʧ                                                                      *
+ *  ˵                                                                                       *
+ *************************************************************************************************/
+TState xMsgBufFlush(TMsgBuffer* pMsgBuf, TError* pError)
+{
+    TState state = eFailure;
+    TError error = IPC_ERR_UNREADY;
+    TBool HiRP = eFalse;
+    TReg32 imask;
+
+    CpuEnterCritical(&imask);
+
+    if (pMsgBuf->Property & IPC_PROP_READY)
+    {
+        /* ϵеȴ̶߳ͷţ̵߳ĵȴTCLE_IPC_FLUSH */
+        uIpcUnblockAll(&(pMsgBuf->Queue), eFailure, IPC_ERR_FLUSH, (void**)0, &HiRP);
+
+        /* Է߳ռ */
+        uThreadPreempt(HiRP);
+
+        error = IPC_ERR_NONE;
+        state = eSuccess;
+    }
+
+    CpuLeaveCritical(imask);
+
+    *pError = error;
+    return state;
+}
+
+#endif
+
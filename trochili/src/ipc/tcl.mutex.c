@@ -21,6 +21,185 @@ static TState FreeMutex(TMutex* pMutex, TError* pError);
 static TState LockMutex(TMutex* pMutex, TOption option, TTimeTick timeo,
                         TReg32* pIMask, TError* pError);
 
+
+/*************************************************************************************************
+ *  : 㻥еȴ̵߳ȼ                                               *
+ *  : (1) pMutex   ṹַ                                                            *
+ *  : ȴ̵߳ȼûеȴ߳ʱȼ                                     *
+ *  ˵ȼеĶͷ߳ȼߣȳҪ                 *
+ *************************************************************************************************/
+static TPriority GetWaiterPriority(TMutex* pMutex)
+{
+    TPriority priority = TCLC_LOWEST_PRIORITY;
+    TObjNode* pNode;
+    TThread* pThread;
+
+    pNode = pMutex->Queue.PrimaryHandle;
+    while (pNode != (TObjNode*)0)
+    {
+        pThread = (TThread*)(((TIpcContext*)(pNode->Owner))->Owner);
+        if (pThread->Priority < priority)
+        {
+            priority = pThread->Priority;
+        }
+
+        pNode = pNode->Next;
+        if ((pMutex->Property & IPC_PROP_PREEMP_PRIMIQ) || (pNode == pMutex->Queue.PrimaryHandle))
+        {
+            break;
+        }
+    }
+
+    return priority;
+}
+
+
+/*************************************************************************************************
+ *  : ߳еλ                                                   *
+ *  : (1) pMutex   ṹַ                                                            *
+ *        (2) priority µȼ                                                          *
+ *  :                                                                                      *
+ *  ˵߳аȼ򣬻ȼ仯Ŷ                           *
+ *************************************************************************************************/
+static void SetLockPriority(TMutex* pMutex, TPriority priority)
+{
+    TThread* pThread = pMutex->Owner;
+
+    uObjListRemoveNode(&(pThread->LockList), &(pMutex->LockNode));
+    pMutex->Priority = priority;
+    uObjListAddPriorityNode(&(pThread->LockList), &(pMutex->LockNode));
+}
+
+
+/*************************************************************************************************
+ *  : ػݼ̳еȼ                                                       *
+ *  : (1) pMutex   ȴ߳׼ȴĻṹַ                                          *
+ *        (2) priority ȴ̵߳ȼ                                                          *
+ *        (3) pHiRP    Ƿиȼ                                                      *
+ *  :                                                                                      *
+ *  ˵߱Ҳһ̳ЭĻϣǸߣ   *
+ *        ֱȼ㹻ߵ̻߲߳Ǽ̳ЭĻΪϵȼֻ         *
+ *        Լʹ֮߳ѾγѭҲһ                                     *
+ *************************************************************************************************/
+static void InheritPriority(TMutex* pMutex, TPriority priority, TBool* pHiRP)
+{
+    TState state;
+    TError error;
+    TThread* pThread;
+
+    while ((pMutex != (TMutex*)0) &&
+            (pMutex->Property & IPC_PROP_INHERIT) &&
+            (pMutex->Priority > priority))
+    {
+        pThread = pMutex->Owner;
+        SetLockPriority(pMutex, priority);
+
+        pMutex = (TMutex*)0;
+        if ((!(pThread->Property & THREAD_PROP_PRIORITY_FIXED)) &&
+                (pThread->Priority > priority))
+        {
+            /* ȴ̱߳ʱǰֻ֪߳ͨߣľ߳
+               ܸڵǰ̣߳ɵ߷ռ */
+            state = uThreadSetPriority(pThread, priority, eFalse, &error);
+            state = state;
+            if ((pThread->Status == eThreadReady) &&
+                    (priority < uKernelVariable.CurrentThread->Priority))
+            {
+                *pHiRP = eTrue;
+            }
+
+            /* ߳ڱĻʱҪǸ */
+            if ((pThread->Status == eThreadBlocked) &&
+                    (pThread->IpcContext.Option & IPC_OPT_MUTEX))
+            {
+                pMutex = (TMutex*)(pThread->IpcContext.Object);
+            }
+        }
+    }
+}
+
+
+/*************************************************************************************************
+ *  : ȴ̷߳ȴ󣬳̶߳ļ̳ȼ                                     *
+ *  : (1) pMutex   ṹַ                                                            *
+ *  :                                                                                      *
+ *  ˵ɳʱֹ߱ȴ߳ڻָкã̲߳ǵǰ̣߳                   *
+ *        ȼҪ̵߳ȡ߳ȼͺҲڱļ̳Э     *
+ *        ϣΪϵȼֻԱѭһ               *
+ *************************************************************************************************/
+static void RevokePriority(TMutex* pMutex)
+{
+    TState    state;
+    TError    error;
+    TPriority priority;
+    TThread*  pThread;
+
+    while ((pMutex != (TMutex*)0) &&
+            (pMutex->Property & IPC_PROP_INHERIT) &&
+            (pMutex->Owner != (TThread*)0))
+    {
+        pThread = pMutex->Owner;
+        SetLockPriority(pMutex, GetWaiterPriority(pMutex));
+
+        pMutex = (TMutex*)0;
+        if (!(pThread->Property & THREAD_PROP_PRIORITY_FIXED))
+        {
+            priority = *((TPriority*)(pThread->LockList->Data));
+            if (priority > pThread->BasePriority)
+            {
+                priority = pThread->BasePriority;
+            }
+
+            if (priority > pThread->Priority)
+            {
+                state = uThreadSetPriority(pThread, priority, eFalse, &error);
+                state = state;
+
+                /* ߳ڱĻʱҪǸߵȼ */
+                if ((pThread->Status == eThreadBlocked) &&
+                        (pThread->IpcContext.Option & IPC_OPT_MUTEX))
+                {
+                    pMutex = (TMutex*)(pThread->IpcContext.Object);
+                }
+            }
+        }
+    }
+}
+
+
+/*************************************************************************************************
+ *  : ڻϵ߳޸ȼ¼̳еȼ                       *
+ *  : (1) pMutex   ߳Ļṹַ                                                *
+ *        (2) priority ߳µȼ                                                            *
+ *        (3) pHiRP    Ƿиȼ                                                      *
+ *  :                                                                                      *
+ *  ˵߳ȼʱʱļ̳ȼܾ߳̿     *
+ *        ǰ̣֮߳ǰ߳̿ܲ߾ȼ                                     *
+ *************************************************************************************************/
+void uMutexResetPriority(TMutex* pMutex, TPriority priority, TBool* pHiRP)
+{
+    TPriority temp;
+
+    if (pMutex->Property & IPC_PROP_INHERIT)
+    {
+        if (pMutex->Priority > priority)
+        {
+            InheritPriority(pMutex, priority, pHiRP);
+        }
+        else
+        {
+            RevokePriority(pMutex);
+        }
+
+        uThreadCalcHiRP(&temp);
+        if (temp < uKernelVariable.CurrentThread->Priority)
+        {
+            *pHiRP = eTrue;
+        }
+    }
+}
+
+
 /*************************************************************************************************
  *  : ʹ̻߳û⻥                                                             *
  *  : (1) pThread  ߳̽ṹַ                                                              *
@@ -52,7 +231,8 @@ static void AddLock(TThread* pThread, TMutex* pMutex, TBool* pHiRP)
 
         /* PCP õ֮󣬵ǰ߳ʵʩ컨㷨,Ϊܻ߳̿ö
         ̵߳ĵǰȼܱ»õĻ컨廹ߡ Ƚһȼ
-        ֱó»컨ȼ */
+        ֱó»컨ȼ̳Э»ȼʣȴ̵߳
+        ȼͬ */
         if (pThread->Priority > pMutex->Priority)
         {
             state = uThreadSetPriority(pThread, pMutex->Priority, eFalse, &error);
@@ -134,8 +314,13 @@ static void RemoveLock(TThread* pThread, TMutex* pMutex, TBool* pHiRP)
                עɾڶκλãڶͷҪ߳ȼ */
             if (pHead == &(pMutex->LockNode))
             {
-                /* ׼ָ߳ȼ */
+                /* ׼ָ߳ȼ컨߼̳ȼܱȻȼͣ
+                   ʱ߳ȼָֻܻȼ */
                 priority = *((TPriority*)(pThread->LockList->Data));
+                if (priority > pThread->BasePriority)
+                {
+                    priority = pThread->BasePriority;
+                }
                 nflag = eTrue;
             }
         }
@@ -216,9 +401,19 @@ static TState TryFreeMutex(TMutex* pMutex, TBool* pHiRP, TError* pError)
                 pContext = (TIpcContext*)(pMutex->Queue.PrimaryHandle->Owner);
                 uIpcUnblockThread(pContext, eSuccess, IPC_ERR_NONE, pHiRP);
 
+                /* ̳Э£߼̳еʣȴ̵߳ȼ */
+                if (pMutex->Property & IPC_PROP_INHERIT)
+                {
+                    pMutex->Priority = GetWaiterPriority(pMutex);
+                }
+
                 pThread = (TThread*)(pContext->Owner);
                 AddLock(pThread, pMutex, pHiRP);
             }
+            else if (pMutex->Property & IPC_PROP_INHERIT)
+            {
+                pMutex->Priority = TCLC_LOWEST_PRIORITY;
+            }
         }
 
         error = IPC_ERR_NONE;
@@ -342,8 +537,14 @@ static TState LockMutex(TMutex* pMutex, TOption option, TTimeTick timeo,
                     /* õǰ̵߳IPCĽṹַ */
                     pContext = &(uKernelVariable.CurrentThread->IpcContext);
 
+                    /* ̳Э£ػ̵߳ȼ */
+                    if (pMutex->Property & IPC_PROP_INHERIT)
+                    {
+                        InheritPriority(pMutex, uKernelVariable.CurrentThread->Priority, &HiRP);
+                    }
+
                     /* 趨߳ڵȴԴϢ */
-                    uIpcSaveContext(pContext, (void*)pMutex, 0U, 0U, (option | IPC_OPT_MUTEX), &state, pError);
+                    uIpcSaveContext(pContext, (void*)pMutex, (void*)0, 0U, (option | IPC_OPT_MUTEX), &state, pError);
 
                     /* ǰ߳ڸû */
                     uIpcBlockThread(pContext, &(pMutex->Queue), timeo);
@@ -358,6 +559,12 @@ static TState LockMutex(TMutex* pMutex, TOption option, TTimeTick timeo,
 
                     /* ̹߳Ϣ */
                     uIpcCleanContext(pContext);
+
+                    /* ʱֹ߱ȴʱ̶̳߳еȼ */
+                    if (state != eSuccess)
+                    {
+                        RevokePriority(pMutex);
+                    }
                 }
             }
         }
@@ -366,6 +573,68 @@ static TState LockMutex(TMutex* pMutex, TOption option, TTimeTick timeo,
     return state;
 }
 
+#if (TCLC_IPC_CONDVAR_ENABLE)
+/*************************************************************************************************
+ *  : ǰ̳߳ͷŻǶռжٴ                                             *
+ *  : (1) pMutex   ṹַ                                                            *
+ *        (2) pNest    滥Ƕ׼                                                    *
+ *        (3) pHiRP    Ƿиȼ                                                      *
+ *        (4) pError   ϸý                                                              *
+ *  : (1) eSuccess ɹ                                                                  *
+ *        (2) eFailure ʧ                                                                  *
+ *  ˵ʹã߳»ûٻָǶ                                       *
+ *************************************************************************************************/
+TState uMutexRelease(TMutex* pMutex, TBase32* pNest, TBool* pHiRP, TError* pError)
+{
+    TState state = eFailure;
+
+    *pError = IPC_ERR_FORBIDDEN;
+    if (pMutex->Owner == uKernelVariable.CurrentThread)
+    {
+        *pNest = pMutex->Nest;
+        pMutex->Nest = 1U;
+        state = TryFreeMutex(pMutex, pHiRP, pError);
+    }
+
+    return state;
+}
+
+
+/*************************************************************************************************
+ *  : IPCϵ߳̽                                                  *
+ *  : (1) pMutex   ṹַ                                                            *
+ *        (2) pContext ̵߳IPC                                                           *
+ *        (3) pHiRP    Ƿиȼ                                                      *
+ *  :                                                                                      *
+ *  ˵ʱֱ߳ӻûѣ̲߳ѣֱתƵ   *
+ *        УȻͷʱٻûʡȥ߳ٴл             *
+ *************************************************************************************************/
+void uMutexHandOver(TMutex* pMutex, TIpcContext* pContext, TBool* pHiRP)
+{
+    TThread* pThread;
+    TOption option;
+
+    pThread = (TThread*)(pContext->Owner);
+    if (pMutex->Owner == (TThread*)0)
+    {
+        uIpcUnblockThread(pContext, eSuccess, IPC_ERR_NONE, pHiRP);
+        AddLock(pThread, pMutex, pHiRP);
+    }
+    else
+    {
+        option = (pContext->Option & (~IPC_OPT_CONDVAR)) | IPC_OPT_MUTEX;
+        uIpcMoveThread(pContext, (void*)pMutex, &(pMutex->Queue), option);
+
+        /* ̳Э£ػ̵߳ȼ */
+        if (pMutex->Property & IPC_PROP_INHERIT)
+        {
+            InheritPriority(pMutex, pThread->Priority, pHiRP);
+        }
+    }
+}
+#endif
+
+
 /*************************************************************************************************
  *  : ͷŻ⻥                                                                         *
  *  : (1) pMutex   ṹַ                                                            *
@@ -522,7 +791,11 @@ TState xMutexReset(TMutex* pMutex, TError* pError)
         pMutex->Property &= IPC_RESET_MUTEX_PROP;
         pMutex->Owner = (TThread*)0;
         pMutex->Nest = 0U;
-        /* pMutex->Priority = keep recent value; */
+        /* 컨ȼֲ䣬̳еõȼҪ */
+        if (pMutex->Property & IPC_PROP_INHERIT)
+        {
+            pMutex->Priority = TCLC_LOWEST_PRIORITY;
+        }
         pMutex->LockNode.Owner = (void*)0;
         pMutex->LockNode.Data = (TBase32*)0;
 
@@ -583,7 +856,7 @@ TState xMutexFlush(TMutex* pMutex, TError* pError)
  *        (4) pError   ϸý                                                              *
  *  : (1) eSuccess ɹ                                                                  *
  *        (2) eFailure ʧ                                                                  *
- *  ˵                                                                                       *
+ *  ˵ȼ̳Э(IPC_PROP_INHERIT)Ļ컨                             *
  *************************************************************************************************/
 TState xMutexCreate(TMutex* pMutex, TPriority priority, TProperty property, TError* pError)
 {
@@ -599,11 +872,9 @@ TState xMutexCreate(TMutex* pMutex, TPriority priority, TProperty property, TErr
         pMutex->Property = property;
         pMutex->Nest = 0U;
         pMutex->Owner = (TThread*)0;
-        pMutex->Priority = priority;
+        pMutex->Priority = (property & IPC_PROP_INHERIT) ? TCLC_LOWEST_PRIORITY : priority;
 
-        pMutex->Queue.PrimaryHandle   = (TObjNode*)0;
-        pMutex->Queue.AuxiliaryHandle = (TObjNode*)0;
-        pMutex->Queue.Property        = &(pMutex->Property);
+        uIpcInitQueue(&(pMutex->Queue), &(pMutex->Property));
 
         pMutex->LockNode.Owner = (void*)pMutex;
         pMutex->LockNode.Data = (TBase32*)(&(pMutex->Priority));
@@ -0,0 +1,668 @@
+/*************************************************************************************************
+ *                                     Trochili RTOS Kernel                                      *
+ *                                  Copyright(C) 2016 LIUXUMING                                  *
+ *                                       www.trochili.com                                        *
+ *************************************************************************************************/
+#include <string.h>
+
+#include "tcl.types.h"
+#include "tcl.config.h"
+#include "tcl.cpu.h"
+#include "tcl.debug.h"
+#include "tcl.kernel.h"
+#include "tcl.ipc.h"
+#include "tcl.rwlock.h"
+
+#if ((TCLC_IPC_ENABLE)&&(TCLC_IPC_MUTEX_ENABLE)&&(TCLC_IPC_RWLOCK_ENABLE))
+
+/*************************************************************************************************
+ *  : ̻߳д                                                                           *
+ *  : (1) pThread  ߳̽ṹַ                                                              *
+ *        (2) pRwLock  дṹַ                                                            *
+ *        (3) pHiRP    Ƿиȼ                                                      *
+ *  :                                                                                      *
+ *  ˵дͻ̵߳У߳ȼߵ컨ȼ             *
+ *        ߳ͬʱռлдʱͷκһȷָȼ                     *
+ *************************************************************************************************/
+static void AddLock(TThread* pThread, TRwLock* pRwLock, TBool* pHiRP)
+{
+    TState state;
+    TError error;
+
+    /* д߳Уȼ */
+    uObjListAddPriorityNode(&(pThread->LockList), &(pRwLock->LockNode));
+    pRwLock->Nest = 1U;
+    pRwLock->Writer = pThread;
+
+    /* ߳ȼûб̶ */
+    if (!(pThread->Property & THREAD_PROP_PRIORITY_FIXED))
+    {
+        /* ߳ȼAPI޸ */
+        pThread->Property &= ~(THREAD_PROP_PRIORITY_SAFE);
+
+        /* ߳̿Ѿռбֻ컨ȼʱ߳ȼ */
+        if (pThread->Priority > pRwLock->Priority)
+        {
+            state = uThreadSetPriority(pThread, pRwLock->Priority, eFalse, &error);
+            state = state;
+
+            /* д߳ʱҪ͵ǰ̱߳Ƚȼ */
+            if ((uKernelVariable.State == eThreadState) &&
+                    (pThread != uKernelVariable.CurrentThread) &&
+                    (pThread->Priority < uKernelVariable.CurrentThread->Priority))
+            {
+                *pHiRP = eTrue;
+            }
+        }
+    }
+}
+
+
+/*************************************************************************************************
+ *  : ߳ͷд                                                                           *
+ *  : (1) pThread ߳̽ṹַ                                                               *
+ *        (2) pRwLock дṹַ                                                             *
+ *        (3) pHiRP   Ƿиȼ                                                       *
+ *  :                                                                                      *
+ *  ˵߳ȼָʣȼΪʱָȼ                 *
+ *************************************************************************************************/
+static void RemoveLock(TThread* pThread, TRwLock* pRwLock, TBool* pHiRP)
+{
+    TState    state;
+    TPriority priority = TCLC_LOWEST_PRIORITY;
+    TObjNode* pHead;
+    TBool     nflag = eFalse;
+    TError    error;
+
+    /* д߳Ƴ */
+    pHead = pThread->LockList;
+    uObjListRemoveNode(&(pThread->LockList), &(pRwLock->LockNode));
+    pRwLock->Writer = (TThread*)0;
+    pRwLock->Nest = 0U;
+
+    /* ߳ȼûб̶ */
+    if (!(pThread->Property & THREAD_PROP_PRIORITY_FIXED))
+    {
+        if (pThread->LockList == (TObjNode*)0)
+        {
+            /* ̲߳ռκȼԱAPI޸ */
+            pThread->Property |= (THREAD_PROP_PRIORITY_SAFE);
+            priority = pThread->BasePriority;
+            nflag = eTrue;
+        }
+        else if (pHead == &(pRwLock->LockNode))
+        {
+            /* ֻƳͷʱ߳ȼſ½ */
+            priority = *((TPriority*)(pThread->LockList->Data));
+            if (priority > pThread->BasePriority)
+            {
+                priority = pThread->BasePriority;
+            }
+            nflag = eTrue;
+        }
+        else
+        {
+            nflag = eFalse;
+        }
+
+        if (nflag && (priority > pThread->Priority))
+        {
+            state = uThreadSetPriority(pThread, priority, eFalse, &error);
+            state = state;
+
+            /* ǰ߳ȼͺ󣬿ܲ߾ȼ */
+            if ((uKernelVariable.State == eThreadState) &&
+                    (pThread == uKernelVariable.CurrentThread))
+            {
+                uThreadCalcHiRP(&priority);
+                if (priority < uKernelVariable.CurrentThread->Priority)
+                {
+                    *pHiRP = eTrue;
+                }
+            }
+        }
+    }
+}
+
+
+/*************************************************************************************************
+ *  : ݶд״̬ͲԻѵȴ߳                                                   *
+ *  : (1) pRwLock  дṹַ                                                            *
+ *        (2) pHiRP    Ƿиȼ                                                      *
+ *  :                                                                                      *
+ *  ˵(1) ̵߳ȴʱֻΪΨһĶߺŰд                           *
+ *        (2) ȫͷźдȲ»ûжߵȴʱдһȴдߣ     *
+ *        (3) Ȳ»ûдߵȴʱȫȴĶ                               *
+ *************************************************************************************************/
+static void GrantWaiters(TRwLock* pRwLock, TBool* pHiRP)
+{
+    TIpcContext* pContext;
+    TThread* pThread;
+    TProperty property;
+
+    /* ʱֹ뿪УûлָʱѾЧ */
+    if ((pRwLock->Upgrader != (TThread*)0) &&
+            (pRwLock->Upgrader->IpcContext.Queue != &(pRwLock->Queue)))
+    {
+        pRwLock->Upgrader = (TThread*)0;
+    }
+
+    if (pRwLock->Writer == (TThread*)0)
+    {
+        property = pRwLock->Property;
+        if (pRwLock->Upgrader != (TThread*)0)
+        {
+            if (pRwLock->Readers == 1U)
+            {
+                pThread = pRwLock->Upgrader;
+                pRwLock->Upgrader = (TThread*)0;
+                pRwLock->Readers = 0U;
+                uIpcUnblockThread(&(pThread->IpcContext), eSuccess, IPC_ERR_NONE, pHiRP);
+                AddLock(pThread, pRwLock, pHiRP);
+            }
+        }
+        else if ((pRwLock->Readers == 0U) && (property & IPC_PROP_PRIMQ_AVAIL) &&
+                 ((property & IPC_PROP_WRITER_PREF) || (!(property & IPC_PROP_AUXIQ_AVAIL))))
+        {
+            pContext = (TIpcContext*)(pRwLock->Queue.PrimaryHandle->Owner);
+            uIpcUnblockThread(pContext, eSuccess, IPC_ERR_NONE, pHiRP);
+
+            pThread = (TThread*)(pContext->Owner);
+            AddLock(pThread, pRwLock, pHiRP);
+        }
+        else if ((property & IPC_PROP_AUXIQ_AVAIL) &&
+                 ((!(property & IPC_PROP_WRITER_PREF)) || (!(property & IPC_PROP_PRIMQ_AVAIL))))
+        {
+            while (pRwLock->Queue.AuxiliaryHandle != (TObjNode*)0)
+            {
+                pContext = (TIpcContext*)(pRwLock->Queue.AuxiliaryHandle->Owner);
+                uIpcUnblockThread(pContext, eSuccess, IPC_ERR_NONE, pHiRP);
+                pRwLock->Readers++;
+            }
+        }
+        else
+        {
+            pThread = (TThread*)0;
+        }
+    }
+}
+
+
+/*************************************************************************************************
+ *  : ߳ʽȴд                                                               *
+ *  : (1) pRwLock  дṹַ                                                            *
+ *        (2) option   ʶдģʽ                                                          *
+ *        (3) timeo    ʱģʽ·ʶдʱ޳                                        *
+ *        (4) pState                                                                     *
+ *        (5) pIMask   жμĴֵ                                                          *
+ *        (6) pError   ϸý                                                              *
+ *  :                                                                                      *
+ *  ˵ȴ߳̽븨Уȴд߳̽С                         *
+ *        ʱѾɻѷ߳                                                       *
+ *************************************************************************************************/
+static void WaitLock(TRwLock* pRwLock, TOption option, TTimeTick timeo, TState* pState,
+                     TReg32* pIMask, TError* pError)
+{
+    TIpcContext* pContext;
+
+    /* õǰ̵߳IPCĽṹַ */
+    pContext = &(uKernelVariable.CurrentThread->IpcContext);
+
+    /* 趨߳ڵȴԴϢ */
+    uIpcSaveContext(pContext, (void*)pRwLock, (void*)0, 0U, (option | IPC_OPT_RWLOCK), pState, pError);
+
+    /* ǰ߳ڸöд */
+    uIpcBlockThread(pContext, &(pRwLock->Queue), timeo);
+
+    /* ǰ̷߳ȣ̵ִ߳ */
+    uThreadSchedule();
+
+    CpuLeaveCritical(*pIMask);
+    /* ʱ˴һεȣǰ߳ѾIPCС
+       ʼִб̣߳ٴδ߳ʱӱС*/
+    CpuEnterCritical(pIMask);
+
+    /* ̹߳Ϣ */
+    uIpcCleanContext(pContext);
+}
+
+
+/*************************************************************************************************
+ *  : ̻߳ö                                                                           *
+ *  : (1) pRwLock  дṹַ                                                            *
+ *        (2) option   ʶдģʽ                                                          *
+ *        (3) timeo    ʱģʽ·ʶдʱ޳                                        *
+ *        (4) pError   ϸý                                                              *
+ *  : (1) eSuccess ɹ                                                                  *
+ *        (2) eFailure ʧ                                                                  *
+ *        (3) eError                                                                     *
+ *  ˵дʱ֮䲻ụдȲ£дߵȴʱµĶҲҪȴ           *
+ *************************************************************************************************/
+TState xRwLockRead(TRwLock* pRwLock, TOption option, TTimeTick timeo, TError* pError)
+{
+    TState state = eFailure;
+    TError error = IPC_ERR_UNREADY;
+    TReg32 imask;
+
+    CpuEnterCritical(&imask);
+
+    if ((pRwLock->Property & IPC_PROP_READY) && (uKernelVariable.State == eThreadState))
+    {
+        if ((pRwLock->Writer == (TThread*)0) &&
+                (!((pRwLock->Property & IPC_PROP_WRITER_PREF) &&
+                   (pRwLock->Property & IPC_PROP_PRIMQ_AVAIL))))
+        {
+            pRwLock->Readers++;
+            error = IPC_ERR_NONE;
+            state = eSuccess;
+        }
+        else
+        {
+            /* д */
+            error = IPC_ERR_FORBIDDEN;
+            if ((pRwLock->Writer != uKernelVariable.CurrentThread) &&
+                    (option & IPC_OPT_WAIT) && (uKernelVariable.Schedulable == eTrue))
+            {
+                WaitLock(pRwLock, option | IPC_OPT_USE_AUXIQ, timeo, &state, &imask, &error);
+            }
+        }
+    }
+
+    CpuLeaveCritical(imask);
+
+    *pError = error;
+    return state;
+}
+
+
+/*************************************************************************************************
+ *  : ̻߳д                                                                           *
+ *  : (1) pRwLock  дṹַ                                                            *
+ *        (2) option   ʶдģʽ                                                          *
+ *        (3) timeo    ʱģʽ·ʶдʱ޳                                        *
+ *        (4) pError   ϸý                                                              *
+ *  : (1) eSuccess ɹ                                                                  *
+ *        (2) eFailure ʧ                                                                  *
+ *        (3) eError                                                                     *
+ *  ˵дǶռСѾռж߳ӦʹһֱȴԼͷŶ       *
+ *************************************************************************************************/
+TState xRwLockWrite(TRwLock* pRwLock, TOption option, TTimeTick timeo, TError* pError)
+{
+    TState state = eFailure;
+    TError error = IPC_ERR_UNREADY;
+    TBool HiRP = eFalse;
+    TReg32 imask;
+
+    CpuEnterCritical(&imask);
+
+    if ((pRwLock->Property & IPC_PROP_READY) && (uKernelVariable.State == eThreadState))
+    {
+        if ((pRwLock->Writer == (TThread*)0) && (pRwLock->Readers == 0U) &&
+                (pRwLock->Upgrader == (TThread*)0))
+        {
+            AddLock(uKernelVariable.CurrentThread, pRwLock, &HiRP);
+            error = IPC_ERR_NONE;
+            state = eSuccess;
+        }
+        else if (pRwLock->Writer == uKernelVariable.CurrentThread)
+        {
+            pRwLock->Nest++;
+            error = IPC_ERR_NONE;
+            state = eSuccess;
+        }
+        else
+        {
+            error = IPC_ERR_FORBIDDEN;
+            if ((option & IPC_OPT_WAIT) && (uKernelVariable.Schedulable == eTrue))
+            {
+                WaitLock(pRwLock, option, timeo, &state, &imask, &error);
+
+                /* д߷ȴ󣬱סĶ߿ܿԻö */
+                if (state != eSuccess)
+                {
+                    GrantWaiters(pRwLock, &HiRP);
+                    uThreadPreempt(HiRP);
+                }
+            }
+        }
+    }
+
+    CpuLeaveCritical(imask);
+
+    *pError = error;
+    return state;
+}
+
+
+/*************************************************************************************************
+ *  : ߳ͷŶд                                                                   *
+ *  : (1) pRwLock  дṹַ                                                            *
+ *        (2) pError   ϸý                                                              *
+ *  : (1) eSuccess ɹ                                                                  *
+ *        (2) eFailure ʧ                                                                  *
+ *  ˵дͷд߳ͷŶ¼ߣ߱ȷʵռж       *
+ *************************************************************************************************/
+TState xRwLockFree(TRwLock* pRwLock, TError* pError)
+{
+    TState state = eFailure;
+    TError error = IPC_ERR_UNREADY;
+    TBool HiRP = eFalse;
+    TReg32 imask;
+
+    CpuEnterCritical(&imask);
+
+    if ((pRwLock->Property & IPC_PROP_READY) && (uKernelVariable.State == eThreadState))
+    {
+        error = IPC_ERR_NONE;
+        state = eSuccess;
+        if (pRwLock->Writer == uKernelVariable.CurrentThread)
+        {
+            pRwLock->Nest--;
+            if (pRwLock->Nest == 0U)
+            {
+                RemoveLock(uKernelVariable.CurrentThread, pRwLock, &HiRP);
+                GrantWaiters(pRwLock, &HiRP);
+            }
+        }
+        else if ((pRwLock->Writer == (TThread*)0) && (pRwLock->Readers > 0U))
+        {
+            pRwLock->Readers--;
+            GrantWaiters(pRwLock, &HiRP);
+        }
+        else
+        {
+            error = IPC_ERR_FORBIDDEN;
+            state = eFailure;
+        }
+
+        uThreadPreempt(HiRP);
+    }
+
+    CpuLeaveCritical(imask);
+
+    *pError = error;
+    return state;
+}
+
+
+/*************************************************************************************************
+ *  : ̰߳ռеĶΪд                                                             *
+ *  : (1) pRwLock  дṹַ                                                            *
+ *        (2) option   ʶдģʽ                                                          *
+ *        (3) timeo    ʱģʽ·ʶдʱ޳                                        *
+ *        (4) pError   ϸý                                                              *
+ *  : (1) eSuccess ɹ                                                                  *
+ *        (2) eFailure ʧ                                                                  *
+ *        (3) eError                                                                     *
+ *  ˵ȴڼ߳Ȼռжͬһʱֻһ̵߳ȴ߻ụ     *
+ *        ȴԷĶʧʱ߳Ȼռж                                             *
+ *************************************************************************************************/
+TState xRwLockUpgrade(TRwLock* pRwLock, TOption option, TTimeTick timeo, TError* pError)
+{
+    TState state = eFailure;
+    TError error = IPC_ERR_UNREADY;
+    TBool HiRP = eFalse;
+    TReg32 imask;
+
+    CpuEnterCritical(&imask);
+
+    if ((pRwLock->Property & IPC_PROP_READY) && (uKernelVariable.State == eThreadState))
+    {
+        error = IPC_ERR_FORBIDDEN;
+        if ((pRwLock->Writer == (TThread*)0) && (pRwLock->Readers > 0U) &&
+                (pRwLock->Upgrader == (TThread*)0))
+        {
+            if (pRwLock->Readers == 1U)
+            {
+                pRwLock->Readers = 0U;
+                AddLock(uKernelVariable.CurrentThread, pRwLock, &HiRP);
+                error = IPC_ERR_NONE;
+                state = eSuccess;
+            }
+            else if ((option & IPC_OPT_WAIT) && (uKernelVariable.Schedulable == eTrue))
+            {
+                pRwLock->Upgrader = uKernelVariable.CurrentThread;
+                WaitLock(pRwLock, option, timeo, &state, &imask, &error);
+
+                /* ʧʱȻǶߣס߳̿ܿԼ */
+                if (state != eSuccess)
+                {
+                    if (pRwLock->Upgrader == uKernelVariable.CurrentThread)
+                    {
+                        pRwLock->Upgrader = (TThread*)0;
+                    }
+                    GrantWaiters(pRwLock, &HiRP);
+                    uThreadPreempt(HiRP);
+                }
+            }
+            else
+            {
+                state = eFailure;
+            }
+        }
+    }
+
+    CpuLeaveCritical(imask);
+
+    *pError = error;
+    return state;
+}
+
+
+/*************************************************************************************************
+ *  : ̰߳ռедΪ                                                             *
+ *  : (1) pRwLock  дṹַ                                                            *
+ *        (2) pError   ϸý                                                              *
+ *  : (1) eSuccess ɹ                                                                  *
+ *        (2) eFailure ʧ                                                                  *
+ *  ˵ǶռедܽȴĶ߿԰ղһö                       *
+ *************************************************************************************************/
+TState xRwLockDowngrade(TRwLock* pRwLock, TError* pError)
+{
+    TState state = eFailure;
+    TError error = IPC_ERR_UNREADY;
+    TBool HiRP = eFalse;
+    TReg32 imask;
+
+    CpuEnterCritical(&imask);
+
+    if ((pRwLock->Property & IPC_PROP_READY) && (uKernelVariable.State == eThreadState))
+    {
+        if ((pRwLock->Writer == uKernelVariable.CurrentThread) && (pRwLock->Nest == 1U))
+        {
+            RemoveLock(uKernelVariable.CurrentThread, pRwLock, &HiRP);
+            pRwLock->Readers = 1U;
+            GrantWaiters(pRwLock, &HiRP);
+            uThreadPreempt(HiRP);
+
+            error = IPC_ERR_NONE;
+            state = eSuccess;
+        }
+        else
+        {
+            error = IPC_ERR_FORBIDDEN;
+        }
+    }
+
+    CpuLeaveCritical(imask);
+
+    *pError = error;
+    return state;
+}
+
+
+/*************************************************************************************************
+ *  : дʼ                                                                       *
+ *  : (1) pRwLock  дṹַ                                                            *
+ *        (2) pError   ϸý                                                              *
+ *  : (1) eSuccess ɹ                                                                  *
+ *        (2) eFailure ʧ                                                                  *
+ *  ˵                                                                                       *
+ *************************************************************************************************/
+TState xRwLockDelete(TRwLock* pRwLock, TError* pError)
+{
+    TState state = eFailure;
+    TError error = IPC_ERR_UNREADY;
+    TReg32 imask;
+    TBool HiRP = eFalse;
+
+    CpuEnterCritical(&imask);
+
+    if (pRwLock->Property & IPC_PROP_READY)
+    {
+        /* д̵߳Ƴ */
+        if (pRwLock->Writer != (TThread*)0)
+        {
+            RemoveLock(pRwLock->Writer, pRwLock, &HiRP);
+        }
+
+        /* ϵеȴ̶߳ͷţ̵߳ĵȴIPC_ERR_DELETE */
+        uIpcUnblockAll(&(pRwLock->Queue), eFailure, IPC_ERR_DELETE, (void**)0, &HiRP);
+
+        /* дȫ */
+        memset(pRwLock, 0U, sizeof(TRwLock));
+
+        /* Է߳ռ */
+        uThreadPreempt(HiRP);
+
+        error = IPC_ERR_NONE;
+        state = eSuccess;
+    }
+
+    CpuLeaveCritical(imask);
+
+    *pError = error;
+    return state;
+}
+
+
+/*************************************************************************************************
+ *  : öд                                                                             *
+ *  : (1) pRwLock  дṹַ                                                            *
+ *        (2) pError   ϸý                                                              *
+ *  : (1) eSuccess ɹ                                                                  *
+ *        (2) eFailure ʧ                                                                  *
+ *  ˵дȫ                                                                     *
+ *************************************************************************************************/
+TState xRwLockReset(TRwLock* pRwLock, TError* pError)
+{
+    TState state = eFailure;
+    TError error = IPC_ERR_UNREADY;
+    TReg32 imask;
+    TBool HiRP = eFalse;
+
+    CpuEnterCritical(&imask);
+
+    if (pRwLock->Property & IPC_PROP_READY)
+    {
+        /* д̵߳Ƴ */
+        if (pRwLock->Writer != (TThread*)0)
+        {
+            RemoveLock(pRwLock->Writer, pRwLock, &HiRP);
+        }
+
+        /* ϵеȴ̶߳ͷţ̵߳ĵȴIPC_ERR_RESET */
+        uIpcUnblockAll(&(pRwLock->Queue), eFailure, IPC_ERR_RESET, (void**)0, &HiRP);
+
+        pRwLock->Property &= IPC_RESET_RWLOCK_PROP;
+        pRwLock->Readers  = 0U;
+        pRwLock->Upgrader = (TThread*)0;
+
+        /* Է߳ռ */
+        uThreadPreempt(HiRP);
+
+        error = IPC_ERR_NONE;
+        state = eSuccess;
+    }
+
+    CpuLeaveCritical(imask);
+
+    *pError = error;
+    return state;
+}
+
+
+/*************************************************************************************************
+ *  ܣдֹ,дϵ߳ȫֹ                          *
+ *  (1) pRwLock  дṹַ                                                            *
+ *        (2) pError   ϸý                                                              *
+ *  : (1) eSuccess ɹ                                                                  *
+ *        (2) eFailure ʧ                                                                  *
+ *  ˵                                                                                       *
+ *************************************************************************************************/
+TState xRwLockFlush(TRwLock* pRwLock, TError* pError)
+{
+    TState state = eFailure;
+    TError error = IPC_ERR_UNREADY;
+    TReg32 imask;
+    TBool HiRP = eFalse;
+
+    CpuEnterCritical(&imask);
+
+    if (pRwLock->Property & IPC_PROP_READY)
+    {
+        /* дϵеȴ̶߳ͷţ̵߳ĵȴTCLE_IPC_FLUSH  */
+        uIpcUnblockAll(&(pRwLock->Queue), eFailure, IPC_ERR_FLUSH, (void**)0, &HiRP);
+
+        /* Է߳ռ */
+        uThreadPreempt(HiRP);
+
+        state = eSuccess;
+        error = IPC_ERR_NONE;
+    }
+
+    CpuLeaveCritical(imask);
+
+    *pError = error;
+    return state;
+}
+
+
+/*************************************************************************************************
+ *  : ʼд                                                                           *
+ *  : (1) pRwLock  дṹַ                                                            *
+ *        (2) priority дȼ컨                                                        *
+ *        (3) property дĳʼ                                                          *
+ *        (4) pError   ϸý                                                              *
+ *  : (1) eSuccess ɹ                                                                  *
+ *        (2) eFailure ʧ                                                                  *
+ *  ˵컨ȼֻдߣ߱ȼ                                 *
+ *************************************************************************************************/
+TState xRwLockCreate(TRwLock* pRwLock, TPriority priority, TProperty property, TError* pError)
+{
+    TState state = eFailure;
+    TError error = IPC_ERR_FAULT;
+    TReg32 imask;
+
+    CpuEnterCritical(&imask);
+
+    if (!(pRwLock->Property & IPC_PROP_READY))
+    {
+        property |= IPC_PROP_READY;
+        pRwLock->Property = property;
+        pRwLock->Writer   = (TThread*)0;
+        pRwLock->Nest     = 0U;
+        pRwLock->Readers  = 0U;
+        pRwLock->Upgrader = (TThread*)0;
+        pRwLock->Priority = priority;
+
+        uIpcInitQueue(&(pRwLock->Queue), &(pRwLock->Property));
+
+        pRwLock->LockNode.Owner  = (void*)pRwLock;
+        pRwLock->LockNode.Data   = (TBase32*)(&(pRwLock->Priority));
+        pRwLock->LockNode.Next   = (TObjNode*)0;
+        pRwLock->LockNode.Prev   = (TObjNode*)0;
+        pRwLock->LockNode.Handle = (TObjNode**)0;
+
+        error = IPC_ERR_NONE;
+        state = eSuccess;
+    }
+
+    CpuLeaveCritical(imask);
+
+    *pError = error;
+    return state;
+}
+
+#endif
+
@@ -26,7 +26,7 @@ static TState ReleaseSemaphore(TSemaphore* pSemaphore, TOption option, TTimeTick
 /*************************************************************************************************
  *  : Իüź                                                                     *
  *  : (1) pSemaphore źṹַ                                                      *
- *        (2) pHiRP     ǷѸȼҪ̵߳ȵı                        *
+ *        (2) pHiRP     ǷѸȼҪ̵߳ȵı                         *
  *        (3) pErrno     ϸý                                                            *
  *  : (1) eSuccess   ɹ                                                                *
  *        (2) eFailure   ʧ                                                                *
@@ -127,7 +127,7 @@ static TState ObtainSemaphore(TSemaphore* pSemaphore, TOption option, TTimeTick
                 pContext = &(uKernelVariable.CurrentThread->IpcContext);
 
                 /* 趨߳ڵȴԴϢ */
-                uIpcSaveContext(pContext, (void*)pSemaphore, 0U, 0U, option | IPC_OPT_SEMAPHORE,
+                uIpcSaveContext(pContext, (void*)pSemaphore, (void*)0, 0U, option | IPC_OPT_SEMAPHORE,
                                 &state, pErrno);
 
                 /* ǰ߳ڸź */
@@ -249,7 +249,7 @@ static TState ReleaseSemaphore(TSemaphore* pSemaphore, TOption option, TTimeTick
                 pContext = &(uKernelVariable.CurrentThread->IpcContext);
 
                 /* 趨߳ڵȴԴϢ */
-                uIpcSaveContext(pContext, (void*)pSemaphore, 0U, 0U, option | IPC_OPT_SEMAPHORE,
+                uIpcSaveContext(pContext, (void*)pSemaphore, (void*)0, 0U, option | IPC_OPT_SEMAPHORE,
                                 &state, pErrno);
 
                 /* ǰ߳ڸźŵУʱ޻޵ȴtimeo */
@@ -380,9 +380,7 @@ TState xSemaphoreCreate(TSemaphore* pSemaphore, TBase32 value, TBase32 mvalue,
         pSemaphore->Value        = value;
         pSemaphore->LimitedValue = mvalue;
         pSemaphore->InitialValue = value;
-        pSemaphore->Queue.PrimaryHandle   = (TObjNode*)0;
-        pSemaphore->Queue.AuxiliaryHandle = (TObjNode*)0;
-        pSemaphore->Queue.Property        = &(pSemaphore->Property);
+        uIpcInitQueue(&(pSemaphore->Queue), &(pSemaphore->Property));
 
         error = IPC_ERR_NONE;
         state = eSuccess;
@@ -514,5 +512,25 @@ TState xSemaphoreFlush(TSemaphore* pSemaphore, TError* pErrno)
     return state;
 }
 
+
+#if (TCLC_IPC_WAITANY_ENABLE)
+/*************************************************************************************************
+ *  : ȴʱԻüź                                                         *
+ *  : (1) pSemaphore źṹַ                                                      *
+ *        (2) pHiRP      ǷѸȼҪ̵߳ȵı                        *
+ *        (3) pError     ϸý                                                            *
+ *  : (1) eSuccess ɹ                                                                  *
+ *        (2) eFailure ʧ                                                                  *
+ *  ˵ֻ߳ͬʱȴIPCʱ                                                    *
+ *************************************************************************************************/
+TState uSemaphoreTryObtain(TSemaphore* pSemaphore, TBool* pHiRP, TError* pError)
+{
+    TState state;
+
+    state = TryObtainSemaphore(pSemaphore, pHiRP, pError);
+    return state;
+}
+#endif
+
 #endif
 
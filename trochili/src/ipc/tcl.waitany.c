@@ -0,0 +1,289 @@
+/*************************************************************************************************
+ *                                     Trochili RTOS Kernel                                      *
+ *                                  Copyright(C) 2016 LIUXUMING                                  *
+ *                                       www.trochili.com                                        *
+ *************************************************************************************************/
+#include "tcl.types.h"
+#include "tcl.config.h"
+#include "tcl.cpu.h"
+#include "tcl.debug.h"
+#include "tcl.thread.h"
+#include "tcl.kernel.h"
+#include "tcl.ipc.h"
+#include "tcl.semaphore.h"
+#include "tcl.mailbox.h"
+#include "tcl.message.h"
+#include "tcl.flags.h"
+#include "tcl.waitany.h"
+
+#if ((TCLC_IPC_ENABLE)&&(TCLC_IPC_WAITANY_ENABLE))
+
+/*************************************************************************************************
+ *  : õIPC߳                                                              *
+ *  : (1) pItem    IPCṹַ                                                       *
+ *  : IPC߳еַЧ߶ûгʼ򷵻ؿָ              *
+ *  ˵                                                                                       *
+ *************************************************************************************************/
+static TIpcQueue* GetItemQueue(TIpcWaitItem* pItem)
+{
+    TIpcQueue* pQueue = (TIpcQueue*)0;
+    TProperty property = IPC_PROPERTY;
+
+    switch (pItem->Type)
+    {
+#if (TCLC_IPC_SEMAPHORE_ENABLE)
+        case eWaitSemaphore:
+            property = ((TSemaphore*)(pItem->Object))->Property;
+            pQueue = &(((TSemaphore*)(pItem->Object))->Queue);
+            break;
+#endif
+#if (TCLC_IPC_MAILBOX_ENABLE)
+        case eWaitMailBox:
+            property = ((TMailBox*)(pItem->Object))->Property;
+            pQueue = &(((TMailBox*)(pItem->Object))->Queue);
+            break;
+#endif
+#if (TCLC_IPC_MQUE_ENABLE)
+        case eWaitMsgQueue:
+            property = ((TMsgQueue*)(pItem->Object))->Property;
+            pQueue = &(((TMsgQueue*)(pItem->Object))->Queue);
+            break;
+#endif
+#if (TCLC_IPC_FLAGS_ENABLE)
+        case eWaitFlags:
+            property = ((TFlags*)(pItem->Object))->Property;
+            pQueue = &(((TFlags*)(pItem->Object))->Queue);
+            break;
+#endif
+        default:
+            break;
+    }
+
+    if (!(property & IPC_PROP_READY))
+    {
+        pQueue = (TIpcQueue*)0;
+    }
+
+    return pQueue;
+}
+
+
+/*************************************************************************************************
+ *  : ԴָIPC                                                              *
+ *  : (1) pItem    IPCṹַ                                                       *
+ *        (2) pHiRP    ǷѸȼҪ̵߳ȵı                          *
+ *        (3) pError   ϸý                                                              *
+ *  : (1) eSuccess ɹ                                                                  *
+ *        (2) eFailure ʧ                                                                  *
+ *  ˵IPCĽղʱȫͬ                                              *
+ *************************************************************************************************/
+static TState TryReceiveItem(TIpcWaitItem* pItem, TBool* pHiRP, TError* pError)
+{
+    TState state = eFailure;
+
+    switch (pItem->Type)
+    {
+#if (TCLC_IPC_SEMAPHORE_ENABLE)
+        case eWaitSemaphore:
+            state = uSemaphoreTryObtain((TSemaphore*)(pItem->Object), pHiRP, pError);
+            break;
+#endif
+#if (TCLC_IPC_MAILBOX_ENABLE)
+        case eWaitMailBox:
+            state = uMailBoxTryReceive((TMailBox*)(pItem->Object), (TMail*)(pItem->Data),
+                                       pHiRP, pError);
+            break;
+#endif
+#if (TCLC_IPC_MQUE_ENABLE)
+        case eWaitMsgQueue:
+            state = uMsgQueueTryReceive((TMsgQueue*)(pItem->Object), (TMessage*)(pItem->Data),
+                                        pHiRP, pError);
+            break;
+#endif
+#if (TCLC_IPC_FLAGS_ENABLE)
+        case eWaitFlags:
+            state = uFlagsTryReceive((TFlags*)(pItem->Object), (TFlagMask*)(pItem->Data),
+                                     pItem->Option, pError);
+            break;
+#endif
+        default:
+            break;
+    }
+
+    return state;
+}
+
+
+/*************************************************************************************************
+ *  : 趨ָ߳IPCʱʹõ                                              *
+ *  : (1) pItem    IPCṹַ                                                       *
+ *        (2) pQueue   IPC߳                                                     *
+ *        (3) option   ȴʽ                                                                  *
+ *  :                                                                                      *
+ *  ˵ĵ趨ʽʸIPCʱͬԻ̵߳һҪ        *
+ *************************************************************************************************/
+static void SaveItemContext(TIpcWaitItem* pItem, TIpcQueue* pQueue, TOption option)
+{
+    TIpcContext* pContext = &(pItem->Context);
+    void* pData = (void*)0;
+    TBase32 len = 0U;
+
+    switch (pItem->Type)
+    {
+        case eWaitSemaphore:
+            option |= IPC_OPT_SEMAPHORE;
+            break;
+        case eWaitMailBox:
+            option |= IPC_OPT_MAILBOX | IPC_OPT_READ_DATA;
+            pData = pItem->Data;
+            len = sizeof(TBase32);
+            break;
+        case eWaitMsgQueue:
+            option |= IPC_OPT_MSGQUEUE | IPC_OPT_READ_DATA;
+            pData = pItem->Data;
+            len = sizeof(TBase32);
+            break;
+        default:
+            option |= IPC_OPT_FLAGS | (pItem->Option & (IPC_OPT_AND | IPC_OPT_OR | IPC_OPT_CONSUME));
+            pData = pItem->Data;
+            len = sizeof(TBase32);
+            break;
+    }
+
+    uIpcInitContext(pContext, (void*)(uKernelVariable.CurrentThread));
+    uIpcSaveContext(pContext, pItem->Object, pData, len, option, &(pItem->State), &(pItem->Error));
+    pContext->Queue = pQueue;
+}
+
+
+/*************************************************************************************************
+ *  : ߳ͬʱȴIPC                                                                *
+ *  : (1) pItems   IPCṹ                                                       *
+ *        (2) number   IPCĿ                                                             *
+ *        (3) pIndex   ʹ̷߳صIPCе                                     *
+ *        (4) option   ȴʽ                                                                  *
+ *        (5) timeo    ʱ޵ȴʽµĵȴʱ                                                  *
+ *        (6) pError   ϸý                                                              *
+ *  : (1) eSuccess ɹ                                                                  *
+ *        (2) eFailure ʧ                                                                  *
+ *  ˵Ȱ˳ÿIPC󣬵һĶɽղ̷أ                *
+ *        ߳ͬʱȫIPCУĸȻ̣߳ɻ̵߳һ      *
+ *        ֱɸöĽղ߳ͬʱ뿪С                             *
+ *        ͬһIPCֻܳһ                                                      *
+ *************************************************************************************************/
+TState xIpcWaitAny(TIpcWaitItem* pItems, TBase32 number, TIndex* pIndex,
+                   TOption option, TTimeTick timeo, TError* pError)
+{
+    TState state = eFailure;
+    TError error = IPC_ERR_UNREADY;
+    TBool HiRP = eFalse;
+    TIpcContext* pContext;
+    TIpcContext* pPrevious;
+    TIpcQueue* pQueue;
+    TIndex i;
+    TReg32 imask;
+
+    CpuEnterCritical(&imask);
+
+    /* ̴ֻ߳ñ */
+    if (uKernelVariable.State == eThreadState)
+    {
+        /* ȫIPCǷѾʼ */
+        for (i = 0U; i < number; i++)
+        {
+            if (GetItemQueue(&(pItems[i])) == (TIpcQueue*)0)
+            {
+                break;
+            }
+        }
+
+        if (i == number)
+        {
+            /* γÿIPC󣬵һĶɽղ */
+            for (i = 0U; i < number; i++)
+            {
+                state = TryReceiveItem(&(pItems[i]), &HiRP, &error);
+                if (state == eSuccess)
+                {
+                    *pIndex = i;
+                    break;
+                }
+            }
+
+            if (uKernelVariable.Schedulable == eTrue)
+            {
+                /* ǰ̻߳˸ȼ߳е */
+                if (state == eSuccess)
+                {
+                    if (HiRP == eTrue)
+                    {
+                        uThreadSchedule();
+                    }
+                }
+                else
+                {
+                    if (option & IPC_OPT_WAIT)
+                    {
+                        /* ߳ԴĲκУͨSiblingԱÿ */
+                        pContext = &(uKernelVariable.CurrentThread->IpcContext);
+                        uIpcSaveContext(pContext, (void*)pItems, (void*)0, number,
+                                        option | IPC_OPT_WAITANY, &state, &error);
+
+                        pPrevious = pContext;
+                        for (i = 0U; i < number; i++)
+                        {
+                            pQueue = GetItemQueue(&(pItems[i]));
+                            SaveItemContext(&(pItems[i]), pQueue, option | IPC_OPT_WAITANY);
+                            pPrevious->Sibling = &(pItems[i].Context);
+                            pPrevious = pPrevious->Sibling;
+                        }
+
+                        /* ǰ߳ͬʱȫIPC */
+                        uIpcBlockThreadAny(pContext, timeo);
+#if ((TCLC_IPC_FLAGS_ENABLE) && (TCLC_IPC_FLAGS_INDEX_ENABLE))
+                        for (i = 0U; i < number; i++)
+                        {
+                            if (pItems[i].Type == eWaitFlags)
+                            {
+                                uFlagsEnterIndex(&(pItems[i].Context));
+                            }
+                        }
+#endif
+
+                        /* ǰ߳ȣִ̼߳ */
+                        uThreadSchedule();
+
+                        CpuLeaveCritical(imask);
+                        /* ʱ˴һεȣǰ߳ѾڶIPCС
+                           ٴδ߳ʱӱС*/
+                        CpuEnterCritical(&imask);
+
+                        /* ߳ǱĳIPCѵģöķʽǱĽ
+                           ߳Ϊʱ߱ǿƽ */
+                        for (i = 0U; i < number; i++)
+                        {
+                            if (pItems[i].State != eError)
+                            {
+                                state = pItems[i].State;
+                                error = pItems[i].Error;
+                                *pIndex = i;
+                            }
+                            uIpcCleanContext(&(pItems[i].Context));
+                        }
+
+                        /* ߳IPCϢ */
+                        uIpcCleanContext(pContext);
+                    }
+                }
+            }
+        }
+    }
+
+    CpuLeaveCritical(imask);
+
+    *pError = error;
+    return state;
+}
+
+#endif
+
@@ -9,6 +9,7 @@
 #include "tcl.types.h"
 #include "tcl.cpu.h"
 #include "tcl.debug.h"
+#include "tcl.trace.h"
 #include "tcl.mem.buddy.h"
 
 #if ((TCLC_MEMORY_ENABLE) && (TCLC_MEMORY_BUDDY_ENABLE))
@@ -17,261 +18,140 @@
 #define BUDDY_PROP_NONE           (0x0)                  /* BUDDYԱ                     */
 #define BUDDY_PROP_READY          (0x1<<0U)              /* BUDDY                       */
 
-#define PAGES_AVAIL (0x1<<7u)
+/* ڴҳǶ壬ֻڴҳбǣ5λڴĽ */
+#define BUDDY_TAG_FREE            (0x1<<7U)              /* ڴҳ                    */
+#define BUDDY_TAG_USED            (0x1<<6U)              /* ѷڴҳ                  */
+#define BUDDY_TAG_ORDER           (0x1FU)
 
-#define PARENT_NODE(x) (((x) - 1u) / 2u)
-#define LEFT_NODE(x) ((x) * 2u + 1u)
-#define RIGHT_NODE(x) ((x) * 2u + 2u)
+/* xλbitıţxΪ0 */
+#define FFS(x)                    ((TBase32)CpuCalcHiPRIO(x))
 
-/* xҲС2 */
-static TBase32 clp2(TBase32 x)
-{
-    x = x - 1U;
-    x = x | (x >> 1U);
-    x = x | (x >> 2U);
-    x = x | (x >> 4U);
-    x = x | (x >> 8U);
-    x = x | (x >> 16U);
-    return (x + 1U);
-}
+/* 㲻СpagesС2Ľ */
+#define CEIL_ORDER(pages)         (((pages) <= 1U) ? 0U : (32U - CpuCountLeadZeros((pages) - 1U)))
 
-/* xҲ2 */
-static TBase32 flp2(TBase32 x)
-{
-    x = x | (x >> 1U);
-    x = x | (x >> 2U);
-    x = x | (x >> 4U);
-    x = x | (x >> 8U);
-    x = x | (x >> 16U);
-    return (x - (x >> 1U));
-}
+/* 㲻pages2ĽpagesΪ0 */
+#define FLOOR_ORDER(pages)        (31U - CpuCountLeadZeros(pages))
 
-/* x2Ϊ׵Ķ */
-static TBase32 log2(TBase32 x)
-{
-    TBase32 i = 0;
-    while (!(x &0x1))
-    {
-        i++;
-        x = x >> 1;
-    }
+#define PAGE_NODE(pBuddy, index)  ((TBuddyNode*)((pBuddy)->PageAddr + (index) * (pBuddy)->PageSize))
+#define NODE_PAGE(pBuddy, pNode)  (((TChar*)(pNode) - (pBuddy)->PageAddr) / (pBuddy)->PageSize)
 
-    return i;
-}
 
-/* 2x */
-static TBase32 power2(TBase32 x)
+/*************************************************************************************************
+ *  ܣѿڴӦĿ                                                     *
+ *  (1) pBuddy    ϵͳַ                                                   *
+ *        (2) index     ڴʼҳ                                                     *
+ *        (3) order     ڴĽ                                                         *
+ *  :                                                                                      *
+ *  ˵                                                                                       *
+ *************************************************************************************************/
+static void PushBlock(TMemBuddy* pBuddy, TBase32 index, TBase32 order)
 {
-    TBase32 i = 1;
-    while (x)
+    TBuddyNode* pNode;
+    TBuddyNode* pHead;
+
+    pNode = PAGE_NODE(pBuddy, index);
+    pHead = pBuddy->FreeList[order];
+    pNode->Next = pHead;
+    pNode->Prev = (TBuddyNode*)0;
+    if (pHead != (TBuddyNode*)0)
     {
-        i = i << 1;
-        x--;
+        pHead->Prev = pNode;
     }
-
-    return i;
+    pBuddy->FreeList[order] = pNode;
+    pBuddy->OrderMap |= (0x1U << order);
+    pBuddy->PageTags[index] = (TByte)(BUDDY_TAG_FREE | order);
 }
 
 
 /*************************************************************************************************
- *  ܣÿڵڴҳ                                                       *
- *  (1) pBuddy  ϵͳַ                                                         *
+ *  ܣѿڴӶӦĿƳ                                                 *
+ *  (1) pBuddy    ϵͳַ                                                   *
+ *        (2) index     ڴʼҳ                                                     *
+ *        (3) order     ڴĽ                                                         *
  *  :                                                                                      *
- *  ˵                                                                                       *
+ *  ˵˫Ƴһڵ㶼Ҫ                                                 *
  *************************************************************************************************/
-static void BuildPageTree(TMemBuddy* pBuddy)
+static void PullBlock(TMemBuddy* pBuddy, TBase32 index, TBase32 order)
 {
-    TIndex node;
-    TBase32 logn;
-    TBase32 x;
-    TBase32 y;
-
-    /* Ľڵ */
-    pBuddy->NodeNbr  = pBuddy->PageNbr * 2u  - 1u;
-
-    /* ÿڵҳ(2Ϊ׵Ķʾ) */
-    logn = log2(pBuddy->PageNbr) & 0x3f;
-    node = 0U;
-    for (y = 0; y <= logn; y++)
+    TBuddyNode* pNode;
+
+    pNode = PAGE_NODE(pBuddy, index);
+    if (pNode->Next != (TBuddyNode*)0)
     {
-        x = (pBuddy->PageNbr >> (logn - y));
-        while (x--)
+        pNode->Next->Prev = pNode->Prev;
+    }
+    if (pNode->Prev != (TBuddyNode*)0)
+    {
+        pNode->Prev->Next = pNode->Next;
+    }
+    else
+    {
+        pBuddy->FreeList[order] = pNode->Next;
+        if (pNode->Next == (TBuddyNode*)0)
         {
-            pBuddy->NodeTags[node] = ((logn - y) | PAGES_AVAIL);
-            node++;
+            pBuddy->OrderMap &= ~(0x1U << order);
         }
     }
+    pBuddy->PageTags[index] = 0U;
 }
 
 
-static int GetAvailPages(TMemBuddy* pBuddy)
-{
-    TByte tag;
-    tag = pBuddy->NodeTags[0];
-    if (tag & PAGES_AVAIL)
-    {
-        return power2(tag & 0x3f);
-    }
-    return 0;
-}
-
 /*************************************************************************************************
- *  ܣӻзһĿҳ                                                         *
+ *  ܣӻзһڴ                                                     *
  *  (1) pBuddy    ϵͳַ                                                   *
- *        (2) pages     Ҫڴҳ                                                       *
- *        (3) index     õڴҳ                                                       *
- *  : (1) 䵽ҳı                                                                 *
- *  ˵                                                                                       *
+ *        (2) order     ҪڴĽ                                                   *
+ *  : 䵽ڴʼҳ                                                               *
+ *  ˵֤߱OrderMapдڲСorderķǿսͨλͼҵСĿýȡ      *
+ *        ׽ڵ㣬ٰѶĲ𼶶԰ֹһؿ                                     *
  *************************************************************************************************/
-static TBase32 MallocPages(TMemBuddy* pBuddy, TBase32 pages)
+static TBase32 MallocPages(TMemBuddy* pBuddy, TBase32 order)
 {
     TBase32 index;
-    TBase32 lvl;
-    TBase32 node;
-    TByte tag;
-    TByte logn;
-
-    TByte ltag;
-    TByte rtag;
-    TByte llogn;
-    TByte rlogn;
-
-    /* pagesӦ2Ϊ׵Ķ */
-    logn = log2(pages);
+    TBase32 avail;
 
-    /* Ҫ(root) */
-    lvl = log2(pBuddy->PageNbr) - logn;
+    avail = FFS(pBuddy->OrderMap & (~0U << order));
+    index = NODE_PAGE(pBuddy, pBuddy->FreeList[avail]);
+    PullBlock(pBuddy, index, avail);
 
-    /* Ӹڵ㿪ʼlvlΣҵɹĽڵ */
-    node = 0U;
-    while (lvl--)
+    while (avail > order)
     {
-        tag = (pBuddy->NodeTags[LEFT_NODE(node)]);
-        if ((tag & PAGES_AVAIL) && ((tag & 0x3f) >= logn))
-        {
-            node = LEFT_NODE(node);
-        }
-        else
-        {
-            node = RIGHT_NODE(node);
-        }
-    }
-
-    /* ȡýڵڴҳ */
-    pBuddy->NodeTags[node] = 0U;
-
-    /* ͨڵżڴҳ */
-    index = (node + 1u) * pages - pBuddy->PageNbr;
-
-    /* ݵڵ·ϵнڵĿɷڴҳ(ע·ϵȫڵ) */
-    while (node)
-    {
-        node  = PARENT_NODE(node);
-        ltag = pBuddy->NodeTags[LEFT_NODE(node)];
-        rtag = pBuddy->NodeTags[RIGHT_NODE(node)];
-        if ((ltag & PAGES_AVAIL) && (rtag & PAGES_AVAIL))
-        {
-            llogn = (ltag & 0x3f);
-            rlogn = (rtag & 0x3f);
-            tag   = (llogn > rlogn) ? llogn : rlogn;
-            tag   |= PAGES_AVAIL;
-        }
-        else if (ltag & PAGES_AVAIL)
-        {
-            tag = ltag;
-        }
-        else if (rtag & PAGES_AVAIL)
-        {
-            tag = rtag;
-        }
-        else
-        {
-            tag = 0U;
-        }
-
-        pBuddy->NodeTags[node] = tag;
+        avail--;
+        PushBlock(pBuddy, index + (0x1U << avail), avail);
     }
 
+    pBuddy->PageTags[index] = (TByte)(BUDDY_TAG_USED | order);
     return index;
 }
 
 
 /*************************************************************************************************
- *  ܣֹ߳ͨ,̴ָֹ߳                                  *
+ *  ܣͷڴ鲢Һͻϲ                                                   *
  *  (1) pBuddy    ϵͳַ                                                   *
- *        (2) index     ͷŵĶڴҳʼҳ                                             *
+ *        (2) index     ͷŵڴʼҳ                                                 *
+ *        (3) order     ͷŵڴĽ                                                     *
  *  :                                                                                      *
- *  ˵                                                                                       *
+ *  ˵ҳŵindex ^ (1 << order)ֻлͬ׵Ŀڴʱźϲ                 *
  *************************************************************************************************/
-static TBase32 FreePages(TMemBuddy* pBuddy, TBase32 index)
+static void FreePages(TMemBuddy* pBuddy, TBase32 index, TBase32 order)
 {
-    TBase32 pages;
-    TBase32 node;
-    TByte tag;
-    TByte logn;
-    TBase32 lvl;
-
-    TByte ltag;
-    TByte rtag;
-    TByte llogn;
-    TByte rlogn;
-
-    /* ڵ2Ϊ׵Ķ */
-    lvl = log2(pBuddy->PageNbr);
-
-    /* ͨڴҳŻҶӽڵ */
-    node = index + pBuddy->PageNbr - 1u;
+    TBase32 buddy;
 
-    /* ͨҶӽڵϻݲҷʼڴҳĽڵ, ȶԴΪ */
-    for (logn = 0; logn <= lvl; logn++)
+    while (order < (MEM_BUDDY_ORDERS - 1U))
     {
-        /* ҵڴ(n)ҳǸڵ */
-        if (!(pBuddy->NodeTags[node] & PAGES_AVAIL))
+        buddy = index ^ (0x1U << order);
+        if ((buddy >= pBuddy->PageNbr) ||
+                (pBuddy->PageTags[buddy] != (TByte)(BUDDY_TAG_FREE | order)))
         {
             break;
         }
-        node = PARENT_NODE(node);
-    }
-
-    /* ոڴ(n)ҳ,¼Թڴҳ */
-    pBuddy->NodeTags[node] = ((logn & 0x3f) | PAGES_AVAIL);
-    pages = power2(logn);
-
-    /* Խнлڵϲ,Ҫһֱrootڵ㡣
-       ǸڵҪ² */
-    while (node)
-    {
-        node = PARENT_NODE(node);
-        logn++;
-        ltag = pBuddy->NodeTags[LEFT_NODE(node)];
-        rtag = pBuddy->NodeTags[RIGHT_NODE(node)];
 
-        if ((ltag &PAGES_AVAIL) && (rtag &PAGES_AVAIL))
-        {
-            llogn = (ltag &0x3f);
-            rlogn = (rtag &0x3f);
-            if (power2(llogn) + power2(rlogn) == power2(logn))
-            {
-                tag = ((logn &0x3f) | PAGES_AVAIL);
-            }
-            else
-            {
-                tag = (llogn > rlogn) ? llogn : rlogn;
-                tag |= PAGES_AVAIL;
-            }
-        }
-        else if (ltag &PAGES_AVAIL)
-        {
-            tag = ltag;
-        }
-        else //if (rtag &PAGES_AVAIL)
-        {
-            tag = rtag;
-        }
-        pBuddy->NodeTags[node] = tag;
+        PullBlock(pBuddy, buddy, order);
+        pBuddy->PageTags[index] = 0U;
+        index &= buddy;
+        order++;
     }
 
-    return pages;
+    PushBlock(pBuddy, index, order);
 }
 
 
@@ -279,43 +159,51 @@ static TBase32 FreePages(TMemBuddy* pBuddy, TBase32 index)
  *  ܣʼڴƽṹ                                                             *
  *  (1) pBuddy    ϵͳڴַ                                                   *
  *        (2) pAddr     ɹڴַ                                                       *
- *        (3) pagesize  ڴҳС                                                               *
- *        (4) pages     ɹڴҳ                                                     *
- *        (5) pError    ϸý                                                             *
+ *        (3) pages     ɹڴҳ                                                     *
+ *        (4) pagesize  ڴҳС                                                               *
+ *        (5) pTags     ڴҳ飬ÿڴҳһֽ                                       *
+ *        (6) pError    ϸý                                                             *
  *  : (1) eSuccess  ɹ                                                                 *
  *        (2) eFailure  ʧ                                                                 *
- *  ˵                                                                                       *
+ *  ˵ڴҳǱڵṩУռñڴ棬ȫڴҳԷ䡣         *
+ *        ڴҳҪ2յַҪֳɸܴĿڴ            *
  *************************************************************************************************/
-TState xBuddyCreate(TMemBuddy* pBuddy, TChar* pAddr, TBase32 pages, TBase32 pagesize, TError* pError)
+TState xBuddyCreate(TMemBuddy* pBuddy, TChar* pAddr, TBase32 pages, TBase32 pagesize,
+                    TByte* pTags, TError* pError)
 {
     TState state = eFailure;
     TError error = MEM_ERR_FAULT;
-    TIndex index;
-
+    TBase32 index;
+    TBase32 order;
     TReg32 imask;
 
     CpuEnterCritical(&imask);
     if (!(pBuddy->Property & BUDDY_PROP_READY))
     {
-        /* pagesҲ2 */
-        pages = flp2(pages);
-        if (pages)
+        if (pages > 0U)
         {
+            memset(pBuddy, 0U, sizeof(TMemBuddy));
+            memset(pTags, 0U, pages);
             pBuddy->Property  = BUDDY_PROP_READY;
+            pBuddy->PageTags  = pTags;
             pBuddy->PageAddr  = pAddr;
             pBuddy->PageSize  = pagesize;
             pBuddy->PageNbr   = pages;
             pBuddy->PageAvail = pages;
 
-            /* ڴ涼ڿɷ״̬ */
-            for (index = 0; index < MEM_BUDDY_PAGE_TAGS; index++)
+            /* ȫڴҳֳɸСĿڴ */
+            index = 0U;
+            while (index < pBuddy->PageNbr)
             {
-                pBuddy->PageTags[index] = ~0U;
+                order = FLOOR_ORDER(pBuddy->PageNbr - index);
+                if (index != 0U)
+                {
+                    order = (FFS(index) < order) ? FFS(index) : order;
+                }
+                PushBlock(pBuddy, index, order);
+                index += (0x1U << order);
             }
 
-            /* ƽṹ */
-            BuildPageTree(pBuddy);
-
             error = MEM_ERR_NONE;
             state = eSuccess;
         }
@@ -342,9 +230,8 @@ TState xBuddyDelete(TMemBuddy* pBuddy, TError* pError)
     TError error = MEM_ERR_UNREADY;
 
     CpuEnterCritical(&imask);
-    if (pBuddy->Property & MEM_PROP_READY)
+    if (pBuddy->Property & BUDDY_PROP_READY)
     {
-        memset(pBuddy->PageAddr, 0U, pBuddy->PageSize * pBuddy->PageNbr);
         memset(pBuddy, 0U, sizeof(TMemBuddy));
         error = MEM_ERR_NONE;
         state = eSuccess;
@@ -372,43 +259,31 @@ TState xBuddyMemMalloc(TMemBuddy* pBuddy, TBase32 length, void** pAddr2, TError*
     TError error = MEM_ERR_UNREADY;
     TReg32 imask;
     TBase32 pages;
+    TBase32 order;
     TBase32 index;
-    TBase32 avail;
-    TIndex x;
-    TIndex y;
-    TIndex i;
 
     CpuEnterCritical(&imask);
 
-    if (pBuddy->Property &BUDDY_PROP_READY)
+    if (pBuddy->Property & BUDDY_PROP_READY)
     {
         /* ڴ泤ûгBUDDYķΧ */
         if (length <= (pBuddy->PageNbr * pBuddy->PageSize))
         {
-            /* Ҫڴҳ */
+            /* ҪڴҳԼӦĽ */
             pages = (length + pBuddy->PageSize - 1u) / (pBuddy->PageSize);
+            order = CEIL_ORDER(pages);
 
-            /* pagesҲС2 */
-            pages = clp2(pages);
-
-            avail = GetAvailPages(pBuddy);
-            if (avail >= pages)
+            /* ڲСڸýĿڴ */
+            if (pBuddy->OrderMap & (~0U << order))
             {
                 /* ÷ڴҳ */
-                index = MallocPages(pBuddy, pages);
-
-                /* ǸòڴҳѾ */
-                for (i = 0; i < pages; i++)
-                {
-                    y = ((index + i) >> 5);
-                    x = ((index + i) & 0x1f);
-                    pBuddy->PageTags[y]  &= ~(0x1 << x);
-                }
-                pBuddy->PageAvail -= pages;
+                index = MallocPages(pBuddy, order);
+                pBuddy->PageAvail -= (0x1U << order);
 
                 /* ͨڴҳŻڴַ */
                 *pAddr2 = (void*)(pBuddy->PageAddr + index * pBuddy->PageSize);
-                
+                KNL_TRACE(TRACE_EVENT_MALLOC, length, TRACE_MEM_BUDDY, *pAddr2);
+
                 error = MEM_ERR_NONE;
                 state = eSuccess;
             }
@@ -445,52 +320,41 @@ TState xBuddyMemFree(TMemBuddy* pBuddy, void* pAddr, TError* pError)
     TError error = MEM_ERR_UNREADY;
     TReg32 imask;
     TBase32 index;
-    TIndex x;
-    TIndex y;
-    TBitMask tag;
-    TBase32 pages;
-    TIndex i;
+    TBase32 order;
+    TByte tag;
 
     CpuEnterCritical(&imask);
-    if ((pBuddy->Property &BUDDY_PROP_READY))
+    if ((pBuddy->Property & BUDDY_PROP_READY))
     {
+        error = MEM_ERR_BAD_ADDR;
+
         /* 鱻ͷŵĵַǷڻϵͳڴ淶Χ */
         if (((char*)pAddr >= (char*)(pBuddy->PageAddr)) &&
             ((char*)pAddr < ((char*)(pBuddy->PageAddr) + pBuddy->PageSize* pBuddy->PageNbr)))
         {
-            /* ͨڴַʼҳ */
+            /* ͨڴַʼҳţҼַǷڴҳʼλ */
             index = ((char*)pAddr - (char*)(pBuddy->PageAddr)) / pBuddy->PageSize;
-
-            /* ڴҳǣٴͷѾͷŹڴҳַ */
-            y = (index >> 5);
-            x = (index & 0x1f);
-            tag = pBuddy->PageTags[y] & (0x1 << x);
-            if (tag == 0)
+            if ((char*)pAddr == (pBuddy->PageAddr + index * pBuddy->PageSize))
             {
-                /* ͷŸҳʼڴ */
-                pages = FreePages(pBuddy, index);
-
-                /* ǸòڴԱ */
-                for (i = 0; i < pages; i++)
+                /* ڴҳǣٴͷѾͷŹڴҳַ */
+                tag = pBuddy->PageTags[index];
+                if (tag & BUDDY_TAG_USED)
                 {
-                    y = (index + i) >> 5;
-                    x = (index + i) & 0x1f;
-                    pBuddy->PageTags[y] |= (0x1 << x);
+                    /* ͷŸҳʼڴ */
+                    order = tag & BUDDY_TAG_ORDER;
+                    pBuddy->PageAvail += (0x1U << order);
+                    FreePages(pBuddy, index, order);
+
+                    KNL_TRACE(TRACE_EVENT_FREE, 0U, TRACE_MEM_BUDDY, pAddr);
+                    error = MEM_ERR_NONE;
+                    state = eSuccess;
+                }
+                else if (tag & BUDDY_TAG_FREE)
+                {
+                    error = MEM_ERR_DBL_FREE;
                 }
-
-                pBuddy->PageAvail += pages;
-                error = MEM_ERR_NONE;
-                state = eSuccess;
-            }
-            else
-            {
-                error = MEM_ERR_DBL_FREE;
             }
         }
-        else
-        {
-            error = MEM_ERR_BAD_ADDR;
-        }
     }
     CpuLeaveCritical(imask);
 
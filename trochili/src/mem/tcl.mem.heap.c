@@ -0,0 +1,396 @@
+/*************************************************************************************************
+ *                                     Trochili RTOS Kernel                                      *
+ *                                  Copyright(C) 2016 LIUXUMING                                  *
+ *                                       www.trochili.com                                        *
+ *************************************************************************************************/
+#include <string.h>
+
+#include "tcl.config.h"
+#include "tcl.types.h"
+#include "tcl.cpu.h"
+#include "tcl.debug.h"
+#include "tcl.trace.h"
+#include "tcl.mem.heap.h"
+
+#if ((TCLC_MEMORY_ENABLE) && (TCLC_MEMORY_HEAP_ENABLE) && (TCLC_MEMORY_POOL_ENABLE))
+
+/* indexڴҳصҳС */
+#define HEAP_PAGE_SIZE(pHeap, index)  (0x1U << ((pHeap)->MinLog2 + (index)))
+
+
+/*************************************************************************************************
+ *  ܣָܹȵСڴҳ                                                   *
+ *  (1) pHeap     ּڴѽṹַ                                                       *
+ *        (2) length    ڴ泤                                                           *
+ *  : ڴҳ𣬳󼶱ʱֵСpHeap->Classes                                   *
+ *  ˵                                                                                       *
+ *************************************************************************************************/
+static TBase32 SizeToClass(TMemHeap* pHeap, TBase32 length)
+{
+    TBase32 pages;
+
+    pages = (length >> pHeap->MinLog2) + ((length & (HEAP_PAGE_SIZE(pHeap, 0U) - 1U)) ? 1U : 0U);
+    if (pages <= 1U)
+    {
+        return 0U;
+    }
+    return (32U - CpuCountLeadZeros(pages - 1U));
+}
+
+
+/*************************************************************************************************
+ *  ܣʼּڴ                                                                       *
+ *  (1) pHeap     ּڴѽṹַ                                                       *
+ *        (2) pAddr     ڴҳعõַ                                             *
+ *        (3) classes   ڴҳؼ                                                             *
+ *        (4) minsize   0ڴҳС2ݣÿһҳСӱ                     *
+ *        (5) pPages    ڴҳĿ飬ĳһΪ0ʱʾʹһ                          *
+ *        (6) property  ڴҳ                                                         *
+ *        (7) pError    ϸý                                                             *
+ *  : (1) eSuccess  ɹ                                                                 *
+ *        (2) eFailure  ʧ                                                                 *
+ *  ˵ֽǸڴҳĿԸҳС֮ͣ˳֡         *
+ *        κһڴҳسʼʧʱѾʼĸ٣ڴѱδʼ״̬           *
+ *************************************************************************************************/
+TState xHeapCreate(TMemHeap* pHeap, void* pAddr, TBase32 classes, TBase32 minsize,
+                   TBase32* pPages, TProperty property, TError* pError)
+{
+    TState state = eFailure;
+    TError error = MEM_ERR_FAULT;
+    TReg32 imask;
+    TIndex index;
+    TChar* pData;
+    TError dummy;
+    TBool  rollback = eFalse;
+
+    CpuEnterCritical(&imask);
+    if (!(pHeap->Property & MEM_PROP_READY))
+    {
+        memset(pHeap, 0U, sizeof(TMemHeap));
+        pHeap->Classes = classes;
+        pHeap->MinLog2 = 31U - CpuCountLeadZeros(minsize);
+        pHeap->HeapAddr = (TChar*)pAddr;
+
+        /* λָڴҳصĳһʧʱټ */
+        state = eSuccess;
+        error = MEM_ERR_NONE;
+        pData = (TChar*)pAddr;
+        for (index = 0U; (index < classes) && (state == eSuccess); index++)
+        {
+            if (pPages[index] != 0U)
+            {
+                state = xMemPoolCreate(&(pHeap->Pools[index]), (void*)pData, pPages[index],
+                                       HEAP_PAGE_SIZE(pHeap, index), property, &error);
+                pData += pPages[index] * HEAP_PAGE_SIZE(pHeap, index);
+            }
+        }
+
+        if (state == eSuccess)
+        {
+            pHeap->HeapEnd = pData;
+            pHeap->Property = MEM_PROP_READY;
+        }
+        else
+        {
+            rollback = eTrue;
+        }
+    }
+    CpuLeaveCritical(imask);
+
+    /* ڴûо벻ʹѾʼĸڴҳؿҪ
+       ˺xHeapDeleteһٽ֮ */
+    if (rollback == eTrue)
+    {
+        for (index = 0U; index < classes; index++)
+        {
+            if (pHeap->Pools[index].Property & MEM_PROP_READY)
+            {
+                xMemPoolDelete(&(pHeap->Pools[index]), &dummy);
+            }
+        }
+        memset(pHeap, 0U, sizeof(TMemHeap));
+    }
+
+    *pError = error;
+    return state;
+}
+
+
+/*************************************************************************************************
+ *  ܣٷּڴ                                                                         *
+ *  (1) pHeap     ּڴѽṹַ                                                       *
+ *        (2) pError    ϸý                                                             *
+ *  : (1) eSuccess  ɹ                                                                 *
+ *        (2) eFailure  ʧ                                                                 *
+ *  ˵ֻȫڴ涼Ѿͷʱ١ϵͳֻǱᱻ                 *
+ *************************************************************************************************/
+TState xHeapDelete(TMemHeap* pHeap, TError* pError)
+{
+    TState state = eFailure;
+    TError error = MEM_ERR_UNREADY;
+    TReg32 imask;
+    TIndex index;
+    TError dummy;
+    TBase32 inuse = 0U;
+
+    CpuEnterCritical(&imask);
+    if (pHeap->Property & MEM_PROP_READY)
+    {
+        for (index = 0U; index < pHeap->Classes; index++)
+        {
+            inuse += pHeap->PageInuse[index];
+        }
+#if (TCLC_MEMORY_BUDDY_ENABLE)
+        inuse += pHeap->BigInuse;
+#endif
+        if (inuse == 0U)
+        {
+            pHeap->Property &= ~MEM_PROP_READY;
+            error = MEM_ERR_NONE;
+            state = eSuccess;
+        }
+        else
+        {
+            error = MEM_ERR_FAULT;
+        }
+    }
+    CpuLeaveCritical(imask);
+
+    /* ڴҳؿҪٽ֮ */
+    if (state == eSuccess)
+    {
+        for (index = 0U; index < pHeap->Classes; index++)
+        {
+            if (pHeap->Pools[index].Property & MEM_PROP_READY)
+            {
+                xMemPoolDelete(&(pHeap->Pools[index]), &dummy);
+            }
+        }
+        memset(pHeap, 0U, sizeof(TMemHeap));
+    }
+
+    *pError = error;
+    return state;
+}
+
+
+#if (TCLC_MEMORY_BUDDY_ENABLE)
+/*************************************************************************************************
+ *  ܣ÷ּڴѵĴڴϵͳ                                                       *
+ *  (1) pHeap     ּڴѽṹַ                                                       *
+ *        (2) pBuddy    ϵͳṹַΪ0ʱȡ                                          *
+ *        (3) pError    ϸý                                                             *
+ *  : (1) eSuccess  ɹ                                                                 *
+ *        (2) eFailure  ʧ                                                                 *
+ *  ˵󼶱룬ԼڴҳѾ룬Ĵӻϵͳз䡣ֻû     *
+ *        ӻϵͳڴʱܸϵͳ                                                 *
+ *************************************************************************************************/
+TState xHeapSetFallback(TMemHeap* pHeap, TMemBuddy* pBuddy, TError* pError)
+{
+    TState state = eFailure;
+    TError error = MEM_ERR_UNREADY;
+    TReg32 imask;
+
+    CpuEnterCritical(&imask);
+    if (pHeap->Property & MEM_PROP_READY)
+    {
+        if (pHeap->BigInuse == 0U)
+        {
+            pHeap->pBuddy = pBuddy;
+            error = MEM_ERR_NONE;
+            state = eSuccess;
+        }
+        else
+        {
+            error = MEM_ERR_FAULT;
+        }
+    }
+    CpuLeaveCritical(imask);
+
+    *pError = error;
+    return state;
+}
+#endif
+
+
+/*************************************************************************************************
+ *  ܣӷּڴڴ                                                                 *
+ *  (1) pHeap     ּڴѽṹַ                                                       *
+ *        (2) length    Ҫڴ泤                                                       *
+ *        (3) pAddr2    õڴַָ                                                   *
+ *        (4) pError    ϸý                                                             *
+ *  : (1) eSuccess  ɹ                                                                 *
+ *        (2) eFailure  ʧ                                                                 *
+ *  ˵ɸóȵСʼ䣬ڴҳʱγԸߵļԻ     *
+ *        ϵͳûڱɹʱ¼һתƣڴҳĿ                       *
+ *************************************************************************************************/
+TState xHeapMemMalloc(TMemHeap* pHeap, TBase32 length, void** pAddr2, TError* pError)
+{
+    TState state = eFailure;
+    TError error = MEM_ERR_UNREADY;
+    TReg32 imask;
+    TBase32 first;
+    TIndex index;
+
+    if (pHeap->Property & MEM_PROP_READY)
+    {
+        error = MEM_ERR_NO_MEM;
+        first = SizeToClass(pHeap, length);
+        for (index = first; index < pHeap->Classes; index++)
+        {
+            if (pHeap->Pools[index].Property & MEM_PROP_READY)
+            {
+                state = xPoolMemMalloc(&(pHeap->Pools[index]), pAddr2, &error);
+                if (state == eSuccess)
+                {
+                    CpuEnterCritical(&imask);
+                    pHeap->PageInuse[index]++;
+                    if (pHeap->PageInuse[index] > pHeap->PagePeak[index])
+                    {
+                        pHeap->PagePeak[index] = pHeap->PageInuse[index];
+                    }
+                    KNL_TRACE(TRACE_EVENT_MALLOC, length, TRACE_MEM_HEAP, *pAddr2);
+                    CpuLeaveCritical(imask);
+                    break;
+                }
+            }
+        }
+
+#if (TCLC_MEMORY_BUDDY_ENABLE)
+        if ((state != eSuccess) && (pHeap->pBuddy != (TMemBuddy*)0))
+        {
+            state = xBuddyMemMalloc(pHeap->pBuddy, length, pAddr2, &error);
+            if (state == eSuccess)
+            {
+                CpuEnterCritical(&imask);
+                pHeap->BigInuse++;
+                if (pHeap->BigInuse > pHeap->BigPeak)
+                {
+                    pHeap->BigPeak = pHeap->BigInuse;
+                }
+                KNL_TRACE(TRACE_EVENT_MALLOC, length, TRACE_MEM_HEAP, *pAddr2);
+                CpuLeaveCritical(imask);
+            }
+        }
+#endif
+
+        if ((first < pHeap->Classes) && ((state != eSuccess) || (index != first)))
+        {
+            CpuEnterCritical(&imask);
+            pHeap->Spills[first]++;
+            CpuLeaveCritical(imask);
+        }
+    }
+
+    *pError = error;
+    return state;
+}
+
+
+/*************************************************************************************************
+ *  ܣּڴͷڴ                                                                 *
+ *  (1) pHeap     ּڴѽṹַ                                                       *
+ *        (2) pAddr     ͷŵڴַ                                                         *
+ *        (3) pError    ϸý                                                             *
+ *  : (1) eSuccess  ɹ                                                                 *
+ *        (2) eFailure  ʧ                                                                 *
+ *  ˵ڴǰûб漶Ϣͷڴַһȷڴҳأ     *
+ *        κһеڴ潻ϵͳ                                             *
+ *************************************************************************************************/
+TState xHeapMemFree(TMemHeap* pHeap, void* pAddr, TError* pError)
+{
+    TState state = eFailure;
+    TError error = MEM_ERR_UNREADY;
+    TReg32 imask;
+    TIndex index;
+    TMemPool* pPool;
+    TChar* pData = (TChar*)pAddr;
+
+    if (pHeap->Property & MEM_PROP_READY)
+    {
+        error = MEM_ERR_BAD_ADDR;
+        if ((pData >= pHeap->HeapAddr) && (pData < pHeap->HeapEnd))
+        {
+            for (index = 0U; index < pHeap->Classes; index++)
+            {
+                pPool = &(pHeap->Pools[index]);
+                if ((pPool->Property & MEM_PROP_READY) &&
+                        (pData >= pPool->PageAddr) &&
+                        (pData < (pPool->PageAddr + pPool->PageNbr * pPool->PageSize)))
+                {
+                    state = xPoolMemFree(pPool, pAddr, &error);
+                    if (state == eSuccess)
+                    {
+                        CpuEnterCritical(&imask);
+                        pHeap->PageInuse[index]--;
+                        KNL_TRACE(TRACE_EVENT_FREE, 0U, TRACE_MEM_HEAP, pAddr);
+                        CpuLeaveCritical(imask);
+                    }
+                    break;
+                }
+            }
+        }
+#if (TCLC_MEMORY_BUDDY_ENABLE)
+        else if (pHeap->pBuddy != (TMemBuddy*)0)
+        {
+            state = xBuddyMemFree(pHeap->pBuddy, pAddr, &error);
+            if (state == eSuccess)
+            {
+                CpuEnterCritical(&imask);
+                pHeap->BigInuse--;
+                KNL_TRACE(TRACE_EVENT_FREE, 0U, TRACE_MEM_HEAP, pAddr);
+                CpuLeaveCritical(imask);
+            }
+        }
+#endif
+    }
+
+    *pError = error;
+    return state;
+}
+
+
+/*************************************************************************************************
+ *  ܣ÷ּڴѵͳϢ                                                               *
+ *  (1) pHeap     ּڴѽṹַ                                                       *
+ *        (2) pInfo     ͳϢĽṹַ                                                   *
+ *        (3) pError    ϸý                                                             *
+ *  : (1) eSuccess  ɹ                                                                 *
+ *        (2) eFailure  ʧ                                                                 *
+ *  ˵                                                                                       *
+ *************************************************************************************************/
+TState xHeapGetInfo(TMemHeap* pHeap, THeapInfo* pInfo, TError* pError)
+{
+    TState state = eFailure;
+    TError error = MEM_ERR_UNREADY;
+    TReg32 imask;
+    TIndex index;
+
+    CpuEnterCritical(&imask);
+    if (pHeap->Property & MEM_PROP_READY)
+    {
+        memset(pInfo, 0U, sizeof(THeapInfo));
+        pInfo->Classes = pHeap->Classes;
+        for (index = 0U; index < pHeap->Classes; index++)
+        {
+            pInfo->PageSize[index]  = HEAP_PAGE_SIZE(pHeap, index);
+            pInfo->PageNbr[index]   = pHeap->Pools[index].PageNbr;
+            pInfo->PageInuse[index] = pHeap->PageInuse[index];
+            pInfo->PagePeak[index]  = pHeap->PagePeak[index];
+            pInfo->Spills[index]    = pHeap->Spills[index];
+        }
+#if (TCLC_MEMORY_BUDDY_ENABLE)
+        pInfo->BigInuse = pHeap->BigInuse;
+        pInfo->BigPeak  = pHeap->BigPeak;
+#endif
+        error = MEM_ERR_NONE;
+        state = eSuccess;
+    }
+    CpuLeaveCritical(imask);
+
+    *pError = error;
+    return state;
+}
+
+#endif
+
@@ -8,44 +8,40 @@
 #include "tcl.types.h"
 #include "tcl.config.h"
 #include "tcl.debug.h"
+#include "tcl.trace.h"
 #include "tcl.cpu.h"
 #include "tcl.mem.pool.h"
 
 #if ((TCLC_MEMORY_ENABLE) && (TCLC_MEMORY_POOL_ENABLE))
+
+/* ڴҳ׸һڴҳĵַȳʽ */
+#define POOL_NEXT_PAGE(page)  (*((void**)(page)))
+
 /*************************************************************************************************
  *  : ʼڴҳ                                                                         *
  *  : (1) pPool      ڴҳؽṹַ                                                        *
  *        (2) pAddr      ڴַ                                                        *
  *        (3) pages      ڴڴҳĿ                                                      *
  *        (4) pgsize     ڴҳС                                                              *
- *        (5) pError     ϸý                                                            *
+ *        (5) property   ڴҳ                                                            *
+ *        (6) pError     ϸý                                                            *
  *  : (1) eSuccess   ɹ                                                                *
  *        (2) eFailure   ʧ                                                                *
- *  ˵                                                                                       *
+ *  ˵ڴҳڴʱһӣ״ηʱPageFresh˳ȡ˳ʼĺʱ      *
+ *        ڴҳĿ޹                                                                       *
  *************************************************************************************************/
-TState xMemPoolCreate(TMemPool* pPool, void* pAddr, TBase32 pages, TBase32 pgsize, TError* pError)
+TState xMemPoolCreate(TMemPool* pPool, void* pAddr, TBase32 pages, TBase32 pgsize,
+                      TProperty property, TError* pError)
 {
     TState state = eFailure;
     TError error = MEM_ERR_FAULT;
     TReg32 imask;
     TIndex index;
-    TChar* pTemp;
 
     CpuEnterCritical(&imask);
 
     if (!(pPool->Property & MEM_PROP_READY))
     {
-        /* ձڴռ */
-        memset(pAddr, 0U, pages * pgsize);
-
-        /* ڴҳ */
-        pTemp = (TChar*)pAddr;
-        for (index = 0; index < pages; index++)
-        {
-            uObjListAddNode(&(pPool->PageList), (TObjNode*)pTemp, eQuePosTail);
-            pTemp += pgsize;
-        }
-
         /* ڴ涼ڿɷ״̬ */
         for (index = 0; index < MEM_PAGE_TAGS; index++)
         {
@@ -55,7 +51,9 @@ TState xMemPoolCreate(TMemPool* pPool, void* pAddr, TBase32 pages, TBase32 pgsiz
         pPool->PageAvail = pages;
         pPool->PageNbr   = pages;
         pPool->PageSize  = pgsize;
-        pPool->Property  = MEM_PROP_READY;
+        pPool->PageFresh = 0U;
+        pPool->PageList  = (void*)0;
+        pPool->Property  = (property & MEM_VALID_POOL_PROP) | MEM_PROP_READY;
 
         error = MEM_ERR_NONE;
         state = eSuccess;
@@ -74,24 +72,36 @@ TState xMemPoolCreate(TMemPool* pPool, void* pAddr, TBase32 pages, TBase32 pgsiz
  *        (2) pError     ϸý                                                            *
  *  : (1) eSuccess   ɹ                                                                *
  *        (2) eFailure   ʧ                                                                *
- *  ˵                                                                                       *
+ *  ˵MEM_PROP_ZERO_FREEԣ˳ٽ֮ձڴռ               *
  *************************************************************************************************/
 TState xMemPoolDelete(TMemPool* pPool, TError* pError)
 {
     TReg32 imask;
     TState state = eFailure;
     TError error = MEM_ERR_UNREADY;
+    TChar* pAddr = (TChar*)0;
+    TBase32 zero = 0U;
 
     CpuEnterCritical(&imask);
     if (pPool->Property & MEM_PROP_READY)
     {
-        memset(pPool->PageAddr, 0, pPool->PageNbr * pPool->PageSize);
+        if (pPool->Property & MEM_PROP_ZERO_FREE)
+        {
+            pAddr = pPool->PageAddr;
+            zero = pPool->PageNbr * pPool->PageSize;
+        }
         memset(pPool, 0, sizeof(TMemPool));
         error = MEM_ERR_NONE;
         state = eSuccess;
     }
     CpuLeaveCritical(imask);
 
+    /* ڴѾעڴռڿжϵ */
+    if (zero != 0U)
+    {
+        memset(pAddr, 0U, zero);
+    }
+
     *pError = error;
     return state;
 }
@@ -104,7 +114,8 @@ TState xMemPoolDelete(TMemPool* pPool, TError* pError)
  *        (3) pError     ϸý                                                            *
  *  : (1) eSuccess   ɹ                                                                *
  *        (2) eFailure   ʧ                                                                *
- *  ˵                                                                                       *
+ *  ˵ȷյڴҳMEM_PROP_ZERO_ALLOCԣ˳ٽ֮    *
+ *        ոڴҳ                                                                             *
  *************************************************************************************************/
 TState xPoolMemMalloc(TMemPool* pPool, void** pAddr2, TError* pError)
 {
@@ -114,7 +125,8 @@ TState xPoolMemMalloc(TMemPool* pPool, void** pAddr2, TError* pError)
     TIndex x;
     TIndex y;
     TIndex index;
-    TChar* pTemp;
+    TChar* pTemp = (TChar*)0;
+    TBase32 zero = 0U;
 
     CpuEnterCritical(&imask);
 
@@ -123,20 +135,29 @@ TState xPoolMemMalloc(TMemPool* pPool, void** pAddr2, TError* pError)
         /* ڴشڿڴҳ */
         if (pPool->PageAvail > 0U)
         {
-            /* ڴҳȥ */
-            pTemp = (TChar*)(pPool->PageList);
-            uObjListRemoveNode(&(pPool->PageList), (TObjNode*)pTemp);
+            /* ȷеڴҳδʹùڴҳ */
+            if (pPool->PageList != (void*)0)
+            {
+                pTemp = (TChar*)(pPool->PageList);
+                pPool->PageList = POOL_NEXT_PAGE(pTemp);
+                index = (pTemp - pPool->PageAddr) / (pPool->PageSize);
+            }
+            else
+            {
+                index = pPool->PageFresh;
+                pTemp = pPool->PageAddr + index * pPool->PageSize;
+                pPool->PageFresh++;
+            }
             pPool->PageAvail--;
             *pAddr2 = (void*)pTemp;
 
             /* ǸڴҳѾ */
-            index = (pTemp - pPool->PageAddr)/(pPool->PageSize);
             y = (index >> 5);
             x = (index & 0x1f);
-            pPool->PageTags[y]  &= ~(0x1 << x);
+            pPool->PageTags[y]  &= ~(0x1U << x);
 
-            /* ոڴҳ */
-            memset((void*)pTemp, 0U, pPool->PageSize);
+            zero = (pPool->Property & MEM_PROP_ZERO_ALLOC) ? pPool->PageSize : 0U;
+            KNL_TRACE(TRACE_EVENT_MALLOC, pPool->PageSize, TRACE_MEM_POOL, pTemp);
 
             error = MEM_ERR_NONE;
             state = eSuccess;
@@ -149,6 +170,12 @@ TState xPoolMemMalloc(TMemPool* pPool, void** pAddr2, TError* pError)
 
     CpuLeaveCritical(imask);
 
+    /* ڴҳѾ߶ռղعرж */
+    if (zero != 0U)
+    {
+        memset((void*)pTemp, 0U, zero);
+    }
+
     *pError = error;
     return state;
 }
@@ -161,7 +188,8 @@ TState xPoolMemMalloc(TMemPool* pPool, void** pAddr2, TError* pError)
  *        (3) pError     ϸý                                                            *
  *  : (1) eSuccess   ɹ                                                                *
  *        (2) eFailure   ʧ                                                                *
- *  ˵                                                                                       *
+ *  ˵MEM_PROP_ZERO_FREEԣڴҳȱΪظͷţȻٽ     *
+ *        ֮գٹ                                                           *
  *************************************************************************************************/
 TState xPoolMemFree (TMemPool* pPool, void* pAddr, TError* pError)
 {
@@ -172,7 +200,8 @@ TState xPoolMemFree (TMemPool* pPool, void* pAddr, TError* pError)
     TChar* pTemp;
     TBase32 x;
     TBase32 y;
-	TBase32 tag;
+    TBase32 tag;
+    TBase32 zero = 0U;
 
     CpuEnterCritical(&imask);
 
@@ -184,27 +213,33 @@ TState xPoolMemFree (TMemPool* pPool, void* pAddr, TError* pError)
             /* ͷŵڴַǷĴںʵĿʼַϡ
                ˴Ҫ󱻹ڴռ */
             index = ((TChar*)pAddr - pPool->PageAddr) / (pPool->PageSize);
-          //  index = (index < pPool->PageNbr) ? index : pPool->PageNbr;
             pTemp = pPool->PageAddr + index * pPool->PageSize;
 
             /* õַȷʵǴĳڴҳ׵ַ */
-            if (pTemp == (TChar*)pAddr)
+            if (((TChar*)pAddr >= pPool->PageAddr) && (index < pPool->PageNbr) &&
+                    (pTemp == (TChar*)pAddr))
             {
                 /* ڴҳǣٴͷѾͷŹڴҳַ */
                 y = (index >> 5);
                 x = (index & 0x1f);
-				tag = pPool->PageTags[y] & (0x1 << x);
-                if (tag == 0)
+                tag = pPool->PageTags[y] & (0x1U << x);
+                if (tag == 0U)
                 {
-                    /* ոڴҳ */
-                    memset(pAddr, 0U, pPool->PageSize);
-
-                    /* ջظõַڴҳ */
-                    uObjListAddNode(&(pPool->PageList), (TObjNode*)pAddr, eQuePosTail);
-                    pPool->PageAvail++;
-
                     /* ǸڴҳԱ */
-                    pPool->PageTags[y] |= (0x1 << x);
+                    pPool->PageTags[y] |= (0x1U << x);
+                    KNL_TRACE(TRACE_EVENT_FREE, 0U, TRACE_MEM_POOL, pAddr);
+
+                    /* ջظõַڴҳҪʱƳٵ֮ջ */
+                    if (pPool->Property & MEM_PROP_ZERO_FREE)
+                    {
+                        zero = pPool->PageSize;
+                    }
+                    else
+                    {
+                        POOL_NEXT_PAGE(pAddr) = pPool->PageList;
+                        pPool->PageList = pAddr;
+                        pPool->PageAvail++;
+                    }
 
                     error = MEM_ERR_NONE;
                     state = eSuccess;
@@ -227,9 +262,20 @@ TState xPoolMemFree (TMemPool* pPool, void* pAddr, TError* pError)
 
     CpuLeaveCritical(imask);
 
+    /* ڿжϵոڴҳȻٰ */
+    if (zero != 0U)
+    {
+        memset(pAddr, 0U, zero);
+
+        CpuEnterCritical(&imask);
+        POOL_NEXT_PAGE(pAddr) = pPool->PageList;
+        pPool->PageList = pAddr;
+        pPool->PageAvail++;
+        CpuLeaveCritical(imask);
+    }
+
     *pError = error;
     return state;
 }
 
 #endif
-
@@ -0,0 +1,343 @@
+/*************************************************************************************************
+ *                                     Trochili RTOS Kernel                                      *
+ *                                  Copyright(C) 2016 LIUXUMING                                  *
+ *                                       www.trochili.com                                        *
+ *************************************************************************************************/
+#include <string.h>
+
+#include "tcl.config.h"
+#include "tcl.types.h"
+#include "tcl.cpu.h"
+#include "tcl.debug.h"
+#include "tcl.trace.h"
+#include "tcl.mem.slab.h"
+
+#if ((TCLC_MEMORY_ENABLE) && (TCLC_MEMORY_SLAB_ENABLE) && \
+     (TCLC_MEMORY_POOL_ENABLE) && (TCLC_MEMORY_BUDDY_ENABLE))
+
+/* slabͷһslabĵַ۴SLAB_ALIGN_BYTESʼ */
+#define SLAB_NEXT(slab)          (*((void**)(slab)))
+#define SLAB_SLOT(slab, index, pSlab) \
+    ((void*)((TChar*)(slab) + SLAB_ALIGN_BYTES + (index) * (pSlab)->SlotSize))
+
+/* ĩβһжĵַͶ״̬ */
+#define SLOT_TAIL_BYTES          SLAB_ALIGN(sizeof(void*) + sizeof(TBase32))
+#define SLOT_NEXT(obj, pSlab)    (*((void**)((TChar*)(obj) + (pSlab)->SlotSize - SLOT_TAIL_BYTES)))
+#define SLOT_TAG(obj, pSlab)     (*((TBase32*)((TChar*)(obj) + (pSlab)->SlotSize - \
+                                               SLOT_TAIL_BYTES + sizeof(void*))))
+#define SLOT_TAG_FREE            (0x51AB0FEEU)
+#define SLOT_TAG_INUSE           (0x51AB05EDU)
+
+
+/*************************************************************************************************
+ *  ܣַǷǶ󻺴ĳ۵ʼַ                                       *
+ *  (1) pSlab     󻺴ṹַ                                                         *
+ *        (2) pObject   ַ                                                                 *
+ *  : (1) eTrue     ַϷ                                                                 *
+ *        (2) eFalse    ַڸö󻺴߲ڶ߽                                   *
+ *  ˵߱봦ٽڣslabʱslabĿ                         *
+ *************************************************************************************************/
+static TBool SlabOwnsObject(TMemSlab* pSlab, void* pObject)
+{
+    TBool owned = eFalse;
+    void* pMem = pSlab->SlabList;
+    TChar* pFirst;
+    TChar* pData = (TChar*)pObject;
+
+    while (pMem != (void*)0)
+    {
+        pFirst = (TChar*)SLAB_SLOT(pMem, 0U, pSlab);
+        if ((pData >= pFirst) && (pData < (pFirst + pSlab->SlabObjs * pSlab->SlotSize)))
+        {
+            owned = (TBool)((((TBase32)(pData - pFirst)) % pSlab->SlotSize) == 0U);
+            break;
+        }
+        pMem = SLAB_NEXT(pMem);
+    }
+
+    return owned;
+}
+
+
+/*************************************************************************************************
+ *  ܣΪ󻺴һslab                                                                 *
+ *  (1) pSlab     󻺴ṹַ                                                         *
+ *        (2) pError    ϸý                                                             *
+ *  : (1) eSuccess  ɹ                                                                 *
+ *        (2) eFailure  ʧ                                                                 *
+ *  ˵slabͶĹ춼ٽ֮УֻйĲҪرж               *
+ *************************************************************************************************/
+static TState GrowSlab(TMemSlab* pSlab, TError* pError)
+{
+    TState state;
+    TReg32 imask;
+    TIndex index;
+    void* pMem;
+    void* pObject;
+
+    if (pSlab->pPool != (TMemPool*)0)
+    {
+        state = xPoolMemMalloc(pSlab->pPool, &pMem, pError);
+    }
+    else
+    {
+        state = xBuddyMemMalloc(pSlab->pBuddy, pSlab->SlabBytes, &pMem, pError);
+    }
+
+    if (state == eSuccess)
+    {
+        /* µslabеĶֻһΣ˺󷴸ͷŶֹ֮״̬ */
+        if (pSlab->Ctor != (TSlabCtor)0)
+        {
+            for (index = 0U; index < pSlab->SlabObjs; index++)
+            {
+                pSlab->Ctor(SLAB_SLOT(pMem, index, pSlab));
+            }
+        }
+
+        CpuEnterCritical(&imask);
+        SLAB_NEXT(pMem) = pSlab->SlabList;
+        pSlab->SlabList = pMem;
+        for (index = 0U; index < pSlab->SlabObjs; index++)
+        {
+            pObject = SLAB_SLOT(pMem, index, pSlab);
+            SLOT_NEXT(pObject, pSlab) = pSlab->FreeList;
+            SLOT_TAG(pObject, pSlab) = SLOT_TAG_FREE;
+            pSlab->FreeList = pObject;
+        }
+        pSlab->ObjAvail += pSlab->SlabObjs;
+        CpuLeaveCritical(imask);
+    }
+
+    return state;
+}
+
+
+/*************************************************************************************************
+ *  ܣʼ󻺴                                                                         *
+ *  (1) pSlab     󻺴ṹַ                                                         *
+ *        (2) size      ֽ                                                               *
+ *        (3) objs      ÿslabеĶĿʹڴҳʱԴ˲                           *
+ *        (4) pPool     ṩslabڴҳأÿڴҳһslab                                 *
+ *        (5) pBuddy    ṩslabĻϵͳpPoolΪ0ʱʹ                                       *
+ *        (6) ctor      캯Ϊ0                                                    *
+ *        (7) dtor      Ϊ0                                                    *
+ *        (8) pError    ϸý                                                             *
+ *  : (1) eSuccess  ɹ                                                                 *
+ *        (2) eFailure  ʧ                                                                 *
+ *  ˵ʼʱڴ棬һηʱslab                                         *
+ *************************************************************************************************/
+TState xSlabCreate(TMemSlab* pSlab, TBase32 size, TBase32 objs, TMemPool* pPool,
+                   TMemBuddy* pBuddy, TSlabCtor ctor, TSlabDtor dtor, TError* pError)
+{
+    TState state = eFailure;
+    TError error = MEM_ERR_FAULT;
+    TReg32 imask;
+    TBase32 slot;
+
+    slot = SLAB_ALIGN(size) + SLOT_TAIL_BYTES;
+    if (pPool != (TMemPool*)0)
+    {
+        objs = (pPool->PageSize > SLAB_ALIGN_BYTES) ?
+               ((pPool->PageSize - SLAB_ALIGN_BYTES) / slot) : 0U;
+    }
+
+    CpuEnterCritical(&imask);
+    if ((!(pSlab->Property & MEM_PROP_READY)) && (objs > 0U))
+    {
+        memset(pSlab, 0U, sizeof(TMemSlab));
+        pSlab->ObjSize   = size;
+        pSlab->SlotSize  = slot;
+        pSlab->SlabObjs  = objs;
+        pSlab->SlabBytes = SLAB_ALIGN_BYTES + objs * slot;
+        pSlab->pPool     = pPool;
+        pSlab->pBuddy    = pBuddy;
+        pSlab->Ctor      = ctor;
+        pSlab->Dtor      = dtor;
+        pSlab->Property  = MEM_PROP_READY;
+
+        error = MEM_ERR_NONE;
+        state = eSuccess;
+    }
+    CpuLeaveCritical(imask);
+
+    *pError = error;
+    return state;
+}
+
+
+/*************************************************************************************************
+ *  ܣٶ󻺴                                                                           *
+ *  (1) pSlab     󻺴ṹַ                                                         *
+ *        (2) pError    ϸý                                                             *
+ *  : (1) eSuccess  ɹ                                                                 *
+ *        (2) eFailure  ʧ                                                                 *
+ *  ˵ֻȫѾͷʱ١ÿȻslabڴҳ     *
+ *        ߻ϵͳ                                                                           *
+ *************************************************************************************************/
+TState xSlabDelete(TMemSlab* pSlab, TError* pError)
+{
+    TState state = eFailure;
+    TError error = MEM_ERR_UNREADY;
+    TReg32 imask;
+    TIndex index;
+    TError dummy;
+    void* pMem = (void*)0;
+    void* pNext;
+
+    CpuEnterCritical(&imask);
+    if (pSlab->Property & MEM_PROP_READY)
+    {
+        if (pSlab->ObjInuse == 0U)
+        {
+            pMem = pSlab->SlabList;
+            pSlab->Property &= ~MEM_PROP_READY;
+            error = MEM_ERR_NONE;
+            state = eSuccess;
+        }
+        else
+        {
+            error = MEM_ERR_FAULT;
+        }
+    }
+    CpuLeaveCritical(imask);
+
+    if (state == eSuccess)
+    {
+        while (pMem != (void*)0)
+        {
+            pNext = SLAB_NEXT(pMem);
+            if (pSlab->Dtor != (TSlabDtor)0)
+            {
+                for (index = 0U; index < pSlab->SlabObjs; index++)
+                {
+                    pSlab->Dtor(SLAB_SLOT(pMem, index, pSlab));
+                }
+            }
+
+            if (pSlab->pPool != (TMemPool*)0)
+            {
+                xPoolMemFree(pSlab->pPool, pMem, &dummy);
+            }
+            else
+            {
+                xBuddyMemFree(pSlab->pBuddy, pMem, &dummy);
+            }
+            pMem = pNext;
+        }
+        memset(pSlab, 0U, sizeof(TMemSlab));
+    }
+
+    *pError = error;
+    return state;
+}
+
+
+/*************************************************************************************************
+ *  ܣӶ󻺴з                                                                   *
+ *  (1) pSlab     󻺴ṹַ                                                         *
+ *        (2) pObject2  䵽Ķַָ                                           *
+ *        (3) pError    ϸý                                                             *
+ *  : (1) eSuccess  ɹ                                                                 *
+ *        (2) eFailure  ʧ                                                                 *
+ *  ˵пжʱֱȡͷŵĶ󣬷һµslab                             *
+ *************************************************************************************************/
+TState xSlabMalloc(TMemSlab* pSlab, void** pObject2, TError* pError)
+{
+    TState state = eFailure;
+    TError error = MEM_ERR_UNREADY;
+    TReg32 imask;
+    TBool  grow;
+
+    do
+    {
+        grow = eFalse;
+
+        CpuEnterCritical(&imask);
+        if (pSlab->Property & MEM_PROP_READY)
+        {
+            if (pSlab->FreeList != (void*)0)
+            {
+                *pObject2 = pSlab->FreeList;
+                pSlab->FreeList = SLOT_NEXT(*pObject2, pSlab);
+                SLOT_TAG(*pObject2, pSlab) = SLOT_TAG_INUSE;
+                pSlab->ObjAvail--;
+                pSlab->ObjInuse++;
+                if (pSlab->ObjInuse > pSlab->ObjPeak)
+                {
+                    pSlab->ObjPeak = pSlab->ObjInuse;
+                }
+
+                KNL_TRACE(TRACE_EVENT_MALLOC, pSlab->ObjSize, TRACE_MEM_SLAB, *pObject2);
+
+                error = MEM_ERR_NONE;
+                state = eSuccess;
+            }
+            else
+            {
+                grow = eTrue;
+            }
+        }
+        CpuLeaveCritical(imask);
+
+        /* ûпжʱµslabɹ֮³Է */
+        if (grow == eTrue)
+        {
+            grow = (TBool)(GrowSlab(pSlab, &error) == eSuccess);
+        }
+    }
+    while (grow == eTrue);
+
+    *pError = error;
+    return state;
+}
+
+
+/*************************************************************************************************
+ *  ܣ󻺴ͷŶ                                                                     *
+ *  (1) pSlab     󻺴ṹַ                                                         *
+ *        (2) pObject   ͷŵĶַ                                                         *
+ *        (3) pError    ϸý                                                             *
+ *  : (1) eSuccess  ɹ                                                                 *
+ *        (2) eFailure  ʧ                                                                 *
+ *  ˵󲻻ᱻһηʱͷʱ״̬ڸö󻺴߲ڶ߽ϵ     *
+ *        ַMEM_ERR_BAD_ADDRѾڿ״̬Ķ󷵻MEM_ERR_DBL_FREE                   *
+ *************************************************************************************************/
+TState xSlabFree(TMemSlab* pSlab, void* pObject, TError* pError)
+{
+    TState state = eFailure;
+    TError error = MEM_ERR_UNREADY;
+    TReg32 imask;
+
+    CpuEnterCritical(&imask);
+    if (pSlab->Property & MEM_PROP_READY)
+    {
+        if (SlabOwnsObject(pSlab, pObject) == eFalse)
+        {
+            error = MEM_ERR_BAD_ADDR;
+        }
+        else if (SLOT_TAG(pObject, pSlab) != SLOT_TAG_INUSE)
+        {
+            error = MEM_ERR_DBL_FREE;
+        }
+        else
+        {
+            SLOT_NEXT(pObject, pSlab) = pSlab->FreeList;
+            SLOT_TAG(pObject, pSlab) = SLOT_TAG_FREE;
+            pSlab->FreeList = pObject;
+            pSlab->ObjAvail++;
+            pSlab->ObjInuse--;
+
+            KNL_TRACE(TRACE_EVENT_FREE, 0U, TRACE_MEM_SLAB, pObject);
+            error = MEM_ERR_NONE;
+            state = eSuccess;
+        }
+    }
+    CpuLeaveCritical(imask);
+
+    *pError = error;
+    return state;
+}
+
+#endif
+
@@ -0,0 +1,641 @@
+/*************************************************************************************************
+ *                                     Trochili RTOS Kernel                                      *
+ *                                  Copyright(C) 2016 LIUXUMING                                  *
+ *                                       www.trochili.com                                        *
+ *************************************************************************************************/
+#include <string.h>
+#include <stddef.h>
+
+#include "tcl.config.h"
+#include "tcl.types.h"
+#include "tcl.cpu.h"
+#include "tcl.debug.h"
+#include "tcl.trace.h"
+#include "tcl.mem.tlsf.h"
+
+#if ((TCLC_MEMORY_ENABLE) && (TCLC_MEMORY_TLSF_ENABLE))
+
+/* ڴߴֶеĿбǣߴTLSF_ALIGN_BYTESλԸ */
+#define BLOCK_FREE          (0x1U)
+#define BLOCK_SIZE_MASK     (~((TBase32)TLSF_ALIGN_BYTES - 1U))
+
+/* ڴͷֻǰָͳߴֶΣָռ */
+#define BLOCK_HEAD_BYTES    ((TBase32)offsetof(TTlsfBlock, NextFree))
+#define BLOCK_MIN_BYTES     ((TBase32)(sizeof(TTlsfBlock) - offsetof(TTlsfBlock, NextFree)))
+
+#define BLOCK_SIZE(b)       ((b)->Size & BLOCK_SIZE_MASK)
+#define BLOCK_IS_FREE(b)    ((b)->Size & BLOCK_FREE)
+#define BLOCK_DATA(b)       ((void*)((TChar*)(b) + BLOCK_HEAD_BYTES))
+#define BLOCK_NEXT(b)       ((TTlsfBlock*)((TChar*)(b) + BLOCK_HEAD_BYTES + BLOCK_SIZE(b)))
+#define DATA_BLOCK(p)       ((TTlsfBlock*)((TChar*)(p) - BLOCK_HEAD_BYTES))
+
+/* xλbitıţxΪ0 */
+#define FLS(x)              (31U - CpuCountLeadZeros(x))
+
+/* xλbitıţxΪ0 */
+#define FFS(x)              ((TBase32)CpuCalcHiPRIO(x))
+
+/* ͳڴʱٽڴĿ */
+#define TLSF_INFO_SCAN_BLOCKS  (8U)
+
+
+/*************************************************************************************************
+ *  ܣڴߴһͶ                                                     *
+ *  (1) size      ڴֽ                                                       *
+ *        (2) pFl       һ                                                             *
+ *        (3) pSl                                                                    *
+ *  :                                                                                      *
+ *  ˵һλbitɽTCLC_MEMORY_TLSF_SLI_LOG2bit      *
+ *************************************************************************************************/
+static void MappingInsert(TBase32 size, TBase32* pFl, TBase32* pSl)
+{
+    TBase32 msb;
+
+    if (size < TLSF_SMALL_BYTES)
+    {
+        *pFl = 0U;
+        *pSl = size >> TLSF_ALIGN_LOG2;
+    }
+    else
+    {
+        msb = FLS(size);
+        *pSl = (size >> (msb - TCLC_MEMORY_TLSF_SLI_LOG2)) ^ TLSF_SL_COUNT;
+        *pFl = msb - TLSF_FL_SHIFT + 1U;
+    }
+}
+
+
+/*************************************************************************************************
+ *  ܣܹߴС                                                         *
+ *  (1) size      ֽ                                                       *
+ *        (2) pFl       һ                                                             *
+ *        (3) pSl                                                                    *
+ *  :                                                                                      *
+ *  ˵Ȱѳߴϵһ㣬֤÷κһڴ鶼㹻󣬱     *
+ *        в                                                                             *
+ *************************************************************************************************/
+static void MappingSearch(TBase32 size, TBase32* pFl, TBase32* pSl)
+{
+    if (size >= TLSF_SMALL_BYTES)
+    {
+        size += (0x1U << (FLS(size) - TCLC_MEMORY_TLSF_SLI_LOG2)) - 1U;
+    }
+    MappingInsert(size, pFl, pSl);
+}
+
+
+/*************************************************************************************************
+ *  ܣڴĿ                                                     *
+ *  (1) pTlsf     TLSFѽṹַ                                                           *
+ *        (2) pBlock    ڴַ                                                           *
+ *  :                                                                                      *
+ *  ˵                                                                                       *
+ *************************************************************************************************/
+static void InsertFreeBlock(TMemTlsf* pTlsf, TTlsfBlock* pBlock)
+{
+    TBase32 fl;
+    TBase32 sl;
+    TTlsfBlock* pHead;
+
+    MappingInsert(BLOCK_SIZE(pBlock), &fl, &sl);
+    pHead = pTlsf->Blocks[fl][sl];
+    pBlock->NextFree = pHead;
+    pBlock->PrevFree = (TTlsfBlock*)0;
+    if (pHead != (TTlsfBlock*)0)
+    {
+        pHead->PrevFree = pBlock;
+    }
+    pTlsf->Blocks[fl][sl] = pBlock;
+    pTlsf->FlMap |= (0x1U << fl);
+    pTlsf->SlMap[fl] |= (0x1U << sl);
+
+    pBlock->Size |= BLOCK_FREE;
+    pTlsf->FreeBytes += BLOCK_SIZE(pBlock);
+    pTlsf->FreeBlocks++;
+}
+
+
+/*************************************************************************************************
+ *  ܣڴĿƳ                                                 *
+ *  (1) pTlsf     TLSFѽṹַ                                                           *
+ *        (2) pBlock    ڴַ                                                           *
+ *  :                                                                                      *
+ *  ˵                                                                                       *
+ *************************************************************************************************/
+static void RemoveFreeBlock(TMemTlsf* pTlsf, TTlsfBlock* pBlock)
+{
+    TBase32 fl;
+    TBase32 sl;
+
+    MappingInsert(BLOCK_SIZE(pBlock), &fl, &sl);
+    if (pBlock->NextFree != (TTlsfBlock*)0)
+    {
+        pBlock->NextFree->PrevFree = pBlock->PrevFree;
+    }
+    if (pBlock->PrevFree != (TTlsfBlock*)0)
+    {
+        pBlock->PrevFree->NextFree = pBlock->NextFree;
+    }
+    else
+    {
+        pTlsf->Blocks[fl][sl] = pBlock->NextFree;
+        if (pBlock->NextFree == (TTlsfBlock*)0)
+        {
+            pTlsf->SlMap[fl] &= ~(0x1U << sl);
+            if (pTlsf->SlMap[fl] == 0U)
+            {
+                pTlsf->FlMap &= ~(0x1U << fl);
+            }
+        }
+    }
+
+    pBlock->Size &= ~BLOCK_FREE;
+    pTlsf->FreeBytes -= BLOCK_SIZE(pBlock);
+    pTlsf->FreeBlocks--;
+}
+
+
+/*************************************************************************************************
+ *  ܣҲСĵһǿշ                                                     *
+ *  (1) pTlsf     TLSFѽṹַ                                                           *
+ *        (2) fl        һ                                                       *
+ *        (3) sl        Ķ                                                       *
+ *  : ҵĿڴַҲʱ0                                                    *
+ *  ˵λͼңʱѵĴСͿڴĿ޹                                       *
+ *************************************************************************************************/
+static TTlsfBlock* FindFreeBlock(TMemTlsf* pTlsf, TBase32 fl, TBase32 sl)
+{
+    TBase32 slmap;
+    TBase32 flmap;
+
+    slmap = pTlsf->SlMap[fl] & (~0U << sl);
+    if (slmap == 0U)
+    {
+        flmap = pTlsf->FlMap & (~0U << (fl + 1U));
+        if (flmap == 0U)
+        {
+            return (TTlsfBlock*)0;
+        }
+        fl = FFS(flmap);
+        slmap = pTlsf->SlMap[fl];
+    }
+    sl = FFS(slmap);
+
+    return pTlsf->Blocks[fl][sl];
+}
+
+
+/*************************************************************************************************
+ *  ܣѷڴ鳬ߴĲֲֳµĿڴ                                   *
+ *  (1) pTlsf     TLSFѽṹַ                                                           *
+ *        (2) pBlock    ѷڴַ                                                         *
+ *        (3) size      Ҫֽ                                                   *
+ *  :                                                                                      *
+ *  ˵ֳĿڴڵĺһڴϲ                             *
+ *************************************************************************************************/
+static void TrimBlock(TMemTlsf* pTlsf, TTlsfBlock* pBlock, TBase32 size)
+{
+    TTlsfBlock* pRest;
+    TTlsfBlock* pNext;
+    TBase32 bytes;
+
+    bytes = BLOCK_SIZE(pBlock);
+    if (bytes >= size + BLOCK_HEAD_BYTES + BLOCK_MIN_BYTES)
+    {
+        pBlock->Size = size;
+        pRest = BLOCK_NEXT(pBlock);
+        pRest->PrevPhys = pBlock;
+        pRest->Size = bytes - size - BLOCK_HEAD_BYTES;
+
+        pNext = BLOCK_NEXT(pRest);
+        if (BLOCK_IS_FREE(pNext))
+        {
+            RemoveFreeBlock(pTlsf, pNext);
+            pRest->Size += BLOCK_HEAD_BYTES + BLOCK_SIZE(pNext);
+            pNext = BLOCK_NEXT(pRest);
+        }
+        pNext->PrevPhys = pRest;
+        InsertFreeBlock(pTlsf, pRest);
+    }
+}
+
+
+/*************************************************************************************************
+ *  ܣͷŵĵַǷĳѷڴַ                                     *
+ *  (1) pTlsf     TLSFѽṹַ                                                           *
+ *        (2) pAddr     ĵַ                                                             *
+ *  : (1) MEM_ERR_NONE      ַϷ                                                         *
+ *        (2) MEM_ERR_BAD_ADDR  ַǷ                                                         *
+ *        (3) MEM_ERR_DBL_FREE  ڴѾͷ                                                 *
+ *  ˵ͨڴǰָ뻥ӡ֤Ҫ                                     *
+ *************************************************************************************************/
+static TError CheckBlock(TMemTlsf* pTlsf, void* pAddr)
+{
+    TTlsfBlock* pBlock;
+    TTlsfBlock* pNext;
+    TChar* pLast;
+
+    pLast = pTlsf->HeapAddr + pTlsf->HeapBytes - BLOCK_HEAD_BYTES;
+    if (((TChar*)pAddr < pTlsf->HeapAddr + BLOCK_HEAD_BYTES) || ((TChar*)pAddr > pLast) ||
+            (((TChar*)pAddr - pTlsf->HeapAddr) % TLSF_ALIGN_BYTES))
+    {
+        return MEM_ERR_BAD_ADDR;
+    }
+
+    pBlock = DATA_BLOCK(pAddr);
+    if (BLOCK_IS_FREE(pBlock))
+    {
+        return MEM_ERR_DBL_FREE;
+    }
+
+    if (BLOCK_SIZE(pBlock) > (TBase32)(pLast - (TChar*)pAddr))
+    {
+        return MEM_ERR_BAD_ADDR;
+    }
+
+    pNext = BLOCK_NEXT(pBlock);
+    if (pNext->PrevPhys != pBlock)
+    {
+        return MEM_ERR_BAD_ADDR;
+    }
+
+    if ((pBlock->PrevPhys != (TTlsfBlock*)0) && (BLOCK_NEXT(pBlock->PrevPhys) != pBlock))
+    {
+        return MEM_ERR_BAD_ADDR;
+    }
+
+    return MEM_ERR_NONE;
+}
+
+
+/*************************************************************************************************
+ *  ܣʼTLSF                                                                           *
+ *  (1) pTlsf     TLSFѽṹַ                                                           *
+ *        (2) pAddr     ɹڴַ                                                       *
+ *        (3) bytes     ɹڴֽ                                                     *
+ *        (4) pError    ϸý                                                             *
+ *  : (1) eSuccess  ɹ                                                                 *
+ *        (2) eFailure  ʧ                                                                 *
+ *  ˵(1 << TCLC_MEMORY_TLSF_MAX_LOG2)ֽڵĲֲڴĩβһߴΪ0    *
+ *        ѷڴΪڱ                                                                 *
+ *************************************************************************************************/
+TState xTlsfCreate(TMemTlsf* pTlsf, void* pAddr, TBase32 bytes, TError* pError)
+{
+    TState state = eFailure;
+    TError error = MEM_ERR_FAULT;
+    TReg32 imask;
+    TChar* pHeap;
+    TBase32 pad;
+    TTlsfBlock* pBlock;
+    TTlsfBlock* pSentinel;
+
+    /* ڴʼַͳȣʹҪ */
+    pad = (TBase32)((TLSF_ALIGN_BYTES - ((TAddr)pAddr % TLSF_ALIGN_BYTES)) % TLSF_ALIGN_BYTES);
+    pHeap = (TChar*)pAddr + pad;
+    bytes = (bytes > pad) ? (bytes - pad) : 0U;
+    if (bytes > (0x1U << TCLC_MEMORY_TLSF_MAX_LOG2))
+    {
+        bytes = (0x1U << TCLC_MEMORY_TLSF_MAX_LOG2);
+    }
+    bytes &= BLOCK_SIZE_MASK;
+
+    CpuEnterCritical(&imask);
+    if (!(pTlsf->Property & MEM_PROP_READY))
+    {
+        if (bytes >= BLOCK_HEAD_BYTES * 2U + BLOCK_MIN_BYTES)
+        {
+            memset(pTlsf, 0U, sizeof(TMemTlsf));
+            pTlsf->HeapAddr  = pHeap;
+            pTlsf->HeapBytes = bytes;
+
+            /* ڴʼΪһڴһڱ */
+            pBlock = (TTlsfBlock*)pHeap;
+            pBlock->PrevPhys = (TTlsfBlock*)0;
+            pBlock->Size = bytes - BLOCK_HEAD_BYTES * 2U;
+            pSentinel = BLOCK_NEXT(pBlock);
+            pSentinel->PrevPhys = pBlock;
+            pSentinel->Size = 0U;
+            InsertFreeBlock(pTlsf, pBlock);
+
+            pTlsf->Property = MEM_PROP_READY;
+            error = MEM_ERR_NONE;
+            state = eSuccess;
+        }
+    }
+    CpuLeaveCritical(imask);
+
+    *pError = error;
+    return state;
+}
+
+
+/*************************************************************************************************
+ *  ܣTLSF                                                                             *
+ *  (1) pTlsf     TLSFѽṹַ                                                           *
+ *        (2) pError    ϸý                                                             *
+ *  : (1) eSuccess  ɹ                                                                 *
+ *        (2) eFailure  ʧ                                                                 *
+ *  ˵                                                                                       *
+ *************************************************************************************************/
+TState xTlsfDelete(TMemTlsf* pTlsf, TError* pError)
+{
+    TReg32 imask;
+    TState state = eFailure;
+    TError error = MEM_ERR_UNREADY;
+
+    CpuEnterCritical(&imask);
+    if (pTlsf->Property & MEM_PROP_READY)
+    {
+        memset(pTlsf, 0U, sizeof(TMemTlsf));
+        error = MEM_ERR_NONE;
+        state = eSuccess;
+    }
+    CpuLeaveCritical(imask);
+
+    *pError = error;
+    return state;
+}
+
+
+/*************************************************************************************************
+ *  ܣTLSFڴ                                                                     *
+ *  (1) pTlsf     TLSFѽṹַ                                                           *
+ *        (2) length    Ҫڴ泤                                                       *
+ *        (3) pAddr2    õڴַָ                                                   *
+ *        (4) pError    ϸý                                                             *
+ *  : (1) eSuccess  ɹ                                                                 *
+ *        (2) eFailure  ʧ                                                                 *
+ *  ˵ʱֻȡλͼҺһβ֣ѵĴСͿڴĿ޹                     *
+ *************************************************************************************************/
+TState xTlsfMemMalloc(TMemTlsf* pTlsf, TBase32 length, void** pAddr2, TError* pError)
+{
+    TState state = eFailure;
+    TError error = MEM_ERR_UNREADY;
+    TReg32 imask;
+    TBase32 size;
+    TBase32 fl;
+    TBase32 sl;
+    TTlsfBlock* pBlock;
+
+    CpuEnterCritical(&imask);
+    if (pTlsf->Property & MEM_PROP_READY)
+    {
+        error = MEM_ERR_NO_MEM;
+        if (length < pTlsf->HeapBytes)
+        {
+            /* 볤ȣʹҪɿָ */
+            size = (length + TLSF_ALIGN_BYTES - 1U) & BLOCK_SIZE_MASK;
+            size = (size < BLOCK_MIN_BYTES) ? BLOCK_MIN_BYTES : size;
+
+            MappingSearch(size, &fl, &sl);
+            if (fl < TLSF_FL_COUNT)
+            {
+                pBlock = FindFreeBlock(pTlsf, fl, sl);
+                if (pBlock != (TTlsfBlock*)0)
+                {
+                    RemoveFreeBlock(pTlsf, pBlock);
+                    TrimBlock(pTlsf, pBlock, size);
+
+                    pTlsf->UsedBytes += BLOCK_SIZE(pBlock);
+                    if (pTlsf->UsedBytes > pTlsf->PeakBytes)
+                    {
+                        pTlsf->PeakBytes = pTlsf->UsedBytes;
+                    }
+
+                    *pAddr2 = BLOCK_DATA(pBlock);
+                    KNL_TRACE(TRACE_EVENT_MALLOC, length, TRACE_MEM_TLSF, *pAddr2);
+                    error = MEM_ERR_NONE;
+                    state = eSuccess;
+                }
+            }
+        }
+    }
+    CpuLeaveCritical(imask);
+
+    *pError = error;
+    return state;
+}
+
+
+/*************************************************************************************************
+ *  ܣTLSFͷڴ                                                                     *
+ *  (1) pTlsf     TLSFѽṹַ                                                           *
+ *        (2) pAddr     ͷŵڴַ                                                         *
+ *        (3) pError    ϸý                                                             *
+ *  : (1) eSuccess  ɹ                                                                 *
+ *        (2) eFailure  ʧ                                                                 *
+ *  ˵ͷŵڴڵĿڴϲвڵڴ         *
+ *************************************************************************************************/
+TState xTlsfMemFree(TMemTlsf* pTlsf, void* pAddr, TError* pError)
+{
+    TState state = eFailure;
+    TError error = MEM_ERR_UNREADY;
+    TReg32 imask;
+    TTlsfBlock* pBlock;
+    TTlsfBlock* pPrev;
+    TTlsfBlock* pNext;
+
+    CpuEnterCritical(&imask);
+    if (pTlsf->Property & MEM_PROP_READY)
+    {
+        error = CheckBlock(pTlsf, pAddr);
+        if (error == MEM_ERR_NONE)
+        {
+            pBlock = DATA_BLOCK(pAddr);
+            pTlsf->UsedBytes -= BLOCK_SIZE(pBlock);
+
+            /* ڵǰһڴϲ */
+            pPrev = pBlock->PrevPhys;
+            if ((pPrev != (TTlsfBlock*)0) && BLOCK_IS_FREE(pPrev))
+            {
+                RemoveFreeBlock(pTlsf, pPrev);
+                pPrev->Size += BLOCK_HEAD_BYTES + BLOCK_SIZE(pBlock);
+
+                /* ̲ĿͷбǣԱʶŵظͷ */
+                pBlock->Size |= BLOCK_FREE;
+                pBlock = pPrev;
+            }
+
+            /* ڵĺһڴϲ */
+            pNext = BLOCK_NEXT(pBlock);
+            if (BLOCK_IS_FREE(pNext))
+            {
+                RemoveFreeBlock(pTlsf, pNext);
+                pBlock->Size += BLOCK_HEAD_BYTES + BLOCK_SIZE(pNext);
+                pNext = BLOCK_NEXT(pBlock);
+            }
+            pNext->PrevPhys = pBlock;
+            InsertFreeBlock(pTlsf, pBlock);
+
+            KNL_TRACE(TRACE_EVENT_FREE, 0U, TRACE_MEM_TLSF, pAddr);
+            state = eSuccess;
+        }
+    }
+    CpuLeaveCritical(imask);
+
+    *pError = error;
+    return state;
+}
+
+
+/*************************************************************************************************
+ *  ܣTLSFѷڴĳ                                                           *
+ *  (1) pTlsf     TLSFѽṹַ                                                           *
+ *        (2) pAddr     ѷڴַΪ0ʱͬڴ                                    *
+ *        (3) length    µڴ泤                                                             *
+ *        (4) pAddr2    ֮ڴַָ                                                   *
+ *        (5) pError    ϸý                                                             *
+ *  : (1) eSuccess  ɹ                                                                 *
+ *        (2) eFailure  ʧ                                                                 *
+ *  ˵Сߺһڴ㹻ʱԭصڴ棬ڿжϵ¸     *
+ *        ݣͷԭڴ档ʧʱԭڴ汣ֲ                                               *
+ *************************************************************************************************/
+TState xTlsfMemRealloc(TMemTlsf* pTlsf, void* pAddr, TBase32 length, void** pAddr2,
+                       TError* pError)
+{
+    TState state = eFailure;
+    TError error = MEM_ERR_UNREADY;
+    TReg32 imask;
+    TBase32 size;
+    TBase32 bytes = 0U;
+    TBase32 avail;
+    TTlsfBlock* pBlock;
+    TTlsfBlock* pNext;
+
+    if (pAddr == (void*)0)
+    {
+        return xTlsfMemMalloc(pTlsf, length, pAddr2, pError);
+    }
+
+    CpuEnterCritical(&imask);
+    if (pTlsf->Property & MEM_PROP_READY)
+    {
+        error = CheckBlock(pTlsf, pAddr);
+        if (error == MEM_ERR_NONE)
+        {
+            error = MEM_ERR_NO_MEM;
+            if (length < pTlsf->HeapBytes)
+            {
+                size = (length + TLSF_ALIGN_BYTES - 1U) & BLOCK_SIZE_MASK;
+                size = (size < BLOCK_MIN_BYTES) ? BLOCK_MIN_BYTES : size;
+
+                pBlock = DATA_BLOCK(pAddr);
+                bytes = BLOCK_SIZE(pBlock);
+                pNext = BLOCK_NEXT(pBlock);
+                avail = BLOCK_IS_FREE(pNext) ? (bytes + BLOCK_HEAD_BYTES + BLOCK_SIZE(pNext)) : bytes;
+
+                /* ԭصҪʱ̲һڴ飬ٰѶಿֲֳȥ */
+                if (avail >= size)
+                {
+                    if (avail > bytes)
+                    {
+                        RemoveFreeBlock(pTlsf, pNext);
+                        pBlock->Size = avail;
+                        BLOCK_NEXT(pBlock)->PrevPhys = pBlock;
+                    }
+                    TrimBlock(pTlsf, pBlock, size);
+
+                    pTlsf->UsedBytes = pTlsf->UsedBytes - bytes + BLOCK_SIZE(pBlock);
+                    if (pTlsf->UsedBytes > pTlsf->PeakBytes)
+                    {
+                        pTlsf->PeakBytes = pTlsf->UsedBytes;
+                    }
+
+                    *pAddr2 = pAddr;
+                    KNL_TRACE(TRACE_EVENT_MALLOC, length, TRACE_MEM_TLSF, pAddr);
+                    error = MEM_ERR_NONE;
+                    state = eSuccess;
+                    bytes = 0U;
+                }
+            }
+        }
+    }
+    CpuLeaveCritical(imask);
+
+    /* ޷ԭصʱڴ沢 */
+    if (bytes != 0U)
+    {
+        state = xTlsfMemMalloc(pTlsf, length, pAddr2, &error);
+        if (state == eSuccess)
+        {
+            memcpy(*pAddr2, pAddr, (bytes < length) ? bytes : length);
+            state = xTlsfMemFree(pTlsf, pAddr, &error);
+        }
+    }
+
+    *pError = error;
+    return state;
+}
+
+
+/*************************************************************************************************
+ *  ܣTLSFѵͳϢ                                                                   *
+ *  (1) pTlsf     TLSFѽṹַ                                                           *
+ *        (2) pInfo     ͳϢĽṹַ                                                   *
+ *        (3) pError    ϸý                                                             *
+ *  : (1) eSuccess  ɹ                                                                 *
+ *        (2) eFailure  ʧ                                                                 *
+ *  ˵Ƭ = (ֽ - ڴֽ) * 100 / ֽڴֻ    *
+ *        ܴߵķǿշУΪƹжʱ䣬ֻͷ                   *
+ *        TLSF_INFO_SCAN_BLOCKSڴ飬õڴƫСһ    *
+ *        Ŀ                                                                                 *
+ *************************************************************************************************/
+TState xTlsfGetInfo(TMemTlsf* pTlsf, TTlsfInfo* pInfo, TError* pError)
+{
+    TState state = eFailure;
+    TError error = MEM_ERR_UNREADY;
+    TReg32 imask;
+    TBase32 fl;
+    TBase32 sl;
+    TTlsfBlock* pBlock;
+    TBase32 count;
+    TBase32 total;
+    TBase32 frag;
+
+    CpuEnterCritical(&imask);
+    if (pTlsf->Property & MEM_PROP_READY)
+    {
+        pInfo->HeapBytes   = pTlsf->HeapBytes;
+        pInfo->FreeBytes   = pTlsf->FreeBytes;
+        pInfo->UsedBytes   = pTlsf->UsedBytes;
+        pInfo->PeakBytes   = pTlsf->PeakBytes;
+        pInfo->FreeBlocks  = pTlsf->FreeBlocks;
+        pInfo->LargestFree = 0U;
+        pInfo->Fragment    = 0U;
+
+        if (pTlsf->FlMap != 0U)
+        {
+            fl = FLS(pTlsf->FlMap);
+            sl = FLS(pTlsf->SlMap[fl]);
+            pBlock = pTlsf->Blocks[fl][sl];
+            for (count = 0U; (pBlock != (TTlsfBlock*)0) && (count < TLSF_INFO_SCAN_BLOCKS); count++)
+            {
+                if (BLOCK_SIZE(pBlock) > pInfo->LargestFree)
+                {
+                    pInfo->LargestFree = BLOCK_SIZE(pBlock);
+                }
+                pBlock = pBlock->NextFree;
+            }
+
+            /* ֽ100ܳ32λȰͬʱС */
+            total = pInfo->FreeBytes;
+            frag = pInfo->FreeBytes - pInfo->LargestFree;
+            while (total > (0xFFFFFFFFU / 100U))
+            {
+                total >>= 1U;
+                frag >>= 1U;
+            }
+            pInfo->Fragment = frag * 100U / total;
+        }
+
+        error = MEM_ERR_NONE;
+        state = eSuccess;
+    }
+    CpuLeaveCritical(imask);
+
+    *pError = error;
+    return state;
+}
+
+#endif
+
@@ -12,6 +12,7 @@
 #include "tcl.kernel.h"
 #include "tcl.thread.h"
 #include "tcl.debug.h"
+#include "tcl.trace.h"
 #include "tcl.irq.h"
 
 #if (TCLC_IRQ_ENABLE)
@@ -52,12 +53,16 @@ void xIrqEnterISR(TIndex irqn)
     TISR        pISR;
     TArgument   data;
     TBitMask    retv = IRQ_ISR_DONE;
+#if ((TCLC_PROBE_ENABLE) && (TCLC_PROBE_LATENCY_ENABLE))
+    TBase32     stamp = CpuGetCycleCount();
+#endif
 
     KNL_ASSERT((irqn < TCLC_CPU_IRQ_NUM), "");
     CpuEnterCritical(&imask);
+    KNL_TRACE(TRACE_EVENT_IRQ_ENTER, irqn, 0U, 0U);
 
     /* úжϺŶӦж */
-    pVector = (TIrqVector*)(IrqMapTable[irqn]);
+    pVector = (TIrqVector*)(TAddr)(IrqMapTable[irqn]);
     if ((pVector != (TIrqVector*)0) &&
             (pVector->Property & IRQ_VECTOR_PROP_READY))
     {
@@ -80,12 +85,20 @@ void xIrqEnterISR(TIndex irqn)
                 (pVector->ASR != (TThread*)0))
         {
             state = uThreadSetReady(pVector->ASR, eThreadSuspended, &error);
+#if ((TCLC_PROBE_ENABLE) && (TCLC_PROBE_LATENCY_ENABLE))
+            /* ASRĻӳٴӽ뱾ʱ̿ʼ㣬Ӳѹջжת */
+            if (state == eSuccess)
+            {
+                uProbeIrqWakeup(&(pVector->ASR->Probe), &(pVector->Latency), stamp);
+            }
+#endif
             state = state;
         }
 
         pVector->Property &= (~IRQ_VECTOR_PROP_LOCKED);
     }
 
+    KNL_TRACE(TRACE_EVENT_IRQ_LEAVE, irqn, retv, 0U);
     CpuLeaveCritical(imask);
 }
 
@@ -114,7 +127,7 @@ TState xIrqSetVector(TIndex irqn, TISR pISR, TThread* pASR, TArgument data, TErr
     /* ָжϺѾעжôֱӸ */
     if (IrqMapTable[irqn] != (TAddr32)0)
     {
-        pVector = (TIrqVector*)(IrqMapTable[irqn]);
+        pVector = (TIrqVector*)(TAddr)(IrqMapTable[irqn]);
 
         /* ֮ǰȷûб */
         if ((pVector->Property & IRQ_VECTOR_PROP_LOCKED))
@@ -136,9 +149,12 @@ TState xIrqSetVector(TIndex irqn, TISR pISR, TThread* pASR, TArgument data, TErr
             if (!(pVector->Property & IRQ_VECTOR_PROP_READY))
             {
                 /* жϺźͶӦжϵ */
-                IrqMapTable[irqn] = (TAddr32)pVector;
+                IrqMapTable[irqn] = (TAddr32)(TAddr)pVector;
                 pVector->IRQn       = irqn;
                 pVector->Property   = IRQ_VECTOR_PROP_READY;
+#if ((TCLC_PROBE_ENABLE) && (TCLC_PROBE_LATENCY_ENABLE))
+                memset(&(pVector->Latency), 0, sizeof(TLatencyStats));
+#endif
 
                 error = IRQ_ERR_NONE;
                 state = eSuccess;
@@ -159,6 +175,9 @@ TState xIrqSetVector(TIndex irqn, TISR pISR, TThread* pASR, TArgument data, TErr
         pVector->ISR      = pISR;
         pVector->ASR      = pASR;
         pVector->Argument = data;
+
+        /* עжжϻںAPIȼܱٽ */
+        CpuSetIrqPriority(irqn);
     }
 
     CpuLeaveCritical(imask);
@@ -186,7 +205,7 @@ TState xIrqCleanVector(TIndex irqn, TError* pError)
     /* ҵжϢ */
     if (IrqMapTable[irqn] != (TAddr32)0)
     {
-        pVector = (TIrqVector*)(IrqMapTable[irqn]);
+        pVector = (TIrqVector*)(TAddr)(IrqMapTable[irqn]);
         if ((pVector->Property & IRQ_VECTOR_PROP_READY) &&
                 (pVector->IRQn == irqn))
         {
@@ -253,6 +272,7 @@ TState xIrqPostRequest(TIrq* pIRQ, TPriority priority, TIrqEntry pEntry, TArgume
         pIRQ->ObjNode.Data   = (TBase32*)(&(pIRQ->Priority));
         pIRQ->ObjNode.Owner  = (void*)pIRQ;
         uObjListAddPriorityNode(&(IrqReqList.Handle), &(pIRQ->ObjNode));
+        KNL_TRACE(TRACE_EVENT_IRQ_POST, priority, 0U, pEntry);
 
         error = IRQ_ERR_NONE;
         state = eSuccess;
@@ -11,6 +11,7 @@
 #include "tcl.thread.h"
 #include "tcl.timer.h"
 #include "tcl.debug.h"
+#include "tcl.trace.h"
 #include "tcl.kernel.h"
 
 /* ں˹ؼ */
@@ -66,6 +67,13 @@ void uKernelEnterIntrState(void)
     uKernelVariable.IntrNestTimes++;
     uKernelVariable.State = eIntrState;
 
+#if ((TCLC_PROBE_ENABLE) && (TCLC_PROBE_CPU_STATS_ENABLE))
+    if (uKernelVariable.IntrNestTimes == 1U)
+    {
+        uProbeIntrEnter();
+    }
+#endif
+
     CpuLeaveCritical(imask);
 }
 
@@ -93,8 +101,15 @@ void uKernelLeaveIntrState(void)
         if (uKernelVariable.Schedulable == eTrue)
         {
             uThreadSchedule();
+#if ((TCLC_PROBE_ENABLE) && (TCLC_PROBE_LATENCY_ENABLE))
+            uProbeScheduleMark();
+#endif
         }
         uKernelVariable.State = eThreadState;
+
+#if ((TCLC_PROBE_ENABLE) && (TCLC_PROBE_CPU_STATS_ENABLE))
+        uProbeIntrLeave();
+#endif
     }
 
     CpuLeaveCritical(imask);
@@ -105,22 +120,24 @@ void uKernelLeaveIntrState(void)
  *  ܣʱӽжϴ                                                                   *
  *                                                                                       *
  *  أ                                                                                     *
- *  ˵ʱУ̵߳ȴ                                           *
+ *  ˵ʱУ̵߳ȴ                                         *
+ *        ʱٽ֮УԼÿֻٽڴһʱ                     *
+ *        ʱӽжϵĹжʱǳͬʱʱĶʱĿ                       *
  *************************************************************************************************/
 void xKernelTickISR(void)
 {
     TReg32 imask;
 
     CpuEnterCritical(&imask);
-
     uKernelVariable.Jiffies++;
+    CpuLeaveCritical(imask);
 
 #if (TCLC_TIMER_ENABLE)
     uTimerTickISR();
 #endif
 
+    CpuEnterCritical(&imask);
     uThreadTickISR();
-
     CpuLeaveCritical(imask);
 }
 
@@ -243,6 +260,9 @@ void xKernelStart(TUserEntry pUserEntry,
     uKernelVariable.Schedulable     = eTrue;
 
     /* ʼںģ */
+#if (TCLC_TRACE_ENABLE)
+    uTraceModuleInit();                     /* ʼں¼¼ģ       */
+#endif
     uThreadModuleInit();                    /* ʼ̹߳ģ           */
 #if (TCLC_TIMER_ENABLE)
     uTimerModuleInit();                     /* ʼʱģ             */
@@ -286,6 +306,59 @@ static TThread IdleDaemonThread;
 /* ں˳ʼ̲߳κ̹߳API */
 #define IDLE_DAEMON_ACAPI (THREAD_ACAPI_NONE)
 
+#if (TCLC_TICKLESS_ENABLE)
+/*************************************************************************************************
+ *  ܣں޽ߺ                                                                     *
+ *                                                                                       *
+ *  أ                                                                                     *
+ *  ˵ֻIDLE߳̾ʱֹͣжֱĶʱʱѺһԲڼĽ *
+ *        ڼһĽжϴʱĶʱ̴               *
+ *************************************************************************************************/
+static void TicklessSleep(void)
+{
+    TReg32 imask;
+    TTimeTick ticks = TCLC_TICKLESS_MAX_TICKS;
+    TTimeTick elapsed;
+#if (TCLC_TIMER_ENABLE)
+    TTimeTick match;
+#endif
+
+    CpuEnterCritical(&imask);
+
+    /* ֻIDLE߳̾ʱ */
+    if ((uKernelVariable.Schedulable == eTrue) &&
+            (uKernelVariable.ThreadReadyQueue->PriorityMask == (0x1U << TCLC_IDLE_DAEMON_PRIORITY)))
+    {
+        /* Ķʱʱжٸ */
+#if (TCLC_TIMER_ENABLE)
+        match = uTimerGetNextMatch();
+        if (match <= uKernelVariable.Jiffies)
+        {
+            ticks = 0U;
+        }
+        else if ((match - uKernelVariable.Jiffies) < ticks)
+        {
+            ticks = match - uKernelVariable.Jiffies;
+        }
+#endif
+
+        if (ticks >= TCLC_TICKLESS_MIN_TICKS)
+        {
+            elapsed = CpuTicklessSleep(ticks);
+#if (TCLC_PROBE_ENABLE)
+            /* ڼжϿԻѴʱ䲻жʱ */
+            uProbeIrqOffEnter();
+#endif
+            uKernelVariable.Jiffies += elapsed;
+            uKernelVariable.IdleDaemon->Jiffies += elapsed;
+        }
+    }
+
+    CpuLeaveCritical(imask);
+}
+#endif
+
+
 /*************************************************************************************************
  *  ܣں˳ʼ̺߳                                                                     *
  *  (1) argument IDLE̵߳Ĳ                                                            *
@@ -327,6 +400,10 @@ static void IdleDaemonEntry(TBase32 argument)
         {
             uKernelVariable.SysIdleEntry();
         }
+
+#if (TCLC_TICKLESS_ENABLE)
+        TicklessSleep();
+#endif
     }
 }
 
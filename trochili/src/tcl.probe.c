@@ -0,0 +1,404 @@
+/*************************************************************************************************
+ *                                     Trochili RTOS Kernel                                      *
+ *                                  Copyright(C) 2016 LIUXUMING                                  *
+ *                                       www.trochili.com                                        *
+ *************************************************************************************************/
+#include <string.h>
+
+#include "tcl.types.h"
+#include "tcl.config.h"
+#include "tcl.cpu.h"
+#include "tcl.kernel.h"
+#include "tcl.thread.h"
+#include "tcl.irq.h"
+#include "tcl.probe.h"
+
+#if (TCLC_PROBE_ENABLE)
+
+/* PendSVʱ */
+static TBase32 ProbeSwitchStamp;
+
+#if (TCLC_PROBE_LATENCY_ENABLE)
+/* ںȫӳͳ */
+static TLatencyStats ProbeSwitchStats;
+static TLatencyStats ProbeScheduleStats;
+
+/* жϷȵʱ */
+static TBase32 ProbeScheduleStamp;
+static TBool   ProbeSchedulePending = eFalse;
+
+/* ٽĹжʱͳƣԼٽʱ */
+static TLatencyStats ProbeIrqOffStats;
+static TBase32 ProbeIrqOffStamp;
+#endif
+
+#if (TCLC_PROBE_CPU_STATS_ENABLE)
+/* ж(PendSV)ռôͳƣԼһμ봦ռõʱ */
+static TThreadStats ProbeIntrStats;
+static TBase32      ProbeCpuStamp;
+
+/* PendSVʱĵǰ߳ */
+static TThread*     ProbeOutgoing;
+#endif
+
+#if (TCLC_PROBE_LATENCY_ENABLE)
+
+/*************************************************************************************************
+ *  ܣ¼һӳٲ                                                                       *
+ *  (1) pStats ӳͳƽṹַ                                                            *
+ *        (2) cycles ӳ                                                                  *
+ *  أ                                                                                     *
+ *  ˵n(n>0)ֱͼͰ¼[2^(SHIFT+n-1), 2^(SHIFT+n))ΧڵĲһͰ     *
+ *************************************************************************************************/
+static void RecordLatency(TLatencyStats* pStats, TBase32 cycles)
+{
+    TBase32 value = cycles >> TCLC_PROBE_BUCKET_SHIFT;
+    TIndex  bucket = 0U;
+
+    while ((value != 0U) && (bucket < (TCLC_PROBE_HISTOGRAM_BUCKETS - 1U)))
+    {
+        value >>= 1U;
+        bucket++;
+    }
+    pStats->Histogram[bucket]++;
+
+    if ((pStats->Count == 0U) || (cycles < pStats->Min))
+    {
+        pStats->Min = cycles;
+    }
+    if (cycles > pStats->Max)
+    {
+        pStats->Max = cycles;
+    }
+    pStats->Count++;
+}
+
+
+/*************************************************************************************************
+ *  ܣ¼߳̽еʱ                                                             *
+ *  (1) pProbe ߳̽ṹַ                                                            *
+ *  أ                                                                                     *
+ *  ˵ڹж״̬µ                                                                 *
+ *************************************************************************************************/
+void uProbeThreadReady(TThreadProbe* pProbe)
+{
+    pProbe->Pending   = eTrue;
+    pProbe->Stamp     = CpuGetCycleCount();
+    pProbe->pIrqStats = (TLatencyStats*)0;
+}
+
+
+/*************************************************************************************************
+ *  ܣ¼жϻѵASR̶߳Ӧںжʱ                                          *
+ *  (1) pProbe ߳̽ṹַ                                                            *
+ *        (2) pStats жӳͳƽṹַ                                                  *
+ *        (3) stamp  xIrqEnterISRʱڼ                                                *
+ *  أ                                                                                     *
+ *  ˵̻߳ӳҲһʱ̿ʼ㣬Ӳѹջжת                         *
+ *************************************************************************************************/
+void uProbeIrqWakeup(TThreadProbe* pProbe, TLatencyStats* pStats, TBase32 stamp)
+{
+    pProbe->Pending   = eTrue;
+    pProbe->Stamp     = stamp;
+    pProbe->pIrqStats = pStats;
+}
+
+
+/*************************************************************************************************
+ *  ܣ¼ж˳ʱ̵߳ȵʱ                                                 *
+ *                                                                                       *
+ *  أ                                                                                     *
+ *  ˵ֻȷʵҪл߳ʱż¼                                                           *
+ *************************************************************************************************/
+void uProbeScheduleMark(void)
+{
+    if (uKernelVariable.NomineeThread != uKernelVariable.CurrentThread)
+    {
+        ProbeScheduleStamp   = CpuGetCycleCount();
+        ProbeSchedulePending = eTrue;
+    }
+}
+
+
+#endif
+
+
+#if (TCLC_PROBE_CPU_STATS_ENABLE)
+/*************************************************************************************************
+ *  ܣѴһͳʱ̵ڵĴڼָͳƽṹ                                 *
+ *  (1) pStats ռͳƽṹַ                                                      *
+ *        (2) now    ǰڼ                                                                *
+ *  أ                                                                                     *
+ *  ˵ڹж״̬µ                                                                 *
+ *************************************************************************************************/
+static void ChargeCycles(TThreadStats* pStats, TBase32 now)
+{
+    pStats->Cycles += (TTimeStamp)(now - ProbeCpuStamp);
+    ProbeCpuStamp = now;
+}
+
+
+/*************************************************************************************************
+ *  ܣжϽʱ̽                                                                 *
+ *                                                                                       *
+ *  أ                                                                                     *
+ *  ˵ж̵߳ʱֹ˿̣uKernelEnterIntrStateڹж״̬µ              *
+ *************************************************************************************************/
+void uProbeIntrEnter(void)
+{
+    ChargeCycles(&(uKernelVariable.CurrentThread->Probe.Stats), CpuGetCycleCount());
+    ProbeIntrStats.SwitchIn++;
+}
+
+
+/*************************************************************************************************
+ *  ܣж˳ʱ̽                                                                 *
+ *                                                                                       *
+ *  أ                                                                                     *
+ *  ˵uKernelLeaveIntrStateڹж״̬µ                                              *
+ *************************************************************************************************/
+void uProbeIntrLeave(void)
+{
+    ChargeCycles(&ProbeIntrStats, CpuGetCycleCount());
+}
+#endif
+
+
+/*************************************************************************************************
+ *  ܣ߳лʼʱ̽                                                                   *
+ *                                                                                       *
+ *  أ                                                                                     *
+ *  ˵PendSV_Handlerڱ浱ǰ֮߳ǰ                                           *
+ *************************************************************************************************/
+void uProbeSwitchEnter(void)
+{
+#if (TCLC_PROBE_CPU_STATS_ENABLE)
+    TThread* pThread = uKernelVariable.CurrentThread;
+#endif
+
+    ProbeSwitchStamp = CpuGetCycleCount();
+
+#if (TCLC_PROBE_CPU_STATS_ENABLE)
+    /* ̵߳ʱֹ˿̣״̬˵̱߳ռó */
+    ChargeCycles(&(pThread->Probe.Stats), ProbeSwitchStamp);
+    ProbeOutgoing = pThread;
+    if (pThread != uKernelVariable.NomineeThread)
+    {
+        if (pThread->Status == eThreadReady)
+        {
+            pThread->Probe.Stats.Preemptions++;
+        }
+        else
+        {
+            pThread->Probe.Stats.Blocks++;
+        }
+    }
+#endif
+}
+
+
+/*************************************************************************************************
+ *  ܣ߳лʱ̽                                                                   *
+ *                                                                                       *
+ *  أ                                                                                     *
+ *  ˵PendSV_Handlerڻָ֮߳쳣֮ǰãʱʱ̾߳         *
+ *        һִָʱ                                                                   *
+ *************************************************************************************************/
+void uProbeSwitchLeave(void)
+{
+    TBase32 now = CpuGetCycleCount();
+    TThreadProbe* pProbe = &(uKernelVariable.CurrentThread->Probe);
+
+#if (TCLC_PROBE_CPU_STATS_ENABLE)
+    /* ߳лĺʱжռ */
+    ChargeCycles(&ProbeIntrStats, now);
+    if (uKernelVariable.CurrentThread != ProbeOutgoing)
+    {
+        pProbe->Stats.SwitchIn++;
+    }
+#endif
+
+#if (TCLC_PROBE_LATENCY_ENABLE)
+    RecordLatency(&ProbeSwitchStats, now - ProbeSwitchStamp);
+
+    if (ProbeSchedulePending == eTrue)
+    {
+        RecordLatency(&ProbeScheduleStats, now - ProbeScheduleStamp);
+        ProbeSchedulePending = eFalse;
+    }
+
+    if (pProbe->Pending == eTrue)
+    {
+        RecordLatency(&(pProbe->Latency), now - pProbe->Stamp);
+        if (pProbe->pIrqStats != (TLatencyStats*)0)
+        {
+            RecordLatency(pProbe->pIrqStats, now - pProbe->Stamp);
+        }
+        pProbe->Pending = eFalse;
+    }
+#endif
+}
+
+
+/*************************************************************************************************
+ *  ܣжϿʼʱ̽                                                                     *
+ *                                                                                       *
+ *  أ                                                                                     *
+ *  ˵CpuEnterCriticalڹرж֮ãֻ¼ٽ                             *
+ *************************************************************************************************/
+void uProbeIrqOffEnter(void)
+{
+#if (TCLC_PROBE_LATENCY_ENABLE)
+    ProbeIrqOffStamp = CpuGetCycleCount();
+#endif
+}
+
+
+/*************************************************************************************************
+ *  ܣжϽʱ̽                                                                     *
+ *                                                                                       *
+ *  أ                                                                                     *
+ *  ˵CpuLeaveCriticalڴж֮ǰãֻ¼ٽ                             *
+ *************************************************************************************************/
+void uProbeIrqOffLeave(void)
+{
+#if (TCLC_PROBE_LATENCY_ENABLE)
+    RecordLatency(&ProbeIrqOffStats, CpuGetCycleCount() - ProbeIrqOffStamp);
+#endif
+}
+
+
+#if (TCLC_PROBE_LATENCY_ENABLE)
+/*************************************************************************************************
+ *  ܣӳͳ                                                                       *
+ *  (1) type    ӳͳ                                                               *
+ *        (2) object  ͳƶ󣬰жͳʱжϺţ߳ͳʱ߳̽ṹַ                 *
+ *        (3) pStats  ͳ                                                               *
+ *        (4) pError  ϸý                                                               *
+ *  : (1) eFailure ʧ                                                                  *
+ *        (2) eSuccess ɹ                                                                  *
+ *  ˵ڹж״̬¸ͳݣõһµĿ                                         *
+ *************************************************************************************************/
+TState xProbeGetLatency(TIndex type, TArgument object, TLatencyStats* pStats, TError* pError)
+{
+    TState state = eFailure;
+    TError error = PROBE_ERR_FAULT;
+    TReg32 imask;
+    TLatencyStats* pSource = (TLatencyStats*)0;
+    TThread* pThread;
+#if (TCLC_IRQ_ENABLE)
+    TIrqVector* pVector;
+#endif
+
+    CpuEnterCritical(&imask);
+
+    if (type == PROBE_LATENCY_SWITCH)
+    {
+        pSource = &ProbeSwitchStats;
+    }
+    else if (type == PROBE_LATENCY_SCHEDULE)
+    {
+        pSource = &ProbeScheduleStats;
+    }
+    else if (type == PROBE_LATENCY_IRQ_OFF)
+    {
+        pSource = &ProbeIrqOffStats;
+    }
+#if (TCLC_IRQ_ENABLE)
+    else if (type == PROBE_LATENCY_ASR)
+    {
+        if (object < TCLC_CPU_IRQ_NUM)
+        {
+            pVector = (TIrqVector*)(uKernelVariable.IrqMapTable[object]);
+            if (pVector != (TIrqVector*)0)
+            {
+                pSource = &(pVector->Latency);
+            }
+            else
+            {
+                error = PROBE_ERR_UNREADY;
+            }
+        }
+    }
+#endif
+    else if (type == PROBE_LATENCY_THREAD)
+    {
+        pThread = (TThread*)object;
+        if ((pThread != (TThread*)0) && (pThread->Property & THREAD_PROP_READY))
+        {
+            pSource = &(pThread->Probe.Latency);
+        }
+        else
+        {
+            error = PROBE_ERR_UNREADY;
+        }
+    }
+    else
+    {
+        error = PROBE_ERR_FAULT;
+    }
+
+    if (pSource != (TLatencyStats*)0)
+    {
+        memcpy(pStats, pSource, sizeof(TLatencyStats));
+        error = PROBE_ERR_NONE;
+        state = eSuccess;
+    }
+
+    CpuLeaveCritical(imask);
+
+    *pError = error;
+    return state;
+}
+#endif
+
+
+#if (TCLC_PROBE_CPU_STATS_ENABLE)
+/*************************************************************************************************
+ *  ܣôռͳ                                                                 *
+ *  (1) pThread ߳̽ṹַΪʱжϵͳ                                     *
+ *        (2) pStats  ͳ                                                               *
+ *        (3) pError  ϸý                                                               *
+ *  : (1) eFailure ʧ                                                                  *
+ *        (2) eSuccess ɹ                                                                  *
+ *  ˵ǰ̵߳ͳݰֹʱ̵ʱ                                         *
+ *************************************************************************************************/
+TState xProbeGetThreadStats(TThread* pThread, TThreadStats* pStats, TError* pError)
+{
+    TState state = eFailure;
+    TError error = PROBE_ERR_UNREADY;
+    TReg32 imask;
+
+    CpuEnterCritical(&imask);
+
+    if (pThread == (TThread*)0)
+    {
+        memcpy(pStats, &ProbeIntrStats, sizeof(TThreadStats));
+        error = PROBE_ERR_NONE;
+        state = eSuccess;
+    }
+    else if (pThread->Property & THREAD_PROP_READY)
+    {
+        /* ̻߳µʱȽ㵱ǰ̵߳ʱ */
+        if ((pThread == uKernelVariable.CurrentThread) &&
+                (uKernelVariable.State == eThreadState))
+        {
+            ChargeCycles(&(pThread->Probe.Stats), CpuGetCycleCount());
+        }
+        memcpy(pStats, &(pThread->Probe.Stats), sizeof(TThreadStats));
+        error = PROBE_ERR_NONE;
+        state = eSuccess;
+    }
+    else
+    {
+        error = PROBE_ERR_UNREADY;
+    }
+
+    CpuLeaveCritical(imask);
+
+    *pError = error;
+    return state;
+}
+#endif
+
+#endif
@@ -10,7 +10,9 @@
 #include "tcl.object.h"
 #include "tcl.cpu.h"
 #include "tcl.ipc.h"
+#include "tcl.mutex.h"
 #include "tcl.debug.h"
+#include "tcl.trace.h"
 #include "tcl.kernel.h"
 #include "tcl.timer.h"
 #include "tcl.thread.h"
@@ -31,7 +33,7 @@ static TThreadQueue ThreadAuxiliaryQueue;
  *************************************************************************************************/
 static void CheckThreadStack(TThread* pThread)
 {
-    if ((pThread->StackTop < pThread->StackBarrier) || (*(TBase32*)(pThread->StackBarrier) !=
+    if ((pThread->StackTop < pThread->StackBarrier) || (*(TBase32*)(TAddr)(pThread->StackBarrier) !=
             TCLC_THREAD_STACK_BARRIER_VALUE))
     {
         uKernelVariable.Diagnosis |= KERNEL_DIAG_THREAD_ERROR;
@@ -206,7 +208,16 @@ void uThreadEnterQueue(TThreadQueue* pQueue, TThread* pThread, TQueuePos pos)
     pThread->Queue = pQueue;
 
     /* 趨߳ȼΪȼ */
-    pQueue->PriorityMask |= (0x1 << priority);
+    pQueue->PriorityMask |= (0x1U << priority);
+
+    /* ̴߳״̬ʱ¼ʱ̣ھڵλõ */
+#if ((TCLC_PROBE_ENABLE) && (TCLC_PROBE_LATENCY_ENABLE))
+    if ((pQueue == &ThreadReadyQueue) &&
+            (pThread->Status != eThreadReady) && (pThread->Status != eThreadRunning))
+    {
+        uProbeThreadReady(&(pThread->Probe));
+    }
+#endif
 }
 
 
@@ -240,7 +251,7 @@ void uThreadLeaveQueue(TThreadQueue* pQueue, TThread* pThread)
     if (pQueue->Handle[priority] == (TObjNode*)0)
     {
         /* 趨߳ȼδ */
-        pQueue->PriorityMask &= (~(0x1 << priority));
+        pQueue->PriorityMask &= (~(0x1U << priority));
     }
 }
 
@@ -343,6 +354,8 @@ void uThreadSchedule(void)
 #if (TCLC_THREAD_STACK_CHECK_ENABLE)
         CheckThreadStack(uKernelVariable.NomineeThread);
 #endif
+        KNL_TRACE(TRACE_EVENT_SWITCH, uKernelVariable.CurrentThread->ThreadID,
+                  uKernelVariable.NomineeThread->Priority, uKernelVariable.NomineeThread->ThreadID);
         uKernelVariable.NomineeThread->Status = eThreadRunning;
         if (uKernelVariable.CurrentThread->Status == eThreadRunning)
         {
@@ -386,7 +399,7 @@ void uThreadCreate(TThread* pThread, TThreadStatus status, TProperty property, T
 
     /* ջС4byte */
     bytes &= (~((TBase32)0x3));
-    pThread->StackBase = (TBase32)pStack + bytes;
+    pThread->StackBase = (TBase32)(TAddr)pStack + bytes;
 
     /* ߳ջռ */
     if (property &THREAD_PROP_CLEAN_STACK)
@@ -396,12 +409,12 @@ void uThreadCreate(TThread* pThread, TThreadStatus status, TProperty property, T
 
     /* (α)̳߳ʼջ֡,ｫ߳̽ṹַΪ̼߳ܺ */
     CpuBuildThreadStack(&(pThread->StackTop), pStack, bytes, (void*)(&xSuperviseThread),
-                        (TArgument)pThread);
+                        (TArgument)(TAddr)pThread);
 
     /* ߳ջ澯ַ */
 #if (TCLC_THREAD_STACK_CHECK_ENABLE)
-    pThread->StackAlarm = (TBase32)pStack + bytes - (bytes* TCLC_THREAD_STACK_ALARM_RATIO) / 100;
-    pThread->StackBarrier = (TBase32)pStack;
+    pThread->StackAlarm = (TBase32)(TAddr)pStack + bytes - (bytes* TCLC_THREAD_STACK_ALARM_RATIO) / 100;
+    pThread->StackBarrier = (TBase32)(TAddr)pStack;
     (*(TAddr32*)pStack) = TCLC_THREAD_STACK_BARRIER_VALUE;
 #endif
 
@@ -425,6 +438,11 @@ void uThreadCreate(TThread* pThread, TThreadStatus status, TProperty property, T
     /* ߳Ϣ */
     pThread->Queue = (TThreadQueue*)0;
 
+    /* ߳ӳ̽ */
+#if (TCLC_PROBE_ENABLE)
+    memset(&(pThread->Probe), 0, sizeof(TThreadProbe));
+#endif
+
     /* ̶߳ʱϢ */
 #if (TCLC_TIMER_ENABLE)
     uTimerCreate(&(pThread->Timer), (TProperty)0, eThreadTimer, TCLM_MAX_VALUE64,
@@ -441,6 +459,12 @@ void uThreadCreate(TThread* pThread, TThreadStatus status, TProperty property, T
     pThread->LockList = (TObjNode*)0;
 #endif
 
+    /* ֪߳ͨ */
+#if (TCLC_THREAD_NOTIFY_ENABLE)
+    pThread->NotifyValue = 0U;
+    pThread->NotifyStatus = 0U;
+#endif
+
     /* ʼ߳Ϣ */
     pThread->Diagnosis = THREAD_DIAG_NORMAL;
 
@@ -492,10 +516,14 @@ TState uThreadDelete(TThread* pThread, TError* pError)
 #if (TCLC_TIMER_ENABLE)
             uTimerDelete(&(pThread->Timer));
 #endif
+            /* ͷ߳ջռõĴԴ */
+            CpuReleaseThreadStack(&(pThread->StackTop));
+
             /* ǰ߳ISRȱdeactivate,Ȼdeinitô˳isrʱᷢ߳л
             һԵǰ̵߳ջòҪԱdeinit߳̽ṹڴ
-            ڻԴдdeinitĵǰ̲߳ջ */
-            memset(pThread, 0, sizeof(pThread));
+            ڻԴдdeinitĵǰ̲߳ջ
+            ֻ߳ԣ߳̽ṹΪδʼ */
+            pThread->Property = THREAD_PROP_NONE;
             error = THREAD_ERR_NONE;
             state = eSuccess;
         }
@@ -581,8 +609,10 @@ TState uThreadSetPriority(TThread* pThread, TPriority priority, TBool flag, TErr
         }
         else
         {
-            /*״̶̬߳ڸֱ޸ȼ*/
+            /* ״̶̬߳ڸаȼֶУҪͬ */
+            uThreadLeaveQueue(&ThreadAuxiliaryQueue, pThread);
             pThread->Priority = priority;
+            uThreadEnterQueue(&ThreadAuxiliaryQueue, pThread, eQuePosTail);
             state = eSuccess;
             error = THREAD_ERR_NONE;
         }
@@ -831,12 +861,16 @@ TState xThreadDelete(TThread* pThread, TError* pError)
  *        (2) eSuccess ߳ȼɹ                                                        *
  *  ˵(1) ʱ޸ȼ޸߳̽ṹĻȼ                             *
  *        (2) ʵʩȼ̳ЭʱAUTHORITY                                    *
+ *        (3) ߳ڼ̳ЭĻʱµȼػ                     *
  *************************************************************************************************/
 TState xThreadSetPriority(TThread* pThread, TPriority priority, TError* pError)
 {
     TState state = eFailure;
     TError error = THREAD_ERR_FAULT;
     TReg32 imask;
+#if ((TCLC_IPC_ENABLE) && (TCLC_IPC_MUTEX_ENABLE))
+    TBool HiRP = eFalse;
+#endif
 
     CpuEnterCritical(&imask);
 
@@ -859,6 +893,18 @@ TState xThreadSetPriority(TThread* pThread, TPriority priority, TError* pError)
                         (pThread->Property & THREAD_PROP_PRIORITY_SAFE))
                 {
                     state = uThreadSetPriority(pThread, priority, eTrue, &error);
+
+                    /* ڼ̳Э黥ϵ߳޸ȼ󣬻ϼ̳е
+                       ȼҲҪ֮߳ */
+#if ((TCLC_IPC_ENABLE) && (TCLC_IPC_MUTEX_ENABLE))
+                    if ((state == eSuccess) &&
+                            (pThread->Status == eThreadBlocked) &&
+                            (pThread->IpcContext.Option & IPC_OPT_MUTEX))
+                    {
+                        uMutexResetPriority((TMutex*)(pThread->IpcContext.Object), priority, &HiRP);
+                        uThreadPreempt(HiRP);
+                    }
+#endif
                 }
                 else
                 {
@@ -1180,7 +1226,17 @@ TState xThreadResume(TThread* pThread, TError* pError)
             /* ߳ǷAPI */
             if (pThread->ACAPI &THREAD_ACAPI_RESUME)
             {
-                state = uThreadSetReady(pThread, eThreadSuspended, &error);
+#if (TCLC_THREAD_NOTIFY_ENABLE)
+                /* ޵ȴ֪ͨ߳Ҳڹ״ֵֻ̬֪ܹͨȴ */
+                if (pThread->NotifyStatus & THREAD_NOTIFY_WAITING)
+                {
+                    error = THREAD_ERR_STATUS;
+                }
+                else
+#endif
+                {
+                    state = uThreadSetReady(pThread, eThreadSuspended, &error);
+                }
             }
             else
             {
@@ -1346,3 +1402,157 @@ TState xThreadUndelay(TThread* pThread, TError* pError)
 }
 
 #endif
+
+
+#if (TCLC_THREAD_NOTIFY_ENABLE)
+/*************************************************************************************************
+ *  ܣ̷ָ֪߳ͨ                                                                     *
+ *  (1) pThread ߳̽ṹַ                                                               *
+ *        (2) value   ֪ͨ                                                                   *
+ *        (3) option  ֵ֪ͨĸ·ʽ                                                           *
+ *        (4) pError  ϸý                                                               *
+ *  أ(1) eSuccess                                                                           *
+ *        (2) eFailure                                                                           *
+ *  ˵̺߳ж϶ԵñĿ߳ڵȴ֪ͨ                         *
+ *        ̲漰IPCIPC߳                                                 *
+ *************************************************************************************************/
+TState xThreadNotify(TThread* pThread, TBase32 value, TOption option, TError* pError)
+{
+    TState state = eFailure;
+    TError error = THREAD_ERR_UNREADY;
+    TReg32 imask;
+
+    CpuEnterCritical(&imask);
+
+    /* ߳ǷѾʼ */
+    if (pThread->Property &THREAD_PROP_READY)
+    {
+        /* ָķʽֵ֪߳ͨTHREAD_NOTIFY_GIVEʽ޸ֵ֪ͨ */
+        if (option & THREAD_NOTIFY_SET_BITS)
+        {
+            pThread->NotifyValue |= value;
+        }
+        else if (option & THREAD_NOTIFY_INCREMENT)
+        {
+            pThread->NotifyValue++;
+        }
+        else if (option & THREAD_NOTIFY_OVERWRITE)
+        {
+            pThread->NotifyValue = value;
+        }
+        else
+        {
+            ;
+        }
+        pThread->NotifyStatus |= THREAD_NOTIFY_PENDING;
+
+        /* ߳ڵȴ֪̣ͨ߳ʱʱ̵߳Ķʱᱻֹͣ
+           ߳̿ѾΪʱ߱ȡȴûüУʱش */
+        if ((pThread->NotifyStatus & THREAD_NOTIFY_WAITING) &&
+                (pThread->Status & (eThreadDelayed | eThreadSuspended)))
+        {
+            pThread->NotifyStatus &= ~THREAD_NOTIFY_WAITING;
+            state = uThreadSetReady(pThread, pThread->Status, &error);
+            state = state;
+        }
+
+        error = THREAD_ERR_NONE;
+        state = eSuccess;
+    }
+
+    CpuLeaveCritical(imask);
+
+    *pError = error;
+    return state;
+}
+
+
+/*************************************************************************************************
+ *  ܣǰ̻߳ȡߵȴ֪ͨ                                                               *
+ *  (1) clear   ȡ֪ͨҪֵ֪ͨλ                                           *
+ *        (2) pValue  ȡ֪ͨʱֵ֪ͨ                                                     *
+ *        (3) option  ȴʽ                                                                   *
+ *        (4) timeo   ʱ޵ȴʽµĵȴʱ                                                   *
+ *        (5) pError  ϸý                                                               *
+ *  أ(1) eSuccess                                                                           *
+ *        (2) eFailure                                                                           *
+ *  ˵ʱ޵ȴ߳ԴĶʱȴڼ̴߳ʱ״̬޵ȴʱ̴߳ڹ״̬   *
+ *        ǲܱTclResumeThreadѡȴû֪ͨʱTHREAD_ERR_EMPTYֻ߳    *
+ *        ñ                                                                             *
+ *************************************************************************************************/
+TState xThreadWaitNotify(TBase32 clear, TBase32* pValue, TOption option, TTimeTick timeo,
+                         TError* pError)
+{
+    TState state = eFailure;
+    TError error = THREAD_ERR_FAULT;
+    TThread* pThread;
+    TReg32 imask;
+
+    CpuEnterCritical(&imask);
+
+    /* ̴ֻ߳ñ */
+    if (uKernelVariable.State == eThreadState)
+    {
+        pThread = uKernelVariable.CurrentThread;
+        error = THREAD_ERR_EMPTY;
+
+        /* ûδȡߵ֪ͨȴǰ̷߳ */
+        if ((!(pThread->NotifyStatus & THREAD_NOTIFY_PENDING)) && (option & THREAD_NOTIFY_WAIT))
+        {
+            pThread->NotifyStatus |= THREAD_NOTIFY_WAITING;
+#if (TCLC_TIMER_ENABLE)
+            if (option & THREAD_NOTIFY_TIMED)
+            {
+                state = uThreadSetUnready(pThread, eThreadDelayed, timeo, &error);
+            }
+            else
+#endif
+            {
+                state = uThreadSetUnready(pThread, eThreadSuspended, 0U, &error);
+            }
+
+            if (state == eSuccess)
+            {
+                CpuLeaveCritical(imask);
+                /* ʱ˴һεȣǰ߳Ѿʱ߹״̬
+                   ߳Ϊõ֪ͨʱ߱ȡȴٴʱӱ */
+                CpuEnterCritical(&imask);
+
+                error = THREAD_ERR_TIMEO;
+                state = eFailure;
+            }
+            pThread->NotifyStatus &= ~THREAD_NOTIFY_WAITING;
+        }
+
+        /* ȡ֪ͨʽÿֻһֵ֪֪ͨͨ */
+        if (pThread->NotifyStatus & THREAD_NOTIFY_PENDING)
+        {
+            *pValue = pThread->NotifyValue;
+            if (option & THREAD_NOTIFY_DECREMENT)
+            {
+                if (pThread->NotifyValue > 0U)
+                {
+                    pThread->NotifyValue--;
+                }
+                if (pThread->NotifyValue == 0U)
+                {
+                    pThread->NotifyStatus &= ~THREAD_NOTIFY_PENDING;
+                }
+            }
+            else
+            {
+                pThread->NotifyValue &= ~clear;
+                pThread->NotifyStatus &= ~THREAD_NOTIFY_PENDING;
+            }
+
+            error = THREAD_ERR_NONE;
+            state = eSuccess;
+        }
+    }
+
+    CpuLeaveCritical(imask);
+
+    *pError = error;
+    return state;
+}
+#endif
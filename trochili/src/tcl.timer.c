@@ -9,6 +9,7 @@
 #include "tcl.config.h"
 #include "tcl.object.h"
 #include "tcl.debug.h"
+#include "tcl.trace.h"
 #include "tcl.cpu.h"
 #include "tcl.ipc.h"
 #include "tcl.kernel.h"
@@ -20,6 +21,60 @@
 /* ں˶ʱΪ3ֱ֣߳ʱʱ޷ʽԴûʱ */
 static TTimerList TimerList;
 
+/* ༶ʱֲnʱÿַ 2^(n*TCLC_TIMER_WHEEL_BITS) ʱӽ */
+#define TIMER_WHEEL_MASK          (TCLC_TIMER_WHEEL_SIZE - 1U)
+#define TIMER_WHEEL_SHIFT(level)  ((level) * TCLC_TIMER_WHEEL_BITS)
+
+
+/*************************************************************************************************
+ *  ܣʱ༶ʱ                                                                 *
+ *  (1) pTimer ʱṹַ                                                              *
+ *  أ                                                                                     *
+ *  ˵ݵʱʱ뵱ǰʱ̵ľѡʱּԵʱʱ̶Ӧλѡַ           *
+ *        ʱ临ӶO(1)0ַϵĶʱʱʱ̶ͬ            *
+ *************************************************************************************************/
+static void AddActiveTimer(TTimer* pTimer)
+{
+    TTimeTick delta;
+    TTimeTick ticks;
+    TIndex    level = 0U;
+    TIndex    spoke;
+
+    KNL_ASSERT((pTimer->MatchTicks >= uKernelVariable.Jiffies), "");
+    delta = pTimer->MatchTicks - uKernelVariable.Jiffies;
+    ticks = pTimer->MatchTicks;
+
+    while ((level < (TCLC_TIMER_WHEEL_LEVELS - 1U)) &&
+            (delta >= ((TTimeTick)0x1 << TIMER_WHEEL_SHIFT(level + 1U))))
+    {
+        level++;
+    }
+
+    /* ߼ʱַΧĶʱ߼ʱԶַϣʱ¼λ */
+    if (delta >= ((TTimeTick)0x1 << TIMER_WHEEL_SHIFT(TCLC_TIMER_WHEEL_LEVELS)))
+    {
+        ticks = uKernelVariable.Jiffies +
+                ((TTimeTick)0x1 << TIMER_WHEEL_SHIFT(TCLC_TIMER_WHEEL_LEVELS)) - 1U;
+    }
+
+    spoke = (TIndex)((ticks >> TIMER_WHEEL_SHIFT(level)) & TIMER_WHEEL_MASK);
+    uObjQueueAddFifoNode(&(TimerList.ActiveHandle[level][spoke]), &(pTimer->ObjNode), eQuePosTail);
+    pTimer->Status = eTimerActive;
+}
+
+
+/*************************************************************************************************
+ *  ܣʱ߶                                                                   *
+ *  (1) pTimer ʱṹַ                                                              *
+ *  أ                                                                                     *
+ *  ˵ʱѾԭĶƳ                                                       *
+ *************************************************************************************************/
+static void AddDormantTimer(TTimer* pTimer)
+{
+    uObjQueueAddFifoNode(&(TimerList.DormantHandle), &(pTimer->ObjNode), eQuePosHead);
+    pTimer->Status = eTimerDormant;
+}
+
 
 /*************************************************************************************************
  *  ܣں˶ʱʼ                                                                   *
@@ -56,7 +111,7 @@ void uTimerCreate(TTimer* pTimer, TProperty property, TTimerType type, TTimeTick
     pTimer->ObjNode.Handle = (TObjNode**)0;
     pTimer->ObjNode.Data   = (TBase32*)(&(pTimer->MatchTicks));
     pTimer->ObjNode.Owner  = (void*)pTimer;
-    uObjListAddNode(&(TimerList.DormantHandle), &(pTimer->ObjNode), eQuePosHead);
+    AddDormantTimer(pTimer);
 }
 
 
@@ -69,7 +124,7 @@ void uTimerCreate(TTimer* pTimer, TProperty property, TTimerType type, TTimeTick
 void uTimerDelete(TTimer* pTimer)
 {
     /* ʱƳ */
-    uObjListRemoveNode(pTimer->ObjNode.Handle, &(pTimer->ObjNode));
+    uObjQueueRemoveNode(pTimer->ObjNode.Handle, &(pTimer->ObjNode));
 
     /* նʱ */
     memset(pTimer, 0U, sizeof(TTimer));
@@ -104,18 +159,14 @@ void uTimerConfig(TTimer* pTimer, TTimerType type, TTimeTick ticks)
  *************************************************************************************************/
 void uTimerStart(TTimer* pTimer, TTimeTick lagticks)
 {
-    TIndex spoke;
-
     if (pTimer->Status == eTimerDormant)
     {
         /* ʱ߶Ƴ */
-        uObjListRemoveNode(pTimer->ObjNode.Handle, &(pTimer->ObjNode));
+        uObjQueueRemoveNode(pTimer->ObjNode.Handle, &(pTimer->ObjNode));
 
         /* ʱ */
         pTimer->MatchTicks  = uKernelVariable.Jiffies + pTimer->PeriodTicks + lagticks;
-        spoke = (TBase32)(pTimer->MatchTicks % TCLC_TIMER_WHEEL_SIZE);
-        uObjListAddPriorityNode(&(TimerList.ActiveHandle[spoke]), &(pTimer->ObjNode));
-        pTimer->Status = eTimerActive;
+        AddActiveTimer(pTimer);
     }
 }
 
@@ -132,9 +183,8 @@ void uTimerStop(TTimer* pTimer)
     /* ʱӻ/Ƴŵ߶ */
     if (pTimer->Status != eTimerDormant)
     {
-        uObjListRemoveNode(pTimer->ObjNode.Handle, &(pTimer->ObjNode));
-        uObjListAddNode(&(TimerList.DormantHandle), &(pTimer->ObjNode), eQuePosHead);
-        pTimer->Status = eTimerDormant;
+        uObjQueueRemoveNode(pTimer->ObjNode.Handle, &(pTimer->ObjNode));
+        AddDormantTimer(pTimer);
     }
 }
 
@@ -147,26 +197,22 @@ void uTimerStop(TTimer* pTimer)
  *************************************************************************************************/
 static void ResetTimer(TTimer* pTimer)
 {
-    TIndex spoke;
     KNL_ASSERT((pTimer->Type == eUserTimer), "");
 
     /* ʱƳ */
-    uObjListRemoveNode(pTimer->ObjNode.Handle, &(pTimer->ObjNode));
+    uObjQueueRemoveNode(pTimer->ObjNode.Handle, &(pTimer->ObjNode));
 
     /* ͵ûʱ·Żػʱ */
     if (pTimer->Property & TIMER_PROP_PERIODIC)
     {
         /* Ҫ»ָʱֵ */
         pTimer->MatchTicks = uKernelVariable.Jiffies + pTimer->PeriodTicks;
-        spoke = (TBase32)(pTimer->MatchTicks % TCLC_TIMER_WHEEL_SIZE);
-        uObjListAddPriorityNode(&(TimerList.ActiveHandle[spoke]), &(pTimer->ObjNode));
-        pTimer->Status = eTimerActive;
+        AddActiveTimer(pTimer);
     }
     else
     {
         /* λصʱŵ߶ */
-        uObjListAddNode(&(TimerList.DormantHandle), &(pTimer->ObjNode), eQuePosHead);
-        pTimer->Status = eTimerDormant;
+        AddDormantTimer(pTimer);
     }
 }
 
@@ -174,26 +220,32 @@ static void ResetTimer(TTimer* pTimer)
 /*************************************************************************************************
  *  ܣں˶ʱִд                                                                 *
  *  (1) pTimer ʱ                                                                      *
+ *        (2) imask  ߽ٽ֮ǰж״̬                                              *
  *  أ                                                                                     *
  *  ˵: (1)߳ʱʱ̱߳ں߳ʱ                                        *
  *        (2)߳ʱ޷ʽԴʱòԴᱻԴ߳              *
  *           Ȼ̶߳вǲеȣΪжеõģ              *
  *           һжϷغ󣬻᳢Խһ߳ллĻǰװ˷ʱ    *
+ *        (3)ߴٽڣûʱĻصٽִ֮                        *
  *************************************************************************************************/
-static void DispatchTimer(TTimer* pTimer)
+static void DispatchTimer(TTimer* pTimer, TReg32 imask)
 {
     TThread* pThread;
+    TTimerRoutine pRoutine;
+    TArgument data;
 #if ((TCLC_IPC_ENABLE) && (TCLC_IPC_TIMER_ENABLE))
     TBool HiRP = eFalse;
 #endif
 
+    KNL_TRACE(TRACE_EVENT_TIMER, pTimer->ID, pTimer->Type,
+              (pTimer->Type == eUserTimer) ? 0U : ((TThread*)(pTimer->Owner))->ThreadID);
+
     /* ʱ߳ʱ͵Ķʱ */
     if (pTimer->Type == eThreadTimer)
     {
         /* ʱӻƳ,ʱŵ߶ */
-        uObjListRemoveNode(pTimer->ObjNode.Handle, &(pTimer->ObjNode));
-        uObjListAddNode(&(TimerList.DormantHandle), &(pTimer->ObjNode), eQuePosHead);
-        pTimer->Status = eTimerDormant;
+        uObjQueueRemoveNode(pTimer->ObjNode.Handle, &(pTimer->ObjNode));
+        AddDormantTimer(pTimer);
 
         /* ʱڵ̴߳ʱ״̷̬߳ں̻߳ */
         pThread = (TThread*)(pTimer->Owner);
@@ -216,19 +268,29 @@ static void DispatchTimer(TTimer* pTimer)
         򽫶ʱں˶ʱбɶʱػ̴߳ */
         if (pTimer->Property & TIMER_PROP_URGENT)
         {
-            pTimer->Routine(pTimer->Argument);
+            pRoutine = pTimer->Routine;
+            data = pTimer->Argument;
             ResetTimer(pTimer);
+
+            CpuLeaveCritical(imask);
+            pRoutine(data);
+            CpuEnterCritical(&imask);
         }
         else
         {
-            uObjListRemoveNode(pTimer->ObjNode.Handle, &(pTimer->ObjNode));
-            uObjListAddNode(&(TimerList.ExpiredHandle), &(pTimer->ObjNode), eQuePosTail);
+            uObjQueueRemoveNode(pTimer->ObjNode.Handle, &(pTimer->ObjNode));
+            uObjQueueAddFifoNode(&(TimerList.ExpiredHandle), &(pTimer->ObjNode), eQuePosTail);
             pTimer->Status = eTimerExpired;
         }
 #else
         /* ISRֱӴʱص */
-        pTimer->Routine(pTimer->Argument);
+        pRoutine = pTimer->Routine;
+        data = pTimer->Argument;
         ResetTimer(pTimer);
+
+        CpuLeaveCritical(imask);
+        pRoutine(data);
+        CpuEnterCritical(&imask);
 #endif
     }
 
@@ -237,9 +299,8 @@ static void DispatchTimer(TTimer* pTimer)
     else if (pTimer->Type == eIpcTimer)
     {
         /* ʱӻƳ,ʱŵ߶ */
-        uObjListRemoveNode(pTimer->ObjNode.Handle, &(pTimer->ObjNode));
-        uObjListAddNode(&(TimerList.DormantHandle), &(pTimer->ObjNode), eQuePosHead);
-        pTimer->Status = eTimerDormant;
+        uObjQueueRemoveNode(pTimer->ObjNode.Handle, &(pTimer->ObjNode));
+        AddDormantTimer(pTimer);
 
         /* IPCȷٴֹͣtimer */
         pThread = (TThread*)(pTimer->Owner);
@@ -255,43 +316,80 @@ static void DispatchTimer(TTimer* pTimer)
 }
 
 
+/*************************************************************************************************
+ *  ܣ߼ʱַϵĶʱ                                                         *
+ *  (1) pHandle2 ַͷָĵַ                                                      *
+ *  أ                                                                                     *
+ *  ˵ÿʱڸʱ౻һΡÿһʱͿһжϣ               *
+ *        Թжʱַ϶ʱĿ޹                                                 *
+ *************************************************************************************************/
+static void CascadeTimers(TObjNode** pHandle2)
+{
+    TTimer* pTimer;
+    TReg32  imask;
+
+    CpuEnterCritical(&imask);
+    while (*pHandle2 != (TObjNode*)0)
+    {
+        pTimer = (TTimer*)((*pHandle2)->Owner);
+        uObjQueueRemoveNode(pHandle2, &(pTimer->ObjNode));
+        AddActiveTimer(pTimer);
+
+        CpuLeaveCritical(imask);
+        CpuEnterCritical(&imask);
+    }
+    CpuLeaveCritical(imask);
+}
+
+
 /*************************************************************************************************
  *  ܣں˶ʱISR                                                                  *
  *                                                                                       *
  *  أ                                                                                     *
- *  ˵:                                                                                        *
+ *  ˵: ͼʱתһȦʱƸ߼ʱ϶ӦַĶʱ                               *
+ *        Ȼ0ǰַϵȫʱǵĵʱʱ̶ڵǰʱ̡                    *
+ *        жϴ򿪵״̬µãÿνٽֻһʱȼжϲ     *
+ *        ΪͬһĵʱĶʱƳ١                                                 *
+ *        Ķʱ뵱ǰʱ1ģᱻڴַԵǰַ        *
+ *        ʱӽƽ֮Ѿͻʱз룬O(n)ժ                   *
+ *        жڴڼַֹͣϵĶʱǲ̵߳ȣ                         *
+ *        Ҫȵж˳ʱŻᷢ൱ڴʱڼر̵߳             *
  *************************************************************************************************/
 void uTimerTickISR(void)
 {
     TState state;
     TError error;
+    TReg32 imask;
 
-    TTimer*   pTimer;
-    TIndex    spoke;
-    TObjNode* pNode;
-    TObjNode* pNext;
-
-    /* õǰʱ */
-    spoke = (TIndex)(uKernelVariable.Jiffies % TCLC_TIMER_WHEEL_SIZE);
-    pNode = TimerList.ActiveHandle[spoke];
+    TTimer*    pTimer;
+    TIndex     level;
+    TIndex     spoke;
+    TObjNode** pHandle2;
 
-    /* 鵱ǰʱÿʱ */
-    while (pNode != (TObjNode*)0)
+    /* Ƹ߼ʱϵڵַ */
+    for (level = 1U; level < TCLC_TIMER_WHEEL_LEVELS; level++)
     {
-        pNext = pNode->Next;
-        pTimer = (TTimer*)(pNode->Owner);
-
-        /* ǰʱĶʱʱӽʹʱںʱӽ */
-        if (pTimer->MatchTicks == uKernelVariable.Jiffies)
-        {
-            /* ʱ */
-            DispatchTimer(pTimer);
-        }
-        else
+        if ((uKernelVariable.Jiffies & (((TTimeTick)0x1 << TIMER_WHEEL_SHIFT(level)) - 1U)) != 0U)
         {
             break;
         }
-        pNode = pNext;
+        spoke = (TIndex)((uKernelVariable.Jiffies >> TIMER_WHEEL_SHIFT(level)) & TIMER_WHEEL_MASK);
+        CascadeTimers(&(TimerList.ActiveHandle[level][spoke]));
+    }
+
+    /* 0ǰַϵÿʱÿһʱͿһж */
+    spoke = (TIndex)(uKernelVariable.Jiffies & TIMER_WHEEL_MASK);
+    pHandle2 = &(TimerList.ActiveHandle[0][spoke]);
+
+    CpuEnterCritical(&imask);
+    while (*pHandle2 != (TObjNode*)0)
+    {
+        pTimer = (TTimer*)((*pHandle2)->Owner);
+        KNL_ASSERT((pTimer->MatchTicks == uKernelVariable.Jiffies), "");
+        DispatchTimer(pTimer, imask);
+
+        CpuLeaveCritical(imask);
+        CpuEnterCritical(&imask);
     }
 
     /* Ҫں˶ʱػ߳ */
@@ -303,7 +401,45 @@ void uTimerTickISR(void)
         state = state;
     }
 #endif
+    CpuLeaveCritical(imask);
+}
+
+
+#if (TCLC_TICKLESS_ENABLE)
+/*************************************************************************************************
+ *  ܣöʱģһҪʱ                                                     *
+ *                                                                                       *
+ *  أĶʱʱʱ̻߸߼ʱַʱ̣ûлʱʱTCLM_MAX_VALUE64   *
+ *  ˵޽߲ǿַʱ̣ʱᶪʧ                                 *
+ *************************************************************************************************/
+TTimeTick uTimerGetNextMatch(void)
+{
+    TTimeTick ticks = TCLM_MAX_VALUE64;
+    TTimeTick base;
+    TIndex    level;
+    TIndex    offset;
+    TIndex    spoke;
+
+    for (level = 0U; level < TCLC_TIMER_WHEEL_LEVELS; level++)
+    {
+        base = uKernelVariable.Jiffies >> TIMER_WHEEL_SHIFT(level);
+        for (offset = 1U; offset <= TCLC_TIMER_WHEEL_SIZE; offset++)
+        {
+            spoke = (TIndex)((base + offset) & TIMER_WHEEL_MASK);
+            if (TimerList.ActiveHandle[level][spoke] != (TObjNode*)0)
+            {
+                if (((base + offset) << TIMER_WHEEL_SHIFT(level)) < ticks)
+                {
+                    ticks = (base + offset) << TIMER_WHEEL_SHIFT(level);
+                }
+                break;
+            }
+        }
+    }
+
+    return ticks;
 }
+#endif
 
 
 /*************************************************************************************************
@@ -0,0 +1,114 @@
+/*************************************************************************************************
+ *                                     Trochili RTOS Kernel                                      *
+ *                                  Copyright(C) 2016 LIUXUMING                                  *
+ *                                       www.trochili.com                                        *
+ *************************************************************************************************/
+#include <string.h>
+
+#include "tcl.types.h"
+#include "tcl.config.h"
+#include "tcl.cpu.h"
+#include "tcl.trace.h"
+
+#if (TCLC_TRACE_ENABLE)
+
+/* 2ݣдλͨȡ */
+#if ((TCLC_TRACE_RECORDS & (TCLC_TRACE_RECORDS - 1U)) != 0U)
+#error "TCLC_TRACE_RECORDS must be a power of 2"
+#endif
+#define TRACE_RECORD_MASK    (TCLC_TRACE_RECORDS - 1U)
+
+/* ں¼λ */
+TTraceBuffer uTraceBuffer;
+
+
+/*************************************************************************************************
+ *  ܣʼں¼¼ģ                                                                 *
+ *                                                                                       *
+ *  أ                                                                                     *
+ *  ˵ں󼴿ʼ¼¼д󸲸ļ¼                                   *
+ *************************************************************************************************/
+void uTraceModuleInit(void)
+{
+    memset(&uTraceBuffer, 0, sizeof(uTraceBuffer));
+    uTraceBuffer.Magic     = TRACE_MAGIC;
+    uTraceBuffer.Records   = TCLC_TRACE_RECORDS;
+    uTraceBuffer.Frequency = TCLC_TRACE_CLOCK_FREQ;
+    uTraceBuffer.Enabled   = eTrue;
+}
+
+
+/*************************************************************************************************
+ *  ܣ¼һں¼                                                                       *
+ *  (1) event  ¼                                                                    *
+ *        (2) object ¼                                                                *
+ *        (3) extra  ¼Ӳ                                                                *
+ *        (4) data   ¼                                                                    *
+ *  أ                                                                                     *
+ *  ˵߱봦ٽڡﲻκθʽڴ䣬ֻдһ¼               *
+ *************************************************************************************************/
+void uTraceRecord(TBase32 event, TBase32 object, TBase32 extra, TBase32 data)
+{
+    TTraceRecord* pRecord;
+
+    if (uTraceBuffer.Enabled)
+    {
+        pRecord = &(uTraceBuffer.Record[uTraceBuffer.Head & TRACE_RECORD_MASK]);
+        uTraceBuffer.Head++;
+
+        pRecord->Stamp  = CpuGetCycleCount();
+        pRecord->Event  = (TByte)event;
+        pRecord->Extra  = (TByte)extra;
+        pRecord->Object = (TBase16)object;
+        pRecord->Data   = data;
+    }
+}
+
+
+/*************************************************************************************************
+ *  ܣ¼ʼ¼¼                                                           *
+ *                                                                                       *
+ *  أ                                                                                     *
+ *  ˵                                                                                       *
+ *************************************************************************************************/
+void xTraceStart(void)
+{
+    TReg32 imask;
+
+    CpuEnterCritical(&imask);
+    uTraceBuffer.Head    = 0U;
+    uTraceBuffer.Enabled = eTrue;
+    CpuLeaveCritical(imask);
+}
+
+
+/*************************************************************************************************
+ *  ܣֹͣ¼¼                                                                           *
+ *                                                                                       *
+ *  أ                                                                                     *
+ *  ˵ֹͣ󻺳ݱֲ䣬԰ȫת                                               *
+ *************************************************************************************************/
+void xTraceStop(void)
+{
+    TReg32 imask;
+
+    CpuEnterCritical(&imask);
+    uTraceBuffer.Enabled = eFalse;
+    CpuLeaveCritical(imask);
+}
+
+
+/*************************************************************************************************
+ *  ܣ¼ĵַͳ                                                             *
+ *  (1) pAddr  滺ַ                                                              *
+ *        (2) pBytes 滺ֽ                                                            *
+ *  أ                                                                                     *
+ *  ˵û԰ԭ͵תPerfettoʽ                   *
+ *************************************************************************************************/
+void xTraceGetBuffer(void** pAddr, TBase32* pBytes)
+{
+    *pAddr  = (void*)(&uTraceBuffer);
+    *pBytes = sizeof(uTraceBuffer);
+}
+#endif
+
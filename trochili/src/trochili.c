@@ -3,6 +3,8 @@
  *                                  Copyright(C) 2016 LIUXUMING                                  *
  *                                       www.trochili.com                                        *
  *************************************************************************************************/
+#include <string.h>
+
 #include "trochili.h"
 
 
@@ -85,6 +87,93 @@ void TclGetTimeStamp(TTimeStamp* pStamp)
 }
 
 
+#if ((TCLC_PROBE_ENABLE) && (TCLC_PROBE_LATENCY_ENABLE))
+/*************************************************************************************************
+ *  ܣӳͳAPI                                                                *
+ *  (1) type    ӳͳ                                                               *
+ *        (2) object  ͳƶTCLO_LATENCY_ASRʱжϺţTCLO_LATENCY_THREADʱ߳̽ṹַ  *
+ *        (3) pStats  ͳ                                                               *
+ *        (4) pError  ϸý                                                               *
+ *  : (1) eFailure ʧ                                                                  *
+ *        (2) eSuccess ɹ                                                                  *
+ *  ˵ͳݵĵλǴ                                                             *
+ *************************************************************************************************/
+TState TclGetLatencyStats(TIndex type, TArgument object, TLatencyStats* pStats, TError* pError)
+{
+    TState state;
+    KNL_ASSERT((pStats != (TLatencyStats*)0), "");
+    KNL_ASSERT((pError != (TError*)0), "");
+
+    state = xProbeGetLatency(type, object, pStats, pError);
+    return state;
+}
+#endif
+
+
+#if ((TCLC_PROBE_ENABLE) && (TCLC_PROBE_CPU_STATS_ENABLE))
+/*************************************************************************************************
+ *  ܣôռͳAPI                                                          *
+ *  (1) pThread ߳̽ṹַΪʱж(߳л)ͳ                       *
+ *        (2) pStats  ͳ                                                               *
+ *        (3) pError  ϸý                                                               *
+ *  : (1) eFailure ʧ                                                                  *
+ *        (2) eSuccess ɹ                                                                  *
+ *  ˵ͳݵĵλǴڣжͳеSwitchInжϵĽ                 *
+ *************************************************************************************************/
+TState TclGetThreadStats(TThread* pThread, TThreadStats* pStats, TError* pError)
+{
+    TState state;
+    KNL_ASSERT((pStats != (TThreadStats*)0), "");
+    KNL_ASSERT((pError != (TError*)0), "");
+
+    state = xProbeGetThreadStats(pThread, pStats, pError);
+    return state;
+}
+#endif
+
+
+#if (TCLC_TRACE_ENABLE)
+/*************************************************************************************************
+ *  ܣں¼ʼ¼API                                                    *
+ *                                                                                       *
+ *  أ                                                                                     *
+ *  ˵                                                                                       *
+ *************************************************************************************************/
+void TclStartTrace(void)
+{
+    xTraceStart();
+}
+
+
+/*************************************************************************************************
+ *  ܣֹͣ¼ں¼API                                                                *
+ *                                                                                       *
+ *  أ                                                                                     *
+ *  ˵ת֮ǰӦֹͣ¼                                                           *
+ *************************************************************************************************/
+void TclStopTrace(void)
+{
+    xTraceStop();
+}
+
+
+/*************************************************************************************************
+ *  ܣں¼API                                                              *
+ *  (1) pAddr  滺ַ                                                              *
+ *        (2) pBytes 滺ֽ                                                            *
+ *  أ                                                                                     *
+ *  ˵ݿtools/trace2perfetto.pyתChrome/PerfettoJSONʽ                 *
+ *************************************************************************************************/
+void TclGetTraceBuffer(void** pAddr, TBase32* pBytes)
+{
+    KNL_ASSERT((pAddr != (void**)0), "");
+    KNL_ASSERT((pBytes != (TBase32*)0), "");
+
+    xTraceGetBuffer(pAddr, pBytes);
+}
+#endif
+
+
 #if (TCLC_IRQ_ENABLE)
 /*************************************************************************************************
  *  ܣж                                                                       *
@@ -471,6 +560,60 @@ TState TclUnDelayThread(TThread* pThread, TError* pError)
 #endif
 
 
+#if (TCLC_THREAD_NOTIFY_ENABLE)
+/*************************************************************************************************
+ *  ܣ߳/ISR ̷ָ֪߳ͨ                                                            *
+ *  (1) pThread ߳̽ṹַ                                                               *
+ *        (2) value   ֪ͨݣֻλ͸Ƿʽʹ                                         *
+ *        (3) option  ֵ֪ͨĸ·ʽ                                                           *
+ *        (4) pError  ϸý                                                               *
+ *  : (1) eSuccess   ɹ                                                                *
+ *        (2) eFailure   ʧ                                                                *
+ *  ˵                                                                                       *
+ *************************************************************************************************/
+TState TclNotifyThread(TThread* pThread, TBase32 value, TOption option, TError* pError)
+{
+    TState state;
+    KNL_ASSERT((pThread != (TThread*)0), "");
+    KNL_ASSERT((pError != (TError*)0), "");
+
+    option &= (THREAD_NOTIFY_GIVE | THREAD_NOTIFY_SET_BITS |
+               THREAD_NOTIFY_INCREMENT | THREAD_NOTIFY_OVERWRITE);
+    state = xThreadNotify(pThread, value, option, pError);
+    return state;
+}
+
+
+/*************************************************************************************************
+ *  ܣǰ̻߳ȡߵȴ֪ͨ                                                               *
+ *  (1) clear   ȡ֪ͨҪֵ֪ͨλ                                           *
+ *        (2) pValue  ȡ֪ͨʱֵ֪ͨ                                                     *
+ *        (3) option  ȴʽ                                                                   *
+ *        (4) timeo   ʱ޵ȴʽµĵȴʱ                                                   *
+ *        (5) pError  ϸý                                                               *
+ *  : (1) eSuccess   ɹ                                                                *
+ *        (2) eFailure   ʧ                                                                *
+ *  ˵                                                                                       *
+ *************************************************************************************************/
+TState TclWaitNotify(TBase32 clear, TBase32* pValue, TOption option, TTimeTick timeo,
+                     TError* pError)
+{
+    TState state;
+    KNL_ASSERT((pValue != (TBase32*)0), "");
+    KNL_ASSERT((pError != (TError*)0), "");
+
+    option &= (THREAD_NOTIFY_WAIT | THREAD_NOTIFY_TIMED | THREAD_NOTIFY_DECREMENT);
+    if (option & THREAD_NOTIFY_TIMED)
+    {
+        KNL_ASSERT((timeo > 0U), "");
+        option |= THREAD_NOTIFY_WAIT;
+    }
+    state = xThreadWaitNotify(clear, pValue, option, timeo, pError);
+    return state;
+}
+#endif
+
+
 #if ((TCLC_IPC_ENABLE)&&(TCLC_IPC_SEMAPHORE_ENABLE))
 /*************************************************************************************************
  *  : ʼź                                                                       *
@@ -644,7 +787,7 @@ TState TclFlushSemaphore(TSemaphore* pSemaphore, TError* pError)
  *        (4) pError   ϸý                                                              *
  *  : (1) eSuccess ɹ                                                                  *
  *        (2) eFailure ʧ                                                                  *
- *  ˵                                                                                       *
+ *  ˵԰TCLP_IPC_INHERITʱȼ̳Э飬컨                     *
  *************************************************************************************************/
 TState TclCreateMutex(TMutex* pMutex, TPriority priority, TProperty property, TError* pError)
 {
@@ -763,800 +906,2269 @@ TState TclFlushMutex(TMutex* pMutex, TError* pError)
 #endif
 
 
-#if ((TCLC_IPC_ENABLE)&&(TCLC_IPC_MAILBOX_ENABLE))
+#if ((TCLC_IPC_ENABLE)&&(TCLC_IPC_MUTEX_ENABLE)&&(TCLC_IPC_RWLOCK_ENABLE))
 /*************************************************************************************************
- *  ܣʼ                                                                             *
- *  (1) pMailbox   ĵַ                                                              *
- *        (2) property   ĳʼ                                                          *
- *        (3) pError     ϸý                                                            *
- *  : (1) eFailure   ʧ                                                                *
- *        (2) eSuccess   ɹ                                                                *
- *  ˵                                                                                       *
+ *  : ʼд                                                                           *
+ *  : (1) pRwLock  дṹַ                                                            *
+ *        (2) priority дȼ컨                                                        *
+ *        (3) property дĳʼ                                                          *
+ *        (4) pError   ϸý                                                              *
+ *  : (1) eSuccess ɹ                                                                  *
+ *        (2) eFailure ʧ                                                                  *
+ *  ˵԰TCLP_IPC_WRITER_PREFʱдȲԣöȲ                   *
  *************************************************************************************************/
-TState TclCreateMailBox(TMailBox* pMailbox, TProperty property, TError* pError)
+TState TclCreateRwLock(TRwLock* pRwLock, TPriority priority, TProperty property, TError* pError)
 {
     TState state;
-    KNL_ASSERT((pMailbox != (TMailBox*)0), "");
+    KNL_ASSERT((pRwLock != (TRwLock*)0), "");
+    KNL_ASSERT((priority < TCLC_LOWEST_PRIORITY), "");
     KNL_ASSERT((pError != (TError*)0), "");
 
-    property &= IPC_VALID_MBOX_PROP;
-    state = xMailBoxCreate(pMailbox, property, pError);
+    property &= IPC_VALID_RWLOCK_PROP;
+    state = xRwLockCreate(pRwLock, priority, property, pError);
     return state;
 }
 
 
 /*************************************************************************************************
- *  ܣ                                                                               *
- *  (1) pMailbox   ĵַ                                                              *
- *        (2) pError     ϸý                                                            *
- *  : (1) eFailure   ʧ                                                                *
- *        (2) eSuccess   ɹ                                                                *
- *  ˵ע̵߳ĵȴTCLE_IPC_DELETE                                                   *
+ *  : дʼ                                                                       *
+ *  : (1) pRwLock  дṹַ                                                            *
+ *        (2) pError   ϸý                                                              *
+ *  : (1) eSuccess ɹ                                                                  *
+ *        (2) eFailure ʧ                                                                  *
+ *  ˵                                                                                       *
  *************************************************************************************************/
-TState TclDeleteMailBox(TMailBox* pMailbox, TError* pError)
+TState TclDeleteRwLock(TRwLock* pRwLock, TError* pError)
 {
     TState state;
-    KNL_ASSERT((pMailbox != (TMailBox*)0), "");
+    KNL_ASSERT((pRwLock != (TRwLock*)0), "");
     KNL_ASSERT((pError != (TError*)0), "");
 
-    state = xMailBoxDelete(pMailbox, pError);
+    state = xRwLockDelete(pRwLock, pError);
     return state;
 }
 
 
 /*************************************************************************************************
- *  : ߳/ISRнʼ                                                               *
- *  : (1) pMailbox ṹַ                                                              *
- *        (2) pMail2   ʼṹַָ                                                *
- *        (3) option   ģʽ                                                            *
- *        (4) timeo    ʱģʽ·ʱ޳                                          *
- *        (5) pError   ϸý                                                              *
- *  : (1) eFailure ʧ                                                                  *
- *        (2) eSuccess ɹ                                                                  *
- *  ˵                                                                                       *
+ *  : öд                                                                             *
+ *  : (1) pRwLock  дṹַ                                                            *
+ *        (2) pError   ϸý                                                              *
+ *  : (1) eSuccess ɹ                                                                  *
+ *        (2) eFailure ʧ                                                                  *
+ *  ˵дȫϣȴ̱߳                                                   *
  *************************************************************************************************/
-TState TclReceiveMail(TMailBox* pMailbox, TMail* pMail2, TOption option, TTimeTick timeo,
-                      TError* pError)
+TState TclResetRwLock(TRwLock* pRwLock, TError* pError)
 {
     TState state;
-    KNL_ASSERT((pMailbox != (TMailBox*)0), "");
-    KNL_ASSERT((pMail2 != (TMail*)0), "");
+    KNL_ASSERT((pRwLock != (TRwLock*)0), "");
     KNL_ASSERT((pError != (TError*)0), "");
 
-    /* ѡβҪֵ֧ѡ */
-    option &= IPC_VALID_MBOX_OPT;
-
-    /* ȡISRǣԶжϵ÷ʽ */
-    option &= ~IPC_OPT_ISR;
-    state = xMailBoxReceive(pMailbox, pMail2, option, timeo, pError);
+    state = xRwLockReset(pRwLock, pError);
     return state;
 }
 
 
 /*************************************************************************************************
- *  : ߳/ISRʼ                                                                       *
- *  : (1) pMailbox ṹַ                                                              *
- *        (2) pMail2   ʼṹַָ                                                *
- *        (3) option   ģʽ                                                            *
- *        (4) timeo    ʱģʽ·ʱ޳                                          *
- *        (5) pError   ϸý                                                              *
- *  : (1) eFailure ʧ                                                                  *
- *        (2) eSuccess ɹ                                                                  *
+ *  : дֹ,дϵ߳ȫֹ                          *
+ *  : (1) pRwLock  дṹַ                                                            *
+ *        (2) pError   ϸý                                                              *
+ *  : (1) eSuccess ɹ                                                                  *
+ *        (2) eFailure ʧ                                                                  *
  *  ˵                                                                                       *
  *************************************************************************************************/
-TState TclSendMail(TMailBox* pMailbox, TMail* pMail2, TOption option,
-                   TTimeTick timeo, TError* pError)
+TState TclFlushRwLock(TRwLock* pRwLock, TError* pError)
 {
     TState state;
-
-    KNL_ASSERT((pMailbox != (TMailBox*)0), "");
-    KNL_ASSERT((pMail2 != (TMail*)0), "");
+    KNL_ASSERT((pRwLock != (TRwLock*)0), "");
     KNL_ASSERT((pError != (TError*)0), "");
-    if ((pMailbox != (TMailBox*)0) &&  (pMail2 != (TMail*)0) && (pError != (TError*)0))
-    {
-        /* ѡβҪֵ֧ѡ */
-        option &= IPC_VALID_MBOX_OPT;
-
-        /* ȡISRǣԶжϵ÷ʽ */
-        option &= ~IPC_OPT_ISR;
-        state = xMailBoxSend(pMailbox, pMail2, option, timeo, pError);
-    }
 
+    state = xRwLockFlush(pRwLock, pError);
     return state;
 }
 
 
 /*************************************************************************************************
- *  ܣISR䷢ʼ                                                                      *
- *  : (1) pMailbox ṹַ                                                              *
- *        (2) pMail2   ʼṹַָ                                                *
- *        (3) option   ģʽ                                                            *
- *  : (1) eFailure ʧ                                                                  *
- *        (2) eSuccess ɹ                                                                  *
- *  ˵                                                                                       *
+ *  : ̻߳ö                                                                           *
+ *  : (1) pRwLock  дṹַ                                                            *
+ *        (2) option   ʶдģʽ                                                          *
+ *        (3) timeo    ʱģʽ·ʶдʱ޳                                        *
+ *        (4) pError   ϸý                                                              *
+ *  : (1) eSuccess ɹ                                                                  *
+ *        (2) eFailure ʧ                                                                  *
+ *        (3) eError                                                                     *
+ *  ˵д߲                                                             *
  *************************************************************************************************/
-TState TclIsrSendMail(TMailBox* pMailbox, TMail* pMail2, TOption option)
+TState TclLockRwRead(TRwLock* pRwLock, TOption option, TTimeTick timeo, TError* pError)
 {
     TState state;
-    TError error;
-    KNL_ASSERT((pMailbox != (TMailBox*)0), "");
-    KNL_ASSERT((pMail2 != (TMail*)0), "");
+    KNL_ASSERT((pRwLock != (TRwLock*)0), "");
+    KNL_ASSERT((pError != (TError*)0), "");
 
     /* ѡβҪֵ֧ѡ */
-    option &= IPC_VALID_MBOX_OPT;
-
-    /* ISRǣǿָ÷ʽ */
-    option |= IPC_OPT_ISR;
-    state = xMailBoxSend(pMailbox, pMail2, option, 0U, &error);
+    option &= IPC_VALID_RWLOCK_OPT;
+    state = xRwLockRead(pRwLock, option, timeo, pError);
     return state;
 }
 
 
 /*************************************************************************************************
- *  ܣ㲥,же̹߳㲥ʼ                                          *
- *  : (1) pMailbox  ṹַ                                                             *
- *        (2) pMail2   ʼṹַָ                                                *
- *        (3) pError    ϸý                                                             *
- *  أ(1) eSuccess  ɹ                                                                     *
- *        (2) eFailure  ʧ                                                                     *
- *  ˵ֻ߳дڶ̵߳ʱ򣬲ܰϢ͸е߳           *
+ *  : ̻߳д                                                                           *
+ *  : (1) pRwLock  дṹַ                                                            *
+ *        (2) option   ʶдģʽ                                                          *
+ *        (3) timeo    ʱģʽ·ʶдʱ޳                                        *
+ *        (4) pError   ϸý                                                              *
+ *  : (1) eSuccess ɹ                                                                  *
+ *        (2) eFailure ʧ                                                                  *
+ *        (3) eError                                                                     *
+ *  ˵дǶռУѾռж߳ӦõTclUpgradeRwLock                           *
  *************************************************************************************************/
-TState TclBroadcastMail(TMailBox* pMailbox, TMail* pMail2, TError* pError)
+TState TclLockRwWrite(TRwLock* pRwLock, TOption option, TTimeTick timeo, TError* pError)
 {
     TState state;
-    KNL_ASSERT((pMailbox != (TMailBox*)0), "");
-    KNL_ASSERT((pMail2 != (TMail*)0), "");
+    KNL_ASSERT((pRwLock != (TRwLock*)0), "");
     KNL_ASSERT((pError != (TError*)0), "");
 
-    state = xMailBoxBroadcast(pMailbox, pMail2, pError);
+    /* ѡβҪֵ֧ѡ */
+    option &= IPC_VALID_RWLOCK_OPT;
+    state = xRwLockWrite(pRwLock, option, timeo, pError);
     return state;
 }
 
 
 /*************************************************************************************************
- *  :                                                                        *
- *  : (1) pMailbox ṹַ                                                              *
+ *  : ߳ͷŶд                                                                   *
+ *  : (1) pRwLock  дṹַ                                                            *
  *        (2) pError   ϸý                                                              *
- *  : (1) eFailure                                                                           *
- *        (2) eSuccess                                                                           *
+ *  : (1) eSuccess ɹ                                                                  *
+ *        (2) eFailure ʧ                                                                  *
  *  ˵                                                                                       *
  *************************************************************************************************/
-TState TclResetMailBox(TMailBox* pMailbox, TError* pError)
+TState TclFreeRwLock(TRwLock* pRwLock, TError* pError)
 {
     TState state;
-    KNL_ASSERT((pMailbox != (TMailBox*)0), "");
+    KNL_ASSERT((pRwLock != (TRwLock*)0), "");
     KNL_ASSERT((pError != (TError*)0), "");
 
-    state = xMailboxReset(pMailbox, pError);
+    state = xRwLockFree(pRwLock, pError);
     return state;
 }
 
 
 /*************************************************************************************************
- *  ܣֹ,̴ָ߳Ķֹ                        *
- *  : (1) pMailbox ṹַ                                                              *
- *        (2) pThread  ߳̽ṹַ                                                              *
- *        (3) option   ѡ                                                                  *
+ *  : ̰߳ռеĶΪд                                                             *
+ *  : (1) pRwLock  дṹַ                                                            *
+ *        (2) option   ʶдģʽ                                                          *
+ *        (3) timeo    ʱģʽ·ʶдʱ޳                                        *
  *        (4) pError   ϸý                                                              *
- *  : (1) eFailure ʧ                                                                  *
- *        (2) eSuccess ɹ                                                                  *
- *  ˵?                                                                                        *
+ *  : (1) eSuccess ɹ                                                                  *
+ *        (2) eFailure ʧ                                                                  *
+ *        (3) eError                                                                     *
+ *  ˵ͬһʱֻһ̵߳ȴʧʱ߳Ȼռж                             *
  *************************************************************************************************/
-TState TclFlushMailBox(TMailBox* pMailbox, TError* pError)
+TState TclUpgradeRwLock(TRwLock* pRwLock, TOption option, TTimeTick timeo, TError* pError)
 {
     TState state;
-    KNL_ASSERT((pMailbox != (TMailBox*)0), "");
+    KNL_ASSERT((pRwLock != (TRwLock*)0), "");
     KNL_ASSERT((pError != (TError*)0), "");
 
-    state = xMailBoxFlush(pMailbox, pError);
+    /* ѡβҪֵ֧ѡ */
+    option &= IPC_VALID_RWLOCK_OPT;
+    state = xRwLockUpgrade(pRwLock, option, timeo, pError);
     return state;
 }
-#endif
 
 
-#if ((TCLC_IPC_ENABLE)&&(TCLC_IPC_MQUE_ENABLE))
 /*************************************************************************************************
- *  ܣϢгʼ                                                                     *
- *  룺(1) pMsgQue   Ϣнṹַ                                                         *
- *        (2) pPool2    Ϣַ                                                             *
- *        (3) capacity  ϢϢС                                             *
- *        (4) policy    Ϣ̵߳Ȳ                                                     *
- *        (5) pError    ϸý                                                             *
- *  أ(1) eSuccess  ɹ                                                                 *
- *        (2) eFailure  ʧ                                                                 *
- *  ˵                                                                                       *
+ *  : ̰߳ռедΪ                                                             *
+ *  : (1) pRwLock  дṹַ                                                            *
+ *        (2) pError   ϸý                                                              *
+ *  : (1) eSuccess ɹ                                                                  *
+ *        (2) eFailure ʧ                                                                  *
+ *  ˵Ƕռедܽ                                                                 *
  *************************************************************************************************/
-TState TclCreateMsgQueue(TMsgQueue* pMsgQue, void** pPool2, TBase32 capacity, TProperty property,
-                         TError* pError)
+TState TclDowngradeRwLock(TRwLock* pRwLock, TError* pError)
 {
     TState state;
-    KNL_ASSERT((pMsgQue != (TMsgQueue*)0), "");
-    KNL_ASSERT((pPool2 != (void*)0), "");
-    KNL_ASSERT((capacity != 0U), "");
+    KNL_ASSERT((pRwLock != (TRwLock*)0), "");
     KNL_ASSERT((pError != (TError*)0), "");
 
-    property &= IPC_VALID_MQUE_PROP;
-    state = xMQCreate(pMsgQue, pPool2, capacity, property, pError);
+    state = xRwLockDowngrade(pRwLock, pError);
     return state;
 }
+#endif
 
 
+#if ((TCLC_IPC_ENABLE)&&(TCLC_IPC_MUTEX_ENABLE)&&(TCLC_IPC_CONDVAR_ENABLE))
 /*************************************************************************************************
- *  : ߳/ISRϢеϢ                                                       *
- *  : (1) pMsgQue  Ϣнṹַ                                                          *
- *        (2) pMsg2    Ϣṹַָ                                                *
- *        (3) option   Ϣеģʽ                                                        *
- *        (4) timeo    ʱģʽ·ʱ޳                                          *
- *        (5) pError   ϸý                                                              *
- *  : (1) eFailure   ʧ                                                                *
- *  : (2) eSuccess   ɹ                                                                *
+ *  : ʼ                                                                         *
+ *  : (1) pCondVar ṹַ                                                          *
+ *        (2) property ĳʼ                                                        *
+ *        (3) pError   ϸý                                                              *
+ *  : (1) eSuccess ɹ                                                                  *
+ *        (2) eFailure ʧ                                                                  *
  *  ˵                                                                                       *
  *************************************************************************************************/
-TState TclReceiveMessage(TMsgQueue* pMsgQue, TMessage* pMsg2, TOption option, TTimeTick timeo,
-                         TError* pError)
+TState TclCreateCondVar(TCondVar* pCondVar, TProperty property, TError* pError)
 {
     TState state;
-    KNL_ASSERT((pMsgQue != (TMsgQueue*)0), "");
-    KNL_ASSERT((pMsg2 != (TMessage*)0), "");
+    KNL_ASSERT((pCondVar != (TCondVar*)0), "");
     KNL_ASSERT((pError != (TError*)0), "");
 
-    /* ѡβҪֵ֧ѡ */
-    option &= IPC_VALID_MSGQ_OPT;
-
-    /* ȡISRǣԶжϵ÷ʽ */
-    option &= ~IPC_OPT_ISR;
-    state = xMQReceive(pMsgQue, pMsg2, option, timeo, pError);
+    property &= IPC_VALID_COND_PROP;
+    state = xCondVarCreate(pCondVar, property, pError);
     return state;
 }
 
 
 /*************************************************************************************************
- *  : ߳/ISRϢзϢ                                                       *
- *  : (1) pMsgQue  Ϣнṹַ                                                          *
- *        (2) pMsg2    Ϣṹַָ                                                *
- *        (3) option   Ϣеģʽ                                                        *
- *        (4) timeo    ʱģʽ·ʱ޳                                          *
- *        (5) pError   ϸý                                                              *
- *  : (1) eFailure   ʧ                                                                *
- *  : (2) eSuccess   ɹ                                                                *
+ *  : ʼ                                                                     *
+ *  : (1) pCondVar ṹַ                                                          *
+ *        (2) pError   ϸý                                                              *
+ *  : (1) eSuccess ɹ                                                                  *
+ *        (2) eFailure ʧ                                                                  *
  *  ˵                                                                                       *
  *************************************************************************************************/
-TState TclSendMessage(TMsgQueue* pMsgQue, TMessage* pMsg2, TOption option, TTimeTick timeo,
-                      TError* pError)
+TState TclDeleteCondVar(TCondVar* pCondVar, TError* pError)
 {
     TState state;
-    KNL_ASSERT((pMsgQue != (TMsgQueue*)0), "");
-    KNL_ASSERT((pMsg2 != (TMessage*)0), "");
+    KNL_ASSERT((pCondVar != (TCondVar*)0), "");
     KNL_ASSERT((pError != (TError*)0), "");
 
-    /* ѡβҪֵ֧ѡ */
-    option &= IPC_VALID_MSGQ_OPT;
-
-    /* ȡISRǣԶжϵ÷ʽ */
-    option &= ~IPC_OPT_ISR;
-    state = xMQSend(pMsgQue, pMsg2, option, timeo, pError);
+    state = xCondVarDelete(pCondVar, pError);
     return state;
 }
 
 
 /*************************************************************************************************
- *  : ISRϢзϢ                                                            *
- *  : (1) pMsgQue  Ϣнṹַ                                                          *
- *        (2) pMsg2    Ϣṹַָ                                                *
- *        (3) option   Ϣеģʽ                                                        *
- *  : (1) eFailure ʧ                                                                  *
- *        (2) eSuccess ɹ                                                                  *
+ *  : ֹ,ϵ߳ȫֹ                      *
+ *  : (1) pCondVar ṹַ                                                          *
+ *        (2) pError   ϸý                                                              *
+ *  : (1) eSuccess ɹ                                                                  *
+ *        (2) eFailure ʧ                                                                  *
  *  ˵                                                                                       *
  *************************************************************************************************/
-TState TclIsrSendMessage(TMsgQueue* pMsgQue, TMessage* pMsg2, TOption option)
+TState TclFlushCondVar(TCondVar* pCondVar, TError* pError)
 {
     TState state;
-    TError error;
-    KNL_ASSERT((pMsgQue != (TMsgQueue*)0), "");
-    KNL_ASSERT((pMsg2 != (TMessage*)0), "");
+    KNL_ASSERT((pCondVar != (TCondVar*)0), "");
+    KNL_ASSERT((pError != (TError*)0), "");
+
+    state = xCondVarFlush(pCondVar, pError);
+    return state;
+}
+
+
+/*************************************************************************************************
+ *  : ߳ͷŻȴ                                                           *
+ *  : (1) pCondVar ṹַ                                                          *
+ *        (2) pMutex   ǰ߳ռеĻ                                                      *
+ *        (3) option   ȴģʽ                                                        *
+ *        (4) timeo    ʱģʽµȴʱ޳                                      *
+ *        (5) pError   ϸý                                                              *
+ *  : (1) eSuccess ɹ                                                                  *
+ *        (2) eFailure ʧ                                                                  *
+ *        (3) eError                                                                     *
+ *  ˵ʱ߳ռлӦѭ¼                       *
+ *************************************************************************************************/
+TState TclWaitCondVar(TCondVar* pCondVar, TMutex* pMutex, TOption option, TTimeTick timeo,
+                      TError* pError)
+{
+    TState state;
+    KNL_ASSERT((pCondVar != (TCondVar*)0), "");
+    KNL_ASSERT((pMutex != (TMutex*)0), "");
+    KNL_ASSERT((pError != (TError*)0), "");
 
     /* ѡβҪֵ֧ѡ */
-    option &= IPC_VALID_MSGQ_OPT;
+    option &= IPC_VALID_COND_OPT;
+    state = xCondVarWait(pCondVar, pMutex, option, timeo, pError);
+    return state;
+}
 
-    /* ISRǣǿָ÷ʽ */
-    option |= IPC_OPT_ISR;
-    state = xMQSend(pMsgQue, pMsg2, option, 0U, &error);
+
+/*************************************************************************************************
+ *  : ֪ͨһȴ߳                                                         *
+ *  : (1) pCondVar ṹַ                                                          *
+ *        (2) pError   ϸý                                                              *
+ *  : (1) eSuccess ɹ                                                                  *
+ *        (2) eFailure ʧ                                                                  *
+ *  ˵ISRе                                                                        *
+ *************************************************************************************************/
+TState TclSignalCondVar(TCondVar* pCondVar, TError* pError)
+{
+    TState state;
+    KNL_ASSERT((pCondVar != (TCondVar*)0), "");
+    KNL_ASSERT((pError != (TError*)0), "");
+
+    state = xCondVarSignal(pCondVar, pError);
     return state;
 }
 
 
 /*************************************************************************************************
- *  ܣϢй㲥,же̹߳㲥Ϣ                                      *
- *  (1) pMsgQue    Ϣнṹַ                                                        *
- *        (2) pMsg2      Ϣṹַָ                                              *
- *        (3) pError     ϸý                                                            *
- *  أ(1) eSuccess   ɹ㲥Ϣ                                                        *
- *        (2) eFailure   㲥Ϣʧ                                                        *
- *  ˵ֻжжϢеʱ򣬲ܰϢ͸е߳                               *
+ *  : 㲥ȫȴ߳                                                         *
+ *  : (1) pCondVar ṹַ                                                          *
+ *        (2) pError   ϸý                                                              *
+ *  : (1) eSuccess ɹ                                                                  *
+ *        (2) eFailure ʧ                                                                  *
+ *  ˵ISRе                                                                        *
  *************************************************************************************************/
-TState TclBroadcastMessage(TMsgQueue* pMsgQue, TMessage* pMsg2, TError* pError)
+TState TclBroadcastCondVar(TCondVar* pCondVar, TError* pError)
 {
     TState state;
-    KNL_ASSERT((pMsgQue != (TMsgQueue*)0), "");
-    KNL_ASSERT((pMsg2 != (TMessage*)0), "");
+    KNL_ASSERT((pCondVar != (TCondVar*)0), "");
     KNL_ASSERT((pError != (TError*)0), "");
 
-    state = xMQBroadcast(pMsgQue, pMsg2, pError);
+    state = xCondVarBroadcast(pCondVar, pError);
     return state;
 }
+#endif
 
 
+#if ((TCLC_IPC_ENABLE)&&(TCLC_IPC_BARRIER_ENABLE))
 /*************************************************************************************************
- *  ܣϢú                                                                       *
- *  룺(1) pMsgQue   Ϣнṹַ                                                         *
- *        (2) pError    ϸý                                                             *
- *  أ(1) eSuccess  ɹ                                                                 *
- *        (2) eFailure  ʧ                                                                 *
+ *  : ʼ߳                                                                         *
+ *  : (1) pBarrier ߳Ͻṹַ                                                          *
+ *        (2) count    ÿҪϵ߳Ŀ                                                    *
+ *        (3) property ߳ϵĳʼ                                                        *
+ *        (4) pError   ϸý                                                              *
+ *  : (1) eSuccess ɹ                                                                  *
+ *        (2) eFailure ʧ                                                                  *
  *  ˵                                                                                       *
  *************************************************************************************************/
-TState TclDeleteMsgQueue(TMsgQueue* pMsgQue, TError* pError)
+TState TclCreateBarrier(TBarrier* pBarrier, TBase32 count, TProperty property, TError* pError)
 {
     TState state;
-    KNL_ASSERT((pMsgQue != (TMsgQueue*)0), "");
+    KNL_ASSERT((pBarrier != (TBarrier*)0), "");
+    KNL_ASSERT((count != 0U), "");
     KNL_ASSERT((pError != (TError*)0), "");
 
-    state = xMQDelete(pMsgQue, pError);
+    property &= IPC_VALID_BARR_PROP;
+    state = xBarrierCreate(pBarrier, count, property, pError);
     return state;
 }
 
 
 /*************************************************************************************************
- *  : Ϣ                                                                   *
- *  : (1) pMsgQue  Ϣнṹַ                                                          *
+ *  : ߳Ͻʼ                                                                     *
+ *  : (1) pBarrier ߳Ͻṹַ                                                          *
  *        (2) pError   ϸý                                                              *
- *  : (1) eFailure                                                                           *
- *        (2) eSuccess                                                                           *
+ *  : (1) eSuccess ɹ                                                                  *
+ *        (2) eFailure ʧ                                                                  *
  *  ˵                                                                                       *
  *************************************************************************************************/
-TState TclResetMsgQueue(TMsgQueue* pMsgQue, TError* pError)
+TState TclDeleteBarrier(TBarrier* pBarrier, TError* pError)
 {
     TState state;
-    KNL_ASSERT((pMsgQue != (TMsgQueue*)0), "");
+    KNL_ASSERT((pBarrier != (TBarrier*)0), "");
     KNL_ASSERT((pError != (TError*)0), "");
 
-    state = xMQReset(pMsgQue, pError);
+    state = xBarrierDelete(pBarrier, pError);
     return state;
 }
 
 
 /*************************************************************************************************
- *  ܣϢֹ,̴ָ߳Ϣеֹ                  *
- *  (1) pMsgQue  Ϣнṹַ                                                          *
- *        (2) option   ѡ                                                                  *
- *        (3) pThread  ̵ַ߳                                                                  *
- *        (4) pError   ϸý                                                              *
- *  أ(1) eSuccess ɹ                                                                      *
- *        (2) eFailure ʧ                                                                      *
- *  ˵                                                                                       *
+ *  : ߳                                                                           *
+ *  : (1) pBarrier ߳Ͻṹַ                                                          *
+ *        (2) pError   ϸý                                                              *
+ *  : (1) eSuccess ɹ                                                                  *
+ *        (2) eFailure ʧ                                                                  *
+ *  ˵ڵȴ߳ȫTCLE_IPC_RESETʧܷ                                             *
  *************************************************************************************************/
-TState TclFlushMsgQueue(TMsgQueue* pMsgQue, TError* pError)
+TState TclResetBarrier(TBarrier* pBarrier, TError* pError)
 {
     TState state;
-    KNL_ASSERT((pMsgQue != (TMsgQueue*)0), "");
+    KNL_ASSERT((pBarrier != (TBarrier*)0), "");
     KNL_ASSERT((pError != (TError*)0), "");
 
-    state = xMQFlush(pMsgQue, pError);
+    state = xBarrierReset(pBarrier, pError);
     return state;
 }
-#endif
 
 
-#if ((TCLC_IPC_ENABLE) && (TCLC_IPC_FLAGS_ENABLE))
 /*************************************************************************************************
- *  ܣʼ¼                                                                         *
- *  (1) pFlags     ¼ǵĵַ                                                          *
- *        (2) property   ¼ǵĳʼ                                                      *
- *        (3) pError     ϸֵ                                                      *
- *  : (1) eFailure   ʧ                                                                *
- *        (2) eSuccess   ɹ                                                                *
- *  ˵                                                                                       *
+ *  : ̵߳ϲȴ߳                                                             *
+ *  : (1) pBarrier ߳Ͻṹַ                                                          *
+ *        (2) option   ȴ߳ϵģʽ                                                        *
+ *        (3) timeo    ʱģʽµȴ߳ϵʱ޳                                      *
+ *        (4) pError   ϸý                                                              *
+ *  : (1) eSuccess ɹ                                                                  *
+ *        (2) eFailure ʧ                                                                  *
+ *        (3) eError                                                                     *
+ *  ˵󵽴ֱ̲߳ӻѱȫȴ߳                                         *
  *************************************************************************************************/
-TState TclCreateFlags(TFlags* pFlags, TProperty property, TError* pError)
+TState TclWaitBarrier(TBarrier* pBarrier, TOption option, TTimeTick timeo, TError* pError)
 {
     TState state;
-    KNL_ASSERT((pFlags != (TFlags*)0), "");
+    KNL_ASSERT((pBarrier != (TBarrier*)0), "");
     KNL_ASSERT((pError != (TError*)0), "");
 
-    property &= IPC_VALID_FLAG_PROP;
-    state = xFlagsCreate(pFlags, property, pError);
+    /* ѡβҪֵ֧ѡ */
+    option &= IPC_VALID_BARR_OPT;
+    state = xBarrierWait(pBarrier, option, timeo, pError);
     return state;
 }
+#endif
 
 
+#if ((TCLC_IPC_ENABLE)&&(TCLC_IPC_MAILBOX_ENABLE))
 /*************************************************************************************************
- *  ܣȡ¼ǳʼ                                                                     *
- *  (1) pFlags   ¼ǵĵַ                                                            *
- *        (2) pError   ϸֵ                                                        *
- *  : (1) eFailure ʧ                                                                  *
- *        (2) eSuccess ɹ                                                                  *
- *  ˵                                                                                       *
+ *  ܣʼ                                                                             *
+ *  (1) pMailbox   ĵַ                                                              *
+ *        (2) property   ĳʼ                                                          *
+ *        (3) pError     ϸý                                                            *
+ *  : (1) eFailure   ʧ                                                                *
+ *        (2) eSuccess   ɹ                                                                *
+ *  ˵԰TCLP_IPC_OVERWRITEʱʼǾʼʼ                         *
  *************************************************************************************************/
-TState TclDeleteFlags(TFlags* pFlags, TError* pError)
+TState TclCreateMailBox(TMailBox* pMailbox, TProperty property, TError* pError)
 {
     TState state;
-    KNL_ASSERT((pFlags != (TFlags*)0), "");
+    KNL_ASSERT((pMailbox != (TMailBox*)0), "");
     KNL_ASSERT((pError != (TError*)0), "");
 
-    state = xFlagsDelete(pFlags, pError);
+    property &= IPC_VALID_MBOX_PROP;
+    state = xMailBoxCreate(pMailbox, property, pError);
     return state;
 }
 
 
 /*************************************************************************************************
- *  ܣ߳/ISR¼Ƿ¼                                                             *
- *  (1) pFlags   ¼ǵĵַ                                                            *
- *        (2) pPattern Ҫյıǵ                                                      *
- *        (3) pError   ϸý                                                              *
+ *  ܣ                                                                               *
+ *  (1) pMailbox   ĵַ                                                              *
+ *        (2) pError     ϸý                                                            *
  *  : (1) eFailure   ʧ                                                                *
  *        (2) eSuccess   ɹ                                                                *
- *  ˵ǰ߳                                                             *
+ *  ˵ע̵߳ĵȴTCLE_IPC_DELETE                                                  *
  *************************************************************************************************/
-TState TclSendFlags(TFlags* pFlags, TBitMask pattern, TError* pError)
+TState TclDeleteMailBox(TMailBox* pMailbox, TError* pError)
 {
     TState state;
-    KNL_ASSERT((pFlags != (TFlags*)0), "");
+    KNL_ASSERT((pMailbox != (TMailBox*)0), "");
     KNL_ASSERT((pError != (TError*)0), "");
 
-    state = xFlagsSend(pFlags, pattern, pError);
+    state = xMailBoxDelete(pMailbox, pError);
     return state;
 }
 
 
 /*************************************************************************************************
- *  ܣ߳/ISR¼                                                                   *
- *  (1) pFlags   ¼ǵĵַ                                                            *
- *        (2) pPattern Ҫյıǵ                                                      *
- *        (3) timeo    ʱģʽ·¼ǵʱ޳                                      *
- *        (4) option   ¼ǵĲ                                                        *
+ *  : ߳/ISRнʼ                                                               *
+ *  : (1) pMailbox ṹַ                                                              *
+ *        (2) pMail2   ʼṹַָ                                                *
+ *        (3) option   ģʽ                                                            *
+ *        (4) timeo    ʱģʽ·ʱ޳                                          *
  *        (5) pError   ϸý                                                              *
  *  : (1) eFailure ʧ                                                                  *
  *        (2) eSuccess ɹ                                                                  *
  *  ˵                                                                                       *
  *************************************************************************************************/
-TState TclReceiveFlags(TFlags* pFlags, TBitMask* pPattern, TOption option, TTimeTick timeo,
-                       TError* pError)
+TState TclReceiveMail(TMailBox* pMailbox, TMail* pMail2, TOption option, TTimeTick timeo,
+                      TError* pError)
 {
     TState state;
-
-    KNL_ASSERT((pFlags != (TFlags*)0), "");
-    KNL_ASSERT((option & (IPC_OPT_AND | IPC_OPT_OR)) != 0U, "");
+    KNL_ASSERT((pMailbox != (TMailBox*)0), "");
+    KNL_ASSERT((pMail2 != (TMail*)0), "");
     KNL_ASSERT((pError != (TError*)0), "");
 
     /* ѡβҪֵ֧ѡ */
-    option &= IPC_VALID_FLAG_OPT;
+    option &= IPC_VALID_MBOX_OPT;
 
-    /* ȡISRǣԶжϵû */
+    /* ȡISRǣԶжϵ÷ʽ */
     option &= ~IPC_OPT_ISR;
-    state = xFlagsReceive(pFlags, pPattern, option, timeo, pError);
+    state = xMailBoxReceive(pMailbox, pMail2, option, timeo, pError);
     return state;
 }
 
 
 /*************************************************************************************************
- *  : ¼                                                                   *
- *  (1) pFlags   ¼ǵĵַ                                                            *
- *        (2) pError   ϸý                                                              *
- *  : (1) eFailure   ʧ                                                                *
- *        (2) eSuccess   ɹ                                                                *
+ *  : ߳/ISRʼ                                                                       *
+ *  : (1) pMailbox ṹַ                                                              *
+ *        (2) pMail2   ʼṹַָ                                                *
+ *        (3) option   ģʽ                                                            *
+ *        (4) timeo    ʱģʽ·ʱ޳                                          *
+ *        (5) pError   ϸý                                                              *
+ *  : (1) eFailure ʧ                                                                  *
+ *        (2) eSuccess ɹ                                                                  *
  *  ˵                                                                                       *
  *************************************************************************************************/
-TState TclResetFlags(TFlags* pFlags, TError* pError)
+TState TclSendMail(TMailBox* pMailbox, TMail* pMail2, TOption option,
+                   TTimeTick timeo, TError* pError)
 {
-    TState state;
+    TState state = eFailure;
 
-    KNL_ASSERT((pFlags != (TFlags*)0), "");
+    KNL_ASSERT((pMailbox != (TMailBox*)0), "");
+    KNL_ASSERT((pMail2 != (TMail*)0), "");
     KNL_ASSERT((pError != (TError*)0), "");
+    if ((pMailbox != (TMailBox*)0) &&  (pMail2 != (TMail*)0) && (pError != (TError*)0))
+    {
+        /* ѡβҪֵ֧ѡ */
+        option &= IPC_VALID_MBOX_OPT;
+
+        /* ȡISRǣԶжϵ÷ʽ */
+        option &= ~IPC_OPT_ISR;
+        state = xMailBoxSend(pMailbox, pMail2, option, timeo, pError);
+    }
 
-    state = xFlagsReset(pFlags, pError);
     return state;
 }
 
 
 /*************************************************************************************************
- *  ܣ¼ֹ,̴ָ߳¼ǵֹ߳                  *
- *  (1) pFlags   ¼ǽṹַ                                                          *
- *        (2) option   ѡ                                                                  *
- *        (3) pThread  ̵ַ߳                                                                  *
- *        (4) pError   ϸý                                                              *
- *  أ(1) eSuccess                                                                           *
- *        (2) eFailure                                                                           *
+ *  ܣISR䷢ʼ                                                                      *
+ *  : (1) pMailbox ṹַ                                                              *
+ *        (2) pMail2   ʼṹַָ                                                *
+ *        (3) option   ģʽ                                                            *
+ *  : (1) eFailure ʧ                                                                  *
+ *        (2) eSuccess ɹ                                                                  *
  *  ˵                                                                                       *
  *************************************************************************************************/
-TState TclFlushFlags(TFlags* pFlags, TError* pError)
+TState TclIsrSendMail(TMailBox* pMailbox, TMail* pMail2, TOption option)
 {
-    TState state = eFailure;
-    KNL_ASSERT((pFlags != (TFlags*)0), "");
-    KNL_ASSERT((pError != (TError*)0), "");
+    TState state;
+    TError error;
+    KNL_ASSERT((pMailbox != (TMailBox*)0), "");
+    KNL_ASSERT((pMail2 != (TMail*)0), "");
 
-    state = xFlagsFlush(pFlags, pError);
+    /* ѡβҪֵ֧ѡ */
+    option &= IPC_VALID_MBOX_OPT;
+
+    /* ISRǣǿָ÷ʽ */
+    option |= IPC_OPT_ISR;
+    state = xMailBoxSend(pMailbox, pMail2, option, 0U, &error);
+    return state;
+}
+
+
+/*************************************************************************************************
+ *  ܣ㲥,же̹߳㲥ʼ                                          *
+ *  : (1) pMailbox  ṹַ                                                             *
+ *        (2) pMail2   ʼṹַָ                                                *
+ *        (3) pError    ϸý                                                             *
+ *  أ(1) eSuccess  ɹ                                                                     *
+ *        (2) eFailure  ʧ                                                                     *
+ *  ˵ֻ߳дڶ̵߳ʱ򣬲ܰϢ͸е߳           *
+ *************************************************************************************************/
+TState TclBroadcastMail(TMailBox* pMailbox, TMail* pMail2, TError* pError)
+{
+    TState state;
+    KNL_ASSERT((pMailbox != (TMailBox*)0), "");
+    KNL_ASSERT((pMail2 != (TMail*)0), "");
+    KNL_ASSERT((pError != (TError*)0), "");
+
+    state = xMailBoxBroadcast(pMailbox, pMail2, pError);
+    return state;
+}
+
+
+/*************************************************************************************************
+ *  :                                                                        *
+ *  : (1) pMailbox ṹַ                                                              *
+ *        (2) pError   ϸý                                                              *
+ *  : (1) eFailure                                                                           *
+ *        (2) eSuccess                                                                           *
+ *  ˵                                                                                       *
+ *************************************************************************************************/
+TState TclResetMailBox(TMailBox* pMailbox, TError* pError)
+{
+    TState state;
+    KNL_ASSERT((pMailbox != (TMailBox*)0), "");
+    KNL_ASSERT((pError != (TError*)0), "");
+
+    state = xMailboxReset(pMailbox, pError);
+    return state;
+}
+
+
+/*************************************************************************************************
+ *  ܣֹ,̴ָ߳Ķֹ                        *
+ *  : (1) pMailbox ṹַ                                                              *
+ *        (2) pThread  ߳̽ṹַ                                                              *
+ *        (3) option   ѡ                                                                  *
+ *        (4) pError   ϸý                                                              *
+ *  : (1) eFailure ʧ                                                                  *
+ *        (2) eSuccess ɹ                                                                  *
+ *  ˵?                                                                                        *
+ *************************************************************************************************/
+TState TclFlushMailBox(TMailBox* pMailbox, TError* pError)
+{
+    TState state;
+    KNL_ASSERT((pMailbox != (TMailBox*)0), "");
+    KNL_ASSERT((pError != (TError*)0), "");
+
+    state = xMailBoxFlush(pMailbox, pError);
+    return state;
+}
+#endif
+
+
+#if ((TCLC_IPC_ENABLE)&&(TCLC_IPC_MQUE_ENABLE))
+/*************************************************************************************************
+ *  ܣϢгʼ                                                                     *
+ *  룺(1) pMsgQue   Ϣнṹַ                                                         *
+ *        (2) pPool2    Ϣַ                                                             *
+ *        (3) capacity  ϢϢС                                             *
+ *        (4) policy    Ϣ̵߳Ȳ                                                     *
+ *        (5) pError    ϸý                                                             *
+ *  أ(1) eSuccess  ɹ                                                                 *
+ *        (2) eFailure  ʧ                                                                 *
+ *  ˵ÿϢȼԼĻζУϢСcapacity*TCLC_IPC_MQUE_LEVELS      *
+ *************************************************************************************************/
+TState TclCreateMsgQueue(TMsgQueue* pMsgQue, void** pPool2, TBase32 capacity, TProperty property,
+                         TError* pError)
+{
+    TState state;
+    KNL_ASSERT((pMsgQue != (TMsgQueue*)0), "");
+    KNL_ASSERT((pPool2 != (void*)0), "");
+    KNL_ASSERT((capacity != 0U), "");
+    KNL_ASSERT((pError != (TError*)0), "");
+
+    property &= IPC_VALID_MQUE_PROP;
+    state = xMQCreate(pMsgQue, pPool2, capacity, property, pError);
+    return state;
+}
+
+
+/*************************************************************************************************
+ *  : ߳/ISRϢеϢ                                                       *
+ *  : (1) pMsgQue  Ϣнṹַ                                                          *
+ *        (2) pMsg2    Ϣṹַָ                                                *
+ *        (3) option   Ϣеģʽ                                                        *
+ *        (4) timeo    ʱģʽ·ʱ޳                                          *
+ *        (5) pError   ϸý                                                              *
+ *  : (1) eFailure   ʧ                                                                *
+ *  : (2) eSuccess   ɹ                                                                *
+ *  ˵                                                                                       *
+ *************************************************************************************************/
+TState TclReceiveMessage(TMsgQueue* pMsgQue, TMessage* pMsg2, TOption option, TTimeTick timeo,
+                         TError* pError)
+{
+    TState state;
+    KNL_ASSERT((pMsgQue != (TMsgQueue*)0), "");
+    KNL_ASSERT((pMsg2 != (TMessage*)0), "");
+    KNL_ASSERT((pError != (TError*)0), "");
+
+    /* ѡβҪֵ֧ѡ */
+    option &= IPC_VALID_MSGQ_OPT;
+
+    /* ȡISRǣԶжϵ÷ʽ */
+    option &= ~IPC_OPT_ISR;
+    state = xMQReceive(pMsgQue, pMsg2, option, timeo, pError);
+    return state;
+}
+
+
+/*************************************************************************************************
+ *  : ߳/ISRϢзϢ                                                       *
+ *  : (1) pMsgQue  Ϣнṹַ                                                          *
+ *        (2) pMsg2    Ϣṹַָ                                                *
+ *        (3) option   Ϣеģʽ                                                        *
+ *        (4) timeo    ʱģʽ·ʱ޳                                          *
+ *        (5) pError   ϸý                                                              *
+ *  : (1) eFailure   ʧ                                                                *
+ *  : (2) eSuccess   ɹ                                                                *
+ *  ˵TCLO_IPC_LEVEL(n)ָϢȼ0Ϊ                                             *
+ *************************************************************************************************/
+TState TclSendMessage(TMsgQueue* pMsgQue, TMessage* pMsg2, TOption option, TTimeTick timeo,
+                      TError* pError)
+{
+    TState state;
+    KNL_ASSERT((pMsgQue != (TMsgQueue*)0), "");
+    KNL_ASSERT((pMsg2 != (TMessage*)0), "");
+    KNL_ASSERT((pError != (TError*)0), "");
+
+    /* ѡβҪֵ֧ѡ */
+    option &= IPC_VALID_MSGQ_OPT;
+
+    /* ȡISRǣԶжϵ÷ʽ */
+    option &= ~IPC_OPT_ISR;
+    state = xMQSend(pMsgQue, pMsg2, option, timeo, pError);
+    return state;
+}
+
+
+/*************************************************************************************************
+ *  : ISRϢзϢ                                                            *
+ *  : (1) pMsgQue  Ϣнṹַ                                                          *
+ *        (2) pMsg2    Ϣṹַָ                                                *
+ *        (3) option   Ϣеģʽ                                                        *
+ *  : (1) eFailure ʧ                                                                  *
+ *        (2) eSuccess ɹ                                                                  *
+ *  ˵                                                                                       *
+ *************************************************************************************************/
+TState TclIsrSendMessage(TMsgQueue* pMsgQue, TMessage* pMsg2, TOption option)
+{
+    TState state;
+    TError error;
+    KNL_ASSERT((pMsgQue != (TMsgQueue*)0), "");
+    KNL_ASSERT((pMsg2 != (TMessage*)0), "");
+
+    /* ѡβҪֵ֧ѡ */
+    option &= IPC_VALID_MSGQ_OPT;
+
+    /* ISRǣǿָ÷ʽ */
+    option |= IPC_OPT_ISR;
+    state = xMQSend(pMsgQue, pMsg2, option, 0U, &error);
+    return state;
+}
+
+
+/*************************************************************************************************
+ *  : ߳һδϢнնϢ                                                   *
+ *  : (1) pMsgQue  Ϣнṹַ                                                          *
+ *        (2) pMsgs    Ϣ                                                            *
+ *        (3) max      յϢĿ                                                        *
+ *        (4) pGot     ʵʽյϢĿ                                                        *
+ *        (5) option   Ϣеģʽ                                                        *
+ *        (6) timeo    ʱģʽ·Ϣеʱ޳                                      *
+ *        (7) pError   ϸý                                                              *
+ *  : (1) eFailure   ʧ                                                                *
+ *        (2) eSuccess   ɹ                                                                *
+ *  ˵ֻһϢҲղʱŻ                                                         *
+ *************************************************************************************************/
+TState TclReceiveMessages(TMsgQueue* pMsgQue, TMessage* pMsgs, TBase32 max, TBase32* pGot,
+                          TOption option, TTimeTick timeo, TError* pError)
+{
+    TState state;
+    KNL_ASSERT((pMsgQue != (TMsgQueue*)0), "");
+    KNL_ASSERT((pMsgs != (TMessage*)0), "");
+    KNL_ASSERT((max != 0U), "");
+    KNL_ASSERT((pGot != (TBase32*)0), "");
+    KNL_ASSERT((pError != (TError*)0), "");
+
+    /* ѡβҪֵ֧ѡ */
+    option &= IPC_VALID_MSGQ_OPT;
+
+    /* ȡISRǣԶжϵ÷ʽ */
+    option &= ~IPC_OPT_ISR;
+    state = xMQReceiveBatch(pMsgQue, pMsgs, max, pGot, option, timeo, pError);
+    return state;
+}
+
+
+/*************************************************************************************************
+ *  : ߳һϢзͶϢ                                                   *
+ *  : (1) pMsgQue  Ϣнṹַ                                                          *
+ *        (2) pMsgs    ͵Ϣ                                                          *
+ *        (3) n        ͵ϢĿ                                                          *
+ *        (4) pSent    ʵʷ͵ϢĿ                                                        *
+ *        (5) option   Ϣеģʽ                                                        *
+ *        (6) timeo    ʱģʽ·Ϣеʱ޳                                      *
+ *        (7) pError   ϸý                                                              *
+ *  : (1) eFailure   ʧ                                                                *
+ *        (2) eSuccess   ɹ                                                                *
+ *  ˵ֻһϢҲʱŻ                                                         *
+ *************************************************************************************************/
+TState TclSendMessages(TMsgQueue* pMsgQue, TMessage* pMsgs, TBase32 n, TBase32* pSent,
+                       TOption option, TTimeTick timeo, TError* pError)
+{
+    TState state;
+    KNL_ASSERT((pMsgQue != (TMsgQueue*)0), "");
+    KNL_ASSERT((pMsgs != (TMessage*)0), "");
+    KNL_ASSERT((n != 0U), "");
+    KNL_ASSERT((pSent != (TBase32*)0), "");
+    KNL_ASSERT((pError != (TError*)0), "");
+
+    /* ѡβҪֵ֧ѡ */
+    option &= IPC_VALID_MSGQ_OPT;
+
+    /* ȡISRǣԶжϵ÷ʽ */
+    option &= ~IPC_OPT_ISR;
+    state = xMQSendBatch(pMsgQue, pMsgs, n, pSent, option, timeo, pError);
+    return state;
+}
+
+
+/*************************************************************************************************
+ *  ܣϢй㲥,же̹߳㲥Ϣ                                      *
+ *  (1) pMsgQue    Ϣнṹַ                                                        *
+ *        (2) pMsg2      Ϣṹַָ                                              *
+ *        (3) pError     ϸý                                                            *
+ *  أ(1) eSuccess   ɹ㲥Ϣ                                                        *
+ *        (2) eFailure   㲥Ϣʧ                                                        *
+ *  ˵ֻжжϢеʱ򣬲ܰϢ͸е߳                               *
+ *************************************************************************************************/
+TState TclBroadcastMessage(TMsgQueue* pMsgQue, TMessage* pMsg2, TError* pError)
+{
+    TState state;
+    KNL_ASSERT((pMsgQue != (TMsgQueue*)0), "");
+    KNL_ASSERT((pMsg2 != (TMessage*)0), "");
+    KNL_ASSERT((pError != (TError*)0), "");
+
+    state = xMQBroadcast(pMsgQue, pMsg2, pError);
+    return state;
+}
+
+
+/*************************************************************************************************
+ *  ܣϢú                                                                       *
+ *  룺(1) pMsgQue   Ϣнṹַ                                                         *
+ *        (2) pError    ϸý                                                             *
+ *  أ(1) eSuccess  ɹ                                                                 *
+ *        (2) eFailure  ʧ                                                                 *
+ *  ˵                                                                                       *
+ *************************************************************************************************/
+TState TclDeleteMsgQueue(TMsgQueue* pMsgQue, TError* pError)
+{
+    TState state;
+    KNL_ASSERT((pMsgQue != (TMsgQueue*)0), "");
+    KNL_ASSERT((pError != (TError*)0), "");
+
+    state = xMQDelete(pMsgQue, pError);
+    return state;
+}
+
+
+/*************************************************************************************************
+ *  : Ϣ                                                                   *
+ *  : (1) pMsgQue  Ϣнṹַ                                                          *
+ *        (2) pError   ϸý                                                              *
+ *  : (1) eFailure                                                                           *
+ *        (2) eSuccess                                                                           *
+ *  ˵                                                                                       *
+ *************************************************************************************************/
+TState TclResetMsgQueue(TMsgQueue* pMsgQue, TError* pError)
+{
+    TState state;
+    KNL_ASSERT((pMsgQue != (TMsgQueue*)0), "");
+    KNL_ASSERT((pError != (TError*)0), "");
+
+    state = xMQReset(pMsgQue, pError);
+    return state;
+}
+
+
+/*************************************************************************************************
+ *  ܣϢֹ,̴ָ߳Ϣеֹ                  *
+ *  (1) pMsgQue  Ϣнṹַ                                                          *
+ *        (2) option   ѡ                                                                  *
+ *        (3) pThread  ̵ַ߳                                                                  *
+ *        (4) pError   ϸý                                                              *
+ *  أ(1) eSuccess ɹ                                                                      *
+ *        (2) eFailure ʧ                                                                      *
+ *  ˵                                                                                       *
+ *************************************************************************************************/
+TState TclFlushMsgQueue(TMsgQueue* pMsgQue, TError* pError)
+{
+    TState state;
+    KNL_ASSERT((pMsgQue != (TMsgQueue*)0), "");
+    KNL_ASSERT((pError != (TError*)0), "");
+
+    state = xMQFlush(pMsgQue, pError);
+    return state;
+}
+#endif
+
+
+#if ((TCLC_IPC_ENABLE) && (TCLC_IPC_MSGBUF_ENABLE))
+/*************************************************************************************************
+ *  ܣϢʼ                                                                   *
+ *  룺(1) pMsgBuf   Ϣṹַ                                                       *
+ *        (2) pAddr     λַ4ֽڶ                                            *
+ *        (3) bytes     λֽ                                                         *
+ *        (4) property  Ϣ̵߳Ȳ                                                   *
+ *        (5) pError    ϸý                                                             *
+ *  أ(1) eSuccess  ɹ                                                                 *
+ *        (2) eFailure  ʧ                                                                 *
+ *  ˵                                                                                       *
+ *************************************************************************************************/
+TState TclCreateMsgBuffer(TMsgBuffer* pMsgBuf, void* pAddr, TBase32 bytes, TProperty property,
+                          TError* pError)
+{
+    TState state;
+    KNL_ASSERT((pMsgBuf != (TMsgBuffer*)0), "");
+    KNL_ASSERT((pAddr != (void*)0), "");
+    KNL_ASSERT((((TAddr)pAddr) % MSGBUF_ALIGN_BYTES == 0U), "");
+    KNL_ASSERT((bytes >= (MSGBUF_HEAD_BYTES + MSGBUF_ALIGN_BYTES)), "");
+    KNL_ASSERT((pError != (TError*)0), "");
+
+    property &= IPC_VALID_MBUF_PROP;
+    state = xMsgBufCreate(pMsgBuf, pAddr, bytes, property, pError);
+    return state;
+}
+
+
+/*************************************************************************************************
+ *  ܣϢע                                                                     *
+ *  룺(1) pMsgBuf   Ϣṹַ                                                       *
+ *        (2) pError    ϸý                                                             *
+ *  أ(1) eSuccess  ɹ                                                                 *
+ *        (2) eFailure  ʧ                                                                 *
+ *  ˵                                                                                       *
+ *************************************************************************************************/
+TState TclDeleteMsgBuffer(TMsgBuffer* pMsgBuf, TError* pError)
+{
+    TState state;
+    KNL_ASSERT((pMsgBuf != (TMsgBuffer*)0), "");
+    KNL_ASSERT((pError != (TError*)0), "");
+
+    state = xMsgBufDelete(pMsgBuf, pError);
+    return state;
+}
+
+
+/*************************************************************************************************
+ *  : ߳ϢԤϢ洢ռ                                                 *
+ *  : (1) pMsgBuf  Ϣṹַ                                                        *
+ *        (2) length   Ϣ                                                                  *
+ *        (3) pAddr2   Ϣ洢ַָ                                                *
+ *        (4) option   Ϣģʽ                                                      *
+ *        (5) timeo    ʱģʽ·Ϣʱ޳                                    *
+ *        (6) pError   ϸý                                                              *
+ *  : (1) eFailure ʧ                                                                  *
+ *        (2) eSuccess ɹ                                                                  *
+ *  ˵ֱ߳ڵõĵַдϢȻTclCommitMsgBufferύ                           *
+ *************************************************************************************************/
+TState TclReserveMsgBuffer(TMsgBuffer* pMsgBuf, TBase32 length, void** pAddr2,
+                           TOption option, TTimeTick timeo, TError* pError)
+{
+    TState state;
+    KNL_ASSERT((pMsgBuf != (TMsgBuffer*)0), "");
+    KNL_ASSERT((pAddr2 != (void**)0), "");
+    KNL_ASSERT((pError != (TError*)0), "");
+
+    /* ѡβҪֵ֧ѡ */
+    option &= IPC_VALID_MBUF_OPT;
+
+    /* ȡISRǣԶжϵ÷ʽ */
+    option &= ~IPC_OPT_ISR;
+    state = xMsgBufReserve(pMsgBuf, length, pAddr2, option, timeo, pError);
+    return state;
+}
+
+
+/*************************************************************************************************
+ *  : ISRϢԤϢ洢ռ                                                  *
+ *  : (1) pMsgBuf  Ϣṹַ                                                        *
+ *        (2) length   Ϣ                                                                  *
+ *        (3) pAddr2   Ϣ洢ַָ                                                *
+ *  : (1) eFailure ʧ                                                                  *
+ *        (2) eSuccess ɹ                                                                  *
+ *  ˵                                                                                       *
+ *************************************************************************************************/
+TState TclIsrReserveMsgBuffer(TMsgBuffer* pMsgBuf, TBase32 length, void** pAddr2)
+{
+    TState state;
+    TError error;
+    KNL_ASSERT((pMsgBuf != (TMsgBuffer*)0), "");
+    KNL_ASSERT((pAddr2 != (void**)0), "");
+
+    state = xMsgBufReserve(pMsgBuf, length, pAddr2, IPC_OPT_ISR, 0U, &error);
+    return state;
+}
+
+
+/*************************************************************************************************
+ *  : ߳/ISRύѾԤϢ                                                         *
+ *  : (1) pMsgBuf  Ϣṹַ                                                        *
+ *        (2) length   ϢʵʳȣΪ0ʱȡԤ                                             *
+ *        (3) pError   ϸý                                                              *
+ *  : (1) eFailure ʧ                                                                  *
+ *        (2) eSuccess ɹ                                                                  *
+ *  ˵                                                                                       *
+ *************************************************************************************************/
+TState TclCommitMsgBuffer(TMsgBuffer* pMsgBuf, TBase32 length, TError* pError)
+{
+    TState state;
+    KNL_ASSERT((pMsgBuf != (TMsgBuffer*)0), "");
+    KNL_ASSERT((pError != (TError*)0), "");
+
+    state = xMsgBufCommit(pMsgBuf, length, pError);
+    return state;
+}
+
+
+/*************************************************************************************************
+ *  : ̶߳ȡϢһϢ                                                 *
+ *  : (1) pMsgBuf  Ϣṹַ                                                        *
+ *        (2) pAddr2   Ϣ洢ַָ                                                *
+ *        (3) pLength  Ϣȵı                                                        *
+ *        (4) option   Ϣģʽ                                                      *
+ *        (5) timeo    ʱģʽ·Ϣʱ޳                                    *
+ *        (6) pError   ϸý                                                              *
+ *  : (1) eFailure ʧ                                                                  *
+ *        (2) eSuccess ɹ                                                                  *
+ *  ˵ֱ߳ڻжȡϢϺTclReleaseMsgBufferͷ                      *
+ *************************************************************************************************/
+TState TclPeekMsgBuffer(TMsgBuffer* pMsgBuf, void** pAddr2, TBase32* pLength,
+                        TOption option, TTimeTick timeo, TError* pError)
+{
+    TState state;
+    KNL_ASSERT((pMsgBuf != (TMsgBuffer*)0), "");
+    KNL_ASSERT((pAddr2 != (void**)0), "");
+    KNL_ASSERT((pLength != (TBase32*)0), "");
+    KNL_ASSERT((pError != (TError*)0), "");
+
+    /* ѡβҪֵ֧ѡ */
+    option &= IPC_VALID_MBUF_OPT;
+
+    /* ȡISRǣԶжϵ÷ʽ */
+    option &= ~IPC_OPT_ISR;
+    state = xMsgBufPeek(pMsgBuf, pAddr2, pLength, option, timeo, pError);
+    return state;
+}
+
+
+/*************************************************************************************************
+ *  : ISRȡϢһϢ                                                  *
+ *  : (1) pMsgBuf  Ϣṹַ                                                        *
+ *        (2) pAddr2   Ϣ洢ַָ                                                *
+ *        (3) pLength  Ϣȵı                                                        *
+ *  : (1) eFailure ʧ                                                                  *
+ *        (2) eSuccess ɹ                                                                  *
+ *  ˵                                                                                       *
+ *************************************************************************************************/
+TState TclIsrPeekMsgBuffer(TMsgBuffer* pMsgBuf, void** pAddr2, TBase32* pLength)
+{
+    TState state;
+    TError error;
+    KNL_ASSERT((pMsgBuf != (TMsgBuffer*)0), "");
+    KNL_ASSERT((pAddr2 != (void**)0), "");
+    KNL_ASSERT((pLength != (TBase32*)0), "");
+
+    state = xMsgBufPeek(pMsgBuf, pAddr2, pLength, IPC_OPT_ISR, 0U, &error);
+    return state;
+}
+
+
+/*************************************************************************************************
+ *  : ߳/ISRͷѾȡϢ                                                         *
+ *  : (1) pMsgBuf  Ϣṹַ                                                        *
+ *        (2) pError   ϸý                                                              *
+ *  : (1) eFailure ʧ                                                                  *
+ *        (2) eSuccess ɹ                                                                  *
+ *  ˵                                                                                       *
+ *************************************************************************************************/
+TState TclReleaseMsgBuffer(TMsgBuffer* pMsgBuf, TError* pError)
+{
+    TState state;
+    KNL_ASSERT((pMsgBuf != (TMsgBuffer*)0), "");
+    KNL_ASSERT((pError != (TError*)0), "");
+
+    state = xMsgBufRelease(pMsgBuf, pError);
+    return state;
+}
+
+
+/*************************************************************************************************
+ *  ܣϢú                                                                     *
+ *  룺(1) pMsgBuf   Ϣṹַ                                                       *
+ *        (2) pError    ϸý                                                             *
+ *  أ(1) eSuccess  ɹ                                                                 *
+ *        (2) eFailure  ʧ                                                                 *
+ *  ˵                                                                                       *
+ *************************************************************************************************/
+TState TclResetMsgBuffer(TMsgBuffer* pMsgBuf, TError* pError)
+{
+    TState state;
+    KNL_ASSERT((pMsgBuf != (TMsgBuffer*)0), "");
+    KNL_ASSERT((pError != (TError*)0), "");
+
+    state = xMsgBufReset(pMsgBuf, pError);
+    return state;
+}
+
+
+/*************************************************************************************************
+ *  ܣϢֹ                                                                 *
+ *  룺(1) pMsgBuf   Ϣṹַ                                                       *
+ *        (2) pError    ϸý                                                             *
+ *  أ(1) eSuccess  ɹ                                                                 *
+ *        (2) eFailure  ʧ                                                                 *
+ *  ˵                                                                                       *
+ *************************************************************************************************/
+TState TclFlushMsgBuffer(TMsgBuffer* pMsgBuf, TError* pError)
+{
+    TState state;
+    KNL_ASSERT((pMsgBuf != (TMsgBuffer*)0), "");
+    KNL_ASSERT((pError != (TError*)0), "");
+
+    state = xMsgBufFlush(pMsgBuf, pError);
+    return state;
+}
+#endif
+
+
+#if ((TCLC_IPC_ENABLE) && (TCLC_IPC_CHANNEL_ENABLE))
+/*************************************************************************************************
+ *  ܣͨʼ                                                                         *
+ *  룺(1) pChannel  ͨṹַ                                                             *
+ *        (2) pAddr     λַ                                                           *
+ *        (3) capacity  ɵԪĿ2                                *
+ *        (4) size      ÿԪصֽ                                                         *
+ *        (5) pError    ϸý                                                             *
+ *  أ(1) eSuccess  ɹ                                                                 *
+ *        (2) eFailure  ʧ                                                                 *
+ *  ˵ֽcapacity * size                                                    *
+ *************************************************************************************************/
+TState TclCreateChannel(TChannel* pChannel, void* pAddr, TBase32 capacity, TBase32 size,
+                        TError* pError)
+{
+    TState state;
+    KNL_ASSERT((pChannel != (TChannel*)0), "");
+    KNL_ASSERT((pAddr != (void*)0), "");
+    KNL_ASSERT((pError != (TError*)0), "");
+
+    state = xChannelCreate(pChannel, pAddr, capacity, size, pError);
+    return state;
+}
+
+
+/*************************************************************************************************
+ *  ܣͨע                                                                           *
+ *  룺(1) pChannel  ͨṹַ                                                             *
+ *        (2) pError    ϸý                                                             *
+ *  أ(1) eSuccess  ɹ                                                                 *
+ *        (2) eFailure  ʧ                                                                 *
+ *  ˵                                                                                       *
+ *************************************************************************************************/
+TState TclDeleteChannel(TChannel* pChannel, TError* pError)
+{
+    TState state;
+    KNL_ASSERT((pChannel != (TChannel*)0), "");
+    KNL_ASSERT((pError != (TError*)0), "");
+
+    state = xChannelDelete(pChannel, pError);
+    return state;
+}
+
+
+/*************************************************************************************************
+ *  ܣֹͨ                                                                       *
+ *  룺(1) pChannel  ͨṹַ                                                             *
+ *        (2) pError    ϸý                                                             *
+ *  أ(1) eSuccess  ɹ                                                                 *
+ *        (2) eFailure  ʧ                                                                 *
+ *  ˵                                                                                       *
+ *************************************************************************************************/
+TState TclFlushChannel(TChannel* pChannel, TError* pError)
+{
+    TState state;
+    KNL_ASSERT((pChannel != (TChannel*)0), "");
+    KNL_ASSERT((pError != (TError*)0), "");
+
+    state = xChannelFlush(pChannel, pError);
+    return state;
+}
+
+
+/*************************************************************************************************
+ *  : ߳/ISRͨдһԪ                                                             *
+ *  : (1) pChannel ͨṹַ                                                              *
+ *        (2) pData    Ԫصַ                                                                  *
+ *        (3) pError   ϸý                                                              *
+ *  : (1) eFailure ʧ                                                                  *
+ *        (2) eSuccess ɹ                                                                  *
+ *  ˵ֻͨһߣ߲ᱻ                                               *
+ *************************************************************************************************/
+TState TclWriteChannel(TChannel* pChannel, void* pData, TError* pError)
+{
+    TState state;
+    KNL_ASSERT((pChannel != (TChannel*)0), "");
+    KNL_ASSERT((pData != (void*)0), "");
+    KNL_ASSERT((pError != (TError*)0), "");
+
+    state = xChannelWrite(pChannel, pData, pError);
+    return state;
+}
+
+
+/*************************************************************************************************
+ *  : ̴߳ͨһԪ                                                             *
+ *  : (1) pChannel ͨṹַ                                                              *
+ *        (2) pData    Ԫصĵַ                                                            *
+ *        (3) option   ͨģʽ                                                            *
+ *        (4) timeo    ʱģʽ·ͨʱ޳                                          *
+ *        (5) pError   ϸý                                                              *
+ *  : (1) eFailure ʧ                                                                  *
+ *        (2) eSuccess ɹ                                                                  *
+ *  ˵ֻͨһ                                                                 *
+ *************************************************************************************************/
+TState TclReadChannel(TChannel* pChannel, void* pData, TOption option, TTimeTick timeo,
+                      TError* pError)
+{
+    TState state;
+    KNL_ASSERT((pChannel != (TChannel*)0), "");
+    KNL_ASSERT((pData != (void*)0), "");
+    KNL_ASSERT((pError != (TError*)0), "");
+
+    /* ѡβҪֵ֧ѡ */
+    option &= IPC_VALID_CHNL_OPT;
+
+    /* ȡISR */
+    option &= ~IPC_OPT_ISR;
+    state = xChannelRead(pChannel, pData, option, timeo, pError);
+    return state;
+}
+
+
+/*************************************************************************************************
+ *  : ISRͨһԪ                                                              *
+ *  : (1) pChannel ͨṹַ                                                              *
+ *        (2) pData    Ԫصĵַ                                                            *
+ *  : (1) eFailure ʧ                                                                  *
+ *        (2) eSuccess ɹ                                                                  *
+ *  ˵ֻͨһ                                                                 *
+ *************************************************************************************************/
+TState TclIsrReadChannel(TChannel* pChannel, void* pData)
+{
+    TState state;
+    TError error;
+    KNL_ASSERT((pChannel != (TChannel*)0), "");
+    KNL_ASSERT((pData != (void*)0), "");
+
+    state = xChannelRead(pChannel, pData, IPC_OPT_ISR, 0U, &error);
+    return state;
+}
+#endif
+
+
+#if ((TCLC_IPC_ENABLE) && (TCLC_IPC_FLAGS_ENABLE))
+/*************************************************************************************************
+ *  ܣʼ¼                                                                         *
+ *  (1) pFlags     ¼ǵĵַ                                                          *
+ *        (2) property   ¼ǵĳʼ                                                      *
+ *        (3) pError     ϸֵ                                                      *
+ *  : (1) eFailure   ʧ                                                                *
+ *        (2) eSuccess   ɹ                                                                *
+ *  ˵                                                                                       *
+ *************************************************************************************************/
+TState TclCreateFlags(TFlags* pFlags, TProperty property, TError* pError)
+{
+    TState state;
+    KNL_ASSERT((pFlags != (TFlags*)0), "");
+    KNL_ASSERT((pError != (TError*)0), "");
+
+    property &= IPC_VALID_FLAG_PROP;
+    state = xFlagsCreate(pFlags, property, pError);
+    return state;
+}
+
+
+/*************************************************************************************************
+ *  ܣȡ¼ǳʼ                                                                     *
+ *  (1) pFlags   ¼ǵĵַ                                                            *
+ *        (2) pError   ϸֵ                                                        *
+ *  : (1) eFailure ʧ                                                                  *
+ *        (2) eSuccess ɹ                                                                  *
+ *  ˵                                                                                       *
+ *************************************************************************************************/
+TState TclDeleteFlags(TFlags* pFlags, TError* pError)
+{
+    TState state;
+    KNL_ASSERT((pFlags != (TFlags*)0), "");
+    KNL_ASSERT((pError != (TError*)0), "");
+
+    state = xFlagsDelete(pFlags, pError);
+    return state;
+}
+
+
+/*************************************************************************************************
+ *  ܣ߳/ISR¼Ƿ¼                                                             *
+ *  (1) pFlags   ¼ǵĵַ                                                            *
+ *        (2) pPattern Ҫյıǵ                                                      *
+ *        (3) pError   ϸý                                                              *
+ *  : (1) eFailure   ʧ                                                                *
+ *        (2) eSuccess   ɹ                                                                *
+ *  ˵ǰ߳                                                             *
+ *************************************************************************************************/
+TState TclSendFlags(TFlags* pFlags, TFlagMask pattern, TError* pError)
+{
+    TState state;
+    KNL_ASSERT((pFlags != (TFlags*)0), "");
+    KNL_ASSERT((pError != (TError*)0), "");
+
+    state = xFlagsSend(pFlags, pattern, pError);
+    return state;
+}
+
+
+/*************************************************************************************************
+ *  ܣ߳/ISR¼                                                                   *
+ *  (1) pFlags   ¼ǵĵַ                                                            *
+ *        (2) pPattern Ҫյıǵ                                                      *
+ *        (3) timeo    ʱģʽ·¼ǵʱ޳                                      *
+ *        (4) option   ¼ǵĲ                                                        *
+ *        (5) pError   ϸý                                                              *
+ *  : (1) eFailure ʧ                                                                  *
+ *        (2) eSuccess ɹ                                                                  *
+ *  ˵                                                                                       *
+ *************************************************************************************************/
+TState TclReceiveFlags(TFlags* pFlags, TFlagMask* pPattern, TOption option, TTimeTick timeo,
+                       TError* pError)
+{
+    TState state;
+
+    KNL_ASSERT((pFlags != (TFlags*)0), "");
+    KNL_ASSERT((option & (IPC_OPT_AND | IPC_OPT_OR)) != 0U, "");
+    KNL_ASSERT((pError != (TError*)0), "");
+
+    /* ѡβҪֵ֧ѡ */
+    option &= IPC_VALID_FLAG_OPT;
+
+    /* ȡISRǣԶжϵû */
+    option &= ~IPC_OPT_ISR;
+    state = xFlagsReceive(pFlags, pPattern, option, timeo, pError);
+    return state;
+}
+
+
+/*************************************************************************************************
+ *  : ¼                                                                   *
+ *  (1) pFlags   ¼ǵĵַ                                                            *
+ *        (2) pError   ϸý                                                              *
+ *  : (1) eFailure   ʧ                                                                *
+ *        (2) eSuccess   ɹ                                                                *
+ *  ˵                                                                                       *
+ *************************************************************************************************/
+TState TclResetFlags(TFlags* pFlags, TError* pError)
+{
+    TState state;
+
+    KNL_ASSERT((pFlags != (TFlags*)0), "");
+    KNL_ASSERT((pError != (TError*)0), "");
+
+    state = xFlagsReset(pFlags, pError);
+    return state;
+}
+
+
+/*************************************************************************************************
+ *  ܣ¼ֹ,̴ָ߳¼ǵֹ߳                  *
+ *  (1) pFlags   ¼ǽṹַ                                                          *
+ *        (2) option   ѡ                                                                  *
+ *        (3) pThread  ̵ַ߳                                                                  *
+ *        (4) pError   ϸý                                                              *
+ *  أ(1) eSuccess                                                                           *
+ *        (2) eFailure                                                                           *
+ *  ˵                                                                                       *
+ *************************************************************************************************/
+TState TclFlushFlags(TFlags* pFlags, TError* pError)
+{
+    TState state = eFailure;
+    KNL_ASSERT((pFlags != (TFlags*)0), "");
+    KNL_ASSERT((pError != (TError*)0), "");
+
+    state = xFlagsFlush(pFlags, pError);
+    return state;
+}
+#endif
+
+
+#if ((TCLC_IPC_ENABLE) && (TCLC_IPC_WAITANY_ENABLE))
+/*************************************************************************************************
+ *  ܣ߳ͬʱȴIPC                                                                *
+ *  (1) pItems   IPCṹ                                                       *
+ *        (2) number   IPCĿ                                                             *
+ *        (3) pIndex   ʹ̷߳صIPCе                                     *
+ *        (4) option   ȴʽ                                                                  *
+ *        (5) timeo    ʱģʽµĵȴʱ                                                  *
+ *        (6) pError   ϸý                                                              *
+ *  : (1) eFailure ʧ                                                                  *
+ *        (2) eSuccess ɹ                                                                  *
+ *  ˵ּ֧ź䡢Ϣк¼ǣʱӦĽղѾ             *
+ *************************************************************************************************/
+TState TclWaitAny(TIpcWaitItem* pItems, TBase32 number, TIndex* pIndex,
+                  TOption option, TTimeTick timeo, TError* pError)
+{
+    TState state;
+
+    KNL_ASSERT((pItems != (TIpcWaitItem*)0), "");
+    KNL_ASSERT((number > 0U), "");
+    KNL_ASSERT((pIndex != (TIndex*)0), "");
+    KNL_ASSERT((pError != (TError*)0), "");
+
+    /* ѡβҪֵ֧ѡ */
+    option &= (IPC_OPT_WAIT | IPC_OPT_TIMED);
+    state = xIpcWaitAny(pItems, number, pIndex, option, timeo, pError);
+    return state;
+}
+#endif
+
+
+#if (TCLC_TIMER_ENABLE)
+/*************************************************************************************************
+ *  ܣûʱʼ                                                                   *
+ *  (1) pTimer   ʱַ                                                                *
+ *        (2) property ʱ                                                                *
+ *        (3) ticks    ʱδĿ                                                            *
+ *        (4) pRoutine ûʱص                                                        *
+ *        (5) pData    ûʱص                                                    *
+ *        (6) pError   ϸý                                                              *
+ *  : (1) eSuccess ɹ                                                                  *
+ *        (2) eFailure ʧ                                                                  *
+ *  ˵                                                                                         *
+ *************************************************************************************************/
+TState TclCreateTimer(TTimer* pTimer, TProperty property, TTimeTick ticks,
+                      TTimerRoutine pRoutine, TArgument data, TError* pError)
+{
+    TState state;
+    KNL_ASSERT((pTimer != (TTimer*)0), "");
+    KNL_ASSERT((pRoutine != (TTimerRoutine)0), "");
+	
+    state = xTimerCreate(pTimer, property, ticks, pRoutine, data, pError);
+    return state;
+}
+
+
+/*************************************************************************************************
+ *  ܣں˶ʱȡʼ                                                                   *
+ *  (1) pTimer   ʱṹַ                                                            *
+ *  : (1) eSuccess ɹ                                                                  *
+ *        (2) eFailure ʧ                                                                  *
+ *        (3) pError   ϸý                                                              *
+ *  ˵                                                                                         *
+ *************************************************************************************************/
+TState TclDeleteTimer(TTimer* pTimer, TError* pError)
+{
+    TState state;
+    KNL_ASSERT((pTimer != (TTimer*)0), "");
+    KNL_ASSERT((pError != (TError*)0), "");
+
+    state = xTimerDelete(pTimer, pError);
+    return state;
+}
+
+
+/*************************************************************************************************
+ *  ܣʱ                                                                         *
+ *  (1) pTimer     ʱṹַ                                                          *
+ *        (2) lagticks   ʱӻʼʱ                                                  *
+ *        (3) pError     ϸý                                                            *
+ *  : (1) eSuccess   ɹ                                                                *
+ *        (2) eFailure   ʧ                                                                *
+ *  ˵                                                                                     *
+ *************************************************************************************************/
+TState TclStartTimer(TTimer* pTimer, TTimeTick lagticks, TError* pError)
+{
+    TState state;
+    KNL_ASSERT((pTimer != (TTimer*)0), "");
+
+    state = xTimerStart(pTimer, lagticks, pError);
+    return state;
+}
+
+
+/*************************************************************************************************
+ *  ܣֹͣûʱ                                                                     *
+ *  (1) pTimer   ʱַ                                                                *
+ *  : (1) eSuccess ɹ                                                                  *
+ *        (2) eFailure ʧ                                                                  *
+ *        (3) pError   ϸý                                                              *
+ *  ˵                                                                                       *
+ *************************************************************************************************/
+TState TclStopTimer(TTimer* pTimer, TError* pError)
+{
+    TState state;
+    KNL_ASSERT((pTimer != (TTimer*)0), "");
+
+    state = xTimerStop(pTimer, pError);
+    return state;
+}
+
+/*************************************************************************************************
+ *  ܣöʱͺͶʱʱ                                                               *
+ *  (1) pTimer ʱṹַ                                                              *
+ *        (2) ticks  ʱʱӽĿ                                                          *
+ *        (3) pError ϸý                                                                *
+ *  أ                                                                                     *
+ *  ˵                                                                                         *
+ *************************************************************************************************/
+TState TclConfigTimer(TTimer* pTimer, TTimeTick ticks, TError* pError)
+{
+    TState state;
+    KNL_ASSERT((pTimer != (TTimer*)0), "");
+    KNL_ASSERT((ticks > 0U), "");
+
+    state = xTimerConfig(pTimer, ticks, pError);
+    return state;
+}
+#endif
+
+
+#if ((TCLC_IRQ_ENABLE) && (TCLC_IRQ_DAEMON_ENABLE))
+/*************************************************************************************************
+ *  ܣύж                                                                           *
+ *  (1) pIRQ      жṹַ                                                         *
+ *        (2) priority  жȼ                                                           *
+ *        (3) pEntry    жϴص                                                         *
+ *        (4) data      жϴص                                                         *
+ *  : (1) eFailure  ʧ                                                                 *
+ *        (2) eSuccess  ɹ                                                                 *
+ *  ˵                                                                                       *
+ *************************************************************************************************/
+TState TclPostIRQ(TIrq* pIRQ, TPriority priority, TIrqEntry pEntry, TArgument data, TError* pError)
+{
+    TState state;
+    KNL_ASSERT((pIRQ != (TIrq*)0), "");
+
+    state = xIrqPostRequest(pIRQ, priority, pEntry, data, pError);
+    return state;
+}
+
+
+/*************************************************************************************************
+ *  ܣж                                                                           *
+ *  (1) TIrq      жṹַ                                                         *
+ *  : (1) eFailure  ʧ                                                                 *
+ *        (2) eSuccess  ɹ                                                                 *
+ *  ˵                                                                                       *
+ *************************************************************************************************/
+TState TclCancelIRQ(TIrq* pIRQ, TError* pError)
+{
+    TState state;
+    KNL_ASSERT((pIRQ != (TIrq*)0), "");
+
+    state = xIrqCancelRequest(pIRQ, pError);
+    return state;
+}
+#endif
+
+
+#if ((TCLC_MEMORY_ENABLE) && (TCLC_MEMORY_POOL_ENABLE))
+/*************************************************************************************************
+ *  : ʼڴҳ                                                                         *
+ *  : (1) pPool      ڴҳؽṹַ                                                        *
+ *        (2) pAddr      ڴַ                                                        *
+ *        (3) pages      ڴڴҳĿ                                                      *
+ *        (4) pgsize     ڴҳС                                                              *
+ *        (5) property   ڴҳ                                                            *
+ *        (6) pError     ϸý                                                            *
+ *  : (1) eSuccess   ɹ                                                                *
+ *        (2) eFailure   ʧ                                                                *
+ *  ˵ڴҳССһָ룬ڴҳ׸ֱָ                       *
+ *************************************************************************************************/
+TState TclCreateMemoryPool(TMemPool* pPool, void* pAddr, TBase32 pages, TBase32 pgsize,
+                           TProperty property, TError* pError)
+{
+    TState state;
+    KNL_ASSERT((pPool != (TMemPool*)0), "");
+    KNL_ASSERT((pAddr != (void*)0), "");
+    KNL_ASSERT((pages != 0U), "");
+    KNL_ASSERT((pgsize >= sizeof(void*)), "");
+    KNL_ASSERT((pgsize % sizeof(void*) == 0U), "");
+    KNL_ASSERT((pages <= TCLC_MEMORY_POOL_PAGES), "");
+    KNL_ASSERT((pError != (TError*)0), "");
+
+    state = xMemPoolCreate(pPool, pAddr, pages, pgsize, property, pError);
+    return state;
+}
+
+
+/*************************************************************************************************
+ *  : ڴ                                                                             *
+ *  : (1) pPool      ڴؽṹַ                                                          *
+ *        (2) pError     ϸý                                                            *
+ *  : (1) eSuccess   ɹ                                                                *
+ *        (2) eFailure   ʧ                                                                *
+ *  ˵                                                                                       *
+ *************************************************************************************************/
+TState TclDeleteMemoryPool(TMemPool* pPool, TError* pError)
+{
+    TState state;
+    KNL_ASSERT((pPool != (TMemPool*)0), "");
+    KNL_ASSERT((pError != (TError*)0), "");
+
+    state = xMemPoolDelete(pPool, pError);
+    return state;
+}
+
+
+/*************************************************************************************************
+ *  : ڴڴ                                                                 *
+ *  : (1) pPool      ڴؽṹַ                                                          *
+ *        (2) pObject2   뵽ڴָ                                              *
+ *        (3) pError     ϸý                                                            *
+ *  : (1) eSuccess   ɹ                                                                *
+ *        (2) eFailure   ʧ                                                                *
+ *  ˵                                                                                       *
+ *************************************************************************************************/
+TState TclMallocPoolMemory(TMemPool* pPool, void** pAddr2, TError* pError)
+{
+    TState state;
+    KNL_ASSERT((pPool != (TMemPool*)0), "");
+    KNL_ASSERT((pAddr2 != (void**)0), "");
+    KNL_ASSERT((pError != (TError*)0), "");
+
+    state = xPoolMemMalloc(pPool, pAddr2, pError);
+    return state;
+}
+
+
+/*************************************************************************************************
+ *  : ڴͷڴ                                                                     *
+ *  : (1) pPool      ڴؽṹַ                                                          *
+ *        (2) pObject    ͷڴĵַ                                                        *
+ *        (3) pError     ϸý                                                            *
+ *  : (1) eSuccess   ɹ                                                                *
+ *        (2) eFailure   ʧ                                                                *
+ *  ˵                                                                                       *
+ *************************************************************************************************/
+TState TclFreePoolMemory(TMemPool* pPool, void* pAddr, TError* pError)
+{
+    TState state;
+    KNL_ASSERT((pPool != (TMemPool*)0), "");
+    KNL_ASSERT((pAddr != (void*)0), "");
+    KNL_ASSERT((pError != (TError*)0), "");
+
+    state = xPoolMemFree(pPool, pAddr, pError);
     return state;
 }
 #endif
 
 
-#if (TCLC_TIMER_ENABLE)
+#if ((TCLC_MEMORY_ENABLE) && (TCLC_MEMORY_BUDDY_ENABLE))
+/*************************************************************************************************
+ *  ܣʼڴƽṹ                                                             *
+ *  (1) pBuddy    ϵͳڴַ                                                   *
+ *        (2) pAddr     ɹڴַ                                                       *
+ *        (3) pages     ɹڴҳ                                                     *
+ *        (4) pagesize  ڴҳС                                                               *
+ *        (5) pTags     ڴҳ飬pagesֽ                                        *
+ *        (6) pError    ϸý                                                             *
+ *  : (1) eSuccess  ɹ                                                                 *
+ *        (2) eFailure  ʧ                                                                 *
+ *  ˵ڴڵ㱣ڴҳУڴ밴ָ볤ȶ룻ڴҳʱ     *
+ *        ڴҳɵ߰ҳṩ                                                       *
+ *************************************************************************************************/
+TState TclCreateMemBuddy(TMemBuddy* pBuddy, TChar* pAddr, TBase32 pages, TBase32 pagesize,
+                         TByte* pTags, TError* pError)
+{
+    TState state;
+    KNL_ASSERT((pBuddy != (TMemBuddy*)0), "");
+    KNL_ASSERT((pAddr != (TChar*)0), "");
+    KNL_ASSERT((((TAddr)pAddr) % sizeof(void*) == 0U), "");
+    KNL_ASSERT((pages > 0U), "");
+    KNL_ASSERT((pagesize >= sizeof(TBuddyNode)), "");
+    KNL_ASSERT((pagesize % sizeof(void*) == 0U), "");
+    KNL_ASSERT((pTags != (TByte*)0), "");
+    KNL_ASSERT((pError != (TError*)0), "");
+
+    state = xBuddyCreate(pBuddy, pAddr, pages, pagesize, pTags, pError);
+    return state;
+}
+
+
+/*************************************************************************************************
+ *  ܣٻڴƽṹ                                                               *
+ *  (1) pBuddy     ϵͳڴַ                                                  *
+ *        (2) pError     ϸý                                                            *
+ *  : (1) eSuccess   ɹ                                                                *
+ *        (2) eFailure   ʧ                                                                *
+ *  ˵                                                                                       *
+ *************************************************************************************************/
+TState TclDeleteMemBuddy(TMemBuddy* pBuddy, TError* pError)
+{
+    TState state;
+    KNL_ASSERT((pBuddy != (TMemBuddy*)0), "");
+    KNL_ASSERT((pError != (TError*)0), "");
+
+    state = xBuddyDelete(pBuddy, pError);
+    return state;
+}
+
+
+/*************************************************************************************************
+ *  ܣӻϵͳڴ                                                                   *
+ *  (1) pBuddy    ϵͳַ                                                   *
+ *        (2) len       Ҫڴ泤                                                       *
+ *        (3) pAddr2    õڴַָ                                                   *
+ *        (4) pError    ϸý                                                             *
+ *  : (1) eSuccess  ɹ                                                                 *
+ *        (2) eFailure  ʧ                                                                 *
+ *  ˵                                                                                       *
+ *************************************************************************************************/
+TState TclMallocBuddyMem(TMemBuddy* pBuddy, int len, void** pAddr2, TError* pError)
+{
+    TState state;
+    KNL_ASSERT((pBuddy != (TMemBuddy*)0), "");
+    KNL_ASSERT((len > 0U), "");
+    KNL_ASSERT((pAddr2 != (void**)0), "");
+    KNL_ASSERT((pError != (TError*)0), "");
+
+    state = xBuddyMemMalloc(pBuddy, len, pAddr2, pError);
+    return state;
+}
+
+
+/*************************************************************************************************
+ *  ܣϵͳͷڴ                                                                   *
+ *  (1) pBuddy    ϵͳַ                                                   *
+ *        (2) pAddr     ͷŵڴַ                                                         *
+ *        (3) pError    ϸý                                                             *
+ *  : (1) eSuccess  ɹ                                                                 *
+ *        (2) eFailure  ʧ                                                                 *
+ *  ˵                                                                                       *
+ *************************************************************************************************/
+TState TclFreeBuddyMem(TMemBuddy* pBuddy,  void* pAddr, TError* pError)
+{
+    TState state;
+    KNL_ASSERT((pBuddy != (TMemBuddy*)0), "");
+    KNL_ASSERT((pAddr != (char*)0), "");
+    KNL_ASSERT((pError != (TError*)0), "");
+
+    state = xBuddyMemFree(pBuddy, pAddr, pError);
+    return state;
+}
+#endif
+
+
+#if ((TCLC_MEMORY_ENABLE) && (TCLC_MEMORY_TLSF_ENABLE))
+/*************************************************************************************************
+ *  ܣʼTLSF                                                                           *
+ *  (1) pTlsf     TLSFѽṹַ                                                           *
+ *        (2) pAddr     ɹڴַ                                                       *
+ *        (3) bytes     ɹڴֽ                                                     *
+ *        (4) pError    ϸý                                                             *
+ *  : (1) eSuccess  ɹ                                                                 *
+ *        (2) eFailure  ʧ                                                                 *
+ *  ˵(1 << TCLC_MEMORY_TLSF_MAX_LOG2)ֽڵĲֲ                                 *
+ *************************************************************************************************/
+TState TclCreateMemTlsf(TMemTlsf* pTlsf, void* pAddr, TBase32 bytes, TError* pError)
+{
+    TState state;
+    KNL_ASSERT((pTlsf != (TMemTlsf*)0), "");
+    KNL_ASSERT((pAddr != (void*)0), "");
+    KNL_ASSERT((bytes > 0U), "");
+    KNL_ASSERT((pError != (TError*)0), "");
+
+    state = xTlsfCreate(pTlsf, pAddr, bytes, pError);
+    return state;
+}
+
+
+/*************************************************************************************************
+ *  ܣTLSF                                                                             *
+ *  (1) pTlsf     TLSFѽṹַ                                                           *
+ *        (2) pError    ϸý                                                             *
+ *  : (1) eSuccess  ɹ                                                                 *
+ *        (2) eFailure  ʧ                                                                 *
+ *  ˵                                                                                       *
+ *************************************************************************************************/
+TState TclDeleteMemTlsf(TMemTlsf* pTlsf, TError* pError)
+{
+    TState state;
+    KNL_ASSERT((pTlsf != (TMemTlsf*)0), "");
+    KNL_ASSERT((pError != (TError*)0), "");
+
+    state = xTlsfDelete(pTlsf, pError);
+    return state;
+}
+
+
+/*************************************************************************************************
+ *  ܣTLSFڴ                                                                     *
+ *  (1) pTlsf     TLSFѽṹַ                                                           *
+ *        (2) len       Ҫڴ泤                                                       *
+ *        (3) pAddr2    õڴַָ                                                   *
+ *        (4) pError    ϸý                                                             *
+ *  : (1) eSuccess  ɹ                                                                 *
+ *        (2) eFailure  ʧ                                                                 *
+ *  ˵                                                                                       *
+ *************************************************************************************************/
+TState TclMallocTlsfMem(TMemTlsf* pTlsf, TBase32 len, void** pAddr2, TError* pError)
+{
+    TState state;
+    KNL_ASSERT((pTlsf != (TMemTlsf*)0), "");
+    KNL_ASSERT((len > 0U), "");
+    KNL_ASSERT((pAddr2 != (void**)0), "");
+    KNL_ASSERT((pError != (TError*)0), "");
+
+    state = xTlsfMemMalloc(pTlsf, len, pAddr2, pError);
+    return state;
+}
+
+
+/*************************************************************************************************
+ *  ܣTLSFͷڴ                                                                     *
+ *  (1) pTlsf     TLSFѽṹַ                                                           *
+ *        (2) pAddr     ͷŵڴַ                                                         *
+ *        (3) pError    ϸý                                                             *
+ *  : (1) eSuccess  ɹ                                                                 *
+ *        (2) eFailure  ʧ                                                                 *
+ *  ˵                                                                                       *
+ *************************************************************************************************/
+TState TclFreeTlsfMem(TMemTlsf* pTlsf, void* pAddr, TError* pError)
+{
+    TState state;
+    KNL_ASSERT((pTlsf != (TMemTlsf*)0), "");
+    KNL_ASSERT((pAddr != (void*)0), "");
+    KNL_ASSERT((pError != (TError*)0), "");
+
+    state = xTlsfMemFree(pTlsf, pAddr, pError);
+    return state;
+}
+
+
+/*************************************************************************************************
+ *  ܣTLSFѷڴĳ                                                           *
+ *  (1) pTlsf     TLSFѽṹַ                                                           *
+ *        (2) pAddr     ѷڴַΪ0ʱͬڴ                                    *
+ *        (3) len       µڴ泤                                                             *
+ *        (4) pAddr2    ֮ڴַָ                                                   *
+ *        (5) pError    ϸý                                                             *
+ *  : (1) eSuccess  ɹ                                                                 *
+ *        (2) eFailure  ʧ                                                                 *
+ *  ˵                                                                                       *
+ *************************************************************************************************/
+TState TclReallocTlsfMem(TMemTlsf* pTlsf, void* pAddr, TBase32 len, void** pAddr2,
+                         TError* pError)
+{
+    TState state;
+    KNL_ASSERT((pTlsf != (TMemTlsf*)0), "");
+    KNL_ASSERT((len > 0U), "");
+    KNL_ASSERT((pAddr2 != (void**)0), "");
+    KNL_ASSERT((pError != (TError*)0), "");
+
+    state = xTlsfMemRealloc(pTlsf, pAddr, len, pAddr2, pError);
+    return state;
+}
+
+
+/*************************************************************************************************
+ *  ܣTLSFѵͳϢ                                                                   *
+ *  (1) pTlsf     TLSFѽṹַ                                                           *
+ *        (2) pInfo     ͳϢĽṹַ                                                   *
+ *        (3) pError    ϸý                                                             *
+ *  : (1) eSuccess  ɹ                                                                 *
+ *        (2) eFailure  ʧ                                                                 *
+ *  ˵                                                                                       *
+ *************************************************************************************************/
+TState TclGetTlsfInfo(TMemTlsf* pTlsf, TTlsfInfo* pInfo, TError* pError)
+{
+    TState state;
+    KNL_ASSERT((pTlsf != (TMemTlsf*)0), "");
+    KNL_ASSERT((pInfo != (TTlsfInfo*)0), "");
+    KNL_ASSERT((pError != (TError*)0), "");
+
+    state = xTlsfGetInfo(pTlsf, pInfo, pError);
+    return state;
+}
+#endif
+
+
+
+#if ((TCLC_MEMORY_ENABLE) && (TCLC_MEMORY_SLAB_ENABLE) && \
+     (TCLC_MEMORY_POOL_ENABLE) && (TCLC_MEMORY_BUDDY_ENABLE))
 /*************************************************************************************************
- *  ܣûʱʼ                                                                   *
- *  (1) pTimer   ʱַ                                                                *
- *        (2) property ʱ                                                                *
- *        (3) ticks    ʱδĿ                                                            *
- *        (4) pRoutine ûʱص                                                        *
- *        (5) pData    ûʱص                                                    *
- *        (6) pError   ϸý                                                              *
- *  : (1) eSuccess ɹ                                                                  *
- *        (2) eFailure ʧ                                                                  *
- *  ˵                                                                                         *
+ *  ܣʼ󻺴                                                                         *
+ *  (1) pSlab     󻺴ṹַ                                                         *
+ *        (2) size      ֽ                                                               *
+ *        (3) objs      ÿslabеĶĿʹڴҳʱԴ˲                           *
+ *        (4) pPool     ṩslabڴҳ                                                       *
+ *        (5) pBuddy    ṩslabĻϵͳpPoolΪ0ʱʹ                                       *
+ *        (6) ctor      캯Ϊ0                                                    *
+ *        (7) dtor      Ϊ0                                                    *
+ *        (8) pError    ϸý                                                             *
+ *  : (1) eSuccess  ɹ                                                                 *
+ *        (2) eFailure  ʧ                                                                 *
+ *  ˵                                                                                       *
  *************************************************************************************************/
-TState TclCreateTimer(TTimer* pTimer, TProperty property, TTimeTick ticks,
-                      TTimerRoutine pRoutine, TArgument data, TError* pError)
+TState TclCreateSlabCache(TMemSlab* pSlab, TBase32 size, TBase32 objs, TMemPool* pPool,
+                          TMemBuddy* pBuddy, TSlabCtor ctor, TSlabDtor dtor, TError* pError)
 {
     TState state;
-    KNL_ASSERT((pTimer != (TTimer*)0), "");
-    KNL_ASSERT((pRoutine != (TTimerRoutine)0), "");
-	
-    state = xTimerCreate(pTimer, property, ticks, pRoutine, data, pError);
+    KNL_ASSERT((pSlab != (TMemSlab*)0), "");
+    KNL_ASSERT((size > 0U), "");
+    KNL_ASSERT(((pPool != (TMemPool*)0) || (pBuddy != (TMemBuddy*)0)), "");
+    KNL_ASSERT(((pPool != (TMemPool*)0) || (objs > 0U)), "");
+    KNL_ASSERT((pError != (TError*)0), "");
+
+    state = xSlabCreate(pSlab, size, objs, pPool, pBuddy, ctor, dtor, pError);
     return state;
 }
 
 
 /*************************************************************************************************
- *  ܣں˶ʱȡʼ                                                                   *
- *  (1) pTimer   ʱṹַ                                                            *
- *  : (1) eSuccess ɹ                                                                  *
- *        (2) eFailure ʧ                                                                  *
- *        (3) pError   ϸý                                                              *
- *  ˵                                                                                         *
+ *  ܣٶ󻺴                                                                           *
+ *  (1) pSlab     󻺴ṹַ                                                         *
+ *        (2) pError    ϸý                                                             *
+ *  : (1) eSuccess  ɹ                                                                 *
+ *        (2) eFailure  ʧ                                                                 *
+ *  ˵                                                                                       *
  *************************************************************************************************/
-TState TclDeleteTimer(TTimer* pTimer, TError* pError)
+TState TclDeleteSlabCache(TMemSlab* pSlab, TError* pError)
 {
     TState state;
-    KNL_ASSERT((pTimer != (TTimer*)0), "");
+    KNL_ASSERT((pSlab != (TMemSlab*)0), "");
     KNL_ASSERT((pError != (TError*)0), "");
 
-    state = xTimerDelete(pTimer, pError);
+    state = xSlabDelete(pSlab, pError);
     return state;
 }
 
 
 /*************************************************************************************************
- *  ܣʱ                                                                         *
- *  (1) pTimer     ʱṹַ                                                          *
- *        (2) lagticks   ʱӻʼʱ                                                  *
- *        (3) pError     ϸý                                                            *
- *  : (1) eSuccess   ɹ                                                                *
- *        (2) eFailure   ʧ                                                                *
- *  ˵                                                                                     *
+ *  ܣӶ󻺴з                                                                   *
+ *  (1) pSlab     󻺴ṹַ                                                         *
+ *        (2) pObject2  䵽Ķַָ                                           *
+ *        (3) pError    ϸý                                                             *
+ *  : (1) eSuccess  ɹ                                                                 *
+ *        (2) eFailure  ʧ                                                                 *
+ *  ˵                                                                                       *
  *************************************************************************************************/
-TState TclStartTimer(TTimer* pTimer, TTimeTick lagticks, TError* pError)
+TState TclMallocSlabObject(TMemSlab* pSlab, void** pObject2, TError* pError)
 {
     TState state;
-    KNL_ASSERT((pTimer != (TTimer*)0), "");
+    KNL_ASSERT((pSlab != (TMemSlab*)0), "");
+    KNL_ASSERT((pObject2 != (void**)0), "");
+    KNL_ASSERT((pError != (TError*)0), "");
 
-    state = xTimerStart(pTimer, lagticks, pError);
+    state = xSlabMalloc(pSlab, pObject2, pError);
     return state;
 }
 
 
 /*************************************************************************************************
- *  ܣֹͣûʱ                                                                     *
- *  (1) pTimer   ʱַ                                                                *
- *  : (1) eSuccess ɹ                                                                  *
- *        (2) eFailure ʧ                                                                  *
- *        (3) pError   ϸý                                                              *
+ *  ܣ󻺴ͷŶ                                                                     *
+ *  (1) pSlab     󻺴ṹַ                                                         *
+ *        (2) pObject   ͷŵĶַ                                                         *
+ *        (3) pError    ϸý                                                             *
+ *  : (1) eSuccess  ɹ                                                                 *
+ *        (2) eFailure  ʧ                                                                 *
  *  ˵                                                                                       *
  *************************************************************************************************/
-TState TclStopTimer(TTimer* pTimer, TError* pError)
+TState TclFreeSlabObject(TMemSlab* pSlab, void* pObject, TError* pError)
 {
     TState state;
-    KNL_ASSERT((pTimer != (TTimer*)0), "");
+    KNL_ASSERT((pSlab != (TMemSlab*)0), "");
+    KNL_ASSERT((pObject != (void*)0), "");
+    KNL_ASSERT((pError != (TError*)0), "");
 
-    state = xTimerStop(pTimer, pError);
+    state = xSlabFree(pSlab, pObject, pError);
     return state;
 }
 
+
 /*************************************************************************************************
- *  ܣöʱͺͶʱʱ                                                               *
- *  (1) pTimer ʱṹַ                                                              *
- *        (2) ticks  ʱʱӽĿ                                                          *
- *        (3) pError ϸý                                                                *
- *  أ                                                                                     *
- *  ˵                                                                                         *
+ *  ܣӶ󻺴ж̬߳                                                               *
+ *  (1) pCache   ̶߳󻺴棬ֽTCLM_THREAD_OBJ_BYTES(ջֽ)             *
+ *        (2) pThread2 ߳̽ṹַָ                                                *
+ *        (3) pEntry   ַ̺߳                                                              *
+ *        (4) data     ַ̲߳(ʾ)                                                  *
+ *        (5) priority ߳ȼ                                                                *
+ *        (6) ticks    ߳ʱƬ                                                            *
+ *        (7) pError   ϸý                                                              *
+ *  أ(1) eFailure                                                                           *
+ *        (2) eSuccess                                                                           *
+ *  ˵߳̽ṹ߳ջͬһУ߳̽ṹ֮߳ջ                                 *
  *************************************************************************************************/
-TState TclConfigTimer(TTimer* pTimer, TTimeTick ticks, TError* pError)
+TState TclCreateThreadDynamic(TMemSlab* pCache, TThread** pThread2, TThreadEntry pEntry,
+                              TArgument data, TPriority priority, TTimeTick ticks,
+                              TError* pError)
 {
     TState state;
-    KNL_ASSERT((pTimer != (TTimer*)0), "");
+    TError error;
+    void* pObject;
+    TThread* pThread;
+
+    /* ҪĲ */
+    KNL_ASSERT((pCache != (TMemSlab*)0), "");
+    KNL_ASSERT((pCache->ObjSize > SLAB_ALIGN(sizeof(TThread))), "");
+    KNL_ASSERT((pThread2 != (TThread**)0), "");
+    KNL_ASSERT((pEntry != (void*)0), "");
+    KNL_ASSERT((priority <= TCLC_USER_PRIORITY_LOW), "");
+    KNL_ASSERT((priority >= TCLC_USER_PRIORITY_HIGH), "");
     KNL_ASSERT((ticks > 0U), "");
+    KNL_ASSERT((pError != (TError*)0), "");
+
+    state = xSlabMalloc(pCache, &pObject, pError);
+    if (state == eSuccess)
+    {
+        /* пܲһ̵߳ݣ߳̽ṹ */
+        pThread = (TThread*)pObject;
+        memset(pThread, 0U, sizeof(TThread));
+        state = xThreadCreate(pThread,
+                              eThreadDormant,
+                              THREAD_PROP_PRIORITY_SAFE,
+                              THREAD_ACAPI_ALL,
+                              pEntry,
+                              data,
+                              (void*)((TChar*)pObject + SLAB_ALIGN(sizeof(TThread))),
+                              pCache->ObjSize - SLAB_ALIGN(sizeof(TThread)),
+                              priority,
+                              ticks,
+                              pError);
+        if (state == eSuccess)
+        {
+            *pThread2 = pThread;
+        }
+        else
+        {
+            xSlabFree(pCache, pObject, &error);
+        }
+    }
 
-    state = xTimerConfig(pTimer, ticks, pError);
     return state;
 }
-#endif
 
 
-#if ((TCLC_IRQ_ENABLE) && (TCLC_IRQ_DAEMON_ENABLE))
 /*************************************************************************************************
- *  ܣύж                                                                           *
- *  (1) pIRQ      жṹַ                                                         *
- *        (2) priority  жȼ                                                           *
- *        (3) pEntry    жϴص                                                         *
- *        (4) data      жϴص                                                         *
- *  : (1) eFailure  ʧ                                                                 *
- *        (2) eSuccess  ɹ                                                                 *
- *  ˵                                                                                       *
+ *  ܣɾ̬̲߳ͷ̶߳                                                       *
+ *  (1) pCache   ̶߳󻺴                                                              *
+ *        (2) pThread  ߳̽ṹַ                                                              *
+ *        (3) pError   ϸý                                                              *
+ *  أ(1) eFailure                                                                           *
+ *        (2) eSuccess                                                                           *
+ *  ˵̱߳Ѿ״̬̲߳ɾԼҪ̻߳                     *
  *************************************************************************************************/
-TState TclPostIRQ(TIrq* pIRQ, TPriority priority, TIrqEntry pEntry, TArgument data, TError* pError)
+TState TclDeleteThreadDynamic(TMemSlab* pCache, TThread* pThread, TError* pError)
 {
     TState state;
-    KNL_ASSERT((pIRQ != (TIrq*)0), "");
+    TError error;
 
-    state = xIrqPostRequest(pIRQ, priority, pEntry, data, pError);
+    /* ҪĲ */
+    KNL_ASSERT((pCache != (TMemSlab*)0), "");
+    KNL_ASSERT((pThread != (TThread*)0), "");
+    KNL_ASSERT((pError != (TError*)0), "");
+
+    state = xThreadDelete(pThread, pError);
+    if (state == eSuccess)
+    {
+        xSlabFree(pCache, (void*)pThread, &error);
+    }
     return state;
 }
 
 
+#if (TCLC_TIMER_ENABLE)
 /*************************************************************************************************
- *  ܣж                                                                           *
- *  (1) TIrq      жṹַ                                                         *
- *  : (1) eFailure  ʧ                                                                 *
- *        (2) eSuccess  ɹ                                                                 *
- *  ˵                                                                                       *
+ *  ܣӶ󻺴ж̬ûʱ                                                         *
+ *  (1) pCache   ʱ󻺴棬ֽTCLM_TIMER_OBJ_BYTES                      *
+ *        (2) pTimer2  涨ʱַָ                                                  *
+ *        (3) property ʱ                                                                *
+ *        (4) ticks    ʱδĿ                                                            *
+ *        (5) pRoutine ûʱص                                                        *
+ *        (6) data     ûʱص                                                    *
+ *        (7) pError   ϸý                                                              *
+ *  : (1) eSuccess ɹ                                                                  *
+ *        (2) eFailure ʧ                                                                  *
+ *  ˵                                                                                         *
  *************************************************************************************************/
-TState TclCancelIRQ(TIrq* pIRQ, TError* pError)
+TState TclCreateTimerDynamic(TMemSlab* pCache, TTimer** pTimer2, TProperty property,
+                             TTimeTick ticks, TTimerRoutine pRoutine, TArgument data,
+                             TError* pError)
 {
     TState state;
-    KNL_ASSERT((pIRQ != (TIrq*)0), "");
+    TError error;
+    void* pObject;
+
+    KNL_ASSERT((pCache != (TMemSlab*)0), "");
+    KNL_ASSERT((pCache->ObjSize >= sizeof(TTimer)), "");
+    KNL_ASSERT((pTimer2 != (TTimer**)0), "");
+    KNL_ASSERT((pRoutine != (TTimerRoutine)0), "");
+    KNL_ASSERT((pError != (TError*)0), "");
+
+    state = xSlabMalloc(pCache, &pObject, pError);
+    if (state == eSuccess)
+    {
+        memset(pObject, 0U, sizeof(TTimer));
+        state = xTimerCreate((TTimer*)pObject, property, ticks, pRoutine, data, pError);
+        if (state == eSuccess)
+        {
+            *pTimer2 = (TTimer*)pObject;
+        }
+        else
+        {
+            xSlabFree(pCache, pObject, &error);
+        }
+    }
 
-    state = xIrqCancelRequest(pIRQ, pError);
     return state;
 }
-#endif
 
 
-#if ((TCLC_MEMORY_ENABLE) && (TCLC_MEMORY_POOL_ENABLE))
 /*************************************************************************************************
- *  : ʼڴҳ                                                                         *
- *  : (1) pPool      ڴҳؽṹַ                                                        *
- *        (2) pAddr      ڴַ                                                        *
- *        (3) pages      ڴڴҳĿ                                                      *
- *        (4) pgsize     ڴҳС                                                              *
- *        (5) pError     ϸý                                                            *
- *  : (1) eSuccess   ɹ                                                                *
- *        (2) eFailure   ʧ                                                                *
- *  ˵                                                                                       *
+ *  ܣɾ̬ûʱͷŶʱ                                               *
+ *  (1) pCache   ʱ󻺴                                                            *
+ *        (2) pTimer   ʱṹַ                                                            *
+ *        (3) pError   ϸý                                                              *
+ *  : (1) eSuccess ɹ                                                                  *
+ *        (2) eFailure ʧ                                                                  *
+ *  ˵                                                                                         *
  *************************************************************************************************/
-TState TclCreateMemoryPool(TMemPool* pPool, void* pAddr, TBase32 pages, TBase32 pgsize, TError* pError)
+TState TclDeleteTimerDynamic(TMemSlab* pCache, TTimer* pTimer, TError* pError)
 {
     TState state;
-    KNL_ASSERT((pPool != (TMemPool*)0), "");
-    KNL_ASSERT((pAddr != (void*)0), "");
-    KNL_ASSERT((pages != 0U), "");
-    KNL_ASSERT((pgsize > 0U), "");
-    KNL_ASSERT((pages <= TCLC_MEMORY_POOL_PAGES), "");
+    TError error;
+    KNL_ASSERT((pCache != (TMemSlab*)0), "");
+    KNL_ASSERT((pTimer != (TTimer*)0), "");
     KNL_ASSERT((pError != (TError*)0), "");
 
-
-    state = xMemPoolCreate(pPool, pAddr, pages, pgsize, pError);
+    state = xTimerDelete(pTimer, pError);
+    if (state == eSuccess)
+    {
+        xSlabFree(pCache, (void*)pTimer, &error);
+    }
     return state;
 }
+#endif
 
 
+#if ((TCLC_IPC_ENABLE) && (TCLC_IPC_MQUE_ENABLE))
 /*************************************************************************************************
- *  : ڴ                                                                             *
- *  : (1) pPool      ڴؽṹַ                                                          *
- *        (2) pError     ϸý                                                            *
- *  : (1) eSuccess   ɹ                                                                *
- *        (2) eFailure   ʧ                                                                *
- *  ˵                                                                                       *
+ *  ܣӶ󻺴ж̬Ϣ                                                           *
+ *  룺(1) pCache    Ϣж󻺴棬ֽTCLM_MQUE_OBJ_BYTES()              *
+ *        (2) pMsgQue2  Ϣнṹַָ                                           *
+ *        (3) property  Ϣ                                                             *
+ *        (4) pError    ϸý                                                             *
+ *  أ(1) eSuccess  ɹ                                                                 *
+ *        (2) eFailure  ʧ                                                                 *
+ *  ˵ϢнṹϢͬһУϢɶֽ                     *
  *************************************************************************************************/
-TState TclDeleteMemoryPool(TMemPool* pPool, TError* pError)
+TState TclCreateMsgQueueDynamic(TMemSlab* pCache, TMsgQueue** pMsgQue2,
+                                TProperty property, TError* pError)
 {
     TState state;
-    KNL_ASSERT((pPool != (TMemPool*)0), "");
+    TError error;
+    TBase32 capacity;
+    void* pObject;
+
+    KNL_ASSERT((pCache != (TMemSlab*)0), "");
+    KNL_ASSERT((pMsgQue2 != (TMsgQueue**)0), "");
     KNL_ASSERT((pError != (TError*)0), "");
 
-    state = xMemPoolDelete(pPool, pError);
+    KNL_ASSERT((pCache->ObjSize > SLAB_ALIGN(sizeof(TMsgQueue))), "");
+
+    capacity = (pCache->ObjSize - SLAB_ALIGN(sizeof(TMsgQueue))) /
+               (TCLC_IPC_MQUE_LEVELS * sizeof(void*));
+    KNL_ASSERT((capacity != 0U), "");
+
+    state = xSlabMalloc(pCache, &pObject, pError);
+    if (state == eSuccess)
+    {
+        memset(pObject, 0U, sizeof(TMsgQueue));
+        property &= IPC_VALID_MQUE_PROP;
+        state = xMQCreate((TMsgQueue*)pObject,
+                          (void**)((TChar*)pObject + SLAB_ALIGN(sizeof(TMsgQueue))),
+                          capacity, property, pError);
+        if (state == eSuccess)
+        {
+            *pMsgQue2 = (TMsgQueue*)pObject;
+        }
+        else
+        {
+            xSlabFree(pCache, pObject, &error);
+        }
+    }
+
     return state;
 }
 
 
 /*************************************************************************************************
- *  : ڴڴ                                                                 *
- *  : (1) pPool      ڴؽṹַ                                                          *
- *        (2) pObject2   뵽ڴָ                                              *
- *        (3) pError     ϸý                                                            *
- *  : (1) eSuccess   ɹ                                                                *
- *        (2) eFailure   ʧ                                                                *
+ *  ܣɾ̬ϢвͷϢж                                               *
+ *  룺(1) pCache    Ϣж󻺴                                                         *
+ *        (2) pMsgQue   Ϣнṹַ                                                         *
+ *        (3) pError    ϸý                                                             *
+ *  أ(1) eSuccess  ɹ                                                                 *
+ *        (2) eFailure  ʧ                                                                 *
  *  ˵                                                                                       *
  *************************************************************************************************/
-TState TclMallocPoolMemory(TMemPool* pPool, void** pAddr2, TError* pError)
+TState TclDeleteMsgQueueDynamic(TMemSlab* pCache, TMsgQueue* pMsgQue, TError* pError)
 {
     TState state;
-    KNL_ASSERT((pPool != (TMemPool*)0), "");
-    KNL_ASSERT((pAddr2 != (void**)0), "");
+    TError error;
+    KNL_ASSERT((pCache != (TMemSlab*)0), "");
+    KNL_ASSERT((pMsgQue != (TMsgQueue*)0), "");
     KNL_ASSERT((pError != (TError*)0), "");
 
-    state = xPoolMemMalloc(pPool, pAddr2, pError);
+    state = xMQDelete(pMsgQue, pError);
+    if (state == eSuccess)
+    {
+        xSlabFree(pCache, (void*)pMsgQue, &error);
+    }
     return state;
 }
+#endif
+#endif
 
 
+
+#if ((TCLC_MEMORY_ENABLE) && (TCLC_MEMORY_HEAP_ENABLE) && (TCLC_MEMORY_POOL_ENABLE))
 /*************************************************************************************************
- *  : ڴͷڴ                                                                     *
- *  : (1) pPool      ڴؽṹַ                                                          *
- *        (2) pObject    ͷڴĵַ                                                        *
- *        (3) pError     ϸý                                                            *
- *  : (1) eSuccess   ɹ                                                                *
- *        (2) eFailure   ʧ                                                                *
+ *  ܣʼּڴ                                                                       *
+ *  (1) pHeap     ּڴѽṹַ                                                       *
+ *        (2) pAddr     ڴҳعõַ                                             *
+ *        (3) classes   ڴҳؼ                                                             *
+ *        (4) minsize   0ڴҳС2                                             *
+ *        (5) pPages    ڴҳĿ                                                       *
+ *        (6) property  ڴҳ                                                         *
+ *        (7) pError    ϸý                                                             *
+ *  : (1) eSuccess  ɹ                                                                 *
+ *        (2) eFailure  ʧ                                                                 *
  *  ˵                                                                                       *
  *************************************************************************************************/
-TState TclFreePoolMemory(TMemPool* pPool, void* pAddr, TError* pError)
+TState TclCreateMemHeap(TMemHeap* pHeap, void* pAddr, TBase32 classes, TBase32 minsize,
+                        TBase32* pPages, TProperty property, TError* pError)
 {
     TState state;
-    KNL_ASSERT((pPool != (TMemPool*)0), "");
+    TIndex index;
+    KNL_ASSERT((pHeap != (TMemHeap*)0), "");
     KNL_ASSERT((pAddr != (void*)0), "");
+    KNL_ASSERT((classes > 0U), "");
+    KNL_ASSERT((classes <= TCLC_MEMORY_HEAP_CLASSES), "");
+    KNL_ASSERT((minsize >= sizeof(void*)), "");
+    KNL_ASSERT(((minsize & (minsize - 1U)) == 0U), "");
+    /* һҳСminsize << (classes - 1)32λʾ */
+    KNL_ASSERT((minsize <= (0x80000000U >> (classes - 1U))), "");
+    KNL_ASSERT((pPages != (TBase32*)0), "");
     KNL_ASSERT((pError != (TError*)0), "");
+    for (index = 0U; index < classes; index++)
+    {
+        KNL_ASSERT((pPages[index] <= TCLC_MEMORY_POOL_PAGES), "");
+    }
 
-    state = xPoolMemFree(pPool, pAddr, pError);
+    state = xHeapCreate(pHeap, pAddr, classes, minsize, pPages, property, pError);
     return state;
 }
-#endif
 
 
-#if ((TCLC_MEMORY_ENABLE) && (TCLC_MEMORY_BUDDY_ENABLE))
 /*************************************************************************************************
- *  ܣʼڴƽṹ                                                             *
- *  (1) pBuddy    ϵͳڴַ                                                   *
- *        (2) pAddr     ɹڴַ                                                       *
- *        (3) pagesize  ڴҳС                                                               *
- *        (4) pages     ɹڴҳ                                                     *
- *        (5) pError    ϸý                                                             *
+ *  ܣٷּڴ                                                                         *
+ *  (1) pHeap     ּڴѽṹַ                                                       *
+ *        (2) pError    ϸý                                                             *
  *  : (1) eSuccess  ɹ                                                                 *
  *        (2) eFailure  ʧ                                                                 *
  *  ˵                                                                                       *
  *************************************************************************************************/
-TState TclCreateMemBuddy(TMemBuddy* pBuddy, TChar* pAddr, TBase32 pages, TBase32 pagesize, TError* pError)
+TState TclDeleteMemHeap(TMemHeap* pHeap, TError* pError)
 {
     TState state;
-    KNL_ASSERT((pBuddy != (TMemBuddy*)0), "");
-    KNL_ASSERT((pAddr != (TChar*)0), "");
-    KNL_ASSERT((pages > 0U), "");
-    KNL_ASSERT((pages <= TCLC_MEMORY_BUDDY_PAGES), "");
-    KNL_ASSERT((pagesize > 0U), "");
+    KNL_ASSERT((pHeap != (TMemHeap*)0), "");
     KNL_ASSERT((pError != (TError*)0), "");
 
-    state = xBuddyCreate(pBuddy, pAddr, pages, pagesize, pError);
+    state = xHeapDelete(pHeap, pError);
     return state;
 }
 
 
+#if (TCLC_MEMORY_BUDDY_ENABLE)
 /*************************************************************************************************
- *  ܣٻڴƽṹ                                                               *
- *  (1) pBuddy     ϵͳڴַ                                                  *
- *        (2) pError     ϸý                                                            *
- *  : (1) eSuccess   ɹ                                                                *
- *        (2) eFailure   ʧ                                                                *
+ *  ܣ÷ּڴѵĴڴϵͳ                                                       *
+ *  (1) pHeap     ּڴѽṹַ                                                       *
+ *        (2) pBuddy    ϵͳṹַΪ0ʱȡ                                          *
+ *        (3) pError    ϸý                                                             *
+ *  : (1) eSuccess  ɹ                                                                 *
+ *        (2) eFailure  ʧ                                                                 *
  *  ˵                                                                                       *
  *************************************************************************************************/
-TState TclDeleteMemBuddy(TMemBuddy* pBuddy, TError* pError)
+TState TclSetHeapFallback(TMemHeap* pHeap, TMemBuddy* pBuddy, TError* pError)
 {
     TState state;
-    KNL_ASSERT((pBuddy != (TMemBuddy*)0), "");
+    KNL_ASSERT((pHeap != (TMemHeap*)0), "");
     KNL_ASSERT((pError != (TError*)0), "");
 
-    state = xBuddyDelete(pBuddy, pError);
+    state = xHeapSetFallback(pHeap, pBuddy, pError);
     return state;
 }
+#endif
 
 
 /*************************************************************************************************
- *  ܣӻϵͳڴ                                                                   *
- *  (1) pBuddy    ϵͳַ                                                   *
+ *  ܣӷּڴڴ                                                                 *
+ *  (1) pHeap     ּڴѽṹַ                                                       *
  *        (2) len       Ҫڴ泤                                                       *
  *        (3) pAddr2    õڴַָ                                                   *
  *        (4) pError    ϸý                                                             *
@@ -1564,36 +3176,57 @@ TState TclDeleteMemBuddy(TMemBuddy* pBuddy, TError* pError)
  *        (2) eFailure  ʧ                                                                 *
  *  ˵                                                                                       *
  *************************************************************************************************/
-TState TclMallocBuddyMem(TMemBuddy* pBuddy, int len, void** pAddr2, TError* pError)
+TState TclMalloc(TMemHeap* pHeap, TBase32 len, void** pAddr2, TError* pError)
 {
     TState state;
-    KNL_ASSERT((pBuddy != (TMemBuddy*)0), "");
+    KNL_ASSERT((pHeap != (TMemHeap*)0), "");
     KNL_ASSERT((len > 0U), "");
     KNL_ASSERT((pAddr2 != (void**)0), "");
     KNL_ASSERT((pError != (TError*)0), "");
 
-    state = xBuddyMemMalloc(pBuddy, len, pAddr2, pError);
+    state = xHeapMemMalloc(pHeap, len, pAddr2, pError);
     return state;
 }
 
 
 /*************************************************************************************************
- *  ܣϵͳͷڴ                                                                   *
- *  (1) pBuddy    ϵͳַ                                                   *
+ *  ܣּڴͷڴ                                                                 *
+ *  (1) pHeap     ּڴѽṹַ                                                       *
  *        (2) pAddr     ͷŵڴַ                                                         *
  *        (3) pError    ϸý                                                             *
  *  : (1) eSuccess  ɹ                                                                 *
  *        (2) eFailure  ʧ                                                                 *
  *  ˵                                                                                       *
  *************************************************************************************************/
-TState TclFreeBuddyMem(TMemBuddy* pBuddy,  void* pAddr, TError* pError)
+TState TclFree(TMemHeap* pHeap, void* pAddr, TError* pError)
 {
     TState state;
-    KNL_ASSERT((pBuddy != (TMemBuddy*)0), "");
-    KNL_ASSERT((pAddr != (char*)0), "");
+    KNL_ASSERT((pHeap != (TMemHeap*)0), "");
+    KNL_ASSERT((pAddr != (void*)0), "");
     KNL_ASSERT((pError != (TError*)0), "");
 
-    state = xBuddyMemFree(pBuddy, pAddr, pError);
+    state = xHeapMemFree(pHeap, pAddr, pError);
+    return state;
+}
+
+
+/*************************************************************************************************
+ *  ܣ÷ּڴѵͳϢ                                                               *
+ *  (1) pHeap     ּڴѽṹַ                                                       *
+ *        (2) pInfo     ͳϢĽṹַ                                                   *
+ *        (3) pError    ϸý                                                             *
+ *  : (1) eSuccess  ɹ                                                                 *
+ *        (2) eFailure  ʧ                                                                 *
+ *  ˵                                                                                       *
+ *************************************************************************************************/
+TState TclGetHeapInfo(TMemHeap* pHeap, THeapInfo* pInfo, TError* pError)
+{
+    TState state;
+    KNL_ASSERT((pHeap != (TMemHeap*)0), "");
+    KNL_ASSERT((pInfo != (THeapInfo*)0), "");
+    KNL_ASSERT((pError != (TError*)0), "");
+
+    state = xHeapGetInfo(pHeap, pInfo, pError);
     return state;
 }
 #endif